@@ -0,0 +1,228 @@
+#!/usr/bin/python3
+#
+# swad_action_texts.py: generate swad_text_action_DB.c from texts of actions
+#
+##########################################################################
+#
+#   SWAD (Shared Workspace At a Distance,
+#   "Web System for Teaching Support" in English),
+#   is a web platform developed at the University of Granada (Spain),
+#   and used to support university teaching.
+#   Copyright (C) 1999-2021 Antonio Canas-Vargas
+#   University of Granada (SPAIN) (acanas@ugr.es)
+#
+#   This program is free software: you can redistribute it and/or modify
+#   it under the terms of the GNU Affero General Public License as
+#   published by the Free Software Foundation, either version 3 of the
+#   License, or (at your option) any later version.
+#
+#   This program is distributed in the hope that it will be useful,
+#   but WITHOUT ANY WARRANTY; without even the implied warranty of
+#   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#   GNU Affero General Public License for more details.
+#
+#   You should have received a copy of the GNU Affero General Public License
+#   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+##########################################################################
+#
+#   Usage:
+#
+#   swad_action_texts.py [--sql sql/cambios.sql] [--output FILE]
+#       Get the Spanish texts of actions by applying to an empty table
+#       the INSERT, REPLACE, UPDATE and DELETE statements on table
+#       actions found in the SQL file of changes.
+#
+#   swad_action_texts.py --database swad [--user U] [--password P] ...
+#       Get the Spanish texts of actions from table actions
+#       of a database.
+#
+#   The output, by default swad_text_action_DB.c, has an array of texts
+#   indexed by action code. It is used for the actions without text
+#   in swad_text_action.c, so no query is needed to get their names.
+#   Current actions not found in table actions get their English text
+#   from swad_text_action.c.
+#
+##########################################################################
+
+import argparse
+import re
+import subprocess
+import sys
+
+LANGUAGE = "es"
+L_ENGLISH = 3	# Language of texts used when there is no text in LANGUAGE
+
+SQL_STRING = r"""(?:'((?:[^'\\]|\\.|'')*)'|"((?:[^"\\]|\\.|"")*)")"""
+SQL_VALUE  = r"""(?:%s|(-?\d+))""" % SQL_STRING
+
+##########################################################################
+# Get texts from SQL file of changes
+##########################################################################
+
+def unquote (match, first_group):
+   for i, quote in ((first_group, "'"), (first_group + 1, '"')):
+      if match.group (i) is not None:
+         return re.sub (r"\\(.)", r"\1",
+                        match.group (i).replace (quote * 2, quote))
+   return match.group (first_group + 2)	# Number, or None if not present
+
+def get_texts_from_sql (file_name):
+   texts = {}	# ActCod -> text in LANGUAGE
+   with open (file_name, encoding="latin-1") as f:
+      for line in f:
+         line = line.strip ()
+         m = re.match (r"(INSERT|REPLACE) INTO actions\s*\(([^)]*)\)\s*VALUES\s*(.*);$",
+                       line, re.I)
+         if m:
+            columns = [c.strip () for c in m.group (2).split (",")]
+            for values in re.finditer (r"\(\s*(%s(?:\s*,\s*%s)*)\s*\)" %
+                                    (SQL_VALUE, SQL_VALUE), m.group (3)):
+               values = [unquote (v, 1) for v in
+                         re.finditer (SQL_VALUE, values.group (1))]
+               row = dict (zip (columns, values))
+               if row.get ("Language", LANGUAGE) == LANGUAGE:
+                  texts[int (row["ActCod"])] = row["Txt"]
+            continue
+
+         m = re.match (r"UPDATE actions SET Txt=%s\s*WHERE ActCod=%s(?:\s*AND Language=%s)?;$" %
+                       (SQL_STRING, SQL_VALUE, SQL_VALUE), line, re.I)
+         if m:
+            act_cod = int (unquote (m, 3))
+            language = unquote (m, 6) or LANGUAGE
+            if language == LANGUAGE and act_cod in texts:
+               texts[act_cod] = unquote (m, 1)
+            continue
+
+         if re.match (r"DELETE FROM actions;$", line, re.I):
+            texts.clear ()
+            continue
+
+         m = re.match (r"DELETE FROM actions WHERE ActCod=%s;$" % SQL_VALUE,
+                       line, re.I)
+         if m:
+            texts.pop (int (unquote (m, 1)), None)
+   return texts
+
+##########################################################################
+# Get texts from database
+##########################################################################
+
+def get_texts_from_database (args):
+   cmd = ["mysql", "--batch", "--skip-column-names", "--raw",
+          "--default-character-set=latin1", args.database]
+   if args.user:
+      cmd.insert (1, "--user=" + args.user)
+   if args.password:
+      cmd.insert (1, "--password=" + args.password)
+   if args.host:
+      cmd.insert (1, "--host=" + args.host)
+   sql = "SELECT ActCod,Txt FROM actions WHERE Language='%s';" % LANGUAGE
+   result = subprocess.run (cmd, input=sql.encode ("latin-1"),
+                            stdout=subprocess.PIPE, check=True)
+   texts = {}
+   for line in result.stdout.decode ("latin-1").splitlines ():
+      act_cod, txt = line.split ("\t", 1)
+      texts[int (act_cod)] = txt
+   return texts
+
+##########################################################################
+# Get texts of current actions from swad_action.c and swad_text_action.c
+##########################################################################
+
+def get_english_texts ():
+   # Code of each action, e.g. "   [ActSeeSysInf	] = {1818, ..."
+   with open ("swad_action.c", encoding="latin-1") as f:
+      act_cods = {m.group (1): int (m.group (2)) for m in
+                  re.finditer (r"^   \[(Act\w+)\s*\] = \{\s*(-?\d+)",
+                               f.read (), re.M)}
+
+   # Text of each action in English, as C string literal
+   texts = {}	# ActCod -> C string literal
+   with open ("swad_text_action.c", encoding="latin-1") as f:
+      for m in re.finditer (r"^\t\[(Act\w+)\] =\n(.*?)^#endif",
+                            f.read (), re.M | re.S):
+         txt = re.search (r"L==%d[^\n]*\n\t(\"(?:[^\"\\]|\\.)*\")" % L_ENGLISH,
+                          m.group (2))
+         act_cod = act_cods.get (m.group (1), -1)
+         if txt and txt.group (1) != '""' and act_cod >= 0:
+            texts[act_cod] = txt.group (1)
+   return texts
+
+##########################################################################
+# Write C source
+##########################################################################
+
+def c_string (txt):
+   return '"%s"' % txt.replace ("\\", "\\\\").replace ('"', '\\"')
+
+def write_source (out, texts, english_texts, source):
+   with open ("swad_text_action.c", encoding="latin-1") as f:
+      license = f.read ()
+   license = license[license.index ("/*\n"):license.index ("*/\n") + 3]
+
+   out.write ("// swad_text_action_DB.c: texts of actions formerly got from database\n\n")
+   out.write (license)
+   out.write ("""/*****************************************************************************/
+/*********************************** Headers *********************************/
+/*****************************************************************************/
+
+#include <stddef.h>		// For NULL
+
+#include "swad_action.h"
+
+/*****************************************************************************/
+/******************************* Public constants ****************************/
+/*****************************************************************************/
+
+// Generated by py/swad_action_texts.py from %s. Do not edit.
+// Texts in Spanish of actions (in English if not found), indexed by action code,
+// used when an action has no text in Txt_Actions
+
+const char *Txt_Actions_DB[1 + Act_MAX_ACTION_COD] =
+	{
+""" % source)
+   literals = {act_cod: c_string (txt) for act_cod, txt in texts.items ()}
+   for act_cod, literal in english_texts.items ():
+      literals.setdefault (act_cod, literal)
+   for act_cod in sorted (literals):
+      if 0 <= act_cod <= ACT_MAX_ACTION_COD:
+         out.write ("\t[%4d] = %s,\n" % (act_cod, literals[act_cod]))
+   out.write ("\t};\n")
+
+def get_max_action_cod ():
+   with open ("swad_action.h", encoding="latin-1") as f:
+      m = re.search (r"#define Act_MAX_ACTION_COD\s+(\d+)", f.read ())
+   return int (m.group (1))
+
+##########################################################################
+# Main
+##########################################################################
+
+def main ():
+   global ACT_MAX_ACTION_COD
+
+   parser = argparse.ArgumentParser (description=__doc__)
+   parser.add_argument ("--sql", default="sql/cambios.sql",
+                        help="SQL file with changes in table actions")
+   parser.add_argument ("--database",
+                        help="get texts from this database instead of SQL file")
+   parser.add_argument ("--host")
+   parser.add_argument ("--user")
+   parser.add_argument ("--password")
+   parser.add_argument ("--output", default="swad_text_action_DB.c")
+   args = parser.parse_args ()
+
+   ACT_MAX_ACTION_COD = get_max_action_cod ()
+   if args.database:
+      texts, source = get_texts_from_database (args), "database"
+   else:
+      texts, source = get_texts_from_sql (args.sql), args.sql
+   if not texts:
+      sys.exit ("No texts of actions found.")
+
+   with open (args.output, "w", encoding="latin-1", newline="\n") as out:
+      write_source (out, texts, get_english_texts (), source)
+
+if __name__ == "__main__":
+   main ()
@@ -0,0 +1,677 @@
+#!/usr/bin/python3
+#
+# swad_bench.py: seed a database and benchmark SWAD CGI binaries
+#
+##########################################################################
+#
+#   SWAD (Shared Workspace At a Distance,
+#   "Web System for Teaching Support" in English),
+#   is a web platform developed at the University of Granada (Spain),
+#   and used to support university teaching.
+#   Copyright (C) 1999-2021 Antonio Canas-Vargas
+#   University of Granada (SPAIN) (acanas@ugr.es)
+#
+#   This program is free software: you can redistribute it and/or modify
+#   it under the terms of the GNU Affero General Public License as
+#   published by the Free Software Foundation, either version 3 of the
+#   License, or (at your option) any later version.
+#
+#   This program is distributed in the hope that it will be useful,
+#   but WITHOUT ANY WARRANTY; without even the implied warranty of
+#   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#   GNU Affero General Public License for more details.
+#
+#   You should have received a copy of the GNU Affero General Public License
+#   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+##########################################################################
+#
+#   Usage:
+#
+#   swad_bench.py seed --database DB --yes-drop-all [--scale N]
+#       Drop all tables in database DB, create them again from
+#       sql/swad.sql and fill them with synthetic institutions,
+#       courses, users, log, forums, messages and a match being
+#       played in each course. Use it only with
+#       a database dedicated to benchmarks: DB can not be "swad",
+#       and nothing is dropped without --yes-drop-all.
+#
+#   swad_bench.py run --database DB --cgi ./swad_en [--requests N]
+#                     [--baseline FILE] [--save-baseline FILE]
+#       Execute the CGI directly, as a web server would do, for a mix
+#       of actions, and report latency percentiles, number of queries
+#       (from table db_act_stats, filled only if swad was built with
+#       make DB_QUERY_STATS=true) and peak resident memory per action.
+#       If a baseline is given, exit with status 1 if any action is
+#       slower or makes more queries than in baseline.
+#
+#   swad_bench.py startup [--runs N] [--lock] CGI...
+#       Execute each CGI binary (for example ./swad_es, or the old
+#       binaries installed in /usr/lib/cgi-bin/swad) with an empty
+#       request and report startup time, peak resident memory and
+#       page faults, together with the size of binary and catalog.
+#       With --lock, a swad.lock file makes the CGI exit just after
+#       starting, so only the cost of loading the program is measured.
+#
+#   swad_bench.py markdown --tool ./swad_markdown_bench [--database DB]
+#                          [--pages N] [--runs N] [FILE...]
+#       Convert Markdown course pages to HTML with pandoc, as SWAD did
+#       before, and with the converter built into SWAD, and report time
+#       per page and speedup. Pages are read from the given files or,
+#       if no file is given, the N longest ones are got from database.
+#
+#   The CGI uses the database name compiled in swad_config.h
+#   (build it with make DB_NAME=DB to use database DB)
+#   and reads swad.cfg from its working directory.
+#
+##########################################################################
+
+import argparse
+import base64
+import hashlib
+import json
+import os
+import random
+import shlex
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+# Codes of actions (see swad_action.c)
+ACT_LOG_IN      =    6
+ACT_SEE_FOR     =   95
+ACT_SEE_RCV_MSG =    3
+ACT_SEE_CRS_INF =  847
+ACT_SEE_DOC_CRS = 1078
+ACT_SEE_GBL_TL  = 1490
+ACT_SEE_USE_GBL =   84
+ACT_REF_MCH_STD = 1782
+
+# Action mix: (name, action code, weight, needs session)
+ACTION_MIX = [
+   ("login",          ACT_LOG_IN,      1, False),
+   ("course_home",    ACT_SEE_CRS_INF, 4, True ),
+   ("file_browser",   ACT_SEE_DOC_CRS, 3, True ),
+   ("forums",         ACT_SEE_FOR,     3, True ),
+   ("messages",       ACT_SEE_RCV_MSG, 2, True ),
+   ("timeline",       ACT_SEE_GBL_TL,  4, True ),
+   ("statistics",     ACT_SEE_USE_GBL, 1, True ),
+   ("match_refresh",  ACT_REF_MCH_STD, 6, True ),
+]
+
+BENCH_PASSWORD = "bench-password"
+
+# Database of a real installation, never seeded
+PRODUCTION_DATABASE = "swad"
+
+# Scale 1: numbers of rows created in each table
+SCALE_INS_PER_CTY  = 2
+SCALE_CTR_PER_INS  = 2
+SCALE_DEG_PER_CTR  = 2
+SCALE_CRS_PER_DEG  = 5
+SCALE_USRS         = 500
+SCALE_CRSS_PER_USR = 4
+SCALE_LOG_PER_USR  = 100
+SCALE_THREADS      = 200
+SCALE_POSTS_PER_THR= 10
+SCALE_MSGS_PER_USR = 20
+
+ROWS_PER_INSERT = 500
+
+##########################################################################
+# Database access through the command-line client
+##########################################################################
+
+def mysql (args, sql):
+   cmd = ["mysql", "--batch", "--skip-column-names",
+          "--default-character-set=latin1", args.database]
+   if args.user:
+      cmd.insert (1, "--user=" + args.user)
+   if args.password:
+      cmd.insert (1, "--password=" + args.password)
+   if args.host:
+      cmd.insert (1, "--host=" + args.host)
+   result = subprocess.run (cmd, input=sql.encode ("latin-1"),
+                            stdout=subprocess.PIPE, check=True)
+   return result.stdout.decode ("latin-1")
+
+def insert_rows (out, table, columns, rows):
+   for i in range (0, len (rows), ROWS_PER_INSERT):
+      out.append ("INSERT INTO %s (%s) VALUES %s;" %
+                  (table, ",".join (columns),
+                   ",".join ("(" + ",".join (str (v) for v in row) + ")"
+                             for row in rows[i:i + ROWS_PER_INSERT])))
+
+def q (s):
+   return "'" + s.replace ("\\", "\\\\").replace ("'", "\\'") + "'"
+
+def encrypt_sha512_base64 (plain):
+   # Same as Cry_EncryptSHA512Base64
+   digest = hashlib.sha512 (plain.encode ("latin-1")).digest ()
+   return base64.urlsafe_b64encode (digest).decode ().rstrip ("=")
+
+def encrypt_sha256_base64 (plain):
+   # Same as Cry_EncryptSHA256Base64
+   digest = hashlib.sha256 (plain.encode ("latin-1")).digest ()
+   return base64.urlsafe_b64encode (digest).decode ().rstrip ("=")
+
+def session_id (usr_cod):
+   return encrypt_sha256_base64 ("bench-session-%d" % usr_cod)
+
+##########################################################################
+# Seed database with synthetic data
+##########################################################################
+
+def seed (args):
+   # All tables are dropped, so be sure database is not a real one
+   if not args.database:
+      sys.exit ("A database dedicated to benchmarks is required.")
+   if args.database == PRODUCTION_DATABASE:
+      sys.exit ("Database \"%s\" is used by real installations"
+                " and will not be seeded." % args.database)
+   if not args.yes_drop_all:
+      sys.exit ("All tables in database \"%s\" would be dropped."
+                " Add --yes-drop-all to do it." % args.database)
+
+   rnd = random.Random (args.seed)
+   scale = args.scale
+   sql_dir = os.path.join (os.path.dirname (os.path.abspath (__file__)),
+                           os.pardir, "sql")
+
+   # Drop and create tables
+   tables = mysql (args, "SHOW TABLES;").split ()
+   if tables:
+      mysql (args, "".join ("DROP TABLE %s;" % t for t in tables))
+   with open (os.path.join (sql_dir, "swad.sql"), encoding="latin-1") as f:
+      mysql (args, f.read ())
+
+   out = []
+
+   # Hierarchy
+   out.append ("INSERT INTO countries (CtyCod,Alpha2,MapAttribution,"
+               + ",".join ("Name_%s,WWW_%s" % (l, l) for l in
+                           ("ca","de","en","es","fr","gn","it","pl","pt"))
+               + ") VALUES (724,'ES',''"
+               + ",'Spain',''" * 9 + ");")
+   out.append ("INSERT INTO deg_types (DegTypCod,DegTypName)"
+               " VALUES (1,'Grado');")
+   ins, ctrs, degs, crss = [], [], [], []
+   for i in range (SCALE_INS_PER_CTY * scale):
+      ins_cod = len (ins) + 1
+      ins.append ((ins_cod, 724, 0, -1, q ("INS%d" % ins_cod),
+                   q ("Institution %d" % ins_cod), "''"))
+      for c in range (SCALE_CTR_PER_INS):
+         ctr_cod = len (ctrs) + 1
+         ctrs.append ((ctr_cod, ins_cod, q ("CTR%d" % ctr_cod),
+                       q ("Centre %d" % ctr_cod), "''", "''"))
+         for d in range (SCALE_DEG_PER_CTR):
+            deg_cod = len (degs) + 1
+            degs.append ((deg_cod, ctr_cod, 1, q ("DEG%d" % deg_cod),
+                          q ("Degree %d" % deg_cod), "''"))
+            for k in range (SCALE_CRS_PER_DEG):
+               crs_cod = len (crss) + 1
+               crss.append ((crs_cod, deg_cod, k % 4 + 1,
+                             q ("C%06d" % crs_cod), q ("CRS%d" % crs_cod),
+                             q ("Course %d" % crs_cod)))
+   insert_rows (out, "institutions",
+                ("InsCod","CtyCod","Status","RequesterUsrCod",
+                 "ShortName","FullName","WWW"), ins)
+   insert_rows (out, "centres",
+                ("CtrCod","InsCod","ShortName","FullName","WWW",
+                 "PhotoAttribution"), ctrs)
+   insert_rows (out, "degrees",
+                ("DegCod","CtrCod","DegTypCod","ShortName","FullName","WWW"),
+                degs)
+   insert_rows (out, "courses",
+                ("CrsCod","DegCod","Year","InsCrsCod","ShortName","FullName"),
+                crss)
+
+   # Users, their nicknames and their courses
+   password = q (encrypt_sha512_base64 (BENCH_PASSWORD))
+   usrs, nicks, crs_usr, sessions = [], [], [], []
+   num_usrs = SCALE_USRS * scale
+   for usr_cod in range (1, num_usrs + 1):
+      usrs.append ((usr_cod, q (encrypt_sha256_base64 ("bench-%d" % usr_cod)),
+                    password, q ("Surname%d" % usr_cod), "''",
+                    q ("Name%d" % usr_cod), "''"))
+      nicks.append ((usr_cod, q ("bench%d" % usr_cod), "NOW()"))
+      my_crss = rnd.sample (range (1, len (crss) + 1),
+                            min (SCALE_CRSS_PER_USR, len (crss)))
+      for n, crs_cod in enumerate (my_crss):
+         role = 5 if usr_cod % 20 == 0 and n == 0 else 3	# Teacher / student
+         crs_usr.append ((crs_cod, usr_cod, role, "'Y'"))
+      sessions.append ((q (session_id (usr_cod)), usr_cod, password, 3,
+                        724, -1, -1, -1, my_crss[0], "NOW()", "NOW()"))
+   insert_rows (out, "usr_data",
+                ("UsrCod","EncryptedUsrCod","Password","Surname1","Surname2",
+                 "FirstName","Comments"), usrs)
+   insert_rows (out, "usr_nicknames", ("UsrCod","Nickname","CreatTime"),
+                nicks)
+   insert_rows (out, "crs_usr", ("CrsCod","UsrCod","Role","Accepted"),
+                crs_usr)
+   insert_rows (out, "sessions",
+                ("SessionId","UsrCod","Password","Role","CtyCod","InsCod",
+                 "CtrCod","DegCod","CrsCod","LastTime","LastRefresh"),
+                sessions)
+
+   # Log
+   log = []
+   now = int (time.time ())
+   for usr_cod in range (1, num_usrs + 1):
+      for n in range (SCALE_LOG_PER_USR):
+         log_cod = len (log) + 1
+         act = rnd.choice (ACTION_MIX)[1]
+         log.append ((log_cod, act, 724, usr_cod, 3,
+                      "FROM_UNIXTIME(%d)" % (now - rnd.randrange (86400 * 14)),
+                      rnd.randrange (100000), rnd.randrange (10000),
+                      "'127.0.0.1'"))
+   columns = ("LogCod","ActCod","CtyCod","UsrCod","Role","ClickTime",
+              "TimeToGenerate","TimeToSend","IP")
+   insert_rows (out, "log", columns, log)
+   insert_rows (out, "log_recent", columns, log)
+
+   # Forums (forum of users in each institution)
+   threads, posts = [], []
+   for thr_cod in range (1, SCALE_THREADS * scale + 1):
+      first = len (posts) + 1
+      for n in range (SCALE_POSTS_PER_THR):
+         pst_cod = len (posts) + 1
+         posts.append ((pst_cod, thr_cod, rnd.randrange (1, num_usrs + 1),
+                        "NOW()", "NOW()", q ("Subject %d" % pst_cod),
+                        q ("Content of post %d " % pst_cod * 10)))
+      num_writers = len (set (post[2] for post in posts[first - 1:]))
+      threads.append ((thr_cod, 6, rnd.randrange (1, len (ins) + 1),
+                       first, len (posts), SCALE_POSTS_PER_THR,
+                       num_writers))
+   insert_rows (out, "forum_thread",
+                ("ThrCod","ForumType","Location","FirstPstCod","LastPstCod",
+                 "NumPsts","NumWriters"), threads)
+   insert_rows (out, "forum_post",
+                ("PstCod","ThrCod","UsrCod","CreatTime","ModifTime",
+                 "Subject","Content"), posts)
+
+   # Messages
+   content, snt, rcv = [], [], []
+   for usr_cod in range (1, num_usrs + 1):
+      for n in range (SCALE_MSGS_PER_USR):
+         msg_cod = len (content) + 1
+         content.append ((msg_cod, q ("Message %d" % msg_cod),
+                          q ("Content of message %d " % msg_cod * 5)))
+         snt.append ((msg_cod, -1, usr_cod, "NOW()"))
+         rcv.append ((msg_cod, rnd.randrange (1, num_usrs + 1)))
+   insert_rows (out, "msg_content", ("MsgCod","Subject","Content"), content)
+   insert_rows (out, "msg_snt", ("MsgCod","CrsCod","UsrCod","CreatTime"), snt)
+   out.append ("INSERT IGNORE INTO msg_rcv (MsgCod,UsrCod) VALUES %s;" %
+               ",".join ("(%d,%d)" % r for r in rcv))
+
+   # A match being played in each course, showing the answers
+   # of a unique choice question. Codes of question, game and match
+   # are the code of the course, so match of session course is known
+   teachers = {}
+   for crs_cod, usr_cod, role, accepted in crs_usr:
+      if role == 5:
+         teachers.setdefault (crs_cod, usr_cod)
+   qsts, answers, games, game_qsts, matches, indexes, playing = \
+      [], [], [], [], [], [], []
+   for crs in crss:
+      cod = crs[0]
+      usr_cod = teachers.get (cod, 1)
+      qsts.append ((cod, cod, "NOW()", "'unique_choice'", "'N'",
+                    q ("Question of course %d" % cod), "''"))
+      for ans_ind in range (4):
+         answers.append ((cod, ans_ind, q ("Answer %d" % ans_ind), "''",
+                          "'Y'" if ans_ind == 0 else "'N'"))
+      games.append ((cod, cod, usr_cod, q ("Game %d" % cod), "''"))
+      game_qsts.append ((cod, 1, cod))
+      matches.append ((cod, cod, usr_cod, "NOW()", "NOW()",
+                       q ("Match %d" % cod), 1, cod, "'answers'"))
+      indexes.append ((cod, 1, "'0,1,2,3'"))
+      playing.append ((cod, "NOW()"))
+   insert_rows (out, "tst_questions",
+                ("QstCod","CrsCod","EditTime","AnsType","Shuffle",
+                 "Stem","Feedback"), qsts)
+   insert_rows (out, "tst_answers",
+                ("QstCod","AnsInd","Answer","Feedback","Correct"), answers)
+   insert_rows (out, "gam_games", ("GamCod","CrsCod","UsrCod","Title","Txt"),
+                games)
+   insert_rows (out, "gam_questions", ("GamCod","QstInd","QstCod"),
+                game_qsts)
+   insert_rows (out, "mch_matches",
+                ("MchCod","GamCod","UsrCod","StartTime","EndTime","Title",
+                 "QstInd","QstCod","Showing"), matches)
+   insert_rows (out, "mch_indexes", ("MchCod","QstInd","Indexes"), indexes)
+   insert_rows (out, "mch_playing", ("MchCod","TS"), playing)
+
+   mysql (args, "\n".join (out))
+   print ("Seeded %d courses, %d users, %d log rows, %d posts, %d messages,"
+          " %d matches" %
+          (len (crss), num_usrs, len (log), len (posts), len (content),
+           len (matches)))
+
+##########################################################################
+# Run CGI as a web server would do
+##########################################################################
+
+def run_cgi (cgi, env, body):
+   proc = subprocess.Popen ([os.path.abspath (cgi)],
+                            cwd=os.path.dirname (os.path.abspath (cgi)),
+                            env=env, stdin=subprocess.PIPE,
+                            stdout=subprocess.PIPE, stderr=subprocess.DEVNULL)
+   start = time.perf_counter ()
+   proc.stdin.write (body)
+   proc.stdin.close ()
+   proc.stdout.read ()
+   _, status, rusage = os.wait4 (proc.pid, 0)
+   elapsed = time.perf_counter () - start
+   proc.returncode = status
+   return elapsed, rusage.ru_maxrss, rusage.ru_minflt + rusage.ru_majflt	# Seconds, KiB, page faults
+
+def make_request (rnd, action, num_usrs, players, num_request):
+   name, act_cod, weight, needs_session = action
+   if act_cod == ACT_REF_MCH_STD:
+      # A student playing the match of the course in session
+      usr_cod, mch_cod = rnd.choice (players)
+   else:
+      usr_cod = rnd.randrange (1, num_usrs + 1)
+   params = [("act", str (act_cod))]
+   if needs_session:
+      params.append (("ses", session_id (usr_cod)))
+   if act_cod == ACT_LOG_IN:
+      params += [("UsrId", "@bench%d" % usr_cod), ("UsrPwd", BENCH_PASSWORD)]
+   if act_cod == ACT_REF_MCH_STD:
+      params.append (("MchCod", str (mch_cod)))
+   body = "&".join ("%s=%s" % p for p in params).encode ()
+   env = {
+      "PATH": os.environ.get ("PATH", "/usr/bin:/bin"),
+      "GATEWAY_INTERFACE": "CGI/1.1",
+      "SERVER_NAME": "localhost",
+      "SERVER_PORT": "443",
+      "HTTPS": "on",
+      "SCRIPT_NAME": "/swad/",
+      "REQUEST_METHOD": "POST",
+      "QUERY_STRING": "",
+      "CONTENT_TYPE": "application/x-www-form-urlencoded",
+      "CONTENT_LENGTH": str (len (body)),
+      # Different IPs to avoid being banned by firewall
+      "REMOTE_ADDR": "10.%d.%d.%d" % ((num_request >> 16) & 255,
+                                      (num_request >> 8) & 255,
+                                      num_request & 255),
+      "HTTP_USER_AGENT": "swad_bench",
+   }
+   return env, body
+
+def get_query_stats (args):
+   stats = {}
+   try:
+      for line in mysql (args, "SELECT ActCod,NumRequests,NumQueries"
+                               " FROM db_act_stats;").splitlines ():
+         act_cod, num_requests, num_queries = (int (v) for v in line.split ())
+         stats[act_cod] = (num_requests, num_queries)
+   except subprocess.CalledProcessError:
+      pass	# Table does not exist
+   return stats
+
+def percentile (values, p):
+   values = sorted (values)
+   k = (len (values) - 1) * p / 100.0
+   i = int (k)
+   j = min (i + 1, len (values) - 1)
+   return values[i] + (values[j] - values[i]) * (k - i)
+
+def run (args):
+   rnd = random.Random (args.seed)
+   num_usrs = int (mysql (args, "SELECT COUNT(*) FROM usr_data;").strip ())
+   if not num_usrs:
+      sys.exit ("Database is empty. Run 'swad_bench.py seed' first.")
+
+   # Sessions must not expire during benchmark,
+   # and matches are being played as if refreshed by teachers
+   mysql (args, "UPDATE sessions SET LastTime=NOW(),LastRefresh=NOW();"
+                "UPDATE mch_playing SET TS=NOW();")
+
+   # Students in the course of their sessions, and match of that course
+   players = [tuple (int (v) for v in line.split ()) for line in
+              mysql (args, "SELECT sessions.UsrCod,sessions.CrsCod"
+                           " FROM sessions,crs_usr"
+                           " WHERE sessions.CrsCod=crs_usr.CrsCod"
+                           " AND sessions.UsrCod=crs_usr.UsrCod"
+                           " AND crs_usr.Role=3;").splitlines ()]
+   if not players:
+      sys.exit ("No students in database. Run 'swad_bench.py seed' again.")
+
+   weighted = [a for a in ACTION_MIX for _ in range (a[2])]
+   times = {a[0]: [] for a in ACTION_MIX}
+   rss = {a[0]: 0 for a in ACTION_MIX}
+   stats_before = get_query_stats (args)
+
+   for num_request in range (args.requests):
+      action = rnd.choice (weighted)
+      env, body = make_request (rnd, action, num_usrs, players, num_request)
+      elapsed, maxrss, _ = run_cgi (args.cgi, env, body)
+      times[action[0]].append (elapsed)
+      rss[action[0]] = max (rss[action[0]], maxrss)
+
+   stats_after = get_query_stats (args)
+
+   # Report
+   results = {}
+   print ("%-14s %6s %9s %9s %9s %9s %9s" %
+          ("action", "n", "p50 ms", "p90 ms", "p99 ms", "queries", "RSS KiB"))
+   for name, act_cod, weight, needs_session in ACTION_MIX:
+      if not times[name]:
+         continue
+      req0, qry0 = stats_before.get (act_cod, (0, 0))
+      req1, qry1 = stats_after.get (act_cod, (0, 0))
+      queries = (qry1 - qry0) / (req1 - req0) if req1 > req0 else None
+      results[name] = {
+         "n":        len (times[name]),
+         "p50_ms":   percentile (times[name], 50) * 1000,
+         "p90_ms":   percentile (times[name], 90) * 1000,
+         "p99_ms":   percentile (times[name], 99) * 1000,
+         "queries":  queries,
+         "rss_kib":  rss[name],
+      }
+      r = results[name]
+      print ("%-14s %6d %9.1f %9.1f %9.1f %9s %9d" %
+             (name, r["n"], r["p50_ms"], r["p90_ms"], r["p99_ms"],
+              "-" if queries is None else "%.1f" % queries, r["rss_kib"]))
+
+   if args.save_baseline:
+      with open (args.save_baseline, "w") as f:
+         json.dump (results, f, indent=3, sort_keys=True)
+
+   # Compare with baseline
+   if args.baseline:
+      with open (args.baseline) as f:
+         baseline = json.load (f)
+      regressions = []
+      for name, r in results.items ():
+         b = baseline.get (name)
+         if not b:
+            continue
+         if r["p50_ms"] > b["p50_ms"] * (1 + args.tolerance / 100.0):
+            regressions.append ("%s: p50 %.1f ms > baseline %.1f ms" %
+                                (name, r["p50_ms"], b["p50_ms"]))
+         if r["queries"] is not None and b["queries"] is not None and \
+            r["queries"] > b["queries"] + 0.5:
+            regressions.append ("%s: %.1f queries > baseline %.1f" %
+                                (name, r["queries"], b["queries"]))
+      for regression in regressions:
+         print ("REGRESSION " + regression)
+      if regressions:
+         sys.exit (1)
+
+##########################################################################
+# Benchmark startup of CGI binaries
+##########################################################################
+
+def startup (args):
+   env = {
+      "PATH": os.environ.get ("PATH", "/usr/bin:/bin"),
+      "GATEWAY_INTERFACE": "CGI/1.1",
+      "SERVER_NAME": "localhost",
+      "SERVER_PORT": "443",
+      "HTTPS": "on",
+      "SCRIPT_NAME": "/swad/",
+      "REQUEST_METHOD": "GET",
+      "QUERY_STRING": "",
+      "REMOTE_ADDR": "10.0.0.1",
+      "HTTP_USER_AGENT": "swad_bench",
+   }
+   print ("%-30s %10s %10s %9s %9s %9s %9s" %
+          ("CGI", "binary KiB", "catalog KiB",
+           "p50 ms", "p90 ms", "RSS KiB", "faults"))
+   for cgi in args.cgis:
+      path = os.path.realpath (cgi)
+      name = os.path.basename (cgi)
+      catalog = os.path.join (os.path.dirname (os.path.abspath (cgi)),
+                              name + ".cat")
+      lock_dir = None
+      if args.lock:
+         # Run a link to CGI in a directory with swad.lock
+         lock_dir = tempfile.mkdtemp (prefix="swad_bench_")
+         open (os.path.join (lock_dir, "swad.lock"), "w").close ()
+         os.symlink (path, os.path.join (lock_dir, name))
+         cgi = os.path.join (lock_dir, name)
+
+      times, maxrss, faults = [], 0, []
+      for _ in range (args.runs):
+         elapsed, rss, num_faults = run_cgi (cgi, env, b"")
+         times.append (elapsed)
+         maxrss = max (maxrss, rss)
+         faults.append (num_faults)
+
+      if lock_dir:
+         shutil.rmtree (lock_dir)
+
+      print ("%-30s %10d %10s %9.2f %9.2f %9d %9d" %
+             (name, os.path.getsize (path) // 1024,
+              "%d" % (os.path.getsize (catalog) // 1024)
+              if os.path.exists (catalog) else "-",
+              percentile (times, 50) * 1000, percentile (times, 90) * 1000,
+              maxrss, percentile (faults, 50)))
+
+##########################################################################
+# Benchmark conversion from Markdown to HTML
+##########################################################################
+
+PANDOC_PIPELINE = ("iconv -f WINDOWS-1252 -t UTF-8 %s"
+                   " | pandoc --ascii --mathjax"
+                   " -f markdown_github+tex_math_dollars -t html5"
+                   " | iconv -f UTF-8 -t WINDOWS-1252 -o /dev/null")
+
+def markdown (args):
+   if not shutil.which ("pandoc"):
+      sys.exit ("pandoc not found")
+   tmp_dir = None
+   files = args.files
+   if not files:
+      # Longest pages of courses in database
+      if not args.database:
+         sys.exit ("--database is required if no file is given")
+      tmp_dir = tempfile.mkdtemp (prefix="swad_bench_")
+      rows = mysql (args, "SELECT HEX(InfoTxtMD) FROM crs_info_txt"
+                          " WHERE InfoTxtMD<>''"
+                          " ORDER BY LENGTH(InfoTxtMD) DESC LIMIT %d;" %
+                          args.pages).split ()
+      for i, row in enumerate (rows):
+         files.append (os.path.join (tmp_dir, "page%d.md" % i))
+         with open (files[-1], "wb") as f:
+            f.write (bytes.fromhex (row))
+      if not files:
+         sys.exit ("No Markdown pages in database")
+
+   # Time of the converter built into SWAD, in microseconds per page
+   result = subprocess.run ([args.tool, "-n", str (args.runs)] + files,
+                            stdout=subprocess.PIPE, check=True)
+   tool_us = {}
+   for line in result.stdout.decode ("latin-1").splitlines ():
+      name, size, us = line.split ("\t")
+      tool_us[name] = (int (size), float (us))
+
+   print ("%-40s %9s %11s %11s %9s" %
+          ("page", "bytes", "pandoc ms", "swad us", "speedup"))
+   total_pandoc = total_tool = 0.0
+   for name in files:
+      times = []
+      for _ in range (args.pandoc_runs):
+         start = time.perf_counter ()
+         subprocess.run (PANDOC_PIPELINE % shlex.quote (name), shell=True, check=True)
+         times.append (time.perf_counter () - start)
+      pandoc_us = percentile (times, 50) * 1E6
+      size, us = tool_us[name]
+      total_pandoc += pandoc_us
+      total_tool += us
+      print ("%-40s %9d %11.2f %11.1f %8.0fx" %
+             (os.path.basename (name), size, pandoc_us / 1000, us,
+              pandoc_us / us if us else 0))
+   print ("%-40s %9s %11.2f %11.1f %8.0fx" %
+          ("total", "", total_pandoc / 1000, total_tool,
+           total_pandoc / total_tool if total_tool else 0))
+
+   if tmp_dir:
+      shutil.rmtree (tmp_dir)
+
+##########################################################################
+# Main
+##########################################################################
+
+def add_database_arguments (p, required):
+   # There is no default database, to avoid using a real one by mistake
+   p.add_argument ("--database", required=required)
+   p.add_argument ("--host")
+   p.add_argument ("--user")
+   p.add_argument ("--password")
+
+def main ():
+   parser = argparse.ArgumentParser (description=__doc__)
+   parser.add_argument ("--seed", type=int, default=1,
+                        help="seed for random numbers")
+   sub = parser.add_subparsers (dest="command", required=True)
+
+   p = sub.add_parser ("seed")
+   add_database_arguments (p, True)
+   p.add_argument ("--scale", type=int, default=1)
+   p.add_argument ("--yes-drop-all", action="store_true",
+                   help="confirm that all tables in database are dropped")
+   p.set_defaults (func=seed)
+
+   p = sub.add_parser ("run")
+   add_database_arguments (p, True)
+   p.add_argument ("--cgi", required=True, help="CGI binary, e.g. ./swad_en")
+   p.add_argument ("--requests", type=int, default=1000)
+   p.add_argument ("--baseline", help="compare with this baseline file")
+   p.add_argument ("--save-baseline", help="save results in this file")
+   p.add_argument ("--tolerance", type=float, default=10.0,
+                   help="allowed increase of p50 latency, in percent")
+   p.set_defaults (func=run)
+
+   p = sub.add_parser ("startup")
+   p.add_argument ("cgis", nargs="+", metavar="CGI",
+                   help="CGI binaries, e.g. ./swad_es")
+   p.add_argument ("--runs", type=int, default=100)
+   p.add_argument ("--lock", action="store_true",
+                   help="exit just after starting (swad.lock)")
+   p.set_defaults (func=startup)
+
+   p = sub.add_parser ("markdown")
+   add_database_arguments (p, False)
+   p.add_argument ("files", nargs="*", metavar="FILE",
+                   help="Markdown files; if none, pages from database")
+   p.add_argument ("--tool", required=True,
+                   help="converter, e.g. ./swad_markdown_bench")
+   p.add_argument ("--pages", type=int, default=20,
+                   help="number of pages got from database")
+   p.add_argument ("--runs", type=int, default=100,
+                   help="conversions of each page with the converter")
+   p.add_argument ("--pandoc-runs", type=int, default=5,
+                   help="conversions of each page with pandoc")
+   p.set_defaults (func=markdown)
+
+   args = parser.parse_args ()
+   args.func (args)
+
+if __name__ == "__main__":
+   main ()
@@ -170,6 +170,34 @@ struct swad__getNotificationsOutput
    struct swad__notificationsArray notificationsArray;
   };
 
+/* getNotificationsPage */
+struct swad__notificationBrief
+  {
+   int notifCode;
+   char *eventType;
+   int eventCode;
+   long eventTime;
+   int userCode;
+   char *userNickname;
+   char *userSurname1;
+   char *userSurname2;
+   char *userFirstname;
+   char *location;
+   int status;
+   char *summary;
+  };
+struct swad__notificationsBriefArray
+  {
+   struct swad__notificationBrief *__ptr;	// pointer to array
+   int __size; 					// number of elements pointed to
+  };
+struct swad__getNotificationsPageOutput
+  {
+   int numNotifications;			// number of notifications in this page
+   char *nextCursor;				// empty string ==> no more pages
+   struct swad__notificationsBriefArray notificationsArray;
+  };
+
 /* markNotificationsAsRead */
 struct swad__markNotificationsAsReadOutput
   {
@@ -340,6 +368,27 @@ struct swad__getUsersOutput
    struct swad__usersArray usersArray;
   };
 
+/* getUsersPage and findUsersPage */
+struct swad__userBrief
+  {
+   int userCode;
+   char *userNickname;
+   char *userSurname1;
+   char *userSurname2;
+   char *userFirstname;
+  };
+struct swad__usersBriefArray
+  {
+   struct swad__userBrief *__ptr;	// pointer to array
+   int __size; 				// number of elements pointed to
+  };
+struct swad__getUsersPageOutput
+  {
+   int numUsers;			// number of users in this page; < 0 ==> filter too short
+   char *nextCursor;			// empty string ==> no more pages
+   struct swad__usersBriefArray usersArray;
+  };
+
 /* getAttendanceEvents */
 struct swad__attendanceEvent
   {
@@ -516,6 +565,8 @@ int swad__sendMyGroups (char *wsKey,int courseCode,char *myGroups,
 /* File browsers */
 int swad__getDirectoryTree (char *wsKey,int courseCode,int groupCode,int treeCode,
                             struct swad__getDirectoryTreeOutput *getDirectoryTreeOut);
+int swad__getDirectoryTreeLevel (char *wsKey,int courseCode,int groupCode,int treeCode,char *path,int maxDepth,
+                                 struct swad__getDirectoryTreeOutput *getDirectoryTreeOut);
 int swad__getFile (char *wsKey,int fileCode,
                    struct swad__getFileOutput *getFileOut);
 int swad__getMarks (char *wsKey,int fileCode,
@@ -544,6 +595,10 @@ int swad__getUsers (char *wsKey,int courseCode,char *groups,int userRole,
                     struct swad__getUsersOutput *getUsersOut);
 int swad__findUsers (char *wsKey,int courseCode,char *filter,int userRole,
                      struct swad__getUsersOutput *getUsersOut);
+int swad__getUsersPage (char *wsKey,int courseCode,char *groups,int userRole,char *cursor,int maxUsers,
+                        struct swad__getUsersPageOutput *getUsersPageOut);
+int swad__findUsersPage (char *wsKey,int courseCode,char *filter,int userRole,char *cursor,int maxUsers,
+                         struct swad__getUsersPageOutput *getUsersPageOut);
 
 /* Control of attendance */
 int swad__getAttendanceEvents (char *wsKey,int courseCode,
@@ -560,6 +615,8 @@ int swad__sendAttendanceUsers (char *wsKey,int attendanceEventCode,char *users,i
 /* Notifications */
 int swad__getNotifications (char *wsKey,long beginTime,
                             struct swad__getNotificationsOutput *getNotificationsOut);
+int swad__getNotificationsPage (char *wsKey,long beginTime,char *cursor,int maxNotifications,
+                                struct swad__getNotificationsPageOutput *getNotificationsPageOut);
 int swad__markNotificationsAsRead (char *wsKey,char *notifications,
                                    struct swad__markNotificationsAsReadOutput *markNotificationAsReadOut);
 
@@ -19,6 +19,7 @@ CREATE TABLE IF NOT EXISTS IP_prefs (
 --
 -- Table actions: stores the text that describes each of the actions.
 -- Each action has a numeric code associated to it that persists over time.
+-- Not read by the program: texts are in swad_text_action_DB.c, generated by py/swad_action_texts.py.
 --
 CREATE TABLE IF NOT EXISTS actions (
 	ActCod INT NOT NULL DEFAULT -1,
@@ -35,6 +36,7 @@ CREATE TABLE IF NOT EXISTS actions_MFU (
 	ActCod INT NOT NULL,
 	Score FLOAT NOT NULL,
 	LastClick DATETIME NOT NULL,
+	Epoch INT NOT NULL DEFAULT 0,
 	UNIQUE INDEX(UsrCod,ActCod));
 --
 -- Table ann_seen: stores users who have seen global announcements
@@ -271,7 +273,6 @@ CREATE TABLE IF NOT EXISTS courses (
 	RequesterUsrCod INT NOT NULL DEFAULT -1,
 	ShortName VARCHAR(511) COLLATE latin1_spanish_ci NOT NULL,
 	FullName VARCHAR(2047) COLLATE latin1_spanish_ci NOT NULL,
-	NumIndicators INT NOT NULL DEFAULT -1,
 	UNIQUE INDEX(CrsCod),
 	INDEX(DegCod,Year),
 	INDEX(Status));
@@ -312,6 +313,27 @@ CREATE TABLE IF NOT EXISTS crs_grp_usr (
 	INDEX(GrpCod),
 	INDEX(UsrCod));
 --
+-- Table crs_indicators: stores the counters and indicators of each course
+--
+CREATE TABLE IF NOT EXISTS crs_indicators (
+	CrsCod INT NOT NULL,
+	Indicators TINYINT NOT NULL DEFAULT 0,
+	NumIndicators TINYINT NOT NULL DEFAULT 0,
+	NumFilesDocum INT NOT NULL DEFAULT 0,
+	NumFilesShare INT NOT NULL DEFAULT 0,
+	NumFilesAssig INT NOT NULL DEFAULT 0,
+	NumFilesWorks INT NOT NULL DEFAULT 0,
+	SyllabusLecSrc TINYINT NOT NULL DEFAULT 0,
+	SyllabusPraSrc TINYINT NOT NULL DEFAULT 0,
+	TeachingGuideSrc TINYINT NOT NULL DEFAULT 0,
+	AssessmentSrc TINYINT NOT NULL DEFAULT 0,
+	NumAssignments INT NOT NULL DEFAULT 0,
+	NumThreads INT NOT NULL DEFAULT 0,
+	NumPosts INT NOT NULL DEFAULT 0,
+	NumMsgsSentByTchs INT NOT NULL DEFAULT 0,
+	UNIQUE INDEX(CrsCod),
+	INDEX(NumIndicators));
+--
 -- Table crs_info_read: stores the users who have read the information with mandatory reading
 --
 CREATE TABLE IF NOT EXISTS crs_info_read (
@@ -365,6 +387,17 @@ CREATE TABLE IF NOT EXISTS crs_records (
 	Txt TEXT NOT NULL,
 	UNIQUE INDEX(FieldCod,UsrCod));
 --
+-- Table crs_rss: stores changes and last modification of RSS files of courses
+--
+CREATE TABLE IF NOT EXISTS crs_rss (
+	CrsCod INT NOT NULL,
+	Changed ENUM('N','Y') NOT NULL DEFAULT 'N',
+	BuildTime DATETIME NOT NULL,
+	ETag CHAR(43) NOT NULL DEFAULT '',
+	ModifTime DATETIME NOT NULL,
+	UNIQUE INDEX(CrsCod),
+	INDEX(Changed,BuildTime));
+--
 -- Table crs_usr: stores who users belong to what courses
 --
 CREATE TABLE IF NOT EXISTS crs_usr (
@@ -416,6 +449,38 @@ CREATE TABLE IF NOT EXISTS debug (
 	Txt TEXT NOT NULL,
 	INDEX(DebugTime));
 --
+-- Table db_act_stats: stores number of queries, rows and time in database per action
+--
+CREATE TABLE IF NOT EXISTS db_act_stats (
+	ActCod INT NOT NULL,
+	NumRequests BIGINT NOT NULL DEFAULT 0,
+	NumQueries BIGINT NOT NULL DEFAULT 0,
+	NumRows BIGINT NOT NULL DEFAULT 0,
+	Time BIGINT NOT NULL DEFAULT 0,
+	UNIQUE INDEX(ActCod));
+--
+-- Table db_query_stats: stores number of queries, rows and time in database per action and call site
+--
+CREATE TABLE IF NOT EXISTS db_query_stats (
+	ActCod INT NOT NULL,
+	CallSite VARCHAR(255) NOT NULL,
+	NumCalls BIGINT NOT NULL DEFAULT 0,
+	NumRows BIGINT NOT NULL DEFAULT 0,
+	Time BIGINT NOT NULL DEFAULT 0,
+	UNIQUE INDEX(ActCod,CallSite));
+--
+-- Table db_slow_queries: stores queries to database slower than a threshold
+--
+CREATE TABLE IF NOT EXISTS db_slow_queries (
+	ActCod INT NOT NULL,
+	CallSite VARCHAR(255) NOT NULL,
+	ClickTime DATETIME NOT NULL,
+	NumRows BIGINT NOT NULL DEFAULT 0,
+	Time BIGINT NOT NULL DEFAULT 0,
+	Query LONGTEXT NOT NULL,
+	INDEX(ActCod),
+	INDEX(ClickTime));
+--
 -- Table deg_types: stores the types of degree
 --
 CREATE TABLE IF NOT EXISTS deg_types (
@@ -754,6 +819,8 @@ CREATE TABLE IF NOT EXISTS forum_thread (
 	Location INT NOT NULL DEFAULT -1,
 	FirstPstCod INT NOT NULL,
 	LastPstCod INT NOT NULL,
+	NumPsts INT NOT NULL DEFAULT 0,
+	NumWriters INT NOT NULL DEFAULT 0,
 	UNIQUE INDEX(ThrCod),
 	INDEX(ForumType),
 	INDEX(Location),
@@ -782,7 +849,8 @@ CREATE TABLE IF NOT EXISTS mch_answers (
 	QstInd INT NOT NULL,
 	NumOpt TINYINT NOT NULL,
 	AnsInd TINYINT NOT NULL,
-	UNIQUE INDEX(MchCod,UsrCod,QstInd));
+	UNIQUE INDEX(MchCod,UsrCod,QstInd),
+	INDEX(MchCod,QstInd,AnsInd));
 --
 -- Table mch_groups: stores the groups associated to each match in a game
 --
@@ -1056,8 +1124,21 @@ CREATE TABLE IF NOT EXISTS marks_properties (
 	FilCod INT NOT NULL AUTO_INCREMENT,
 	Header INT NOT NULL,
 	Footer INT NOT NULL,
+	FileSize INT NOT NULL DEFAULT -1,
+	FileTime INT NOT NULL DEFAULT 0,
+	HeadEnd INT NOT NULL DEFAULT 0,
+	FootStart INT NOT NULL DEFAULT 0,
 	UNIQUE INDEX(FilCod));
 --
+-- Table marks_rows: stores the byte range of the row of each user's ID in files of marks
+--
+CREATE TABLE IF NOT EXISTS marks_rows (
+	FilCod INT NOT NULL,
+	UsrID CHAR(16) NOT NULL,
+	RowStart INT NOT NULL,
+	RowEnd INT NOT NULL,
+	UNIQUE INDEX(FilCod,UsrID));
+--
 -- Table media: stores information about media (images, videos, YouTube)
 --
 CREATE TABLE IF NOT EXISTS media (
@@ -1382,6 +1463,7 @@ CREATE TABLE IF NOT EXISTS surveys (
 	EndTime DATETIME NOT NULL,
 	Title VARCHAR(2047) NOT NULL,
 	Txt TEXT NOT NULL,
+	NumUsrs INT NOT NULL DEFAULT 0,
 	UNIQUE INDEX(SvyCod),
 	INDEX(Scope,Cod));
 --
@@ -1714,6 +1796,17 @@ CREATE TABLE IF NOT EXISTS usr_follow (
 	UNIQUE INDEX (FollowedCod,FollowerCod),
 	INDEX (FollowTime));
 --
+-- Table usr_hits: stores the number of hits of each user per year, course, role and action
+--
+CREATE TABLE IF NOT EXISTS usr_hits (
+	UsrCod INT NOT NULL,
+	Year SMALLINT NOT NULL,
+	CrsCod INT NOT NULL,
+	Role TINYINT NOT NULL,
+	ActCod INT NOT NULL,
+	NumHits INT NOT NULL DEFAULT 0,
+	UNIQUE INDEX(UsrCod,Year,CrsCod,Role,ActCod));
+--
 -- Table usr_IDs: stores the users' IDs
 --
 CREATE TABLE IF NOT EXISTS usr_IDs (
@@ -1736,6 +1829,7 @@ CREATE TABLE IF NOT EXISTS usr_last (
 	LastTime DATETIME NOT NULL,
 	LastAccNotif DATETIME NOT NULL,
 	TimelineUsrs TINYINT NOT NULL DEFAULT 0,
+	MFUEpoch INT NOT NULL DEFAULT 0,
 	UNIQUE INDEX(UsrCod),
 	INDEX(LastTime));
 --
@@ -1748,6 +1842,18 @@ CREATE TABLE IF NOT EXISTS usr_nicknames (
 	UNIQUE INDEX(UsrCod,Nickname),
 	UNIQUE INDEX(Nickname));
 --
+-- Table usr_ranks: stores the positions of users in the rankings of figures shown in public profile
+--
+CREATE TABLE IF NOT EXISTS usr_ranks (
+	UsrCod INT NOT NULL,
+	RankClicks INT NOT NULL DEFAULT 0,
+	RankClicksPerDay INT NOT NULL DEFAULT 0,
+	RankFileViews INT NOT NULL DEFAULT 0,
+	RankSocPub INT NOT NULL DEFAULT 0,
+	RankForPst INT NOT NULL DEFAULT 0,
+	RankMsgSnt INT NOT NULL DEFAULT 0,
+	PRIMARY KEY(UsrCod));
+--
 -- Table usr_report: stores users' usage reports
 --
 CREATE TABLE IF NOT EXISTS usr_report (
@@ -114,6 +114,7 @@ cp -f /home/acanas/swad/swad/swad /var/www/cgi-bin/
 #include "swad_notice.h"
 #include "swad_notification.h"
 #include "swad_password.h"
+#include "swad_random.h"
 #include "swad_role.h"
 #include "swad_search.h"
 #include "swad_test_config.h"
@@ -171,6 +172,10 @@ static const char *API_Functions[1 + API_NUM_FUNCTIONS] =
    [API_sendMyLocation		] = "sendMyLocation",		// 33
    [API_getLastLocation		] = "getLastLocation",		// 34
    [API_getAvailableRoles	] = "getAvailableRoles",	// 35
+   [API_getUsersPage		] = "getUsersPage",		// 36
+   [API_findUsersPage		] = "findUsersPage",		// 37
+   [API_getNotificationsPage	] = "getNotificationsPage",	// 38
+   [API_getDirectoryTreeLevel	] = "getDirectoryTreeLevel",	// 39
   };
 
 /* Web service roles (they do not match internal swad-core roles) */
@@ -203,6 +208,12 @@ static const API_Role_t API_RolRole_to_SvcRole[Rol_NUM_ROLES] =
 
 #define API_BYTES_WS_KEY Cry_BYTES_ENCRYPTED_STR_SHA256_BASE64
 
+/* Pages returned by paginated web service functions */
+#define API_DEF_USERS_PER_PAGE		100
+#define API_MAX_USERS_PER_PAGE		500
+#define API_DEF_NOTIFICATIONS_PER_PAGE	 20
+#define API_MAX_NOTIFICATIONS_PER_PAGE	100
+
 /*****************************************************************************/
 /***************************** Private prototypes ****************************/
 /*****************************************************************************/
@@ -246,6 +257,16 @@ static void API_CopyUsrData (struct soap *soap,
 			     struct swad__user *Usr,struct UsrData *UsrDat,
 			     bool UsrIDIsVisible);
 
+static unsigned API_GetPageSize (int RequestedSize,
+                                 unsigned DefaultSize,unsigned MaxSize);
+static char *API_BuildNextCursor (struct soap *soap,
+                                  bool ThereAreMore,long LastCod);
+static void API_BuildSubQueryGrpsSel (char **SubQuery);
+static void API_CopyPageOfUsers (struct soap *soap,
+                                 MYSQL_RES *mysql_res,
+                                 unsigned NumRows,unsigned MaxUsrs,
+			         struct swad__getUsersPageOutput *getUsersPageOut);
+
 static void API_GetListGrpsInAttendanceEventFromDB (struct soap *soap,
 						    long AttCod,char **ListGroups);
 static void API_GetLstGrpsSel (const char *Groups);
@@ -271,7 +292,14 @@ static int API_GetTstQuestionTags (struct soap *soap,
 static void API_GetListGrpsInGameFromDB (struct soap *soap,
 					 long MchCod,char **ListGroups);
 
-static void API_ListDir (unsigned Level,const char *Path,const char *PathInTree);
+static int API_GetDirectoryTree (struct soap *soap,
+                                 char *wsKey,int courseCode,int groupCode,int treeCode,
+                                 const char *SubPath,unsigned MaxLevel,
+                                 struct swad__getDirectoryTreeOutput *getDirectoryTreeOut);
+static bool API_CheckIfSubPathIsVisible (const char *SubPath);
+static void API_ListDir (unsigned Level,unsigned MaxLevel,
+                         const char *Path,const char *PathInTree);
+static bool API_CheckIfDirIsEmpty (const char *Path);
 static bool API_WriteRowFileBrowser (unsigned Level,Brw_FileType_t FileType,const char *FileName);
 static void API_IndentXMLLine (unsigned Level);
 
@@ -1976,6 +2004,396 @@ int swad__findUsers (struct soap *soap,
    return SOAP_OK;
   }
 
+/*****************************************************************************/
+/********** Get a page of users in a course (and optionally in groups) *******/
+/*****************************************************************************/
+// Users are ordered by code and only codes and names are returned.
+// cursor is empty for the first page, or nextCursor returned by previous page
+
+int swad__getUsersPage (struct soap *soap,
+                        char *wsKey,int courseCode,char *groups,int userRole,	// input
+                        char *cursor,int maxUsers,				// input
+                        struct swad__getUsersPageOutput *getUsersPageOut)	// output
+  {
+   int ReturnCode;
+   Rol_Role_t Role;
+   long LastUsrCod;
+   unsigned MaxUsrs;
+   char *SubQueryGrps;
+   MYSQL_RES *mysql_res;
+   unsigned NumRows;
+
+   /***** Initializations *****/
+   API_Set_gSOAP_RuntimeEnv (soap);
+   Gbl.WebService.Function = API_getUsersPage;
+   Gbl.Hierarchy.Crs.CrsCod = (courseCode > 0) ? (long) courseCode :
+	                                          -1L;
+
+   /***** Check web service key *****/
+   if ((ReturnCode = API_CheckWSKey (wsKey)) != SOAP_OK)
+      return ReturnCode;
+   if (Gbl.Usrs.Me.UsrDat.UsrCod < 0)	// Web service key does not exist in database
+      return soap_receiver_fault (soap,
+	                          "Bad web service key",
+	                          "Web service key does not exist in database");
+
+   /***** Check course *****/
+   if ((ReturnCode = API_CheckCourseAndGroupCodes (soap,
+						   Gbl.Hierarchy.Crs.CrsCod,
+						   -1L)) != SOAP_OK)
+      return ReturnCode;
+
+   /***** Get some of my data *****/
+   if (!API_GetSomeUsrDataFromUsrCod (&Gbl.Usrs.Me.UsrDat,Gbl.Hierarchy.Crs.CrsCod))
+      return soap_receiver_fault (soap,
+	                          "Can not get user's data from database",
+	                          "User does not exist in database");
+   Gbl.Usrs.Me.Logged = true;
+   Gbl.Usrs.Me.Role.Logged = Gbl.Usrs.Me.UsrDat.Roles.InCurrentCrs.Role;
+
+   /***** Check if I am a student, non-editing teacher or teacher in the course *****/
+   if (Gbl.Usrs.Me.UsrDat.Roles.InCurrentCrs.Role != Rol_STD &&
+       Gbl.Usrs.Me.UsrDat.Roles.InCurrentCrs.Role != Rol_NET &&
+       Gbl.Usrs.Me.UsrDat.Roles.InCurrentCrs.Role != Rol_TCH)
+      return soap_receiver_fault (soap,
+				  "Request forbidden",
+				  "Requester must belong to course");
+
+   /***** Check requested users' role *****/
+   if (userRole != API_ROLE_STUDENT &&	// Students
+       userRole != API_ROLE_TEACHER)	// Teachers
+      return soap_sender_fault (soap,
+	                        "Bad requested users' type",
+	                        "User roles allowed are 2 (students) or 3 (teachers)");
+   Role = API_SvcRole_to_RolRole[userRole];
+
+   /***** Get page parameters *****/
+   LastUsrCod = Str_ConvertStrCodToLongCod (cursor);	// -1 ==> first page
+   MaxUsrs = API_GetPageSize (maxUsers,
+                              API_DEF_USERS_PER_PAGE,API_MAX_USERS_PER_PAGE);
+
+   /***** Create a list of groups selected *****/
+   API_GetLstGrpsSel (groups);
+   API_BuildSubQueryGrpsSel (&SubQueryGrps);
+
+   /***** Get one page of users (one more to know if there are more pages) *****/
+   NumRows = (unsigned)
+   DB_QuerySELECT (&mysql_res,"can not get page of users",
+		   "SELECT usr_data.UsrCod,"	// row[0]
+			  "usr_data.Surname1,"	// row[1]
+			  "usr_data.Surname2,"	// row[2]
+			  "usr_data.FirstName,"	// row[3]
+			  "(SELECT Nickname FROM usr_nicknames"
+			  " WHERE usr_nicknames.UsrCod=usr_data.UsrCod"
+			  " ORDER BY CreatTime DESC LIMIT 1)"	// row[4]
+		   " FROM crs_usr,usr_data"
+		   " WHERE crs_usr.CrsCod=%ld"
+		   " AND crs_usr.Role=%u"
+		   " AND crs_usr.UsrCod>%ld"
+		   "%s"
+		   " AND crs_usr.UsrCod=usr_data.UsrCod"
+		   " ORDER BY crs_usr.UsrCod"
+		   " LIMIT %u",
+		   Gbl.Hierarchy.Crs.CrsCod,
+		   (unsigned) Role,
+		   LastUsrCod,
+		   SubQueryGrps,
+		   MaxUsrs + 1);
+   free (SubQueryGrps);
+
+   /***** Copy page of users into output structure *****/
+   API_CopyPageOfUsers (soap,mysql_res,NumRows,MaxUsrs,getUsersPageOut);
+
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+
+   /***** Free memory for list of selected groups *****/
+   if (Gbl.Crs.Grps.LstGrpsSel.NumGrps)
+      Grp_FreeListCodSelectedGrps ();
+
+   return SOAP_OK;
+  }
+
+/*****************************************************************************/
+/************************ Find a page of users by name ***********************/
+/*****************************************************************************/
+// Users are ordered by code and only codes and names are returned.
+// cursor is empty for the first page, or nextCursor returned by previous page
+
+int swad__findUsersPage (struct soap *soap,
+                         char *wsKey,int courseCode,char *filter,int userRole,	// input
+                         char *cursor,int maxUsers,				// input
+                         struct swad__getUsersPageOutput *getUsersPageOut)	// output
+  {
+   int ReturnCode;
+   char SearchQuery[Sch_MAX_BYTES_SEARCH_QUERY + 1];
+   Rol_Role_t Role;
+   long LastUsrCod;
+   unsigned MaxUsrs;
+   char SubQueryRole[128];
+   MYSQL_RES *mysql_res;
+   unsigned NumRows;
+
+   /***** Initializations *****/
+   API_Set_gSOAP_RuntimeEnv (soap);
+   Gbl.WebService.Function = API_findUsersPage;
+   Gbl.Hierarchy.Crs.CrsCod = (courseCode > 0) ? (long) courseCode :
+	                                          -1L;
+
+   /***** Check web service key *****/
+   if ((ReturnCode = API_CheckWSKey (wsKey)) != SOAP_OK)
+      return ReturnCode;
+   if (Gbl.Usrs.Me.UsrDat.UsrCod < 0)	// Web service key does not exist in database
+      return soap_receiver_fault (soap,
+	                          "Bad web service key",
+	                          "Web service key does not exist in database");
+
+   if (Gbl.Hierarchy.Level == Hie_Lvl_CRS)	// Course selected
+      /***** Check course *****/
+      if ((ReturnCode = API_CheckCourseAndGroupCodes (soap,
+						      Gbl.Hierarchy.Crs.CrsCod,
+						      -1L)) != SOAP_OK)
+	 return ReturnCode;
+
+   /***** Get some of my data *****/
+   if (!API_GetSomeUsrDataFromUsrCod (&Gbl.Usrs.Me.UsrDat,Gbl.Hierarchy.Crs.CrsCod))
+      return soap_receiver_fault (soap,
+	                          "Can not get user's data from database",
+	                          "User does not exist in database");
+   Gbl.Usrs.Me.Logged = true;
+   Gbl.Usrs.Me.Role.Logged = Gbl.Usrs.Me.UsrDat.Roles.InCurrentCrs.Role;
+
+   if (Gbl.Hierarchy.Level == Hie_Lvl_CRS)	// Course selected
+      /***** Check if I am a student, non-editing teacher or teacher in the course *****/
+      if (Gbl.Usrs.Me.UsrDat.Roles.InCurrentCrs.Role != Rol_STD &&
+          Gbl.Usrs.Me.UsrDat.Roles.InCurrentCrs.Role != Rol_NET &&
+	  Gbl.Usrs.Me.UsrDat.Roles.InCurrentCrs.Role != Rol_TCH)
+	 return soap_receiver_fault (soap,
+				     "Request forbidden",
+				     "Requester must belong to course");
+
+   /***** Check requested users' role *****/
+   if (userRole < API_ROLE_UNKNOWN ||
+       userRole > API_ROLE_TEACHER)
+      return soap_sender_fault (soap,
+	                        "Bad requested users' type",
+	                        "User roles allowed are 0 (all), 1 (guests), 2 (students) or 3 (teachers)");
+   Role = API_SvcRole_to_RolRole[userRole];
+
+   /***** Get page parameters *****/
+   LastUsrCod = Str_ConvertStrCodToLongCod (cursor);	// -1 ==> first page
+   MaxUsrs = API_GetPageSize (maxUsers,
+                              API_DEF_USERS_PER_PAGE,API_MAX_USERS_PER_PAGE);
+
+   /***** Build search query *****/
+   Str_Copy (Gbl.Search.Str,filter,sizeof (Gbl.Search.Str) - 1);
+   if (!Gbl.Search.Str[0] ||
+       !Sch_BuildSearchQuery (SearchQuery,
+			      "CONCAT_WS(' ',FirstName,Surname1,Surname2)",
+			      NULL,NULL))
+     {
+      /***** Return error in filter *****/
+      getUsersPageOut->numUsers = -1;	// < 0 ==> filter too short
+      getUsersPageOut->nextCursor = API_BuildNextCursor (soap,false,-1L);
+      getUsersPageOut->usersArray.__size = 0;
+      getUsersPageOut->usersArray.__ptr = NULL;
+      return SOAP_OK;
+     }
+
+   /***** Build subquery to filter candidate users by role *****/
+   switch (Role)
+     {
+      case Rol_GST:	// Guests (scope is not used)
+	 Str_Copy (SubQueryRole," AND candidate_users.UsrCod NOT IN"
+				" (SELECT UsrCod FROM crs_usr)",
+		   sizeof (SubQueryRole) - 1);
+	 break;
+      case Rol_STD:	// Student
+      case Rol_TCH:	// Teacher
+	 if (Gbl.Hierarchy.Level == Hie_Lvl_CRS)
+	    snprintf (SubQueryRole,sizeof (SubQueryRole),
+		      " AND candidate_users.UsrCod IN"
+		      " (SELECT UsrCod FROM crs_usr"
+		      " WHERE CrsCod=%ld AND Role=%u)",
+		      Gbl.Hierarchy.Crs.CrsCod,(unsigned) Role);
+	 else
+	    snprintf (SubQueryRole,sizeof (SubQueryRole),
+		      " AND candidate_users.UsrCod IN"
+		      " (SELECT UsrCod FROM crs_usr WHERE Role=%u)",
+		      (unsigned) Role);
+	 break;
+      default:		// Any role
+	 if (Gbl.Hierarchy.Level == Hie_Lvl_CRS)
+	    snprintf (SubQueryRole,sizeof (SubQueryRole),
+		      " AND candidate_users.UsrCod IN"
+		      " (SELECT UsrCod FROM crs_usr WHERE CrsCod=%ld)",
+		      Gbl.Hierarchy.Crs.CrsCod);
+	 else
+	    SubQueryRole[0] = '\0';
+	 break;
+     }
+
+   /***** Create temporary table with candidate users *****/
+   // Search is faster (aproximately x2) using temporary tables
+   Usr_CreateTmpTableAndSearchCandidateUsrs (SearchQuery);
+
+   /***** Get one page of users (one more to know if there are more pages) *****/
+   NumRows = (unsigned)
+   DB_QuerySELECT (&mysql_res,"can not get page of users",
+		   "SELECT usr_data.UsrCod,"	// row[0]
+			  "usr_data.Surname1,"	// row[1]
+			  "usr_data.Surname2,"	// row[2]
+			  "usr_data.FirstName,"	// row[3]
+			  "(SELECT Nickname FROM usr_nicknames"
+			  " WHERE usr_nicknames.UsrCod=usr_data.UsrCod"
+			  " ORDER BY CreatTime DESC LIMIT 1)"	// row[4]
+		   " FROM candidate_users,usr_data"
+		   " WHERE candidate_users.UsrCod>%ld"
+		   "%s"
+		   " AND candidate_users.UsrCod=usr_data.UsrCod"
+		   " ORDER BY candidate_users.UsrCod"
+		   " LIMIT %u",
+		   LastUsrCod,
+		   SubQueryRole,
+		   MaxUsrs + 1);
+
+   /***** Copy page of users into output structure *****/
+   API_CopyPageOfUsers (soap,mysql_res,NumRows,MaxUsrs,getUsersPageOut);
+
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+
+   /***** Drop temporary table with candidate users *****/
+   Usr_DropTmpTableWithCandidateUsrs ();
+
+   return SOAP_OK;
+  }
+
+/*****************************************************************************/
+/**************** Get number of items in a page of results *******************/
+/*****************************************************************************/
+
+static unsigned API_GetPageSize (int RequestedSize,
+                                 unsigned DefaultSize,unsigned MaxSize)
+  {
+   if (RequestedSize <= 0)
+      return DefaultSize;
+   if ((unsigned) RequestedSize > MaxSize)
+      return MaxSize;
+   return (unsigned) RequestedSize;
+  }
+
+/*****************************************************************************/
+/****************** Build cursor to get the next page ************************/
+/*****************************************************************************/
+// Return an empty string if there are no more pages
+
+static char *API_BuildNextCursor (struct soap *soap,
+                                  bool ThereAreMore,long LastCod)
+  {
+   char *Cursor;
+
+   Cursor = soap_malloc (soap,Cns_MAX_DECIMAL_DIGITS_LONG + 1);
+   if (ThereAreMore)
+      snprintf (Cursor,Cns_MAX_DECIMAL_DIGITS_LONG + 1,"%ld",LastCod);
+   else
+      Cursor[0] = '\0';
+
+   return Cursor;
+  }
+
+/*****************************************************************************/
+/*********** Build subquery to get only users in selected groups *************/
+/*****************************************************************************/
+// Subquery must be freed by caller
+
+static void API_BuildSubQueryGrpsSel (char **SubQuery)
+  {
+   size_t MaxLength;
+   unsigned NumGrpSel;
+   char LongStr[1 + Cns_MAX_DECIMAL_DIGITS_LONG + 1];
+
+   /***** Allocate space for subquery *****/
+   MaxLength = 128 + Gbl.Crs.Grps.LstGrpsSel.NumGrps * (1 + Cns_MAX_DECIMAL_DIGITS_LONG);
+   if ((*SubQuery = malloc (MaxLength + 1)) == NULL)
+      Lay_NotEnoughMemoryExit ();
+   (*SubQuery)[0] = '\0';
+
+   /***** Users in any of the selected groups *****/
+   if (Gbl.Crs.Grps.LstGrpsSel.NumGrps)
+     {
+      Str_Concat (*SubQuery," AND crs_usr.UsrCod IN"
+			    " (SELECT DISTINCT UsrCod FROM crs_grp_usr"
+			    " WHERE GrpCod IN (",
+		  MaxLength);
+      for (NumGrpSel = 0;
+	   NumGrpSel < Gbl.Crs.Grps.LstGrpsSel.NumGrps;
+	   NumGrpSel++)
+	{
+	 snprintf (LongStr,sizeof (LongStr),NumGrpSel ? ",%ld" :
+							"%ld",
+		   Gbl.Crs.Grps.LstGrpsSel.GrpCods[NumGrpSel]);
+	 Str_Concat (*SubQuery,LongStr,MaxLength);
+	}
+      Str_Concat (*SubQuery,"))",MaxLength);
+     }
+  }
+
+/*****************************************************************************/
+/********************** Copy a page of users from query **********************/
+/*****************************************************************************/
+
+static void API_CopyPageOfUsers (struct soap *soap,
+                                 MYSQL_RES *mysql_res,
+                                 unsigned NumRows,unsigned MaxUsrs,
+			         struct swad__getUsersPageOutput *getUsersPageOut)
+  {
+   unsigned NumUsrs;
+   unsigned NumUsr;
+   MYSQL_ROW row;
+   struct swad__userBrief *Usr;
+   long UsrCod = -1L;
+
+   /***** The row beyond page size is used only to know if there are more *****/
+   NumUsrs = (NumRows > MaxUsrs) ? MaxUsrs :
+				   NumRows;
+
+   /***** Initialize result *****/
+   getUsersPageOut->numUsers = (int) NumUsrs;
+   getUsersPageOut->usersArray.__size = (int) NumUsrs;
+   getUsersPageOut->usersArray.__ptr = NULL;
+
+   if (NumUsrs)
+     {
+      getUsersPageOut->usersArray.__ptr = soap_malloc (soap,
+						       NumUsrs *
+						       sizeof (*(getUsersPageOut->usersArray.__ptr)));
+
+      /***** Copy users *****/
+      for (NumUsr = 0;
+	   NumUsr < NumUsrs;
+	   NumUsr++)
+	{
+	 row = mysql_fetch_row (mysql_res);
+	 Usr = &(getUsersPageOut->usersArray.__ptr[NumUsr]);
+
+	 /* Get user's code (row[0]) */
+	 UsrCod = Str_ConvertStrCodToLongCod (row[0]);
+	 Usr->userCode = (int) UsrCod;
+
+	 /* Get surnames, first name and nickname (row[1], row[2], row[3], row[4]) */
+	 Usr->userSurname1  = soap_strdup (soap,row[1]);
+	 Usr->userSurname2  = soap_strdup (soap,row[2]);
+	 Usr->userFirstname = soap_strdup (soap,row[3]);
+	 Usr->userNickname  = soap_strdup (soap,row[4] ? row[4] :
+							 "");
+	}
+     }
+
+   /***** Cursor to get next page *****/
+   getUsersPageOut->nextCursor = API_BuildNextCursor (soap,NumRows > MaxUsrs,UsrCod);
+  }
+
 /*****************************************************************************/
 /***************************** Copy users from list **************************/
 /*****************************************************************************/
@@ -3520,6 +3938,244 @@ int swad__getNotifications (struct soap *soap,
    return SOAP_OK;
   }
 
+/*****************************************************************************/
+/***************** Return a page of notifications of a user ******************/
+/*****************************************************************************/
+// Notifications are ordered from newest to oldest, without content.
+// cursor is empty for the first page, or nextCursor returned by previous page
+
+int swad__getNotificationsPage (struct soap *soap,
+                                char *wsKey,long beginTime,				// input
+                                char *cursor,int maxNotifications,			// input
+                                struct swad__getNotificationsPageOutput *getNotificationsPageOut)	// output
+  {
+   extern const char *Ntf_WSNotifyEvents[Ntf_NUM_NOTIFY_EVENTS];
+   extern const char *Txt_Forum;
+   extern const char *Txt_Course;
+   extern const char *Txt_Degree;
+   extern const char *Txt_Centre;
+   extern const char *Txt_Institution;
+   int ReturnCode;
+   long LastNtfCod;
+   unsigned MaxNotifs;
+   char SubQueryCursor[32 + Cns_MAX_DECIMAL_DIGITS_LONG + 1];
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   unsigned NumRows;
+   unsigned NumNotifs;
+   unsigned NumNotif;
+   struct swad__notificationBrief *Notif;
+   long NtfCod = -1L;
+   Ntf_NotifyEvent_t NotifyEvent;
+   long CrsCod;
+   long Cod;
+   struct For_Forum ForumSelected;
+   char ForumName[For_MAX_BYTES_FORUM_NAME + 1];
+   char SummaryStr[Ntf_MAX_BYTES_SUMMARY + 1];
+   char *ContentStr;
+   Ntf_Status_t Status;
+   unsigned UnsignedNum;
+
+   /***** Initializations *****/
+   API_Set_gSOAP_RuntimeEnv (soap);
+   Gbl.WebService.Function = API_getNotificationsPage;
+
+   /***** Check web service key *****/
+   if ((ReturnCode = API_CheckWSKey (wsKey)) != SOAP_OK)
+      return ReturnCode;
+   if (Gbl.Usrs.Me.UsrDat.UsrCod < 0)	// Web service key does not exist in database
+      return soap_receiver_fault (soap,
+	                          "Bad web service key",
+	                          "Web service key does not exist in database");
+
+   /***** Get some of my data *****/
+   if (!API_GetSomeUsrDataFromUsrCod (&Gbl.Usrs.Me.UsrDat,-1L))
+      return soap_receiver_fault (soap,
+	                          "Can not get user's data from database",
+	                          "User does not exist in database");
+   Gbl.Usrs.Me.Logged = true;
+   Gbl.Usrs.Me.Role.Logged = Gbl.Usrs.Me.UsrDat.Roles.InCurrentCrs.Role;
+
+   /***** Get my language from database *****/
+   if ((ReturnCode = API_GetMyLanguage (soap)) != SOAP_OK)
+      return ReturnCode;
+
+   /***** Get page parameters *****/
+   LastNtfCod = Str_ConvertStrCodToLongCod (cursor);	// -1 ==> first page
+   MaxNotifs = API_GetPageSize (maxNotifications,
+                                API_DEF_NOTIFICATIONS_PER_PAGE,
+                                API_MAX_NOTIFICATIONS_PER_PAGE);
+   if (LastNtfCod > 0)
+      snprintf (SubQueryCursor,sizeof (SubQueryCursor),
+	        " AND notif.NtfCod<%ld",
+		LastNtfCod);
+   else
+      SubQueryCursor[0] = '\0';
+
+   /***** Get one page of my notifications from database,
+          together with data of senders, locations and forums of posts
+          (one more to know if there are more pages) *****/
+   NumRows = (unsigned)
+   DB_QuerySELECT (&mysql_res,"can not get user's notifications",
+		   "SELECT notif.NtfCod,"			// row[ 0]
+			  "notif.NotifyEvent,"			// row[ 1]
+			  "UNIX_TIMESTAMP(notif.TimeNotif),"	// row[ 2]
+			  "notif.FromUsrCod,"			// row[ 3]
+			  "notif.CrsCod,"			// row[ 4]
+			  "notif.Cod,"				// row[ 5]
+			  "notif.Status,"			// row[ 6]
+			  "usr_data.Surname1,"			// row[ 7]
+			  "usr_data.Surname2,"			// row[ 8]
+			  "usr_data.FirstName,"			// row[ 9]
+			  "(SELECT Nickname FROM usr_nicknames"
+			  " WHERE usr_nicknames.UsrCod=notif.FromUsrCod"
+			  " ORDER BY CreatTime DESC LIMIT 1),"	// row[10]
+			  "courses.ShortName,"			// row[11]
+			  "degrees.ShortName,"			// row[12]
+			  "centres.ShortName,"			// row[13]
+			  "institutions.ShortName,"		// row[14]
+			  "forum_thread.ForumType,"		// row[15]
+			  "forum_thread.Location"		// row[16]
+		   " FROM notif"
+		   " LEFT JOIN usr_data ON notif.FromUsrCod=usr_data.UsrCod"
+		   " LEFT JOIN courses ON notif.CrsCod=courses.CrsCod"
+		   " LEFT JOIN degrees ON notif.DegCod=degrees.DegCod"
+		   " LEFT JOIN centres ON notif.CtrCod=centres.CtrCod"
+		   " LEFT JOIN institutions ON notif.InsCod=institutions.InsCod"
+		   " LEFT JOIN forum_post ON notif.NotifyEvent IN (%u,%u)"
+		   " AND notif.Cod=forum_post.PstCod"
+		   " LEFT JOIN forum_thread ON forum_post.ThrCod=forum_thread.ThrCod"
+		   " WHERE notif.ToUsrCod=%ld"
+		   " AND notif.TimeNotif>=FROM_UNIXTIME(%ld)"
+		   "%s"
+		   " ORDER BY notif.NtfCod DESC"
+		   " LIMIT %u",
+		   (unsigned) Ntf_EVENT_FORUM_POST_COURSE,
+		   (unsigned) Ntf_EVENT_FORUM_REPLY,
+		   Gbl.Usrs.Me.UsrDat.UsrCod,beginTime,
+		   SubQueryCursor,
+		   MaxNotifs + 1);
+
+   /***** The row beyond page size is used only to know if there are more *****/
+   NumNotifs = (NumRows > MaxNotifs) ? MaxNotifs :
+				       NumRows;
+   getNotificationsPageOut->numNotifications = (int) NumNotifs;
+   getNotificationsPageOut->notificationsArray.__size = (int) NumNotifs;
+   getNotificationsPageOut->notificationsArray.__ptr = NULL;
+
+   if (NumNotifs)	// Notifications found
+     {
+      getNotificationsPageOut->notificationsArray.__ptr = soap_malloc (soap,
+								       NumNotifs *
+								       sizeof (*(getNotificationsPageOut->notificationsArray.__ptr)));
+
+      for (NumNotif = 0;
+	   NumNotif < NumNotifs;
+	   NumNotif++)
+	{
+	 /* Get next notification */
+	 row = mysql_fetch_row (mysql_res);
+	 Notif = &(getNotificationsPageOut->notificationsArray.__ptr[NumNotif]);
+
+         /* Get unique notification code (row[0]) */
+         NtfCod = Str_ConvertStrCodToLongCod (row[0]);
+         Notif->notifCode = (int) NtfCod;
+
+         /* Get notification event type (row[1]) */
+         NotifyEvent = Ntf_GetNotifyEventFromStr ((const char *) row[1]);
+         Notif->eventType = soap_strdup (soap,Ntf_WSNotifyEvents[NotifyEvent]);
+
+         /* Get time of the event (row[2]) */
+         Notif->eventTime = 0L;
+         if (row[2])
+            sscanf (row[2],"%ld",&Notif->eventTime);
+
+         /* Get user's code of the user who caused the event (row[3]) */
+         Notif->userCode = (int) Str_ConvertStrCodToLongCod (row[3]);
+
+         /* Get course (row[4]) */
+         CrsCod = Str_ConvertStrCodToLongCod (row[4]);
+
+         /* Get message/post/... code (row[5]) */
+         Cod = Str_ConvertStrCodToLongCod (row[5]);
+         Notif->eventCode = (int) Cod;
+
+         /* Get status (row[6]) */
+         if (sscanf (row[6],"%u",&Status) != 1)
+            Status = (Ntf_Status_t) 0;
+         Notif->status = (int) Status;
+
+         /* Get names of the user who caused the event (row[7], row[8], row[9], row[10]) */
+         if (row[7])	// User exists
+           {
+            Notif->userSurname1  = soap_strdup (soap,row[7]);
+            Notif->userSurname2  = soap_strdup (soap,row[8]);
+            Notif->userFirstname = soap_strdup (soap,row[9]);
+            Notif->userNickname  = soap_strdup (soap,row[10] ? row[10] :
+								 "");
+           }
+         else
+           {
+            Notif->userSurname1  = NULL;
+            Notif->userSurname2  = NULL;
+            Notif->userFirstname = NULL;
+            Notif->userNickname  = NULL;
+           }
+
+         /* Set location from short names of course, degree, centre and institution (row[11], row[12], row[13], row[14]) */
+         Notif->location = soap_malloc (soap,Ntf_MAX_BYTES_NOTIFY_LOCATION + 1);
+	 if (NotifyEvent == Ntf_EVENT_FORUM_POST_COURSE ||
+	     NotifyEvent == Ntf_EVENT_FORUM_REPLY)
+	   {
+	    /* Get forum type (row[15]) and location (row[16]) of the post */
+	    ForumSelected.Type = For_FORUM_UNKNOWN;
+	    if (row[15])
+	       if (sscanf (row[15],"%u",&UnsignedNum) == 1)
+		  if (UnsignedNum < For_NUM_TYPES_FORUM)
+		     ForumSelected.Type = (For_ForumType_t) UnsignedNum;
+	    ForumSelected.Location = Str_ConvertStrCodToLongCod (row[16]);
+
+            For_SetForumName (&ForumSelected,
+        	              ForumName,Gbl.Prefs.Language,false);	// Set forum name in recipient's language
+            snprintf (Notif->location,Ntf_MAX_BYTES_NOTIFY_LOCATION + 1,"%s: %s",
+                      Txt_Forum,ForumName);
+           }
+         else if (row[11])
+            snprintf (Notif->location,Ntf_MAX_BYTES_NOTIFY_LOCATION + 1,"%s: %s",
+                      Txt_Course,row[11]);
+         else if (row[12])
+            snprintf (Notif->location,Ntf_MAX_BYTES_NOTIFY_LOCATION + 1,"%s: %s",
+                      Txt_Degree,row[12]);
+         else if (row[13])
+            snprintf (Notif->location,Ntf_MAX_BYTES_NOTIFY_LOCATION + 1,"%s: %s",
+                      Txt_Centre,row[13]);
+         else if (row[14])
+            snprintf (Notif->location,Ntf_MAX_BYTES_NOTIFY_LOCATION + 1,"%s: %s",
+                      Txt_Institution,row[14]);
+         else
+            Str_Copy (Notif->location,"-",
+                      Ntf_MAX_BYTES_NOTIFY_LOCATION);
+
+         /* Get summary (content is not got).
+            Each type of event gets its summary from its own table,
+            so this is still one query per notification */
+         ContentStr = NULL;
+         Ntf_GetNotifSummaryAndContent (SummaryStr,&ContentStr,NotifyEvent,
+                                        Cod,CrsCod,Gbl.Usrs.Me.UsrDat.UsrCod,
+                                        false);
+         Notif->summary = soap_strdup (soap,SummaryStr);
+	}
+     }
+
+   /***** Cursor to get next page *****/
+   getNotificationsPageOut->nextCursor = API_BuildNextCursor (soap,NumRows > MaxNotifs,NtfCod);
+
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+
+   return SOAP_OK;
+  }
+
 /*****************************************************************************/
 /********************* Get my language from database *************************/
 /*****************************************************************************/
@@ -4633,14 +5289,14 @@ int swad__getTrivialQuestion (struct soap *soap,
 	                        "Bad score interval",
 	                        "lowerScore or upperScore values not valid");
 
-   /***** Start query *****/
+   /***** Get codes of candidate questions *****/
+   // Don't use ORDER BY RAND(): all the candidate questions would be sorted.
+   // Only codes are got, not the text of all the candidate questions
    Str_SetDecimalPointToUS ();	// To print the floating point as a dot
    NumRows =
    (unsigned) DB_QuerySELECT (&mysql_res,"can not get test questions",
-			      "SELECT DISTINCTROW tst_questions.QstCod,"
-			      "tst_questions.AnsType,tst_questions.Shuffle,"
-			      "tst_questions.Stem,tst_questions.Feedback,"
-			      "tst_questions.Score/tst_questions.NumHits AS S"
+			      "SELECT DISTINCTROW tst_questions.QstCod,"	// row[0]
+			      "tst_questions.Score/tst_questions.NumHits AS S"	// row[1]
 			      " FROM courses,tst_questions"
 			      " WHERE courses.DegCod IN (%s)"
 			      " AND courses.CrsCod=tst_questions.CrsCod"
@@ -4653,60 +5309,79 @@ int swad__getTrivialQuestion (struct soap *soap,
 			      " AND courses.CrsCod=tst_tags.CrsCod"
 			      " AND tst_tags.TagHidden='Y'"
 			      " AND tst_tags.TagCod=tst_question_tags.TagCod)"
-			      " HAVING S>='%f' AND S<='%f'"
-			      " ORDER BY RAND() LIMIT 1",
+			      " HAVING S>='%f' AND S<='%f'",
 			      DegreesStr,DegreesStr,
 			      lowerScore,upperScore);
    Str_SetDecimalPointToLocal ();	// Return to local system
 
+   /***** Select a random question from candidates *****/
+   if ((row = Rnd_GetRandomRow (mysql_res,NumRows)))
+      /* Get question code (row[0]) */
+      QstCod = Str_ConvertStrCodToLongCod (row[0]);
+
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+
+   /***** Get data of the selected question *****/
+   NumRows = 0;
+   if (QstCod > 0)
+      NumRows =
+      (unsigned) DB_QuerySELECT (&mysql_res,"can not get test question",
+				 "SELECT AnsType,"	// row[0]
+					"Shuffle,"	// row[1]
+					"Stem,"		// row[2]
+					"Feedback"	// row[3]
+				 " FROM tst_questions"
+				 " WHERE QstCod=%ld",
+				 QstCod);
+
    if (NumRows == 1)	// Question found
      {
       /* Get next question */
       row = mysql_fetch_row (mysql_res);
 
-      /* Get question code (row[0]) */
-      QstCod = Str_ConvertStrCodToLongCod (row[0]);
+      /* Set question code */
       getTrivialQuestionOut->question.questionCode = (int) QstCod;
 
-      /* Get answer type (row[1]) */
-      AnswerType = Tst_ConvertFromStrAnsTypDBToAnsTyp (row[1]);
+      /* Get answer type (row[0]) */
+      AnswerType = Tst_ConvertFromStrAnsTypDBToAnsTyp (row[0]);
       getTrivialQuestionOut->question.answerType =
          soap_malloc (soap,Tst_MAX_BYTES_ANSWER_TYPE + 1);
       Str_Copy (getTrivialQuestionOut->question.answerType,
                 Tst_StrAnswerTypesXML[AnswerType],Tst_MAX_BYTES_ANSWER_TYPE);
 
-      /* Get shuffle (row[2]) */
-      getTrivialQuestionOut->question.shuffle = (row[2][0] == 'Y') ? 1 :
+      /* Get shuffle (row[1]) */
+      getTrivialQuestionOut->question.shuffle = (row[1][0] == 'Y') ? 1 :
 							             0;
 
-      /* Get question stem (row[3]) */
+      /* Get question stem (row[2]) */
       getTrivialQuestionOut->question.stem =
          soap_malloc (soap,Cns_MAX_BYTES_TEXT + 1);
-      Str_Copy (getTrivialQuestionOut->question.stem,row[3],Cns_MAX_BYTES_TEXT);
+      Str_Copy (getTrivialQuestionOut->question.stem,row[2],Cns_MAX_BYTES_TEXT);
 
-      /* Get question feedback (row[4]) */
+      /* Get question feedback (row[3]) */
       getTrivialQuestionOut->question.feedback =
          soap_malloc (soap,Cns_MAX_BYTES_TEXT + 1);
-      Str_Copy (getTrivialQuestionOut->question.feedback,row[4],Cns_MAX_BYTES_TEXT);
+      Str_Copy (getTrivialQuestionOut->question.feedback,row[3],Cns_MAX_BYTES_TEXT);
      }
    else		// Empty question
      {
-      /* Question code (row[0]) */
+      /* Question code */
       QstCod = -1L;
       getTrivialQuestionOut->question.questionCode = -1;
 
-      /* Answer type (row[1]) */
+      /* Answer type */
       getTrivialQuestionOut->question.answerType = soap_malloc (soap,1);
       getTrivialQuestionOut->question.answerType[0] = '\0';
 
-      /* Shuffle (row[2]) */
+      /* Shuffle */
       getTrivialQuestionOut->question.shuffle = 0;
 
-      /* Question stem (row[3]) */
+      /* Question stem */
       getTrivialQuestionOut->question.stem = soap_malloc (soap,1);
       getTrivialQuestionOut->question.stem[0] = '\0';
 
-      /* Get question feedback (row[4]) */
+      /* Get question feedback */
       getTrivialQuestionOut->question.feedback = soap_malloc (soap,1);
       getTrivialQuestionOut->question.feedback[0] = '\0';
      }
@@ -5396,16 +6071,73 @@ static void API_GetListGrpsInGameFromDB (struct soap *soap,
 int swad__getDirectoryTree (struct soap *soap,
                             char *wsKey,int courseCode,int groupCode,int treeCode,	// input
                             struct swad__getDirectoryTreeOutput *getDirectoryTreeOut)	// output
+  {
+   /***** Initializations *****/
+   API_Set_gSOAP_RuntimeEnv (soap);
+   Gbl.WebService.Function = API_getDirectoryTree;
+
+   /***** Return full directory tree *****/
+   return API_GetDirectoryTree (soap,
+                                wsKey,courseCode,groupCode,treeCode,
+                                "",0,	// Root folder, all levels
+                                getDirectoryTreeOut);
+  }
+
+/*****************************************************************************/
+/********** Return some levels of a directory tree, from a folder ************/
+/*****************************************************************************/
+// path is relative to root folder ("" for root folder)
+// Folders not listed because of maxDepth contain an element <more/> if not empty
+
+int swad__getDirectoryTreeLevel (struct soap *soap,
+                                 char *wsKey,int courseCode,int groupCode,int treeCode,	// input
+                                 char *path,int maxDepth,				// input
+                                 struct swad__getDirectoryTreeOutput *getDirectoryTreeOut)	// output
+  {
+   /***** Initializations *****/
+   API_Set_gSOAP_RuntimeEnv (soap);
+   Gbl.WebService.Function = API_getDirectoryTreeLevel;
+
+   /***** Check path and depth *****/
+   if (!path)
+      path = "";
+   if (path[0] == '/' ||
+       strstr (path,"..") ||
+       strlen (path) > PATH_MAX / 2)
+      return soap_sender_fault (soap,
+	                        "Bad path",
+	                        "Path must be relative to root folder");
+   if (maxDepth <= 0 || maxDepth > Brw_MAX_DIR_LEVELS)
+      return soap_sender_fault (soap,
+	                        "Bad depth",
+	                        "Depth must be a integer between 1 and 10");
+
+   /***** Return some levels of directory tree *****/
+   return API_GetDirectoryTree (soap,
+                                wsKey,courseCode,groupCode,treeCode,
+                                path,(unsigned) maxDepth,
+                                getDirectoryTreeOut);
+  }
+
+/*****************************************************************************/
+/************** Return directory tree, or part of it, in XML *****************/
+/*****************************************************************************/
+// MaxLevel == 0 ==> all levels
+
+static int API_GetDirectoryTree (struct soap *soap,
+                                 char *wsKey,int courseCode,int groupCode,int treeCode,
+                                 const char *SubPath,unsigned MaxLevel,
+                                 struct swad__getDirectoryTreeOutput *getDirectoryTreeOut)
   {
    extern const char *Brw_RootFolderInternalNames[Brw_NUM_TYPES_FILE_BROWSER];
    int ReturnCode;
    char XMLFileName[PATH_MAX + 1];
+   char Path[PATH_MAX + 1];
+   char PathInTree[PATH_MAX + 1];
    unsigned long FileSize;
    unsigned long NumBytesRead;
 
    /***** Initializations *****/
-   API_Set_gSOAP_RuntimeEnv (soap);
-   Gbl.WebService.Function = API_getDirectoryTree;
    Gbl.Hierarchy.Crs.CrsCod = (long) courseCode;
    Gbl.Crs.Grps.GrpCod = (long) groupCode;
 
@@ -5519,7 +6251,23 @@ int swad__getDirectoryTree (struct soap *soap,
    XML_WriteStartFile (Gbl.F.XML,"tree",false);
    if (!Brw_CheckIfFileOrFolderIsSetAsHiddenInDB (Brw_IS_FOLDER,
                                                   Gbl.FileBrowser.FilFolLnk.Full)) // If root folder is visible
-      API_ListDir (1,Gbl.FileBrowser.Priv.PathRootFolder,Brw_RootFolderInternalNames[Gbl.FileBrowser.Type]);
+     {
+      if (SubPath[0])	// Starting at a folder inside root folder
+	{
+	 if (API_CheckIfSubPathIsVisible (SubPath))
+	   {
+	    snprintf (Path,sizeof (Path),"%s/%s",
+		      Gbl.FileBrowser.Priv.PathRootFolder,SubPath);
+	    snprintf (PathInTree,sizeof (PathInTree),"%s/%s",
+		      Brw_RootFolderInternalNames[Gbl.FileBrowser.Type],SubPath);
+	    API_ListDir (1,MaxLevel,Path,PathInTree);
+	   }
+	}
+      else		// Starting at root folder
+	 API_ListDir (1,MaxLevel,
+	              Gbl.FileBrowser.Priv.PathRootFolder,
+	              Brw_RootFolderInternalNames[Gbl.FileBrowser.Type]);
+     }
    XML_WriteEndFile (Gbl.F.XML,"tree");
 
    /* Compute file size */
@@ -5539,11 +6287,48 @@ int swad__getDirectoryTree (struct soap *soap,
    return SOAP_OK;
   }
 
+/*****************************************************************************/
+/********** Check if the folders in a path inside tree are visible ***********/
+/*****************************************************************************/
+
+static bool API_CheckIfSubPathIsVisible (const char *SubPath)
+  {
+   extern const char *Brw_RootFolderInternalNames[Brw_NUM_TYPES_FILE_BROWSER];
+   char PathInTree[PATH_MAX + 1];
+   size_t LengthRoot;
+   size_t i;
+
+   /***** Only documents can be hidden *****/
+   if (Gbl.FileBrowser.Type != Brw_SHOW_DOC_CRS &&
+       Gbl.FileBrowser.Type != Brw_SHOW_DOC_GRP)
+      return true;
+
+   /***** Check each folder from the upper to the lower *****/
+   snprintf (PathInTree,sizeof (PathInTree),"%s/%s",
+	     Brw_RootFolderInternalNames[Gbl.FileBrowser.Type],SubPath);
+   LengthRoot = strlen (Brw_RootFolderInternalNames[Gbl.FileBrowser.Type]);
+   for (i = LengthRoot + 1;
+	;
+	i++)
+      if (PathInTree[i] == '/' || PathInTree[i] == '\0')
+	{
+	 if (PathInTree[i] == '\0')
+	    return !Brw_CheckIfFileOrFolderIsSetAsHiddenInDB (Brw_IS_FOLDER,PathInTree);
+
+	 PathInTree[i] = '\0';
+	 if (Brw_CheckIfFileOrFolderIsSetAsHiddenInDB (Brw_IS_FOLDER,PathInTree))
+	    return false;
+	 PathInTree[i] = '/';
+	}
+  }
+
 /*****************************************************************************/
 /************************ List a directory recursively ***********************/
 /*****************************************************************************/
+// MaxLevel == 0 ==> all levels
 
-static void API_ListDir (unsigned Level,const char *Path,const char *PathInTree)
+static void API_ListDir (unsigned Level,unsigned MaxLevel,
+                         const char *Path,const char *PathInTree)
   {
    extern const char *Txt_NEW_LINE;
    struct dirent **FileList;
@@ -5585,7 +6370,14 @@ static void API_ListDir (unsigned Level,const char *Path,const char *PathInTree)
 		  if (API_WriteRowFileBrowser (Level,Brw_IS_FOLDER,FileList[NumFile]->d_name))
 		    {
 		     /* List subtree starting at this this directory */
-		     API_ListDir (Level + 1,PathFileRel,PathFileInExplTree);
+		     if (MaxLevel == 0 || Level < MaxLevel)
+			API_ListDir (Level + 1,MaxLevel,PathFileRel,PathFileInExplTree);
+		     else if (!API_CheckIfDirIsEmpty (PathFileRel))
+		       {
+			/* Subtree not listed */
+			API_IndentXMLLine (Level + 1);
+			fprintf (Gbl.F.XML,"<more/>%s",Txt_NEW_LINE);
+		       }
 
 		     /* Indent and end dir */
 		     API_IndentXMLLine (Level);
@@ -5606,6 +6398,31 @@ static void API_ListDir (unsigned Level,const char *Path,const char *PathInTree)
      }
   }
 
+/*****************************************************************************/
+/********************** Check if a directory is empty ************************/
+/*****************************************************************************/
+
+static bool API_CheckIfDirIsEmpty (const char *Path)
+  {
+   DIR *Dir;
+   struct dirent *Entry;
+   bool IsEmpty = true;
+
+   if ((Dir = opendir (Path)) != NULL)
+     {
+      while ((Entry = readdir (Dir)) != NULL)
+	 if (strcmp (Entry->d_name,".") &&
+	     strcmp (Entry->d_name,".."))	// Skip directories "." and ".."
+	   {
+	    IsEmpty = false;
+	    break;
+	   }
+      closedir (Dir);
+     }
+
+   return IsEmpty;
+  }
+
 /*****************************************************************************/
 /*********************** Write a row of a file browser ***********************/
 /*****************************************************************************/
@@ -5646,8 +6463,11 @@ static bool API_WriteRowFileBrowser (unsigned Level,Brw_FileType_t FileType,cons
 	 FileMetadata.FilCod = Brw_AddPathToDB (-1L,FileMetadata.FilFolLnk.Type,
 	                                        Gbl.FileBrowser.FilFolLnk.Full,false,Brw_LICENSE_DEFAULT);
 
-      Gbl.Usrs.Other.UsrDat.UsrCod = FileMetadata.PublisherUsrCod;
-      Usr_ChkUsrCodAndGetAllUsrDataFromUsrCod (&Gbl.Usrs.Other.UsrDat,Usr_DONT_GET_PREFS);
+      if (FileMetadata.PublisherUsrCod != Gbl.Usrs.Other.UsrDat.UsrCod)	// Not the publisher of previous file
+	{
+	 Gbl.Usrs.Other.UsrDat.UsrCod = FileMetadata.PublisherUsrCod;
+	 Usr_ChkUsrCodAndGetAllUsrDataFromUsrCod (&Gbl.Usrs.Other.UsrDat,Usr_DONT_GET_PREFS);
+	}
       Pho_BuildLinkToPhoto (&Gbl.Usrs.Me.UsrDat,PhotoURL);
 
       fprintf (Gbl.F.XML,"<file name=\"%s\">"
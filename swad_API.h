@@ -31,7 +31,7 @@
 /***************************** Public constants ******************************/
 /*****************************************************************************/
 
-#define API_NUM_FUNCTIONS 35
+#define API_NUM_FUNCTIONS 39
 
 /*****************************************************************************/
 /******************************* Public types ********************************/
@@ -76,6 +76,10 @@ typedef enum
    API_sendMyLocation		= 33,
    API_getLastLocation		= 34,
    API_getAvailableRoles	= 35,
+   API_getUsersPage		= 36,
+   API_findUsersPage		= 37,
+   API_getNotificationsPage	= 38,
+   API_getDirectoryTreeLevel	= 39,
   } API_Function_t;
 
 /*****************************************************************************/
@@ -54,6 +54,15 @@
 #define MFU_MAX_CHARS_MENU	(128 - 1)	// 127
 #define MFU_MAX_BYTES_MENU	((MFU_MAX_CHARS_MENU + 1) * Str_MAX_BYTES_PER_CHAR - 1)	// 2047
 
+#define MFU_MIN_SCORE		  0.5
+#define MFU_MAX_SCORE		100.0
+#define MFU_INCREASE_FACTOR	  1.2
+#define MFU_DECREASE_FACTOR	  0.99
+
+// Scores are decayed lazily: each row stores its score at epoch Epoch,
+// and the current score is the stored one decayed once per click since then
+#define MFU_CURRENT_SCORE	"GREATEST(Score*POW('%.15lg',GREATEST(%ld-Epoch,0)),'%.15lg')"
+
 /*****************************************************************************/
 /******************************* Private types *******************************/
 /*****************************************************************************/
@@ -109,10 +118,15 @@ void MFU_GetMFUActions (struct MFU_ListMFUActions *ListMFUActions,unsigned MaxAc
    Act_Action_t Action;
 
    /***** Get most frequently used actions *****/
+   Str_SetDecimalPointToUS ();	// To get the decimal point as a dot
    NumRows = DB_QuerySELECT (&mysql_res,"can not get most frequently used actions",
 			     "SELECT ActCod FROM actions_MFU"
-			     " WHERE UsrCod=%ld ORDER BY Score DESC,LastClick DESC",
-			     Gbl.Usrs.Me.UsrDat.UsrCod);
+			     " WHERE UsrCod=%ld"
+			     " ORDER BY " MFU_CURRENT_SCORE " DESC,LastClick DESC",
+			     Gbl.Usrs.Me.UsrDat.UsrCod,
+			     MFU_DECREASE_FACTOR,Gbl.Usrs.Me.UsrLast.MFUEpoch,
+			     MFU_MIN_SCORE);
+   Str_SetDecimalPointToLocal ();	// Return to local system
 
    /***** Write list of frequently used actions *****/
    for (NumRow = 0, ListMFUActions->NumActions = 0;
@@ -152,13 +166,17 @@ Act_Action_t MFU_GetMyLastActionInCurrentTab (void)
    if (Gbl.Usrs.Me.UsrDat.UsrCod > 0)
      {
       /***** Get my most frequently used actions *****/
+      Str_SetDecimalPointToUS ();	// To get the decimal point as a dot
       NumActions =
       (unsigned) DB_QuerySELECT (&mysql_res,"can not get"
 					    " most frequently used actions",
 				 "SELECT ActCod FROM actions_MFU"
 				 " WHERE UsrCod=%ld"
-				 " ORDER BY LastClick DESC,Score DESC",
-				 Gbl.Usrs.Me.UsrDat.UsrCod);
+				 " ORDER BY LastClick DESC," MFU_CURRENT_SCORE " DESC",
+				 Gbl.Usrs.Me.UsrDat.UsrCod,
+				 MFU_DECREASE_FACTOR,Gbl.Usrs.Me.UsrLast.MFUEpoch,
+				 MFU_MIN_SCORE);
+      Str_SetDecimalPointToLocal ();	// Return to local system
 
       /***** Loop over list of frequently used actions *****/
       for (NumAct = 0;
@@ -320,17 +338,11 @@ void MFU_WriteSmallMFUActions (struct MFU_ListMFUActions *ListMFUActions)
 /*****************************************************************************/
 /******************** Update most frequently used actions ********************/
 /*****************************************************************************/
-
-#define MFU_MIN_SCORE		  0.5
-#define MFU_MAX_SCORE		100.0
-#define MFU_INCREASE_FACTOR	  1.2
-#define MFU_DECREASE_FACTOR	  0.99
+// Only the score of the current action is written, deferred until the end
+// of the request. The other actions are decayed by advancing my MFU epoch.
 
 void MFU_UpdateMFUActions (void)
   {
-   MYSQL_RES *mysql_res;
-   MYSQL_ROW row;
-   double Score;
    long ActCod;
    Act_Action_t SuperAction;
 
@@ -347,39 +359,25 @@ void MFU_UpdateMFUActions (void)
 
    Str_SetDecimalPointToUS ();	// To get the decimal point as a dot
 
-   /***** Get current score *****/
-   if (DB_QuerySELECT (&mysql_res,"can not get score for current action",
-	               "SELECT Score FROM actions_MFU"
-		       " WHERE UsrCod=%ld AND ActCod=%ld",
-		       Gbl.Usrs.Me.UsrDat.UsrCod,ActCod))
-     {
-      row = mysql_fetch_row (mysql_res);
-      if (sscanf (row[0],"%lf",&Score) != 1)
-         Lay_ShowErrorAndExit ("Error when getting score for current action.");
-      Score *= MFU_INCREASE_FACTOR;
-      if (Score > MFU_MAX_SCORE)
-         Score = MFU_MAX_SCORE;
-     }
-   else
-      Score = MFU_MIN_SCORE;	// Initial score for a new action not present in MFU table
-
-   /* Free structure that stores the query result */
-   DB_FreeMySQLResult (&mysql_res);
-
    /***** Update score for the current action *****/
-   DB_QueryREPLACE ("can not update most frequently used actions",
-		    "REPLACE INTO actions_MFU"
-		    " (UsrCod,ActCod,Score,LastClick)"
-		    " VALUES"
-		    " (%ld,%ld,'%15lg',NOW())",
-	            Gbl.Usrs.Me.UsrDat.UsrCod,ActCod,Score);
-
-   /***** Update score for other actions *****/
-   DB_QueryUPDATE ("can not update most frequently used actions",
-		   "UPDATE actions_MFU SET Score=GREATEST(Score*'%.15lg','%.15lg')"
-		   " WHERE UsrCod=%ld AND ActCod<>%ld",
-                   MFU_DECREASE_FACTOR,MFU_MIN_SCORE,
-                   Gbl.Usrs.Me.UsrDat.UsrCod,ActCod);
+   DB_DeferQuery ("INSERT INTO actions_MFU"
+		  " (UsrCod,ActCod,Score,LastClick,Epoch)"
+		  " VALUES"
+		  " (%ld,%ld,'%.15lg',NOW(),%ld)"
+		  " ON DUPLICATE KEY UPDATE"
+		  " Score=LEAST(" MFU_CURRENT_SCORE "*'%.15lg','%.15lg'),"
+		  "LastClick=NOW(),"
+		  "Epoch=VALUES(Epoch)",
+		  Gbl.Usrs.Me.UsrDat.UsrCod,ActCod,
+		  MFU_MIN_SCORE,	// Initial score for a new action not present in MFU table
+		  Gbl.Usrs.Me.UsrLast.MFUEpoch + 1,
+		  MFU_DECREASE_FACTOR,Gbl.Usrs.Me.UsrLast.MFUEpoch,MFU_MIN_SCORE,
+		  MFU_INCREASE_FACTOR,MFU_MAX_SCORE);
 
    Str_SetDecimalPointToLocal ();	// Return to local system
+
+   /***** Decay score for other actions *****/
+   DB_DeferQuery ("UPDATE usr_last SET MFUEpoch=%ld WHERE UsrCod=%ld",
+		  Gbl.Usrs.Me.UsrLast.MFUEpoch + 1,
+		  Gbl.Usrs.Me.UsrDat.UsrCod);
   }
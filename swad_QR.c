@@ -25,16 +25,22 @@
 /*********************************** Headers *********************************/
 /*****************************************************************************/
 
-#define _GNU_SOURCE 		// For asprintf
-#include <stdio.h>		// For asprintf
-#include <stdlib.h>		// For free
+#define _GNU_SOURCE 		// For asprintf, open_memstream
+#include <linux/limits.h>	// For PATH_MAX, NAME_MAX
+#include <stdio.h>		// For asprintf, open_memstream, rename
+#include <stdlib.h>		// For free, malloc
+#include <string.h>		// For memcpy
+#include <utime.h>		// For utime
 
 #include "swad_action.h"
+#include "swad_cryptography.h"
+#include "swad_file.h"
 #include "swad_global.h"
 #include "swad_HTML.h"
 #include "swad_ID.h"
 #include "swad_parameter.h"
 #include "swad_QR.h"
+#include "swad_QR_image.h"
 
 /*****************************************************************************/
 /****************************** Public constants *****************************/
@@ -65,6 +71,11 @@ extern struct Globals Gbl;
 /***************************** Private prototypes ****************************/
 /*****************************************************************************/
 
+static void QR_BuildQRImageDataURI (const char *Text,unsigned Size,
+                                    char **DataURI);
+static void QR_BuildQRImageFile (const char *Text,unsigned Size,
+                                 char FileName[NAME_MAX + 1]);
+
 /*****************************************************************************/
 /***************** Put a link to a print view of a QR code *******************/
 /*****************************************************************************/
@@ -108,21 +119,21 @@ void QR_PrintQRCode (void)
 /*****************************************************************************/
 /******************** Write an QR (image) based on a string ******************/
 /*****************************************************************************/
+// The string may be personal (user's ID, nickname...),
+// so the image is embedded in the page instead of being stored in a file
 
 void QR_ImageQRCode (const char *QRString)
   {
-   char *URL;
+   char *DataURI;
 
    HTM_DIV_Begin ("class=\"CM\" style=\"margin:0 auto; width:%upx;\"",
 		  QR_CODE_SIZE);
 
-   if (asprintf (&URL,"https://chart.googleapis.com/chart?cht=qr&amp;chs=%ux%u&amp;chl=%s",
-		 QR_CODE_SIZE,QR_CODE_SIZE,QRString) < 0)
-      Lay_NotEnoughMemoryExit ();
-   HTM_IMG (URL,NULL,QRString,
+   QR_BuildQRImageDataURI (QRString,QR_CODE_SIZE,&DataURI);
+   HTM_IMG (DataURI,NULL,QRString,
 	    "style=\"width:%upx;height:%upx;border:1px dashed silver;\"",
 	    QR_CODE_SIZE,QR_CODE_SIZE);
-   free (URL);
+   free (DataURI);
 
    HTM_DIV_End ();
   }
@@ -135,23 +146,25 @@ void QR_LinkTo (unsigned Size,const char *ParamName,long Cod)
   {
    extern const char *Txt_Shortcut;
    char *URL;
+   char FileName[NAME_MAX + 1];
 
    /***** Show QR code with link *****/
    if (ParamName)
      {
-      if (asprintf (&URL,"https://chart.googleapis.com/chart?cht=qr&amp;chs=%ux%u&amp;chl=%s/?%s=%ld",
-		    Size,Size,Cfg_URL_SWAD_CGI,ParamName,Cod) < 0)
+      if (asprintf (&URL,"%s/?%s=%ld",
+		    Cfg_URL_SWAD_CGI,ParamName,Cod) < 0)
 	 Lay_NotEnoughMemoryExit ();
      }
    else
      {
-      if (asprintf (&URL,"https://chart.googleapis.com/chart?cht=qr&amp;chs=%ux%u&amp;chl=%s/",
-		    Size,Size,Cfg_URL_SWAD_CGI) < 0)
+      if (asprintf (&URL,"%s/",
+		    Cfg_URL_SWAD_CGI) < 0)
 	 Lay_NotEnoughMemoryExit ();
      }
-   HTM_IMG (URL,NULL,Txt_Shortcut,
-	    "style=\"width:%upx;height:%upx;\"",Size,Size);
+   QR_BuildQRImageFile (URL,Size,FileName);
    free (URL);
+   HTM_IMG (Cfg_URL_QR_PUBLIC,FileName,Txt_Shortcut,
+	    "style=\"width:%upx;height:%upx;\"",Size,Size);
   }
 
 /*****************************************************************************/
@@ -162,18 +175,120 @@ void QR_ExamAnnnouncement (void)
   {
    extern const char *Txt_Link_to_announcement_of_exam;
    char *URL;
+   char FileName[NAME_MAX + 1];
 
    /***** Show QR code with direct link to the exam announcement *****/
    HTM_DIV_Begin ("class=\"CM\"");
 
-   if (asprintf (&URL,"https://chart.googleapis.com/chart?cht=qr&amp;chs=%ux%u&amp;chl=%s/?crs=%ld%%26act=%ld",
-		 300,300,
+   if (asprintf (&URL,"%s/?crs=%ld&act=%ld",
                  Cfg_URL_SWAD_CGI,Gbl.Hierarchy.Crs.CrsCod,
 		 Act_GetActCod (ActSeeAllExaAnn)) < 0)
       Lay_NotEnoughMemoryExit ();
-   HTM_IMG (URL,NULL,Txt_Link_to_announcement_of_exam,
-	    "style=\"width:250px;height:250px;\"");
+   QR_BuildQRImageFile (URL,250,FileName);
    free (URL);
+   HTM_IMG (Cfg_URL_QR_PUBLIC,FileName,Txt_Link_to_announcement_of_exam,
+	    "style=\"width:250px;height:250px;\"");
 
    HTM_DIV_End ();
   }
+
+/*****************************************************************************/
+/********** Build a data URI with the PNG image of a QR code of a text *******/
+/*****************************************************************************/
+// DataURI must be freed by the caller
+
+static void QR_BuildQRImageDataURI (const char *Text,unsigned Size,
+                                    char **DataURI)
+  {
+   static const char BinToBase64[64 + 1] =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+   static const char Prefix[] = "data:image/png;base64,";
+   FILE *FilePNG;
+   char *PNG;
+   size_t PNGSize;
+   const unsigned char *Src;
+   char *Dst;
+   size_t i;
+   unsigned long Bits;
+
+   /***** Generate PNG image in memory *****/
+   if ((FilePNG = open_memstream (&PNG,&PNGSize)) == NULL)
+      Lay_NotEnoughMemoryExit ();
+   if (!QRI_WritePNGFromText (Text,Size,FilePNG,Lay_NotEnoughMemoryExit))
+      Lay_ShowErrorAndExit ("Text too long for a QR code.");
+   fclose (FilePNG);
+
+   /***** Encode image in base64 *****/
+   if ((*DataURI = malloc (sizeof (Prefix) - 1 + (PNGSize + 2) / 3 * 4 + 1)) == NULL)
+      Lay_NotEnoughMemoryExit ();
+   memcpy (*DataURI,Prefix,sizeof (Prefix) - 1);
+   Dst = *DataURI + sizeof (Prefix) - 1;
+   for (i = 0, Src = (const unsigned char *) PNG;
+	i < PNGSize;
+	i += 3, Src += 3)
+     {
+      Bits = (unsigned long) Src[0] << 16;
+      if (i + 1 < PNGSize)
+	 Bits |= (unsigned long) Src[1] << 8;
+      if (i + 2 < PNGSize)
+	 Bits |= (unsigned long) Src[2];
+      *Dst++ = BinToBase64[(Bits >> 18) & 0x3F];
+      *Dst++ = BinToBase64[(Bits >> 12) & 0x3F];
+      *Dst++ = i + 1 < PNGSize ? BinToBase64[(Bits >> 6) & 0x3F] :
+				 '=';
+      *Dst++ = i + 2 < PNGSize ? BinToBase64[ Bits       & 0x3F] :
+				 '=';
+     }
+   *Dst = '\0';
+   free (PNG);
+  }
+
+/*****************************************************************************/
+/*********** Build a public PNG file with the QR code of a text **************/
+/*****************************************************************************/
+// Only for links to public pages, never for personal data.
+// The file is named with a hash of the text and the size,
+// so each QR code is generated only the first time it is shown,
+// and then it is served by the web server as a static file
+
+static void QR_BuildQRImageFile (const char *Text,unsigned Size,
+                                 char FileName[NAME_MAX + 1])
+  {
+   char *TextAndSize;
+   char Hash[Cry_BYTES_ENCRYPTED_STR_SHA256_BASE64 + 1];
+   char PathFilePNG[PATH_MAX + 1 + NAME_MAX + 1];
+   char PathFileTmp[PATH_MAX + 1 + NAME_MAX + 1];
+   FILE *FilePNG;
+
+   /***** Build file name from hash of text and size
+          and version of generator *****/
+   if (asprintf (&TextAndSize,"%u %s",Size,Text) < 0)
+      Lay_NotEnoughMemoryExit ();
+   Cry_EncryptSHA256Base64 (TextAndSize,Hash);
+   free (TextAndSize);
+   snprintf (FileName,NAME_MAX + 1,"%u_%s.png",(unsigned) QRI_VERSION,Hash);
+   snprintf (PathFilePNG,sizeof (PathFilePNG),"%s/%s",
+	     Cfg_PATH_QR_PUBLIC,FileName);
+
+   if (Fil_CheckIfPathExists (PathFilePNG))
+      /***** Image already generated. Update its time
+             so it is not removed while it is being shown *****/
+      utime (PathFilePNG,NULL);
+   else
+     {
+      /***** Generate image in a temporary file *****/
+      Fil_CreateDirIfNotExists (Cfg_PATH_QR_PUBLIC);
+      snprintf (PathFileTmp,sizeof (PathFileTmp),"%s/%s.tmp",
+	        Cfg_PATH_QR_PUBLIC,Gbl.UniqueNameEncrypted);
+      if ((FilePNG = fopen (PathFileTmp,"wb")) == NULL)
+	 Lay_ShowErrorAndExit ("Can not create QR code.");
+      if (!QRI_WritePNGFromText (Text,Size,FilePNG,Lay_NotEnoughMemoryExit))
+	 Lay_ShowErrorAndExit ("Text too long for a QR code.");
+      fclose (FilePNG);
+
+      /***** Rename is atomic, so the web server
+             never serves a partially written file *****/
+      if (rename (PathFileTmp,PathFilePNG))
+	 Lay_ShowErrorAndExit ("Can not rename QR code.");
+     }
+  }
@@ -0,0 +1,930 @@
+// swad_QR_image.c: generation of images of QR codes
+
+/*
+    SWAD (Shared Workspace At a Distance),
+    is a web platform developed at the University of Granada (Spain),
+    and used to support university teaching.
+
+    This file is part of SWAD core.
+    Copyright (C) 1999-2021 Antonio Caas Vargas
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as
+    published by the Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.
+
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/*****************************************************************************/
+/********************************* Headers ***********************************/
+/*****************************************************************************/
+
+#include <stdbool.h>		// For boolean type
+#include <stdio.h>		// For FILE
+#include <stdlib.h>		// For malloc, free
+#include <string.h>		// For memset, strlen
+#include <zlib.h>		// For compress2, crc32
+
+#include "swad_QR_image.h"
+
+/*****************************************************************************/
+/*
+   QR codes (ISO/IEC 18004) are encoded with the text in byte mode
+   (ISO-8859-1, the encoding of texts in swad)
+   and with error correction level M (about 15% of codewords can be restored).
+   The smallest version (1 to 40) in which the text fits is used,
+   and the mask with the lowest penalty is chosen.
+   The image is a black and white PNG with a quiet zone of 4 modules.
+   The generation does not depend on other modules of swad.
+*/
+/*****************************************************************************/
+
+/*****************************************************************************/
+/***************************** Private constants *****************************/
+/*****************************************************************************/
+
+#define QRI_MAX_VERSION		40
+#define QRI_MAX_SIZE		(17 + 4 * QRI_MAX_VERSION)	// Modules per side
+#define QRI_MAX_CODEWORDS	3706	// Data and error correction codewords in version 40
+#define QRI_MAX_ECC_PER_BLOCK	  30	// Maximum error correction codewords per block
+
+#define QRI_QUIET_ZONE		   4	// Light modules around the symbol
+#define QRI_NUM_MASKS		   8
+
+#define QRI_MODE_BYTE		 0x4	// Mode indicator of byte mode
+#define QRI_ECC_LEVEL_M		 0x0	// Bits of level M in format information
+
+/* Penalties to choose mask */
+#define QRI_PENALTY_N1		   3	// Run of 5 modules of the same colour
+#define QRI_PENALTY_N2		   3	// Block of 2x2 modules of the same colour
+#define QRI_PENALTY_N3		  40	// Pattern similar to finder
+#define QRI_PENALTY_N4		  10	// Each 5% of deviation from 50% dark modules
+
+/* Error correction codewords per block with level M, for each version */
+static const unsigned char QRI_ECCCodewordsPerBlock[1 + QRI_MAX_VERSION] =
+  {
+    0,
+   10,16,26,18,24,16,18,22,22,26,	//  1-10
+   30,22,22,24,24,28,28,26,26,26,	// 11-20
+   26,28,28,28,28,28,28,28,28,28,	// 21-30
+   28,28,28,28,28,28,28,28,28,28,	// 31-40
+  };
+
+/* Number of error correction blocks with level M, for each version */
+static const unsigned char QRI_NumBlocks[1 + QRI_MAX_VERSION] =
+  {
+    0,
+    1, 1, 1, 2, 2, 4, 4, 4, 5, 5,	//  1-10
+    5, 8, 9, 9,10,10,11,13,14,16,	// 11-20
+   17,17,18,20,21,23,25,26,28,29,	// 21-30
+   31,33,35,37,38,40,43,45,47,49,	// 31-40
+  };
+
+/*****************************************************************************/
+/******************************* Private types *******************************/
+/*****************************************************************************/
+
+struct QRI_QRCode
+  {
+   unsigned Version;
+   unsigned Size;					// Modules per side
+   bool Dark[QRI_MAX_SIZE][QRI_MAX_SIZE];		// [y][x]
+   bool IsFunction[QRI_MAX_SIZE][QRI_MAX_SIZE];		// [y][x] Not data
+  };
+
+/*****************************************************************************/
+/************************** Private global variables *************************/
+/*****************************************************************************/
+
+static void (*QRI_NotEnoughMemoryExit) (void);	// Called if no memory, must not return
+
+/*****************************************************************************/
+/***************************** Private prototypes ****************************/
+/*****************************************************************************/
+
+static unsigned QRI_GetNumRawCodewords (unsigned Version);
+static unsigned QRI_GetNumDataCodewords (unsigned Version);
+static unsigned QRI_GetNumBitsCharCount (unsigned Version);
+static void QRI_AppendBits (unsigned char *Codewords,unsigned *NumBits,
+                            unsigned Value,unsigned NumBitsValue);
+
+static void QRI_AddECCAndInterleave (unsigned Version,
+                                     const unsigned char *Data,
+                                     unsigned char *Codewords);
+static unsigned char QRI_GFMultiply (unsigned char x,unsigned char y);
+static void QRI_ComputeRSGenerator (unsigned Degree,unsigned char *Generator);
+static void QRI_ComputeRSRemainder (const unsigned char *Data,unsigned Len,
+                                    const unsigned char *Generator,
+                                    unsigned Degree,unsigned char *Remainder);
+
+static void QRI_SetFunctionModule (struct QRI_QRCode *QR,
+                                   unsigned x,unsigned y,bool Dark);
+static void QRI_DrawFunctionPatterns (struct QRI_QRCode *QR);
+static void QRI_DrawFinderPattern (struct QRI_QRCode *QR,int x,int y);
+static void QRI_DrawAlignmentPattern (struct QRI_QRCode *QR,int x,int y);
+static unsigned QRI_GetAlignmentPositions (unsigned Version,unsigned *Positions);
+static void QRI_DrawFormatBits (struct QRI_QRCode *QR,unsigned Mask);
+static void QRI_DrawVersionBits (struct QRI_QRCode *QR);
+static void QRI_DrawCodewords (struct QRI_QRCode *QR,
+                               const unsigned char *Codewords,unsigned Len);
+
+static void QRI_ApplyMask (struct QRI_QRCode *QR,unsigned Mask);
+static unsigned QRI_GetPenalty (const struct QRI_QRCode *QR);
+static bool QRI_GetModule (const struct QRI_QRCode *QR,
+                           bool Vertical,unsigned Line,unsigned Pos);
+
+static void QRI_WritePNG (const struct QRI_QRCode *QR,unsigned SizePx,
+                          FILE *FilePNG);
+static void QRI_WritePNGChunk (FILE *FilePNG,const char *Type,
+                               const unsigned char *Data,unsigned long Len);
+static void QRI_WriteUint32 (FILE *FilePNG,unsigned long Value);
+
+/*****************************************************************************/
+/******** Write a PNG image with the QR code of a text (byte string) *********/
+/*****************************************************************************/
+// SizePx is the approximate width and height in pixels of the image.
+// Return false if the text is too long to be encoded.
+
+bool QRI_WritePNGFromText (const char *Text,unsigned SizePx,FILE *FilePNG,
+                           void (*NotEnoughMemoryExit) (void))
+  {
+   struct QRI_QRCode *QR;
+   unsigned Len = strlen (Text);
+   unsigned Version;
+   unsigned NumDataCodewords;
+   unsigned NumBits;
+   unsigned char Data[QRI_MAX_CODEWORDS];
+   unsigned char Codewords[QRI_MAX_CODEWORDS];
+   unsigned i;
+   unsigned char Pad;
+   unsigned Mask;
+   unsigned BestMask;
+   unsigned Penalty;
+   unsigned MinPenalty;
+
+   /***** Set function to be called if no memory *****/
+   QRI_NotEnoughMemoryExit = NotEnoughMemoryExit;
+
+   /***** Get the smallest version in which the text fits *****/
+   for (Version = 1;
+	Version <= QRI_MAX_VERSION;
+	Version++)
+      if (4 + QRI_GetNumBitsCharCount (Version) + 8 * Len <=
+	  8 * QRI_GetNumDataCodewords (Version))
+	 break;
+   if (Version > QRI_MAX_VERSION)
+      return false;	// Text too long
+   NumDataCodewords = QRI_GetNumDataCodewords (Version);
+
+   /***** Encode text in data codewords *****/
+   memset (Data,0,sizeof (Data));
+   NumBits = 0;
+   QRI_AppendBits (Data,&NumBits,QRI_MODE_BYTE,4);
+   QRI_AppendBits (Data,&NumBits,Len,QRI_GetNumBitsCharCount (Version));
+   for (i = 0;
+	i < Len;
+	i++)
+      QRI_AppendBits (Data,&NumBits,(unsigned char) Text[i],8);
+
+   /* Terminator (up to 4 zero bits) and bits up to a byte boundary,
+      already zero in data */
+   NumBits += 4;
+   if (NumBits > 8 * NumDataCodewords)
+      NumBits = 8 * NumDataCodewords;
+   NumBits = (NumBits + 7) / 8 * 8;
+
+   /* Pad codewords alternating 0xEC and 0x11 */
+   for (i = NumBits / 8, Pad = 0xEC;
+	i < NumDataCodewords;
+	i++, Pad ^= 0xEC ^ 0x11)
+      Data[i] = Pad;
+
+   /***** Add error correction codewords *****/
+   QRI_AddECCAndInterleave (Version,Data,Codewords);
+
+   /***** Draw modules *****/
+   if ((QR = malloc (sizeof (struct QRI_QRCode))) == NULL)
+      QRI_NotEnoughMemoryExit ();
+   memset (QR,0,sizeof (struct QRI_QRCode));
+   QR->Version = Version;
+   QR->Size = 17 + 4 * Version;
+   QRI_DrawFunctionPatterns (QR);
+   QRI_DrawCodewords (QR,Codewords,QRI_GetNumRawCodewords (Version));
+
+   /***** Choose mask with lowest penalty *****/
+   for (Mask = 0, BestMask = 0, MinPenalty = (unsigned) -1;
+	Mask < QRI_NUM_MASKS;
+	Mask++)
+     {
+      QRI_ApplyMask (QR,Mask);
+      QRI_DrawFormatBits (QR,Mask);
+      if ((Penalty = QRI_GetPenalty (QR)) < MinPenalty)
+	{
+	 MinPenalty = Penalty;
+	 BestMask = Mask;
+	}
+      QRI_ApplyMask (QR,Mask);	// Undo mask (XOR)
+     }
+   QRI_ApplyMask (QR,BestMask);
+   QRI_DrawFormatBits (QR,BestMask);
+
+   /***** Write image *****/
+   QRI_WritePNG (QR,SizePx,FilePNG);
+
+   free (QR);
+   return true;
+  }
+
+/*****************************************************************************/
+/************ Get number of codewords (data and ECC) of a version ************/
+/*****************************************************************************/
+
+static unsigned QRI_GetNumRawCodewords (unsigned Version)
+  {
+   unsigned NumModules = (16 * Version + 128) * Version + 64;
+   unsigned NumAlign;
+
+   if (Version >= 2)
+     {
+      NumAlign = Version / 7 + 2;
+      NumModules -= (25 * NumAlign - 10) * NumAlign - 55;
+      if (Version >= 7)
+	 NumModules -= 36;	// Version information
+     }
+   return NumModules / 8;	// Remainder bits are not used
+  }
+
+/*****************************************************************************/
+/************** Get number of data codewords of a version ********************/
+/*****************************************************************************/
+
+static unsigned QRI_GetNumDataCodewords (unsigned Version)
+  {
+   return QRI_GetNumRawCodewords (Version) -
+	  (unsigned) QRI_ECCCodewordsPerBlock[Version] *
+	  (unsigned) QRI_NumBlocks[Version];
+  }
+
+/*****************************************************************************/
+/******* Get number of bits of character count in byte mode of a version *****/
+/*****************************************************************************/
+
+static unsigned QRI_GetNumBitsCharCount (unsigned Version)
+  {
+   return Version <= 9 ? 8 :
+			 16;
+  }
+
+/*****************************************************************************/
+/************ Append the lowest bits of a value to the codewords *************/
+/*****************************************************************************/
+
+static void QRI_AppendBits (unsigned char *Codewords,unsigned *NumBits,
+                            unsigned Value,unsigned NumBitsValue)
+  {
+   int i;
+
+   for (i = (int) NumBitsValue - 1;
+	i >= 0;
+	i--, (*NumBits)++)
+      if ((Value >> i) & 1)
+	 Codewords[*NumBits >> 3] |= 0x80 >> (*NumBits & 7);
+  }
+
+/*****************************************************************************/
+/***** Split data in blocks, add error correction and interleave blocks ******/
+/*****************************************************************************/
+
+static void QRI_AddECCAndInterleave (unsigned Version,
+                                     const unsigned char *Data,
+                                     unsigned char *Codewords)
+  {
+   unsigned NumBlocks = QRI_NumBlocks[Version];
+   unsigned NumECCPerBlock = QRI_ECCCodewordsPerBlock[Version];
+   unsigned NumRawCodewords = QRI_GetNumRawCodewords (Version);
+   unsigned NumShortBlocks = NumBlocks - NumRawCodewords % NumBlocks;
+   unsigned NumDataShortBlock = NumRawCodewords / NumBlocks - NumECCPerBlock;
+   unsigned char Generator[QRI_MAX_ECC_PER_BLOCK];
+   unsigned char ECC[QRI_MAX_CODEWORDS];
+   unsigned NumBlock;
+   unsigned NumData;
+   unsigned Start;
+   unsigned i;
+   unsigned k;
+
+   /***** Compute error correction codewords of each block.
+	  First blocks are short, last blocks have one more data codeword *****/
+   QRI_ComputeRSGenerator (NumECCPerBlock,Generator);
+   for (NumBlock = 0, Start = 0;
+	NumBlock < NumBlocks;
+	NumBlock++, Start += NumData)
+     {
+      NumData = NumDataShortBlock + (NumBlock < NumShortBlocks ? 0 :
+							         1);
+      QRI_ComputeRSRemainder (&Data[Start],NumData,
+                              Generator,NumECCPerBlock,
+                              &ECC[NumBlock * NumECCPerBlock]);
+     }
+
+   /***** Interleave data codewords of all blocks *****/
+   for (i = 0, k = 0;
+	i <= NumDataShortBlock;
+	i++)
+      for (NumBlock = 0, Start = 0;
+	   NumBlock < NumBlocks;
+	   NumBlock++)
+	{
+	 NumData = NumDataShortBlock + (NumBlock < NumShortBlocks ? 0 :
+								    1);
+	 if (i < NumData)
+	    Codewords[k++] = Data[Start + i];
+	 Start += NumData;
+	}
+
+   /***** Interleave error correction codewords of all blocks *****/
+   for (i = 0;
+	i < NumECCPerBlock;
+	i++)
+      for (NumBlock = 0;
+	   NumBlock < NumBlocks;
+	   NumBlock++)
+	 Codewords[k++] = ECC[NumBlock * NumECCPerBlock + i];
+  }
+
+/*****************************************************************************/
+/*************** Multiply in Galois field GF(2^8) mod 0x11D ******************/
+/*****************************************************************************/
+
+static unsigned char QRI_GFMultiply (unsigned char x,unsigned char y)
+  {
+   unsigned z = 0;
+   int i;
+
+   for (i = 7;
+	i >= 0;
+	i--)
+     {
+      z = (z << 1) ^ ((z >> 7) * 0x11D);
+      z ^= ((y >> i) & 1) * x;
+     }
+   return (unsigned char) z;
+  }
+
+/*****************************************************************************/
+/********** Compute Reed-Solomon generator polynomial of a degree ************/
+/*****************************************************************************/
+// Coefficients from highest to lowest power, except the leading 1
+
+static void QRI_ComputeRSGenerator (unsigned Degree,unsigned char *Generator)
+  {
+   unsigned char Root = 1;
+   unsigned i;
+   unsigned j;
+
+   /***** Start with the monomial x^0 *****/
+   memset (Generator,0,Degree);
+   Generator[Degree - 1] = 1;
+
+   /***** Multiply by (x - r^0) (x - r^1) ... (x - r^(Degree-1)) *****/
+   for (i = 0;
+	i < Degree;
+	i++)
+     {
+      for (j = 0;
+	   j < Degree;
+	   j++)
+	{
+	 Generator[j] = QRI_GFMultiply (Generator[j],Root);
+	 if (j + 1 < Degree)
+	    Generator[j] ^= Generator[j + 1];
+	}
+      Root = QRI_GFMultiply (Root,0x02);
+     }
+  }
+
+/*****************************************************************************/
+/******** Compute Reed-Solomon error correction codewords of a block *********/
+/*****************************************************************************/
+
+static void QRI_ComputeRSRemainder (const unsigned char *Data,unsigned Len,
+                                    const unsigned char *Generator,
+                                    unsigned Degree,unsigned char *Remainder)
+  {
+   unsigned i;
+   unsigned j;
+   unsigned char Factor;
+
+   memset (Remainder,0,Degree);
+   for (i = 0;
+	i < Len;
+	i++)
+     {
+      Factor = Data[i] ^ Remainder[0];
+      memmove (&Remainder[0],&Remainder[1],Degree - 1);
+      Remainder[Degree - 1] = 0;
+      for (j = 0;
+	   j < Degree;
+	   j++)
+	 Remainder[j] ^= QRI_GFMultiply (Generator[j],Factor);
+     }
+  }
+
+/*****************************************************************************/
+/******************** Set a module that is not for data **********************/
+/*****************************************************************************/
+
+static void QRI_SetFunctionModule (struct QRI_QRCode *QR,
+                                   unsigned x,unsigned y,bool Dark)
+  {
+   QR->Dark[y][x] = Dark;
+   QR->IsFunction[y][x] = true;
+  }
+
+/*****************************************************************************/
+/********* Draw finder, timing, alignment and information patterns ***********/
+/*****************************************************************************/
+
+static void QRI_DrawFunctionPatterns (struct QRI_QRCode *QR)
+  {
+   unsigned i;
+   unsigned j;
+   unsigned Positions[7];
+   unsigned NumAlign;
+
+   /***** Timing patterns *****/
+   for (i = 0;
+	i < QR->Size;
+	i++)
+     {
+      QRI_SetFunctionModule (QR,6,i,i % 2 == 0);
+      QRI_SetFunctionModule (QR,i,6,i % 2 == 0);
+     }
+
+   /***** Finder patterns with their separators, on three corners *****/
+   QRI_DrawFinderPattern (QR,3,3);
+   QRI_DrawFinderPattern (QR,(int) QR->Size - 4,3);
+   QRI_DrawFinderPattern (QR,3,(int) QR->Size - 4);
+
+   /***** Alignment patterns, except over finder patterns *****/
+   NumAlign = QRI_GetAlignmentPositions (QR->Version,Positions);
+   for (i = 0;
+	i < NumAlign;
+	i++)
+      for (j = 0;
+	   j < NumAlign;
+	   j++)
+	 if (!((i == 0 && j == 0) ||
+	       (i == 0 && j == NumAlign - 1) ||
+	       (i == NumAlign - 1 && j == 0)))
+	    QRI_DrawAlignmentPattern (QR,(int) Positions[i],(int) Positions[j]);
+
+   /***** Reserve format information (drawn later with mask) *****/
+   QRI_DrawFormatBits (QR,0);
+
+   /***** Version information *****/
+   QRI_DrawVersionBits (QR);
+  }
+
+/*****************************************************************************/
+/********** Draw a finder pattern and its separator around a center **********/
+/*****************************************************************************/
+
+static void QRI_DrawFinderPattern (struct QRI_QRCode *QR,int x,int y)
+  {
+   int dx;
+   int dy;
+   int Dist;
+
+   for (dy = -4;
+	dy <= 4;
+	dy++)
+      for (dx = -4;
+	   dx <= 4;
+	   dx++)
+	 if (x + dx >= 0 && x + dx < (int) QR->Size &&
+	     y + dy >= 0 && y + dy < (int) QR->Size)
+	   {
+	    Dist = abs (dx) > abs (dy) ? abs (dx) :
+					 abs (dy);	// Chebyshev distance
+	    QRI_SetFunctionModule (QR,x + dx,y + dy,Dist != 2 && Dist != 4);
+	   }
+  }
+
+/*****************************************************************************/
+/******************* Draw an alignment pattern around a center ***************/
+/*****************************************************************************/
+
+static void QRI_DrawAlignmentPattern (struct QRI_QRCode *QR,int x,int y)
+  {
+   int dx;
+   int dy;
+
+   for (dy = -2;
+	dy <= 2;
+	dy++)
+      for (dx = -2;
+	   dx <= 2;
+	   dx++)
+	 QRI_SetFunctionModule (QR,x + dx,y + dy,
+				abs (dx) == 2 || abs (dy) == 2 ||
+				(dx == 0 && dy == 0));
+  }
+
+/*****************************************************************************/
+/****** Get coordinates of centers of alignment patterns of a version ********/
+/*****************************************************************************/
+// Return the number of positions (0 or 2 to 7)
+
+static unsigned QRI_GetAlignmentPositions (unsigned Version,unsigned *Positions)
+  {
+   unsigned NumAlign;
+   unsigned Step;
+   unsigned Pos;
+   unsigned i;
+
+   if (Version == 1)
+      return 0;
+
+   NumAlign = Version / 7 + 2;
+   Step = (Version == 32) ? 26 :
+			    (Version * 4 + NumAlign * 2 + 1) / (NumAlign * 2 - 2) * 2;
+   Positions[0] = 6;
+   for (i = NumAlign - 1, Pos = 17 + 4 * Version - 7;
+	i >= 1;
+	i--, Pos -= Step)
+      Positions[i] = Pos;
+
+   return NumAlign;
+  }
+
+/*****************************************************************************/
+/*** Draw format information (level of error correction and mask), twice *****/
+/*****************************************************************************/
+
+static void QRI_DrawFormatBits (struct QRI_QRCode *QR,unsigned Mask)
+  {
+   unsigned Data = QRI_ECC_LEVEL_M << 3 | Mask;
+   unsigned Rem = Data;
+   unsigned Bits;
+   unsigned i;
+
+   /***** BCH code (15,5) *****/
+   for (i = 0;
+	i < 10;
+	i++)
+      Rem = (Rem << 1) ^ ((Rem >> 9) * 0x537);
+   Bits = (Data << 10 | Rem) ^ 0x5412;
+
+   /***** First copy, around top left finder *****/
+   for (i = 0;
+	i <= 5;
+	i++)
+      QRI_SetFunctionModule (QR,8,i,(Bits >> i) & 1);
+   QRI_SetFunctionModule (QR,8,7,(Bits >> 6) & 1);
+   QRI_SetFunctionModule (QR,8,8,(Bits >> 7) & 1);
+   QRI_SetFunctionModule (QR,7,8,(Bits >> 8) & 1);
+   for (i = 9;
+	i < 15;
+	i++)
+      QRI_SetFunctionModule (QR,14 - i,8,(Bits >> i) & 1);
+
+   /***** Second copy, split between top right and bottom left finders *****/
+   for (i = 0;
+	i < 8;
+	i++)
+      QRI_SetFunctionModule (QR,QR->Size - 1 - i,8,(Bits >> i) & 1);
+   for (i = 8;
+	i < 15;
+	i++)
+      QRI_SetFunctionModule (QR,8,QR->Size - 15 + i,(Bits >> i) & 1);
+
+   /***** Module always dark *****/
+   QRI_SetFunctionModule (QR,8,QR->Size - 8,true);
+  }
+
+/*****************************************************************************/
+/************* Draw version information (versions 7 and above) ***************/
+/*****************************************************************************/
+
+static void QRI_DrawVersionBits (struct QRI_QRCode *QR)
+  {
+   unsigned Rem = QR->Version;
+   unsigned Bits;
+   unsigned i;
+   bool Dark;
+
+   if (QR->Version < 7)
+      return;
+
+   /***** BCH code (18,6) *****/
+   for (i = 0;
+	i < 12;
+	i++)
+      Rem = (Rem << 1) ^ ((Rem >> 11) * 0x1F25);
+   Bits = QR->Version << 12 | Rem;
+
+   /***** Two copies, near top right and bottom left finders *****/
+   for (i = 0;
+	i < 18;
+	i++)
+     {
+      Dark = (Bits >> i) & 1;
+      QRI_SetFunctionModule (QR,QR->Size - 11 + i % 3,i / 3,Dark);
+      QRI_SetFunctionModule (QR,i / 3,QR->Size - 11 + i % 3,Dark);
+     }
+  }
+
+/*****************************************************************************/
+/********* Draw codewords in data modules, in zigzag from bottom right *******/
+/*****************************************************************************/
+
+static void QRI_DrawCodewords (struct QRI_QRCode *QR,
+                               const unsigned char *Codewords,unsigned Len)
+  {
+   unsigned NumBit = 0;
+   int Right;
+   unsigned Vert;
+   unsigned j;
+   unsigned x;
+   unsigned y;
+   bool Upward;
+
+   /***** Pairs of columns from right to left *****/
+   for (Right = (int) QR->Size - 1;
+	Right >= 1;
+	Right -= 2)
+     {
+      if (Right == 6)	// Skip vertical timing pattern
+	 Right = 5;
+      Upward = ((Right + 1) & 2) == 0;
+      for (Vert = 0;
+	   Vert < QR->Size;
+	   Vert++)
+	 for (j = 0;
+	      j < 2;
+	      j++)
+	   {
+	    x = (unsigned) Right - j;
+	    y = Upward ? QR->Size - 1 - Vert :
+			 Vert;
+	    if (!QR->IsFunction[y][x] && NumBit < Len * 8)
+	      {
+	       QR->Dark[y][x] = (Codewords[NumBit >> 3] >> (7 - (NumBit & 7))) & 1;
+	       NumBit++;
+	      }
+	    // Remainder bits are left light
+	   }
+     }
+  }
+
+/*****************************************************************************/
+/************** Apply (or undo, as it is XOR) a mask to data modules *********/
+/*****************************************************************************/
+
+static void QRI_ApplyMask (struct QRI_QRCode *QR,unsigned Mask)
+  {
+   unsigned x;
+   unsigned y;
+   bool Invert;
+
+   for (y = 0;
+	y < QR->Size;
+	y++)
+      for (x = 0;
+	   x < QR->Size;
+	   x++)
+	 if (!QR->IsFunction[y][x])
+	   {
+	    switch (Mask)
+	      {
+	       case 0:  Invert = (x + y) % 2 == 0;			break;
+	       case 1:  Invert = y % 2 == 0;				break;
+	       case 2:  Invert = x % 3 == 0;				break;
+	       case 3:  Invert = (x + y) % 3 == 0;			break;
+	       case 4:  Invert = (x / 3 + y / 2) % 2 == 0;		break;
+	       case 5:  Invert = x * y % 2 + x * y % 3 == 0;		break;
+	       case 6:  Invert = (x * y % 2 + x * y % 3) % 2 == 0;	break;
+	       default: Invert = ((x + y) % 2 + x * y % 3) % 2 == 0;	break;
+	      }
+	    QR->Dark[y][x] ^= Invert;
+	   }
+  }
+
+/*****************************************************************************/
+/************* Compute penalty of the modules with a mask applied ************/
+/*****************************************************************************/
+
+static unsigned QRI_GetPenalty (const struct QRI_QRCode *QR)
+  {
+   static const bool Finder[7] = {true,false,true,true,true,false,true};
+   unsigned Penalty = 0;
+   unsigned Vertical;
+   unsigned Line;
+   unsigned Pos;
+   unsigned Run;
+   unsigned i;
+   bool Match;
+   bool LightBefore;
+   bool LightAfter;
+   unsigned x;
+   unsigned y;
+   unsigned NumDark = 0;
+   unsigned Total = QR->Size * QR->Size;
+   unsigned Deviation;
+
+   for (Vertical = 0;
+	Vertical <= 1;
+	Vertical++)
+      for (Line = 0;
+	   Line < QR->Size;
+	   Line++)
+	{
+	 /***** N1: runs of 5 or more modules of the same colour *****/
+	 for (Pos = 0, Run = 1;
+	      Pos < QR->Size;
+	      Pos++)
+	    if (Pos + 1 < QR->Size &&
+		QRI_GetModule (QR,Vertical,Line,Pos + 1) ==
+		QRI_GetModule (QR,Vertical,Line,Pos))
+	       Run++;
+	    else
+	      {
+	       if (Run >= 5)
+		  Penalty += QRI_PENALTY_N1 + Run - 5;
+	       Run = 1;
+	      }
+
+	 /***** N3: 1:1:3:1:1 pattern with 4 light modules on a side *****/
+	 for (Pos = 0;
+	      Pos + 7 <= QR->Size;
+	      Pos++)
+	   {
+	    for (i = 0, Match = true;
+		 i < 7 && Match;
+		 i++)
+	       Match = QRI_GetModule (QR,Vertical,Line,Pos + i) == Finder[i];
+	    if (Match)
+	      {
+	       // Modules out of the symbol belong to the quiet zone (light)
+	       for (i = 1, LightBefore = true, LightAfter = true;
+		    i <= 4;
+		    i++)
+		 {
+		  if (Pos >= i)
+		     LightBefore &= !QRI_GetModule (QR,Vertical,Line,Pos - i);
+		  if (Pos + 6 + i < QR->Size)
+		     LightAfter &= !QRI_GetModule (QR,Vertical,Line,Pos + 6 + i);
+		 }
+	       if (LightBefore || LightAfter)
+		  Penalty += QRI_PENALTY_N3;
+	      }
+	   }
+	}
+
+   for (y = 0;
+	y < QR->Size;
+	y++)
+      for (x = 0;
+	   x < QR->Size;
+	   x++)
+	{
+	 /***** N2: blocks of 2x2 modules of the same colour *****/
+	 if (x + 1 < QR->Size && y + 1 < QR->Size &&
+	     QR->Dark[y][x] == QR->Dark[y][x + 1] &&
+	     QR->Dark[y][x] == QR->Dark[y + 1][x] &&
+	     QR->Dark[y][x] == QR->Dark[y + 1][x + 1])
+	    Penalty += QRI_PENALTY_N2;
+
+	 if (QR->Dark[y][x])
+	    NumDark++;
+	}
+
+   /***** N4: proportion of dark modules far from 50% *****/
+   Deviation = NumDark * 20 > Total * 10 ? NumDark * 20 - Total * 10 :
+					   Total * 10 - NumDark * 20;
+   Penalty += QRI_PENALTY_N4 * (Deviation / Total);	// Each 5%
+
+   return Penalty;
+  }
+
+/*****************************************************************************/
+/************ Get a module of a row (horizontal) or column (vertical) ********/
+/*****************************************************************************/
+
+static bool QRI_GetModule (const struct QRI_QRCode *QR,
+                           bool Vertical,unsigned Line,unsigned Pos)
+  {
+   return Vertical ? QR->Dark[Pos][Line] :
+		     QR->Dark[Line][Pos];
+  }
+
+/*****************************************************************************/
+/********************* Write a QR code as a PNG image ************************/
+/*****************************************************************************/
+// Greyscale with 1 bit per pixel (0 = black, 1 = white)
+
+static void QRI_WritePNG (const struct QRI_QRCode *QR,unsigned SizePx,
+                          FILE *FilePNG)
+  {
+   static const unsigned char Signature[8] = {0x89,'P','N','G','\r','\n',0x1A,'\n'};
+   unsigned NumModules = QR->Size + 2 * QRI_QUIET_ZONE;
+   unsigned Scale = SizePx / NumModules ? SizePx / NumModules :
+					  1;	// Pixels per module
+   unsigned Width = NumModules * Scale;
+   unsigned long BytesPerRow = 1 + (Width + 7) / 8;	// Filter type and pixels
+   unsigned long RawLen = BytesPerRow * Width;
+   unsigned long CompressedLen = compressBound (RawLen);
+   unsigned char *Raw;
+   unsigned char *Compressed;
+   unsigned char *Row;
+   unsigned char IHDR[13];
+   unsigned PixelX;
+   unsigned PixelY;
+   int x;
+   int y;
+
+   /***** Build rows of pixels *****/
+   if ((Raw = malloc (RawLen)) == NULL ||
+       (Compressed = malloc (CompressedLen)) == NULL)
+      QRI_NotEnoughMemoryExit ();
+   for (PixelY = 0, Row = Raw;
+	PixelY < Width;
+	PixelY++, Row += BytesPerRow)
+     {
+      memset (Row,0xFF,BytesPerRow);	// White
+      Row[0] = 0;			// Filter type None
+      y = (int) (PixelY / Scale) - QRI_QUIET_ZONE;
+      if (y >= 0 && y < (int) QR->Size)
+	 for (PixelX = 0;
+	      PixelX < Width;
+	      PixelX++)
+	   {
+	    x = (int) (PixelX / Scale) - QRI_QUIET_ZONE;
+	    if (x >= 0 && x < (int) QR->Size)
+	       if (QR->Dark[y][x])
+		  Row[1 + PixelX / 8] &= (unsigned char) ~(0x80 >> (PixelX % 8));
+	   }
+     }
+
+   /***** Compress pixels *****/
+   if (compress2 (Compressed,&CompressedLen,Raw,RawLen,Z_BEST_COMPRESSION) != Z_OK)
+      QRI_NotEnoughMemoryExit ();
+   free (Raw);
+
+   /***** Write signature and chunks *****/
+   fwrite (Signature,1,sizeof (Signature),FilePNG);
+
+   IHDR[ 0] = (unsigned char) (Width >> 24);
+   IHDR[ 1] = (unsigned char) (Width >> 16);
+   IHDR[ 2] = (unsigned char) (Width >>  8);
+   IHDR[ 3] = (unsigned char)  Width;
+   memcpy (&IHDR[4],&IHDR[0],4);	// Height = width
+   IHDR[ 8] = 1;	// Bit depth
+   IHDR[ 9] = 0;	// Colour type greyscale
+   IHDR[10] = 0;	// Compression method deflate
+   IHDR[11] = 0;	// Filter method
+   IHDR[12] = 0;	// No interlace
+   QRI_WritePNGChunk (FilePNG,"IHDR",IHDR,sizeof (IHDR));
+   QRI_WritePNGChunk (FilePNG,"IDAT",Compressed,CompressedLen);
+   QRI_WritePNGChunk (FilePNG,"IEND",NULL,0);
+
+   free (Compressed);
+  }
+
+/*****************************************************************************/
+/******************* Write a chunk of PNG with its CRC ***********************/
+/*****************************************************************************/
+
+static void QRI_WritePNGChunk (FILE *FilePNG,const char *Type,
+                               const unsigned char *Data,unsigned long Len)
+  {
+   unsigned long CRC;
+
+   CRC = crc32 (0L,(const Bytef *) Type,4);
+   if (Len)
+      CRC = crc32 (CRC,Data,Len);
+
+   QRI_WriteUint32 (FilePNG,Len);
+   fwrite (Type,1,4,FilePNG);
+   if (Len)
+      fwrite (Data,1,Len,FilePNG);
+   QRI_WriteUint32 (FilePNG,CRC);
+  }
+
+/*****************************************************************************/
+/********************* Write a 32-bit big-endian number **********************/
+/*****************************************************************************/
+
+static void QRI_WriteUint32 (FILE *FilePNG,unsigned long Value)
+  {
+   fputc ((int) ((Value >> 24) & 0xFF),FilePNG);
+   fputc ((int) ((Value >> 16) & 0xFF),FilePNG);
+   fputc ((int) ((Value >>  8) & 0xFF),FilePNG);
+   fputc ((int) ( Value        & 0xFF),FilePNG);
+  }
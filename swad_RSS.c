@@ -27,9 +27,12 @@
 
 #include <linux/limits.h>	// For PATH_MAX
 #include <stddef.h>		// For NULL
+#include <stdio.h>		// For open_memstream, rename
+#include <stdlib.h>		// For free
 #include <string.h>
 
 #include "swad_changelog.h"
+#include "swad_cryptography.h"
 #include "swad_database.h"
 #include "swad_exam_announcement.h"
 #include "swad_global.h"
@@ -50,30 +53,128 @@ extern struct Globals Gbl;
 /***************************** Private prototypes ****************************/
 /*****************************************************************************/
 
+static void RSS_WriteChannel (FILE *FileRSS,struct Crs_Course *Crs);
 static void RSS_WriteNotices (FILE *FileRSS,struct Crs_Course *Crs);
 static void RSS_WriteExamAnnouncements (FILE *FileRSS,struct Crs_Course *Crs);
+static bool RSS_CheckIfETagIsStored (long CrsCod,
+                                     const char ETag[Cry_BYTES_ENCRYPTED_STR_SHA256_BASE64 + 1]);
+
+/*****************************************************************************/
+/************ Mark RSS file of a course as changed, to update it *************/
+/*****************************************************************************/
+// The RSS file is not written here, but later by RSS_UpdateChangedRSSFiles,
+// so several changes in a short time cause only one update of the file
+
+void RSS_MarkRSSFileForACrsAsChanged (long CrsCod)
+  {
+   DB_QueryINSERT ("can not mark RSS file as changed",
+		   "INSERT INTO crs_rss"
+		   " (CrsCod,Changed,BuildTime,ETag,ModifTime)"
+		   " VALUES"
+		   " (%ld,'Y',FROM_UNIXTIME(0),'',FROM_UNIXTIME(0))"
+		   " ON DUPLICATE KEY UPDATE Changed='Y'",
+		   CrsCod);
+  }
+
+/*****************************************************************************/
+/********** Update RSS files of courses marked as changed, if any ************/
+/*****************************************************************************/
+// A file is updated at most once every Cfg_TIME_TO_UPDATE_RSS seconds
+
+void RSS_UpdateChangedRSSFiles (void)
+  {
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   unsigned NumCrss;
+   unsigned NumCrs;
+   struct Crs_Course Crs;
+
+   /***** Get courses with RSS file changed and not updated recently *****/
+   NumCrss = (unsigned)
+   DB_QuerySELECT (&mysql_res,"can not get courses with RSS file changed",
+		   "SELECT CrsCod FROM crs_rss"
+		   " WHERE Changed='Y'"
+		   " AND BuildTime<=FROM_UNIXTIME(%ld)",
+		   (long) (Gbl.StartExecutionTimeUTC - Cfg_TIME_TO_UPDATE_RSS));
+
+   for (NumCrs = 0;
+	NumCrs < NumCrss;
+	NumCrs++)
+     {
+      row = mysql_fetch_row (mysql_res);
+      Crs.CrsCod = Str_ConvertStrCodToLongCod (row[0]);
+
+      /***** Clear mark before updating the file,
+             so a change made while it is written is not lost.
+             If another process has cleared it first, do not update *****/
+      DB_QueryUPDATE ("can not clear mark of RSS file changed",
+		      "UPDATE crs_rss SET Changed='N',BuildTime=NOW()"
+		      " WHERE CrsCod=%ld AND Changed='Y'"
+		      " AND BuildTime<=FROM_UNIXTIME(%ld)",
+		      Crs.CrsCod,
+		      (long) (Gbl.StartExecutionTimeUTC - Cfg_TIME_TO_UPDATE_RSS));
+      if (mysql_affected_rows (&Gbl.mysql))
+	{
+	 if (Crs_GetDataOfCourseByCod (&Crs))
+	    RSS_UpdateRSSFileForACrs (&Crs);
+	 else
+	    DB_QueryDELETE ("can not remove RSS file of a course",
+			    "DELETE FROM crs_rss WHERE CrsCod=%ld",
+			    Crs.CrsCod);
+	}
+     }
+
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+  }
 
 /*****************************************************************************/
 /******* Update RSS archive with active notices in the current course ********/
 /*****************************************************************************/
+// The file is replaced only if its content has changed,
+// so its modification time (Last-Modified and ETag given by the web server
+// to readers of the feed) changes only when there are new items
 
 void RSS_UpdateRSSFileForACrs (struct Crs_Course *Crs)
   {
    char PathRelPublRSSDir[PATH_MAX + 1];
    char PathRelPublRSSFile[PATH_MAX + 1 + NAME_MAX + 1];
+   char PathRelPublRSSTmp[PATH_MAX + 1 + NAME_MAX + 1];
+   FILE *FileChannel;
+   char *Channel = NULL;
+   size_t ChannelSize = 0;
+   char ETag[Cry_BYTES_ENCRYPTED_STR_SHA256_BASE64 + 1];
    FILE *FileRSS;
-   char RSSLink[Cns_MAX_BYTES_WWW + 1];
    struct tm *tm;
 
-   /***** Create RSS directory if not exists *****/
+   /***** Write channel in memory, without dates of publication *****/
+   if ((FileChannel = open_memstream (&Channel,&ChannelSize)) == NULL)
+      Lay_NotEnoughMemoryExit ();
+   RSS_WriteChannel (FileChannel,Crs);
+   fclose (FileChannel);
+
+   /***** Build paths to RSS directory and file *****/
    snprintf (PathRelPublRSSDir,sizeof (PathRelPublRSSDir),"%s/%ld/%s",
 	     Cfg_PATH_CRS_PUBLIC,Crs->CrsCod,Cfg_RSS_FOLDER);
-   Fil_CreateDirIfNotExists (PathRelPublRSSDir);
-
-   /***** Create RSS file *****/
    snprintf (PathRelPublRSSFile,sizeof (PathRelPublRSSFile),"%s/%s",
 	     PathRelPublRSSDir,Cfg_RSS_FILE);
-   if ((FileRSS = fopen (PathRelPublRSSFile,"wb")) == NULL)
+
+   /***** If content has not changed, do not write the file *****/
+   Cry_EncryptSHA256Base64 (Channel,ETag);
+   if (Fil_CheckIfPathExists (PathRelPublRSSFile) &&
+       RSS_CheckIfETagIsStored (Crs->CrsCod,ETag))
+     {
+      free (Channel);
+      return;
+     }
+
+   /***** Create RSS directory if not exists *****/
+   Fil_CreateDirIfNotExists (PathRelPublRSSDir);
+
+   /***** Create temporary RSS file *****/
+   snprintf (PathRelPublRSSTmp,sizeof (PathRelPublRSSTmp),"%s/%s.tmp",
+	     PathRelPublRSSDir,Gbl.UniqueNameEncrypted);
+   if ((FileRSS = fopen (PathRelPublRSSTmp,"wb")) == NULL)
       Lay_ShowErrorAndExit ("Can not create RSS file.");
 
    /***** Write RSS header *****/
@@ -83,6 +184,53 @@ void RSS_UpdateRSSFileForACrs (struct Crs_Course *Crs)
    /***** Write channel header *****/
    fprintf (FileRSS,"<channel>\n");
 
+   // All date-times in RSS conform to the Date and Time Specification of RFC 822, with the exception that the year may be expressed with two characters or four characters (four preferred)
+   fprintf (FileRSS,"<pubDate>");	
+   tm = gmtime (&Gbl.StartExecutionTimeUTC);
+   Dat_WriteRFC822DateFromTM (FileRSS,tm);
+   fprintf (FileRSS,"</pubDate>\n");
+
+   fprintf (FileRSS,"<lastBuildDate>");	
+   tm = gmtime (&Gbl.StartExecutionTimeUTC);
+   Dat_WriteRFC822DateFromTM (FileRSS,tm);
+   fprintf (FileRSS,"</lastBuildDate>\n");
+
+   /***** Write rest of channel *****/
+   fwrite (Channel,1,ChannelSize,FileRSS);
+   free (Channel);
+
+   /***** Write channel footer *****/
+   fprintf (FileRSS,"</channel>\n");
+
+   /***** Write RSS footer *****/
+   fprintf (FileRSS,"</rss>\n");
+
+   /***** Close RSS file *****/
+   fclose (FileRSS);
+
+   /***** Replace RSS file. Rename is atomic,
+          so readers never get an RSS file partially written *****/
+   if (rename (PathRelPublRSSTmp,PathRelPublRSSFile))
+      Lay_ShowErrorAndExit ("Can not rename RSS file.");
+
+   /***** Store ETag and time of last modification *****/
+   DB_QueryINSERT ("can not update RSS file",
+		   "INSERT INTO crs_rss"
+		   " (CrsCod,Changed,BuildTime,ETag,ModifTime)"
+		   " VALUES"
+		   " (%ld,'N',NOW(),'%s',NOW())"
+		   " ON DUPLICATE KEY UPDATE ETag='%s',ModifTime=NOW()",
+		   Crs->CrsCod,ETag,ETag);
+  }
+
+/*****************************************************************************/
+/************** Write channel of RSS, except dates of publication ************/
+/*****************************************************************************/
+
+static void RSS_WriteChannel (FILE *FileRSS,struct Crs_Course *Crs)
+  {
+   char RSSLink[Cns_MAX_BYTES_WWW + 1];
+
    fprintf (FileRSS,"<atom:link href=\"");
    RSS_BuildRSSLink (RSSLink,Crs->CrsCod);
    fprintf (FileRSS,"%s",RSSLink);
@@ -110,17 +258,6 @@ void RSS_UpdateRSSFileForACrs (struct Crs_Course *Crs)
    fprintf (FileRSS,"<height>32</height>\n");
    fprintf (FileRSS,"</image>\n");
 
-   // All date-times in RSS conform to the Date and Time Specification of RFC 822, with the exception that the year may be expressed with two characters or four characters (four preferred)
-   fprintf (FileRSS,"<pubDate>");	
-   tm = gmtime (&Gbl.StartExecutionTimeUTC);
-   Dat_WriteRFC822DateFromTM (FileRSS,tm);
-   fprintf (FileRSS,"</pubDate>\n");
-
-   fprintf (FileRSS,"<lastBuildDate>");	
-   tm = gmtime (&Gbl.StartExecutionTimeUTC);
-   Dat_WriteRFC822DateFromTM (FileRSS,tm);
-   fprintf (FileRSS,"</lastBuildDate>\n");
-
    fprintf (FileRSS,"<generator>%s</generator>\n",
             Log_PLATFORM_VERSION);
    fprintf (FileRSS,"<docs>http://www.rssboard.org/rss-specification</docs>\n");
@@ -130,15 +267,6 @@ void RSS_UpdateRSSFileForACrs (struct Crs_Course *Crs)
 
    /***** Write exam announcements as RSS items *****/
    RSS_WriteExamAnnouncements (FileRSS,Crs);
-
-   /***** Write channel footer *****/
-   fprintf (FileRSS,"</channel>\n");
-
-   /***** Write RSS footer *****/
-   fprintf (FileRSS,"</rss>\n");
-
-   /***** Close RSS file *****/
-   fclose (FileRSS);
   }
 
 /*****************************************************************************/
@@ -259,7 +387,7 @@ static void RSS_WriteExamAnnouncements (FILE *FileRSS,struct Crs_Course *Crs)
 					     " FROM exam_announcements"
 					     " WHERE CrsCod=%ld AND Status=%u AND ExamDate>=NOW()"
 					     " ORDER BY T",
-					     Gbl.Hierarchy.Crs.CrsCod,
+					     Crs->CrsCod,
 					     (unsigned) ExaAnn_VISIBLE_EXAM_ANNOUNCEMENT);
 
       /***** Write items with notices *****/
@@ -316,6 +444,19 @@ static void RSS_WriteExamAnnouncements (FILE *FileRSS,struct Crs_Course *Crs)
      }
   }
 
+/*****************************************************************************/
+/**** Check if the ETag of the content of an RSS file is the one stored ******/
+/*****************************************************************************/
+
+static bool RSS_CheckIfETagIsStored (long CrsCod,
+                                     const char ETag[Cry_BYTES_ENCRYPTED_STR_SHA256_BASE64 + 1])
+  {
+   return (DB_QueryCOUNT ("can not check ETag of RSS file",
+			  "SELECT COUNT(*) FROM crs_rss"
+			  " WHERE CrsCod=%ld AND ETag='%s'",
+			  CrsCod,ETag) != 0);
+  }
+
 /*****************************************************************************/
 /********* Write URL to RSS archive with active notices in a course **********/
 /*****************************************************************************/
@@ -39,6 +39,8 @@
 /***************************** Public prototypes *****************************/
 /*****************************************************************************/
 
+void RSS_MarkRSSFileForACrsAsChanged (long CrsCod);
+void RSS_UpdateChangedRSSFiles (void);
 void RSS_UpdateRSSFileForACrs (struct Crs_Course *Crs);
 void RSS_BuildRSSLink (char RSSLink[Cns_MAX_BYTES_WWW + 1],long CrsCod);
 
@@ -1116,7 +1116,7 @@ void Acc_CompletelyEliminateAccount (struct UsrData *UsrDat,
    /***** Remove social content associated to the user *****/
    TL_Usr_RemoveUsrContent (UsrDat->UsrCod);
 
-   /***** Remove user's figures *****/
+   /***** Remove user's figures and positions in rankings *****/
    Prf_RemoveUsrFigures (UsrDat->UsrCod);
 
    /***** Remove user from table of followers *****/
@@ -732,6 +732,7 @@ const struct Act_Actions Act_Actions[Act_NUM_ACTIONS] =
    [ActRemExaSes	] = {1851,-1,TabUnk,ActSeeAllExa	,0x230,0x200,    0,    0,    0,    0,    0,Act_CONT_NORM,Act_BRW_1ST_TAB,NULL				,ExaSes_RemoveSession		,NULL},
    [ActHidExaSes	] = {1900,-1,TabUnk,ActSeeAllExa	,0x238,0x200,    0,    0,    0,    0,    0,Act_CONT_NORM,Act_BRW_1ST_TAB,NULL				,ExaSes_HideSession		,NULL},
    [ActUnhExaSes	] = {1901,-1,TabUnk,ActSeeAllExa	,0x238,0x200,    0,    0,    0,    0,    0,Act_CONT_NORM,Act_BRW_1ST_TAB,NULL				,ExaSes_UnhideSession		,NULL},
+   [ActRegExaSes	] = {1915,-1,TabUnk,ActSeeAllExa	,0x238,0x200,    0,    0,    0,    0,    0,Act_CONT_NORM,Act_BRW_1ST_TAB,NULL				,ExaSes_RegradeSession		,NULL},
 
    [ActSeeExaPrn	] = {1904,-1,TabUnk,ActSeeAllExa	,0x238,0x200,    0,    0,    0,    0,    0,Act_CONT_NORM,Act_BRW_1ST_TAB,NULL				,ExaPrn_ShowExamPrint		,NULL},
    [ActAnsExaPrn	] = {1906,-1,TabUnk,ActSeeAllExa	,0x238,0x200,    0,    0,    0,    0,    0,Act_CONT_NORM,Act_AJAX_NORMAL,NULL				,ExaPrn_ReceivePrintAnswer	,NULL},
@@ -3737,14 +3738,9 @@ Act_Action_t Act_FromActCodToAction[1 + Act_MAX_ACTION_COD] =	// Do not reuse un
 	ActLstOneGam,		// #1912
 	ActEdiMch,		// #1913
 	ActChgMch,		// #1914
+	ActRegExaSes,		// #1915
   };
 
-/*****************************************************************************/
-/**************************** Private prototypes *****************************/
-/*****************************************************************************/
-
-static const char *Act_GetActionTextFromDB (long ActCod);	// TODO: Remove when database table actions is removed
-
 /*****************************************************************************/
 /****************** Get action from permanent action code ********************/
 /*****************************************************************************/
@@ -3927,12 +3923,16 @@ const char *Act_GetSubtitleAction (Act_Action_t Action)
   }
 
 /*****************************************************************************/
-/********************* Get text for action from database *********************/
+/***************************** Get text for action ***************************/
 /*****************************************************************************/
+// Actions without text in current language get their text
+// from a table indexed by action code, generated by py/swad_action_texts.py
 
 const char *Act_GetActionText (Act_Action_t Action)
   {
    extern const char *Txt_Actions[Act_NUM_ACTIONS];
+   extern const char *Txt_Actions_DB[1 + Act_MAX_ACTION_COD];
+   long ActCod;
 
    if (Action >= 0 && Action < Act_NUM_ACTIONS)
       if (Txt_Actions[Action])
@@ -3940,42 +3940,17 @@ const char *Act_GetActionText (Act_Action_t Action)
 	 if (Txt_Actions[Action][0])
 	    return Txt_Actions[Action];
 
-	 return Act_GetActionTextFromDB (Act_GetActCod (Action));	// TODO: Remove when database table actions is removed
+	 if ((ActCod = Act_GetActCod (Action)) >= 0 &&
+	     ActCod <= Act_MAX_ACTION_COD)
+	    if (Txt_Actions_DB[ActCod])
+	       return Txt_Actions_DB[ActCod];
+
+	 return "";
 	}
 
    return "?";
   }
 
-/*****************************************************************************/
-/********************* Get text for action from database *********************/
-/*****************************************************************************/
-
-static const char *Act_GetActionTextFromDB (long ActCod)	// TODO: Remove when database table actions is removed
-  {
-   extern const char *Lan_STR_LANG_ID[1 + Lan_NUM_LANGUAGES];
-   MYSQL_RES *mysql_res;
-   MYSQL_ROW row;
-   static char ActTxt[Act_MAX_BYTES_ACTION_TXT + 1];
-
-   /***** Get test for an action from database *****/
-   if (DB_QuerySELECT (&mysql_res,"can not get text for an action",
-	               "SELECT Txt FROM actions"
-	               " WHERE ActCod=%ld AND Language='%s'",
-                       ActCod,Lan_STR_LANG_ID[Lan_LANGUAGE_ES]))
-     {
-      /***** Get text *****/
-      row = mysql_fetch_row (mysql_res);
-      Str_Copy (ActTxt,row[0],sizeof (ActTxt) - 1);
-     }
-   else	// ActCod-Language not found on database
-      ActTxt[0] = '\0';
-
-   /***** Free structure that stores the query result *****/
-   DB_FreeMySQLResult (&mysql_res);
-
-   return ActTxt;
-  }
-
 /*****************************************************************************/
 /***************** Adjust current action when no user's logged ***************/
 /*****************************************************************************/
@@ -64,7 +64,7 @@ typedef enum
 
 typedef signed int Act_Action_t;	// Must be a signed type, because -1 is used to indicate obsolete action
 
-#define Act_MAX_ACTION_COD		1914
+#define Act_MAX_ACTION_COD		1915
 
 #define Act_MAX_OPTIONS_IN_MENU_PER_TAB	  13
 
@@ -692,91 +692,92 @@ typedef signed int Act_Action_t;	// Must be a signed type, because -1 is used to
 #define ActRemExaSes		(ActChgCrsTT1stDay + 162)
 #define ActHidExaSes		(ActChgCrsTT1stDay + 163)
 #define ActUnhExaSes		(ActChgCrsTT1stDay + 164)
-
-#define ActSeeExaPrn		(ActChgCrsTT1stDay + 165)
-#define ActAnsExaPrn		(ActChgCrsTT1stDay + 166)
-#define ActEndExaPrn		(ActChgCrsTT1stDay + 167)
-
-#define ActSeeMyExaResCrs	(ActChgCrsTT1stDay + 168)
-#define ActSeeMyExaResExa	(ActChgCrsTT1stDay + 169)
-#define ActSeeMyExaResSes	(ActChgCrsTT1stDay + 170)
-#define ActSeeOneExaResMe	(ActChgCrsTT1stDay + 171)
-#define ActReqSeeUsrExaRes	(ActChgCrsTT1stDay + 172)
-#define ActSeeUsrExaResCrs	(ActChgCrsTT1stDay + 173)
-#define ActSeeUsrExaResExa	(ActChgCrsTT1stDay + 174)
-#define ActSeeUsrExaResSes	(ActChgCrsTT1stDay + 175)
-#define ActSeeOneExaResOth	(ActChgCrsTT1stDay + 176)
-#define ActChgVisExaRes		(ActChgCrsTT1stDay + 177)
-
-#define ActSeeGam		(ActChgCrsTT1stDay + 178)
-#define ActReqRemMch		(ActChgCrsTT1stDay + 179)
-#define ActRemMch		(ActChgCrsTT1stDay + 180)
-#define ActEdiMch		(ActChgCrsTT1stDay + 181)
-#define ActChgMch		(ActChgCrsTT1stDay + 182)
-#define ActReqNewMch		(ActChgCrsTT1stDay + 183)
-#define ActNewMch		(ActChgCrsTT1stDay + 184)
-#define ActResMch		(ActChgCrsTT1stDay + 185)
-#define ActBckMch		(ActChgCrsTT1stDay + 186)
-#define ActPlyPauMch		(ActChgCrsTT1stDay + 187)
-#define ActFwdMch		(ActChgCrsTT1stDay + 188)
-#define ActChgNumColMch		(ActChgCrsTT1stDay + 189)
-#define ActChgVisResMchQst	(ActChgCrsTT1stDay + 190)
-#define ActMchCntDwn		(ActChgCrsTT1stDay + 191)
-#define ActRefMchTch		(ActChgCrsTT1stDay + 192)
-
-#define ActJoiMch		(ActChgCrsTT1stDay + 193)
-#define ActSeeMchAnsQstStd	(ActChgCrsTT1stDay + 194)
-#define ActRemMchAnsQstStd	(ActChgCrsTT1stDay + 195)
-#define ActAnsMchQstStd		(ActChgCrsTT1stDay + 196)
-#define ActRefMchStd		(ActChgCrsTT1stDay + 197)
-
-#define ActSeeMyMchResCrs	(ActChgCrsTT1stDay + 198)
-#define ActSeeMyMchResGam	(ActChgCrsTT1stDay + 199)
-#define ActSeeMyMchResMch	(ActChgCrsTT1stDay + 200)
-#define ActSeeOneMchResMe	(ActChgCrsTT1stDay + 201)
-
-#define ActReqSeeUsrMchRes	(ActChgCrsTT1stDay + 202)
-#define ActSeeUsrMchResCrs	(ActChgCrsTT1stDay + 203)
-#define ActSeeUsrMchResGam	(ActChgCrsTT1stDay + 204)
-#define ActSeeUsrMchResMch	(ActChgCrsTT1stDay + 205)
-#define ActSeeOneMchResOth	(ActChgCrsTT1stDay + 206)
-
-#define ActChgVisResMchUsr	(ActChgCrsTT1stDay + 207)
-
-#define ActLstOneGam		(ActChgCrsTT1stDay + 208)
-
-#define ActFrmNewGam		(ActChgCrsTT1stDay + 209)
-#define ActEdiOneGam		(ActChgCrsTT1stDay + 210)
-#define ActNewGam		(ActChgCrsTT1stDay + 211)
-#define ActChgGam		(ActChgCrsTT1stDay + 212)
-#define ActReqRemGam		(ActChgCrsTT1stDay + 213)
-#define ActRemGam		(ActChgCrsTT1stDay + 214)
-#define ActHidGam		(ActChgCrsTT1stDay + 215)
-#define ActShoGam		(ActChgCrsTT1stDay + 216)
-#define ActAddOneGamQst		(ActChgCrsTT1stDay + 217)
-#define ActGamLstTstQst		(ActChgCrsTT1stDay + 218)
-#define ActAddTstQstToGam	(ActChgCrsTT1stDay + 219)
-#define ActReqRemGamQst		(ActChgCrsTT1stDay + 220)
-#define ActRemGamQst		(ActChgCrsTT1stDay + 221)
-#define ActUp_GamQst		(ActChgCrsTT1stDay + 222)
-#define ActDwnGamQst		(ActChgCrsTT1stDay + 223)
-
-#define ActSeeSvy		(ActChgCrsTT1stDay + 224)
-#define ActAnsSvy		(ActChgCrsTT1stDay + 225)
-#define ActFrmNewSvy		(ActChgCrsTT1stDay + 226)
-#define ActEdiOneSvy		(ActChgCrsTT1stDay + 227)
-#define ActNewSvy		(ActChgCrsTT1stDay + 228)
-#define ActChgSvy		(ActChgCrsTT1stDay + 229)
-#define ActReqRemSvy		(ActChgCrsTT1stDay + 230)
-#define ActRemSvy		(ActChgCrsTT1stDay + 231)
-#define ActReqRstSvy		(ActChgCrsTT1stDay + 232)
-#define ActRstSvy		(ActChgCrsTT1stDay + 233)
-#define ActHidSvy		(ActChgCrsTT1stDay + 234)
-#define ActShoSvy		(ActChgCrsTT1stDay + 235)
-#define ActEdiOneSvyQst		(ActChgCrsTT1stDay + 236)
-#define ActRcvSvyQst		(ActChgCrsTT1stDay + 237)
-#define ActReqRemSvyQst		(ActChgCrsTT1stDay + 238)
-#define ActRemSvyQst		(ActChgCrsTT1stDay + 239)
+#define ActRegExaSes		(ActChgCrsTT1stDay + 165)
+
+#define ActSeeExaPrn		(ActChgCrsTT1stDay + 166)
+#define ActAnsExaPrn		(ActChgCrsTT1stDay + 167)
+#define ActEndExaPrn		(ActChgCrsTT1stDay + 168)
+
+#define ActSeeMyExaResCrs	(ActChgCrsTT1stDay + 169)
+#define ActSeeMyExaResExa	(ActChgCrsTT1stDay + 170)
+#define ActSeeMyExaResSes	(ActChgCrsTT1stDay + 171)
+#define ActSeeOneExaResMe	(ActChgCrsTT1stDay + 172)
+#define ActReqSeeUsrExaRes	(ActChgCrsTT1stDay + 173)
+#define ActSeeUsrExaResCrs	(ActChgCrsTT1stDay + 174)
+#define ActSeeUsrExaResExa	(ActChgCrsTT1stDay + 175)
+#define ActSeeUsrExaResSes	(ActChgCrsTT1stDay + 176)
+#define ActSeeOneExaResOth	(ActChgCrsTT1stDay + 177)
+#define ActChgVisExaRes		(ActChgCrsTT1stDay + 178)
+
+#define ActSeeGam		(ActChgCrsTT1stDay + 179)
+#define ActReqRemMch		(ActChgCrsTT1stDay + 180)
+#define ActRemMch		(ActChgCrsTT1stDay + 181)
+#define ActEdiMch		(ActChgCrsTT1stDay + 182)
+#define ActChgMch		(ActChgCrsTT1stDay + 183)
+#define ActReqNewMch		(ActChgCrsTT1stDay + 184)
+#define ActNewMch		(ActChgCrsTT1stDay + 185)
+#define ActResMch		(ActChgCrsTT1stDay + 186)
+#define ActBckMch		(ActChgCrsTT1stDay + 187)
+#define ActPlyPauMch		(ActChgCrsTT1stDay + 188)
+#define ActFwdMch		(ActChgCrsTT1stDay + 189)
+#define ActChgNumColMch		(ActChgCrsTT1stDay + 190)
+#define ActChgVisResMchQst	(ActChgCrsTT1stDay + 191)
+#define ActMchCntDwn		(ActChgCrsTT1stDay + 192)
+#define ActRefMchTch		(ActChgCrsTT1stDay + 193)
+
+#define ActJoiMch		(ActChgCrsTT1stDay + 194)
+#define ActSeeMchAnsQstStd	(ActChgCrsTT1stDay + 195)
+#define ActRemMchAnsQstStd	(ActChgCrsTT1stDay + 196)
+#define ActAnsMchQstStd		(ActChgCrsTT1stDay + 197)
+#define ActRefMchStd		(ActChgCrsTT1stDay + 198)
+
+#define ActSeeMyMchResCrs	(ActChgCrsTT1stDay + 199)
+#define ActSeeMyMchResGam	(ActChgCrsTT1stDay + 200)
+#define ActSeeMyMchResMch	(ActChgCrsTT1stDay + 201)
+#define ActSeeOneMchResMe	(ActChgCrsTT1stDay + 202)
+
+#define ActReqSeeUsrMchRes	(ActChgCrsTT1stDay + 203)
+#define ActSeeUsrMchResCrs	(ActChgCrsTT1stDay + 204)
+#define ActSeeUsrMchResGam	(ActChgCrsTT1stDay + 205)
+#define ActSeeUsrMchResMch	(ActChgCrsTT1stDay + 206)
+#define ActSeeOneMchResOth	(ActChgCrsTT1stDay + 207)
+
+#define ActChgVisResMchUsr	(ActChgCrsTT1stDay + 208)
+
+#define ActLstOneGam		(ActChgCrsTT1stDay + 209)
+
+#define ActFrmNewGam		(ActChgCrsTT1stDay + 210)
+#define ActEdiOneGam		(ActChgCrsTT1stDay + 211)
+#define ActNewGam		(ActChgCrsTT1stDay + 212)
+#define ActChgGam		(ActChgCrsTT1stDay + 213)
+#define ActReqRemGam		(ActChgCrsTT1stDay + 214)
+#define ActRemGam		(ActChgCrsTT1stDay + 215)
+#define ActHidGam		(ActChgCrsTT1stDay + 216)
+#define ActShoGam		(ActChgCrsTT1stDay + 217)
+#define ActAddOneGamQst		(ActChgCrsTT1stDay + 218)
+#define ActGamLstTstQst		(ActChgCrsTT1stDay + 219)
+#define ActAddTstQstToGam	(ActChgCrsTT1stDay + 220)
+#define ActReqRemGamQst		(ActChgCrsTT1stDay + 221)
+#define ActRemGamQst		(ActChgCrsTT1stDay + 222)
+#define ActUp_GamQst		(ActChgCrsTT1stDay + 223)
+#define ActDwnGamQst		(ActChgCrsTT1stDay + 224)
+
+#define ActSeeSvy		(ActChgCrsTT1stDay + 225)
+#define ActAnsSvy		(ActChgCrsTT1stDay + 226)
+#define ActFrmNewSvy		(ActChgCrsTT1stDay + 227)
+#define ActEdiOneSvy		(ActChgCrsTT1stDay + 228)
+#define ActNewSvy		(ActChgCrsTT1stDay + 229)
+#define ActChgSvy		(ActChgCrsTT1stDay + 230)
+#define ActReqRemSvy		(ActChgCrsTT1stDay + 231)
+#define ActRemSvy		(ActChgCrsTT1stDay + 232)
+#define ActReqRstSvy		(ActChgCrsTT1stDay + 233)
+#define ActRstSvy		(ActChgCrsTT1stDay + 234)
+#define ActHidSvy		(ActChgCrsTT1stDay + 235)
+#define ActShoSvy		(ActChgCrsTT1stDay + 236)
+#define ActEdiOneSvyQst		(ActChgCrsTT1stDay + 237)
+#define ActRcvSvyQst		(ActChgCrsTT1stDay + 238)
+#define ActReqRemSvyQst		(ActChgCrsTT1stDay + 239)
+#define ActRemSvyQst		(ActChgCrsTT1stDay + 240)
 
 /*****************************************************************************/
 /******************************** Files tab **********************************/
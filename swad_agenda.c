@@ -439,7 +439,7 @@ void Agd_ShowUsrAgenda (void)
 void Agd_ShowOtherAgendaAfterLogIn (void)
   {
    extern const char *Hlp_PROFILE_Agenda_public_agenda;
-   extern const unsigned Txt_Current_CGI_SWAD_Language;
+   extern unsigned Txt_Current_CGI_SWAD_Language;
    extern const char *Txt_Public_agenda_USER;
    extern const char *Txt_Switching_to_LANGUAGE[1 + Lan_NUM_LANGUAGES];
    struct Agd_Agenda Agenda;
@@ -79,8 +79,6 @@ static void Ctr_GetParamCtrOrder (void);
 static void Ctr_EditCentresInternal (void);
 static void Ctr_PutIconsEditingCentres (__attribute__((unused)) void *Args);
 
-static void Ctr_GetDataOfCentreFromRow (struct Ctr_Centre *Ctr,MYSQL_ROW row);
-
 static void Ctr_ListCentresForEdition (const struct Plc_Places *Places);
 static bool Ctr_CheckIfICanEditACentre (struct Ctr_Centre *Ctr);
 static Ctr_StatusTxt_t Ctr_GetStatusTxtFromStatusBits (Ctr_Status_t Status);
@@ -749,7 +747,7 @@ bool Ctr_GetDataOfCentreByCod (struct Ctr_Centre *Ctr)
 /********** Get data of a centre from a row resulting of a query *************/
 /*****************************************************************************/
 
-static void Ctr_GetDataOfCentreFromRow (struct Ctr_Centre *Ctr,MYSQL_ROW row)
+void Ctr_GetDataOfCentreFromRow (struct Ctr_Centre *Ctr,MYSQL_ROW row)
   {
    /***** Get centre code (row[0]) *****/
    if ((Ctr->CtrCod = Str_ConvertStrCodToLongCod (row[0])) <= 0)
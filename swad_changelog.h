@@ -553,7 +553,7 @@ enscript -2 --landscape --color --file-align=2 --highlight --line-numbers -o - *
 En OpenSWAD:
 ps2pdf source.ps destination.pdf
 */
-#define Log_PLATFORM_VERSION	"SWAD 20.35.1 (2021-02-23)"
+#define Log_PLATFORM_VERSION	"SWAD 20.59.18 (2021-03-08)"
 #define CSS_FILE		"swad20.33.9.css"
 #define JS_FILE			"swad20.6.2.js"
 /*
@@ -601,6 +601,91 @@ TODO: DNI de un estudiante sale err
 TODO: BUG: Cuando un tipo de grupo slo tiene un grupo, inscribirse es voluntario, el estudiante slo puede pertenecer a un grupo, y se inscribe en l, debera poder desapuntarse. Ahora no puede.
 TODO: Salvador Romero Corts: @acanas opcin para editar posts
 
+	Version 20.59.18: Mar 8, 2021  Building a text catalog fails without writing it when there is no memory. (316323 lines)
+	Version 20.59.17: Mar 8, 2021  Number of levels and items with children in syllabus binary file are checked. (316313 lines)
+	Version 20.59.16: Mar 8, 2021  Removed unused functions to get, print and free XML trees. (316299 lines)
+	Version 20.59.15: Mar 8, 2021  Removed unused functions for prepared queries. (316419 lines)
+	Version 20.59.14: Mar 8, 2021  Fixed bug in regrading of exam prints: questions with unknown type of answer are skipped. (316475 lines)
+	Version 20.59.13: Mar 8, 2021  Benchmark script does not seed a database without explicit name and confirmation. (316416 lines)
+	Version 20.59.12: Mar 8, 2021  Forum type and location of posts got in the same query in API function getNotificationsPage. (316394 lines)
+	Version 20.59.11: Mar 8, 2021  Fixed bug in regrading of exam prints: scores are updated without inserting rows. (316377 lines)
+	Version 20.59.10: Mar 8, 2021  Rankings of users' figures computed by only one process at a time. (316376 lines)
+	Version 20.59.9:  Mar 8, 2021  Generation of QR codes calls a function given by caller when there is no memory. (316331 lines)
+	Version 20.59.8:  Mar 8, 2021  Conversion of Markdown calls a function given by caller when there is no memory. (316330 lines)
+	Version 20.59.7:  Mar 8, 2021  QR codes of users' IDs, nicknames and other texts embedded in pages instead of stored in public files. (316340 lines)
+					Remove all files in public directory qr, since some of them may contain personal data.
+
+	Version 20.59.6:  Mar 8, 2021  Catalogs of texts loaded from the directory of the program. If a catalog can not be loaded, an error is shown instead of a page in English. (316284 lines)
+	Version 20.59.5:  Mar 8, 2021  Fixed rules in Makefile to build texts again when their sources change. (316260 lines)
+	Version 20.59.4:  Mar 8, 2021  Fixed bug in reset of query stats. (316259 lines)
+	Version 20.59.3:  Mar 8, 2021  Slow queries stored without parameters and removed periodically. (316259 lines)
+					1 change necessary in database:
+DELETE FROM db_slow_queries;
+
+	Version 20.59.2:  Mar 8, 2021  Query stats disabled by default, enabled only in builds for benchmarking. (316187 lines)
+	Version 20.59.1:  Mar 8, 2021  Session, log and connected users got again with text queries, since they are executed only once per request. (316183 lines)
+	Version 20.59:    Mar 8, 2021  Answers of a user to a survey stored with one query in a transaction. Number of users who have answered a survey stored in table surveys. (316184 lines)
+					2 changes necessary in database:
+ALTER TABLE surveys ADD COLUMN NumUsrs INT NOT NULL DEFAULT 0 AFTER Txt;
+UPDATE surveys SET NumUsrs=(SELECT COUNT(*) FROM svy_users WHERE svy_users.SvyCod=surveys.SvyCod);
+
+	Version 20.58:    Mar 8, 2021  Syllabus items read from a binary file mapped in memory, built again only when XML file changes. Edition of syllabus changes items in memory and writes files once. (316163 lines)
+	Version 20.57:    Mar 8, 2021  QR codes generated inside swad as PNG images, cached in public files named with a hash of text and size, instead of got from Google Chart API. (315911 lines)
+	Version 20.56:    Mar 8, 2021  Changes in notices and exam announcements only mark the RSS file of the course as changed. Changed RSS files are updated periodically, at most once a minute, written to a temporary file and renamed, and not rewritten if their content has not changed. (315007 lines)
+					1 change necessary in database:
+CREATE TABLE IF NOT EXISTS crs_rss (CrsCod INT NOT NULL,Changed ENUM('N','Y') NOT NULL DEFAULT 'N',BuildTime DATETIME NOT NULL,ETag CHAR(43) NOT NULL DEFAULT '',ModifTime DATETIME NOT NULL,UNIQUE INDEX(CrsCod),INDEX(Changed,BuildTime));
+
+	Version 20.55:    Mar 8, 2021  Markdown converted to HTML inside swad instead of with pandoc, and HTML cached in files named with a hash of the text. New command markdown in py/swad_bench.py. (314838 lines)
+	Version 20.54:    Mar 8, 2021  Notifications to all users stored with one INSERT ... SELECT checking users' settings in database. (312299 lines)
+	Version 20.53:    Mar 8, 2021  Export of test questions getting questions, tags and answers with one query each per block of questions. (312308 lines)
+	Version 20.52:    Mar 8, 2021  Import of test questions from XML file read as a stream, question by question, in one transaction. (312085 lines)
+	Version 20.51:    Mar 8, 2021  Texts of actions not found in swad_text_action.c are got from a table generated in swad_text_action_DB.c instead of from database table actions. (311708 lines)
+	Version 20.50:    Mar 8, 2021  One program swad for all languages. Texts of languages not built in are read from catalogs swad_xx.cat mapped in memory. New command startup in py/swad_bench.py. (309650 lines)
+	Version 20.49:    Mar 7, 2021  New paginated web service functions getUsersPage, findUsersPage and getNotificationsPage with cursors and only codes and names, and getDirectoryTreeLevel to get a folder with a limited depth. (309228 lines)
+	Version 20.48:    Mar 6, 2021  Number of queries, rows and time in database are stored per action and per call site. Slow queries are stored with their SQL. (308075 lines)
+					3 changes necessary in database:
+CREATE TABLE IF NOT EXISTS db_act_stats (ActCod INT NOT NULL,NumRequests BIGINT NOT NULL DEFAULT 0,NumQueries BIGINT NOT NULL DEFAULT 0,NumRows BIGINT NOT NULL DEFAULT 0,Time BIGINT NOT NULL DEFAULT 0,UNIQUE INDEX(ActCod));
+CREATE TABLE IF NOT EXISTS db_query_stats (ActCod INT NOT NULL,CallSite VARCHAR(255) NOT NULL,NumCalls BIGINT NOT NULL DEFAULT 0,NumRows BIGINT NOT NULL DEFAULT 0,Time BIGINT NOT NULL DEFAULT 0,UNIQUE INDEX(ActCod,CallSite));
+CREATE TABLE IF NOT EXISTS db_slow_queries (ActCod INT NOT NULL,CallSite VARCHAR(255) NOT NULL,ClickTime DATETIME NOT NULL,NumRows BIGINT NOT NULL DEFAULT 0,Time BIGINT NOT NULL DEFAULT 0,Query LONGTEXT NOT NULL,INDEX(ActCod),INDEX(ClickTime));
+
+	Version 20.47:    Mar 5, 2021  Prepared statements for most frequent queries (session, user's data, log and connected users). (307756 lines)
+	Version 20.46:    Mar 4, 2021  Bookkeeping writes at end of request sent to database in one round trip. Lazy decay of scores of most frequently used actions. (307425 lines)
+					2 changes necessary in database:
+ALTER TABLE actions_MFU ADD COLUMN Epoch INT NOT NULL DEFAULT 0 AFTER LastClick;
+ALTER TABLE usr_last ADD COLUMN MFUEpoch INT NOT NULL DEFAULT 0 AFTER TimelineUsrs;
+
+	Version 20.45:    Mar 3, 2021  Current course, degree, centre, institution and country are got in one query. (307332 lines)
+	Version 20.44:    Mar 2, 2021  Messages received or sent are counted and paginated in database. (307167 lines)
+	Version 20.43:    Mar 1, 2021  Positions of users in rankings of figures are computed periodically in one pass and stored. (307081 lines)
+					1 change necessary in database:
+CREATE TABLE IF NOT EXISTS usr_ranks (UsrCod INT NOT NULL,RankClicks INT NOT NULL DEFAULT 0,RankClicksPerDay INT NOT NULL DEFAULT 0,RankFileViews INT NOT NULL DEFAULT 0,RankSocPub INT NOT NULL DEFAULT 0,RankForPst INT NOT NULL DEFAULT 0,RankMsgSnt INT NOT NULL DEFAULT 0,PRIMARY KEY(UsrCod));
+
+	Version 20.42:    Feb 28, 2021  User's usage report is built from hits pre-aggregated per user, year, course, role and action. (306735 lines)
+					2 changes necessary in database:
+CREATE TABLE IF NOT EXISTS usr_hits (UsrCod INT NOT NULL,Year SMALLINT NOT NULL,CrsCod INT NOT NULL,Role TINYINT NOT NULL,ActCod INT NOT NULL,NumHits INT NOT NULL DEFAULT 0,UNIQUE INDEX(UsrCod,Year,CrsCod,Role,ActCod));
+INSERT INTO usr_hits (UsrCod,Year,CrsCod,Role,ActCod,NumHits) SELECT UsrCod,YEAR(CONVERT_TZ(ClickTime,@@session.time_zone,'UTC')) AS Y,CrsCod,Role,ActCod,COUNT(*) FROM log WHERE UsrCod>0 GROUP BY UsrCod,Y,CrsCod,Role,ActCod;
+
+	Version 20.41:    Feb 27, 2021  Counters of course indicators are stored and updated on write. (306677 lines)
+					2 changes necessary in database:
+ALTER TABLE courses DROP COLUMN NumIndicators;
+CREATE TABLE IF NOT EXISTS crs_indicators (CrsCod INT NOT NULL,Indicators TINYINT NOT NULL DEFAULT 0,NumIndicators TINYINT NOT NULL DEFAULT 0,NumFilesDocum INT NOT NULL DEFAULT 0,NumFilesShare INT NOT NULL DEFAULT 0,NumFilesAssig INT NOT NULL DEFAULT 0,NumFilesWorks INT NOT NULL DEFAULT 0,SyllabusLecSrc TINYINT NOT NULL DEFAULT 0,SyllabusPraSrc TINYINT NOT NULL DEFAULT 0,TeachingGuideSrc TINYINT NOT NULL DEFAULT 0,AssessmentSrc TINYINT NOT NULL DEFAULT 0,NumAssignments INT NOT NULL DEFAULT 0,NumThreads INT NOT NULL DEFAULT 0,NumPosts INT NOT NULL DEFAULT 0,NumMsgsSentByTchs INT NOT NULL DEFAULT 0,UNIQUE INDEX(CrsCod),INDEX(NumIndicators));
+
+	Version 20.40:    Feb 26, 2021  Number of posts and writers are stored in forum threads, and data of threads in a page are got in only two queries. (306190 lines)
+					2 changes necessary in database:
+ALTER TABLE forum_thread ADD COLUMN NumPsts INT NOT NULL DEFAULT 0 AFTER LastPstCod,ADD COLUMN NumWriters INT NOT NULL DEFAULT 0 AFTER NumPsts;
+UPDATE forum_thread SET NumPsts=(SELECT COUNT(*) FROM forum_post WHERE forum_post.ThrCod=forum_thread.ThrCod),NumWriters=(SELECT COUNT(DISTINCT UsrCod) FROM forum_post WHERE forum_post.ThrCod=forum_thread.ThrCod);
+
+	Version 20.39:    Feb 26, 2021  Rows of users in files of marks are indexed in database to avoid parsing the whole file when showing my marks. (306175 lines)
+					2 changes necessary in database:
+ALTER TABLE marks_properties ADD COLUMN FileSize INT NOT NULL DEFAULT -1,ADD COLUMN FileTime INT NOT NULL DEFAULT 0,ADD COLUMN HeadEnd INT NOT NULL DEFAULT 0,ADD COLUMN FootStart INT NOT NULL DEFAULT 0;
+CREATE TABLE IF NOT EXISTS marks_rows (FilCod INT NOT NULL,UsrID CHAR(16) NOT NULL,RowStart INT NOT NULL,RowEnd INT NOT NULL,UNIQUE INDEX(FilCod,UsrID));
+
+	Version 20.38:    Feb 25, 2021  New action to regrade all the exam prints in an exam session. (305757 lines)
+	Version 20.37:    Feb 24, 2021  New module swad_random for random selection of questions and shuffling of answers without ORDER BY RAND(). (305311 lines)
+	Version 20.36:    Feb 24, 2021  Answers to match questions are stored in only one query and histogram of answers is got in only one query. (305107 lines)
+					1 change necessary in database:
+ALTER TABLE mch_answers ADD INDEX(MchCod,QstInd,AnsInd);
+
 	Version 20.35.1:  Feb 23, 2021  Code refactoring in timeline related to sharing and faving. (305021 lines)
 	Version 20.35:    Feb 23, 2021  Code refactoring in timeline related to sharing and faving. (304986 lines)
 	Version 20.34.1:  Feb 23, 2021  Code refactoring in timeline related to sharing and faving. (305009 lines)
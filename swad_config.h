@@ -236,7 +236,9 @@
 #endif
 
 /* Database */
+#ifndef Cfg_DATABASE_DBNAME	// To benchmark with another database, build with make DB_NAME=...
 #define Cfg_DATABASE_DBNAME		"swad"				// Database name
+#endif
 #define Cfg_DATABASE_USER		"swad"				// Database user
 
 /* Email */
@@ -367,6 +369,10 @@
 #define Cfg_FOLDER_TEST				"test"			// Created automatically the first time it is accessed
 #define Cfg_PATH_TEST_PRIVATE			Cfg_PATH_SWAD_PRIVATE "/" Cfg_FOLDER_TEST
 
+/* Folder for HTML converted from Markdown, inside private swad directory */
+#define Cfg_FOLDER_MARKDOWN			"md"			// Created automatically the first time it is accessed
+#define Cfg_PATH_MARKDOWN_PRIVATE		Cfg_PATH_SWAD_PRIVATE "/" Cfg_FOLDER_MARKDOWN
+
 /* Folder for compression of assignments and works into a zip files, inside private swad directory */
 #define Cfg_FOLDER_ZIP				"zip"			// Created automatically the first time it is accessed
 #define Cfg_PATH_ZIP_PRIVATE			Cfg_PATH_SWAD_PRIVATE "/" Cfg_FOLDER_ZIP
@@ -394,6 +400,11 @@
 #define Cfg_PATH_REP_PUBLIC			Cfg_PATH_SWAD_PUBLIC "/" Cfg_FOLDER_REP
 #define Cfg_URL_REP_PUBLIC			Cfg_URL_SWAD_PUBLIC "/" Cfg_FOLDER_REP
 
+/* Folder for images of QR codes, inside public swad directory */
+#define Cfg_FOLDER_QR 				"qr"			// Created automatically the first time it is accessed
+#define Cfg_PATH_QR_PUBLIC			Cfg_PATH_SWAD_PUBLIC "/" Cfg_FOLDER_QR
+#define Cfg_URL_QR_PUBLIC			Cfg_URL_SWAD_PUBLIC "/" Cfg_FOLDER_QR
+
 /* Folder for banners, inside public swad directory */
 #define Cfg_FOLDER_BANNER			"banner"		// If not exists, it should be created during installation inside swad public directory!
 #define Cfg_URL_BANNER_PUBLIC			Cfg_URL_SWAD_PUBLIC "/" Cfg_FOLDER_BANNER
@@ -427,6 +438,7 @@
 #define Cfg_SYLLABUS_FOLDER_LECTURES		"lec"
 #define Cfg_SYLLABUS_FOLDER_PRACTICALS		"pra"
 #define Cfg_SYLLABUS_FILENAME			"syllabus.xml"
+#define Cfg_SYLLABUS_BIN_FILENAME		"syllabus.bin"	// Items parsed from XML file
 
 /* Main folders in file browsers */
 #define Cfg_CRS_INFO_INTRODUCTION		"intro"
@@ -500,6 +512,9 @@
 #define Cfg_TIME_TO_CHANGE_BANNER			((time_t)(               2UL * 60UL))	// After these seconds, change banner
 #define Cfg_NUMBER_OF_BANNERS				1					// Number of banners to show simultaneously
 
+#define Cfg_TIME_TO_UPDATE_USR_RANKS			((time_t)(         1UL * 60UL * 60UL))	// Rankings of users' figures are computed again after these seconds
+#define Cfg_TIME_TO_KEEP_OLD_USR_RANKS			((time_t)(        24UL * 60UL * 60UL))	// Old rankings are shown while other process computes them, if not older than these seconds
+
 #define Cfg_TIME_TO_DELETE_WEB_SERVICE_KEY		((time_t)( 7UL * 24UL * 60UL * 60UL))	// After these seconds, a web service key is removed
 
 #define Cfg_TIME_TO_DELETE_HTML_OUTPUT			((time_t)(              30UL * 60UL))	// Remove the HTML output files older than these seconds
@@ -520,6 +535,12 @@
 
 #define Cfg_TIME_TO_DELETE_TEST_TMP_FILES		((time_t)(        2UL * 60UL * 60UL))  	// Temporary files related to imported test questions after these seconds
 
+#define Cfg_TIME_TO_DELETE_MARKDOWN_CACHE		((time_t)(30UL * 24UL * 60UL * 60UL))	// HTML converted from Markdown not viewed during these seconds is removed
+
+#define Cfg_TIME_TO_DELETE_QR_CACHE			((time_t)(30UL * 24UL * 60UL * 60UL))	// Images of QR codes not shown during these seconds are removed
+
+#define Cfg_TIME_TO_UPDATE_RSS				((time_t)(                    60UL))	// RSS file of a course is updated at most once during these seconds
+
 #define Cfg_TIME_TO_DELETE_ENROLMENT_REQUESTS		((time_t)(30UL * 24UL * 60UL * 60UL))	// Past these seconds, remove expired enrolment requests
 
 #define Cfg_TIME_TO_DELETE_THREAD_CLIPBOARD		((time_t)(              15UL * 60UL))	// Threads older than these seconds are removed from clipboard
@@ -535,6 +556,12 @@
 
 #define Cfg_MAX_TIME_TO_REMEMBER_LAST_ACTION_ON_LOGIN	((time_t)(        2UL * 60UL * 60UL))	// On login, if interval since last action is less than this time, remember last action
 
+#ifndef Cfg_DB_QUERY_STATS	// To benchmark, build with make DB_QUERY_STATS=true
+#define Cfg_DB_QUERY_STATS				false			// Store number of queries, rows and time per action and per call site? It adds writes to every request
+#endif
+#define Cfg_DB_SLOW_QUERY_TIME				(100L * 1000L)		// Queries lasting more than these microseconds are stored with their SQL, without parameters
+#define Cfg_TIME_TO_DELETE_SLOW_QUERIES			((time_t)( 7UL * 24UL * 60UL * 60UL))	// Past these seconds, remove slow queries stored
+
 /*****************************************************************************/
 /***************************** Public prototypes *****************************/
 /*****************************************************************************/
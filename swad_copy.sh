@@ -7,17 +7,21 @@ APACHE_GROUP=www-data
 USER=acanas
 CORE=/home/$USER/swad/swad-core
 
-cp -af $CGI/swad_ca $CGI/swad_ca.old
-cp -af $CGI/swad_de $CGI/swad_de.old
-cp -af $CGI/swad_en $CGI/swad_en.old
-cp -af $CGI/swad_es $CGI/swad_es.old
-cp -af $CGI/swad_fr $CGI/swad_fr.old
-cp -af $CGI/swad_gn $CGI/swad_gn.old
-cp -af $CGI/swad_it $CGI/swad_it.old
-cp -af $CGI/swad_pl $CGI/swad_pl.old
-cp -af $CGI/swad_pt $CGI/swad_pt.old
+LANGUAGES="ca de en es fr gn it pl pt"
+
+# Backup of program and catalogs
+cp -af $CGI/swad $CGI/swad.old
+for lan in $LANGUAGES; do
+  [ -f $CGI/swad_$lan.cat ] && cp -af $CGI/swad_$lan.cat $CGI/swad_$lan.cat.old
+done
+
+# One program for all languages: swad_xx are links to swad,
+# and texts of each language not built in swad are read from swad_xx.cat
+cp -f $CORE/swad $CORE/swad_*.cat $CGI
+for lan in $LANGUAGES; do
+  ln -sf swad $CGI/swad_$lan
+done
 
-cp -f $CORE/swad_ca $CORE/swad_de $CORE/swad_en $CORE/swad_es $CORE/swad_fr $CORE/swad_gn $CORE/swad_it $CORE/swad_pl $CORE/swad_pt $CGI
 cp -f $CORE/js/swad*.js $PUBLIC_HTML
 cp -f $CORE/css/swad*.css $PUBLIC_HTML
 
@@ -1077,15 +1077,7 @@ bool Cty_GetDataOfCountryByCod (struct Cty_Countr *Cty)
 
       /* Get row */
       row = mysql_fetch_row (mysql_res);
-
-      /* Get Alpha-2 country code (row[0]) */
-      Str_Copy (Cty->Alpha2,row[0],sizeof (Cty->Alpha2) - 1);
-
-      /* Get name and WWW of the country in current language */
-      Str_Copy (Cty->Name[Gbl.Prefs.Language],row[1],
-                sizeof (Cty->Name[Gbl.Prefs.Language]) - 1);
-      Str_Copy (Cty->WWW[Gbl.Prefs.Language],row[2],
-		sizeof (Cty->WWW[Gbl.Prefs.Language]) - 1);
+      Cty_GetDataOfCountryFromRow (Cty,row);
      }
    else
       CtyFound = false;
@@ -1096,6 +1088,24 @@ bool Cty_GetDataOfCountryByCod (struct Cty_Countr *Cty)
    return CtyFound;
   }
 
+/*****************************************************************************/
+/********** Get data of a country from a row resulting of a query ************/
+/*****************************************************************************/
+// row[0]: Alpha2, row[1]: name and row[2]: WWW in current language
+
+void Cty_GetDataOfCountryFromRow (struct Cty_Countr *Cty,MYSQL_ROW row)
+  {
+   /***** Get Alpha-2 country code (row[0]) *****/
+   Str_Copy (Cty->Alpha2,row[0],sizeof (Cty->Alpha2) - 1);
+
+   /***** Get name (row[1]) and WWW (row[2]) of the country
+          in current language *****/
+   Str_Copy (Cty->Name[Gbl.Prefs.Language],row[1],
+	     sizeof (Cty->Name[Gbl.Prefs.Language]) - 1);
+   Str_Copy (Cty->WWW[Gbl.Prefs.Language],row[2],
+	     sizeof (Cty->WWW[Gbl.Prefs.Language]) - 1);
+  }
+
 /*****************************************************************************/
 /***************************** Get country name ******************************/
 /*****************************************************************************/
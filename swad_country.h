@@ -101,6 +101,7 @@ void Cty_FreeListCountries (void);
 void Cty_WriteSelectorOfCountry (void);
 void Cty_WriteCountryName (long CtyCod,const char *ClassLink);
 bool Cty_GetDataOfCountryByCod (struct Cty_Countr *Cty);
+void Cty_GetDataOfCountryFromRow (struct Cty_Countr *Cty,MYSQL_ROW row);
 void Cty_FlushCacheCountryName (void);
 void Cty_GetCountryName (long CtyCod,Lan_Language_t Language,
 			 char CtyName[Cty_MAX_BYTES_NAME + 1]);
@@ -45,6 +45,7 @@
 #include "swad_help.h"
 #include "swad_hierarchy.h"
 #include "swad_HTML.h"
+#include "swad_indicator.h"
 #include "swad_info.h"
 #include "swad_logo.h"
 #include "swad_message.h"
@@ -101,7 +102,6 @@ static void Crs_ReceiveFormRequestOrCreateCrs (unsigned Status);
 static void Crs_GetParamsNewCourse (struct Crs_Course *Crs);
 
 static void Crs_CreateCourse (unsigned Status);
-static void Crs_GetDataOfCourseFromRow (struct Crs_Course *Crs,MYSQL_ROW row);
 
 static void Crs_GetShortNamesByCod (long CrsCod,
                                     char CrsShortName[Cns_HIERARCHY_MAX_BYTES_SHRT_NAME + 1],
@@ -1789,7 +1789,7 @@ bool Crs_GetDataOfCourseByCod (struct Crs_Course *Crs)
 /********** Get data of a course from a row resulting of a query *************/
 /*****************************************************************************/
 
-static void Crs_GetDataOfCourseFromRow (struct Crs_Course *Crs,MYSQL_ROW row)
+void Crs_GetDataOfCourseFromRow (struct Crs_Course *Crs,MYSQL_ROW row)
   {
    /***** Get course code (row[0]) *****/
    if ((Crs->CrsCod = Str_ConvertStrCodToLongCod (row[0])) < 0)
@@ -1866,6 +1866,11 @@ void Crs_RemoveCourseCompletely (long CrsCod)
 		      "DELETE FROM crs_last WHERE CrsCod=%ld",
 		      CrsCod);
 
+      /***** Remove course from table of RSS files in database *****/
+      DB_QueryDELETE ("can not remove a course",
+		      "DELETE FROM crs_rss WHERE CrsCod=%ld",
+		      CrsCod);
+
       /***** Remove course from table of courses in database *****/
       DB_QueryDELETE ("can not remove a course",
 		      "DELETE FROM courses WHERE CrsCod=%ld",
@@ -1912,6 +1917,9 @@ static void Crs_EmptyCourseCompletely (long CrsCod)
 		      "DELETE FROM crs_info_txt WHERE CrsCod=%ld",
 		      CrsCod);
 
+      /* Remove stored indicators of the course */
+      Ind_RemoveIndicatorsCrs (CrsCod);
+
       /***** Remove exam announcements in the course *****/
       /* Mark all exam announcements in the course as deleted */
       DB_QueryUPDATE ("can not remove exam announcements of a course",
@@ -2836,10 +2844,9 @@ void Crs_UpdateCrsLast (void)
    if (Gbl.Hierarchy.Level == Hie_Lvl_CRS &&	// Course selected
        Gbl.Usrs.Me.Role.Logged >= Rol_STD)
       /***** Update my last access to current course *****/
-      DB_QueryUPDATE ("can not update last access to current course",
-		      "REPLACE INTO crs_last (CrsCod,LastTime)"
-		      " VALUES (%ld,NOW())",
-	              Gbl.Hierarchy.Crs.CrsCod);
+      DB_DeferQuery ("REPLACE INTO crs_last (CrsCod,LastTime)"
+		     " VALUES (%ld,NOW())",
+	             Gbl.Hierarchy.Crs.CrsCod);
   }
 
 /*****************************************************************************/
@@ -426,12 +426,10 @@ static void CrsCfg_Indicators (void)
    extern const char *Txt_Indicators;
    extern const char *Txt_of_PART_OF_A_TOTAL;
    struct Ind_IndicatorsCrs IndicatorsCrs;
-   int NumIndicatorsFromDB = Ind_GetNumIndicatorsCrsFromDB (Gbl.Hierarchy.Crs.CrsCod);
    char *Title;
 
-   /***** Compute indicators ******/
-   Ind_ComputeAndStoreIndicatorsCrs (Gbl.Hierarchy.Crs.CrsCod,
-				     NumIndicatorsFromDB,&IndicatorsCrs);
+   /***** Get indicators ******/
+   Ind_GetIndicatorsCrs (Gbl.Hierarchy.Crs.CrsCod,&IndicatorsCrs);
 
    /***** Number of indicators *****/
    HTM_TR_Begin (NULL);
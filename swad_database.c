@@ -28,11 +28,15 @@
 
 #define _GNU_SOURCE 		// For vasprintf
 #include <mysql/mysql.h>	// To access MySQL databases
+#include <ctype.h>		// For isalnum, isdigit
 #include <stdarg.h>		// For va_start, va_end
 #include <stddef.h>		// For NULL
 #include <stdio.h>		// For FILE, vasprintf
-#include <stdlib.h>		// For free
+#include <stdlib.h>		// For calloc, free, malloc, realloc
+#include <string.h>		// For memcpy, memset, strlen
+#include <sys/time.h>		// For gettimeofday
 
+#include "swad_action.h"
 #include "swad_config.h"
 #include "swad_database.h"
 #include "swad_global.h"
@@ -45,15 +49,78 @@
 
 extern struct Globals Gbl;
 
+/*****************************************************************************/
+/***************************** Private constants *****************************/
+/*****************************************************************************/
+
+#define DB_MAX_CALL_SITES	256	// Maximum number of call sites accounted in a request
+#define DB_MAX_CHARS_CALL_SITE	(255 - 1)	// 254
+
+/*****************************************************************************/
+/******************************* Private types *******************************/
+/*****************************************************************************/
+
+struct DB_CallSite
+  {
+   long ActCod;			// Action being executed when calling
+   const char *MsgError;	// Description passed to query function
+   unsigned long NumCalls;
+   unsigned long NumRows;
+   long Time;			// Microseconds
+  };
+
+#if !defined (MARIADB_BASE_VERSION) && MYSQL_VERSION_ID >= 80001
+typedef bool my_bool;	// my_bool was removed in MySQL 8.0
+#endif
+
+struct DB_StmtResult
+  {
+   unsigned NumFields;
+   MYSQL_BIND *Bind;		// Columns are got as strings
+   char **Buffers;		// Buffer for each column
+   unsigned long *Lengths;	// Length of each column in current row
+   my_bool *IsNull;		// Is each column NULL in current row?
+   MYSQL_ROW Row;		// Current row, as returned by mysql_fetch_row
+  };
+
 /*****************************************************************************/
 /************************* Private global variables **************************/
 /*****************************************************************************/
 
+static char *DB_DeferredQueries = NULL;		// Write queries separated by ';'
+static size_t DB_DeferredQueriesLength = 0;
+
+static struct DB_Stmt *DB_PreparedStmts = NULL;	// Statements prepared in this connection
+
+static struct
+  {
+   unsigned long NumQueries;
+   unsigned long NumRows;
+   long Time;			// Microseconds
+   unsigned NumCallSites;
+   struct DB_CallSite CallSites[DB_MAX_CALL_SITES];
+  } DB_QueryStats;		// Queries made in this request
+
 /*****************************************************************************/
 /***************************** Private prototypes ****************************/
 /*****************************************************************************/
 
 static void DB_CreateTable (const char *Query);
+static void DB_ExecuteDeferredQueries (void);
+static void DB_CloseStmts (void);
+
+static void DB_AccountQuery (const struct timeval *tvStart,
+                             const char *MsgError,const char *Query,
+			     unsigned long NumRows);
+static void DB_StoreQueryStats (void);
+static void DB_RemoveParamsFromQuery (char *Dst,const char *Src);
+static void DB_EscapeCallSite (char CallSite[2 * DB_MAX_CHARS_CALL_SITE + 1],
+			       const char *MsgError);
+
+static void DB_StmtPrepare (struct DB_Stmt *Stmt,const char *MsgError);
+static void DB_StmtExecute (struct DB_Stmt *Stmt,const char *MsgError,
+                            va_list ap,struct timeval *tvStart);
+static void DB_ExitOnStmtError (const struct DB_Stmt *Stmt,const char *MsgError);
 static unsigned long DB_QuerySELECTusingQueryStr (char *Query,
 					          MYSQL_RES **mysql_res,
 						  const char *MsgError);
@@ -155,14 +222,16 @@ mysql> DESCRIBE actions_MFU;
 | ActCod    | int(11)  | NO   | PRI | NULL    |       |
 | Score     | float    | NO   |     | NULL    |       |
 | LastClick | datetime | NO   |     | NULL    |       |
+| Epoch     | int(11)  | NO   |     | 0       |       |
 +-----------+----------+------+-----+---------+-------+
-4 rows in set (0.01 sec)
+5 rows in set (0.01 sec)
 */
    DB_CreateTable ("CREATE TABLE IF NOT EXISTS actions_MFU ("
 			"UsrCod INT NOT NULL,"
 			"ActCod INT NOT NULL,"
 			"Score FLOAT NOT NULL,"
 			"LastClick DATETIME NOT NULL,"
+			"Epoch INT NOT NULL DEFAULT 0,"
 		   "UNIQUE INDEX(UsrCod,ActCod))");
 
 /***** Table admin *****/
@@ -637,9 +706,8 @@ mysql> DESCRIBE courses;
 | RequesterUsrCod | int(11)       | NO   |     | -1      |                |
 | ShortName       | varchar(511)  | NO   |     | NULL    |                |
 | FullName        | varchar(2047) | NO   |     | NULL    |                |
-| NumIndicators   | int(11)       | NO   |     | -1      |                |
 +-----------------+---------------+------+-----+---------+----------------+
-9 rows in set (0,00 sec)
+8 rows in set (0,00 sec)
 */
    DB_CreateTable ("CREATE TABLE IF NOT EXISTS courses ("
 			"CrsCod INT NOT NULL AUTO_INCREMENT,"
@@ -650,7 +718,6 @@ mysql> DESCRIBE courses;
 			"RequesterUsrCod INT NOT NULL DEFAULT -1,"
 			"ShortName VARCHAR(511) COLLATE latin1_spanish_ci NOT NULL,"	// Cns_HIERARCHY_MAX_BYTES_SHRT_NAME
 			"FullName VARCHAR(2047) COLLATE latin1_spanish_ci NOT NULL,"	// Cns_HIERARCHY_MAX_BYTES_FULL_NAME
-			"NumIndicators INT NOT NULL DEFAULT -1,"
 		   "UNIQUE INDEX(CrsCod),"
 		   "INDEX(DegCod,Year),"
 		   "INDEX(Status))");
@@ -728,6 +795,49 @@ mysql> DESCRIBE crs_grp_usr;
 		   "INDEX(GrpCod),"
 		   "INDEX(UsrCod))");
 
+   /***** Table crs_indicators *****/
+/*
+mysql> DESCRIBE crs_indicators;
++-------------------+------------+------+-----+---------+-------+
+| Field             | Type       | Null | Key | Default | Extra |
++-------------------+------------+------+-----+---------+-------+
+| CrsCod            | int(11)    | NO   | PRI | NULL    |       |
+| Indicators        | tinyint(4) | NO   |     | 0       |       |
+| NumIndicators     | tinyint(4) | NO   | MUL | 0       |       |
+| NumFilesDocum     | int(11)    | NO   |     | 0       |       |
+| NumFilesShare     | int(11)    | NO   |     | 0       |       |
+| NumFilesAssig     | int(11)    | NO   |     | 0       |       |
+| NumFilesWorks     | int(11)    | NO   |     | 0       |       |
+| SyllabusLecSrc    | tinyint(4) | NO   |     | 0       |       |
+| SyllabusPraSrc    | tinyint(4) | NO   |     | 0       |       |
+| TeachingGuideSrc  | tinyint(4) | NO   |     | 0       |       |
+| AssessmentSrc     | tinyint(4) | NO   |     | 0       |       |
+| NumAssignments    | int(11)    | NO   |     | 0       |       |
+| NumThreads        | int(11)    | NO   |     | 0       |       |
+| NumPosts          | int(11)    | NO   |     | 0       |       |
+| NumMsgsSentByTchs | int(11)    | NO   |     | 0       |       |
++-------------------+------------+------+-----+---------+-------+
+15 rows in set (0,00 sec)
+*/
+   DB_CreateTable ("CREATE TABLE IF NOT EXISTS crs_indicators ("
+			"CrsCod INT NOT NULL,"
+			"Indicators TINYINT NOT NULL DEFAULT 0,"
+			"NumIndicators TINYINT NOT NULL DEFAULT 0,"
+			"NumFilesDocum INT NOT NULL DEFAULT 0,"
+			"NumFilesShare INT NOT NULL DEFAULT 0,"
+			"NumFilesAssig INT NOT NULL DEFAULT 0,"
+			"NumFilesWorks INT NOT NULL DEFAULT 0,"
+			"SyllabusLecSrc TINYINT NOT NULL DEFAULT 0,"
+			"SyllabusPraSrc TINYINT NOT NULL DEFAULT 0,"
+			"TeachingGuideSrc TINYINT NOT NULL DEFAULT 0,"
+			"AssessmentSrc TINYINT NOT NULL DEFAULT 0,"
+			"NumAssignments INT NOT NULL DEFAULT 0,"
+			"NumThreads INT NOT NULL DEFAULT 0,"
+			"NumPosts INT NOT NULL DEFAULT 0,"
+			"NumMsgsSentByTchs INT NOT NULL DEFAULT 0,"
+		   "UNIQUE INDEX(CrsCod),"
+		   "INDEX(NumIndicators))");
+
    /***** Table crs_info_read *****/
 /*
 mysql> DESCRIBE crs_info_read;
@@ -844,6 +954,29 @@ mysql> DESCRIBE crs_records;
 			"Txt TEXT NOT NULL,"	// Cns_MAX_BYTES_TEXT
 		   "UNIQUE INDEX(FieldCod,UsrCod))");
 
+   /***** Table crs_rss *****/
+/*
+mysql> DESCRIBE crs_rss;
++-----------+---------------+------+-----+---------+-------+
+| Field     | Type          | Null | Key | Default | Extra |
++-----------+---------------+------+-----+---------+-------+
+| CrsCod    | int(11)       | NO   | PRI | NULL    |       |
+| Changed   | enum('N','Y') | NO   | MUL | N       |       |
+| BuildTime | datetime      | NO   |     | NULL    |       |
+| ETag      | char(43)      | NO   |     |         |       |
+| ModifTime | datetime      | NO   |     | NULL    |       |
++-----------+---------------+------+-----+---------+-------+
+5 rows in set (0.00 sec)
+*/
+   DB_CreateTable ("CREATE TABLE IF NOT EXISTS crs_rss ("
+			"CrsCod INT NOT NULL,"
+			"Changed ENUM('N','Y') NOT NULL DEFAULT 'N',"
+			"BuildTime DATETIME NOT NULL,"
+			"ETag CHAR(43) NOT NULL DEFAULT '',"	// Cry_BYTES_ENCRYPTED_STR_SHA256_BASE64
+			"ModifTime DATETIME NOT NULL,"
+		   "UNIQUE INDEX(CrsCod),"
+		   "INDEX(Changed,BuildTime))");
+
    /***** Table crs_usr *****/
 /*
 mysql> DESCRIBE crs_usr;
@@ -929,6 +1062,75 @@ mysql> DESCRIBE crs_usr_requests;
 		   "UNIQUE INDEX(CrsCod,UsrCod),"
 		   "INDEX(UsrCod))");
 
+   /***** Table db_act_stats *****/
+/*
+mysql> DESCRIBE db_act_stats;
++-------------+------------+------+-----+---------+-------+
+| Field       | Type       | Null | Key | Default | Extra |
++-------------+------------+------+-----+---------+-------+
+| ActCod      | int(11)    | NO   | PRI | NULL    |       |
+| NumRequests | bigint(20) | NO   |     | 0       |       |
+| NumQueries  | bigint(20) | NO   |     | 0       |       |
+| NumRows     | bigint(20) | NO   |     | 0       |       |
+| Time        | bigint(20) | NO   |     | 0       |       |
++-------------+------------+------+-----+---------+-------+
+5 rows in set (0.00 sec)
+*/
+   DB_CreateTable ("CREATE TABLE IF NOT EXISTS db_act_stats ("
+			"ActCod INT NOT NULL,"
+			"NumRequests BIGINT NOT NULL DEFAULT 0,"
+			"NumQueries BIGINT NOT NULL DEFAULT 0,"
+			"NumRows BIGINT NOT NULL DEFAULT 0,"
+			"Time BIGINT NOT NULL DEFAULT 0,"
+		   "UNIQUE INDEX(ActCod))");
+
+   /***** Table db_query_stats *****/
+/*
+mysql> DESCRIBE db_query_stats;
++----------+--------------+------+-----+---------+-------+
+| Field    | Type         | Null | Key | Default | Extra |
++----------+--------------+------+-----+---------+-------+
+| ActCod   | int(11)      | NO   | PRI | NULL    |       |
+| CallSite | varchar(255) | NO   | PRI | NULL    |       |
+| NumCalls | bigint(20)   | NO   |     | 0       |       |
+| NumRows  | bigint(20)   | NO   |     | 0       |       |
+| Time     | bigint(20)   | NO   |     | 0       |       |
++----------+--------------+------+-----+---------+-------+
+5 rows in set (0.00 sec)
+*/
+   DB_CreateTable ("CREATE TABLE IF NOT EXISTS db_query_stats ("
+			"ActCod INT NOT NULL,"
+			"CallSite VARCHAR(255) NOT NULL,"
+			"NumCalls BIGINT NOT NULL DEFAULT 0,"
+			"NumRows BIGINT NOT NULL DEFAULT 0,"
+			"Time BIGINT NOT NULL DEFAULT 0,"
+		   "UNIQUE INDEX(ActCod,CallSite))");
+
+   /***** Table db_slow_queries *****/
+/*
+mysql> DESCRIBE db_slow_queries;
++-----------+--------------+------+-----+---------+-------+
+| Field     | Type         | Null | Key | Default | Extra |
++-----------+--------------+------+-----+---------+-------+
+| ActCod    | int(11)      | NO   | MUL | NULL    |       |
+| CallSite  | varchar(255) | NO   |     | NULL    |       |
+| ClickTime | datetime     | NO   | MUL | NULL    |       |
+| NumRows   | bigint(20)   | NO   |     | 0       |       |
+| Time      | bigint(20)   | NO   |     | 0       |       |
+| Query     | longtext     | NO   |     | NULL    |       |
++-----------+--------------+------+-----+---------+-------+
+6 rows in set (0.00 sec)
+*/
+   DB_CreateTable ("CREATE TABLE IF NOT EXISTS db_slow_queries ("
+			"ActCod INT NOT NULL,"
+			"CallSite VARCHAR(255) NOT NULL,"
+			"ClickTime DATETIME NOT NULL,"
+			"NumRows BIGINT NOT NULL DEFAULT 0,"
+			"Time BIGINT NOT NULL DEFAULT 0,"
+			"Query LONGTEXT NOT NULL,"
+		   "INDEX(ActCod),"
+		   "INDEX(ClickTime))");
+
    /***** Table deg_types *****/
 /*
 mysql> DESCRIBE deg_types;
@@ -1632,8 +1834,10 @@ mysql> DESCRIBE forum_thread;
 | Location    | int(11)    | NO   | MUL | -1      |                |
 | FirstPstCod | int(11)    | NO   | UNI | NULL    |                |
 | LastPstCod  | int(11)    | NO   | UNI | NULL    |                |
+| NumPsts     | int(11)    | NO   |     | 0       |                |
+| NumWriters  | int(11)    | NO   |     | 0       |                |
 +-------------+------------+------+-----+---------+----------------+
-5 rows in set (0.00 sec)
+7 rows in set (0.00 sec)
 */
    DB_CreateTable ("CREATE TABLE IF NOT EXISTS forum_thread ("
 			"ThrCod INT NOT NULL AUTO_INCREMENT,"
@@ -1641,6 +1845,8 @@ mysql> DESCRIBE forum_thread;
 			"Location INT NOT NULL DEFAULT -1,"
 			"FirstPstCod INT NOT NULL,"
 			"LastPstCod INT NOT NULL,"
+			"NumPsts INT NOT NULL DEFAULT 0,"
+			"NumWriters INT NOT NULL DEFAULT 0,"
 		   "UNIQUE INDEX(ThrCod),"
 		   "INDEX(ForumType),"
 		   "INDEX(Location),"
@@ -1715,7 +1921,8 @@ mysql> DESCRIBE mch_answers;
 			"QstInd INT NOT NULL,"
 			"NumOpt TINYINT NOT NULL,"	// Number of button on screen (Always ordered: 0,1,2,3)
 			"AnsInd TINYINT NOT NULL,"	// Answer index (Can be shuffled: 0,3,1,2)
-		   "UNIQUE INDEX(MchCod,UsrCod,QstInd))");
+		   "UNIQUE INDEX(MchCod,UsrCod,QstInd),"
+		   "INDEX(MchCod,QstInd,AnsInd))");
 
    /***** Table mch_groups *****/
 /*
@@ -2201,21 +2408,49 @@ mysql> DESCRIBE mail_domains;
    /***** Table marks_properties *****/
 /*
 mysql> DESCRIBE marks_properties;
-+--------+---------+------+-----+---------+-------+
-| Field  | Type    | Null | Key | Default | Extra |
-+--------+---------+------+-----+---------+-------+
-| FilCod | int(11) | NO   | PRI | NULL    |       |
-| Header | int(11) | NO   |     | NULL    |       |
-| Footer | int(11) | NO   |     | NULL    |       |
-+--------+---------+------+-----+---------+-------+
-3 rows in set (0.00 sec)
++-----------+---------+------+-----+---------+-------+
+| Field     | Type    | Null | Key | Default | Extra |
++-----------+---------+------+-----+---------+-------+
+| FilCod    | int(11) | NO   | PRI | NULL    |       |
+| Header    | int(11) | NO   |     | NULL    |       |
+| Footer    | int(11) | NO   |     | NULL    |       |
+| FileSize  | int(11) | NO   |     | -1      |       |
+| FileTime  | int(11) | NO   |     | 0       |       |
+| HeadEnd   | int(11) | NO   |     | 0       |       |
+| FootStart | int(11) | NO   |     | 0       |       |
++-----------+---------+------+-----+---------+-------+
+7 rows in set (0.00 sec)
 */
    DB_CreateTable ("CREATE TABLE IF NOT EXISTS marks_properties ("
 			"FilCod INT NOT NULL,"
 			"Header INT NOT NULL,"
 			"Footer INT NOT NULL,"
+			"FileSize INT NOT NULL DEFAULT -1,"
+			"FileTime INT NOT NULL DEFAULT 0,"
+			"HeadEnd INT NOT NULL DEFAULT 0,"
+			"FootStart INT NOT NULL DEFAULT 0,"
 		   "UNIQUE INDEX(FilCod))");
 
+   /***** Table marks_rows *****/
+/*
+mysql> DESCRIBE marks_rows;
++----------+----------+------+-----+---------+-------+
+| Field    | Type     | Null | Key | Default | Extra |
++----------+----------+------+-----+---------+-------+
+| FilCod   | int(11)  | NO   | PRI | NULL    |       |
+| UsrID    | char(16) | NO   | PRI | NULL    |       |
+| RowStart | int(11)  | NO   |     | NULL    |       |
+| RowEnd   | int(11)  | NO   |     | NULL    |       |
++----------+----------+------+-----+---------+-------+
+4 rows in set (0.00 sec)
+*/
+   DB_CreateTable ("CREATE TABLE IF NOT EXISTS marks_rows ("
+			"FilCod INT NOT NULL,"
+			"UsrID CHAR(16) NOT NULL,"	// ID_MAX_BYTES_USR_ID
+			"RowStart INT NOT NULL,"
+			"RowEnd INT NOT NULL,"
+		   "UNIQUE INDEX(FilCod,UsrID))");
+
    /***** Table media *****/
 /*
 mysql> DESCRIBE media;
@@ -2897,8 +3132,9 @@ mysql> DESCRIBE surveys;
 | EndTime   | datetime                                  | NO   |     | NULL    |                |
 | Title     | varchar(2047)                             | NO   |     | NULL    |                |
 | Txt       | text                                      | NO   |     | NULL    |                |
+| NumUsrs   | int(11)                                   | NO   |     | 0       |                |
 +-----------+-------------------------------------------+------+-----+---------+----------------+
-13 rows in set (0,00 sec)
+14 rows in set (0,00 sec)
 */
    DB_CreateTable ("CREATE TABLE IF NOT EXISTS surveys ("
 			"SvyCod INT NOT NULL AUTO_INCREMENT,"
@@ -2912,6 +3148,7 @@ mysql> DESCRIBE surveys;
 			"EndTime DATETIME NOT NULL,"
 			"Title VARCHAR(2047) NOT NULL,"	// Svy_MAX_BYTES_SURVEY_TITLE
 			"Txt TEXT NOT NULL,"		// Cns_MAX_BYTES_TEXT
+			"NumUsrs INT NOT NULL DEFAULT 0,"	// Users who have answered (svy_users)
 		   "UNIQUE INDEX(SvyCod),"
 		   "INDEX(Scope,Cod))");
 
@@ -3581,6 +3818,30 @@ mysql> DESCRIBE usr_follow;
 		   "UNIQUE INDEX (FollowedCod,FollowerCod),"
 		   "INDEX (FollowTime))");
 
+   /***** Table usr_hits *****/
+/*
+mysql> DESCRIBE usr_hits;
++---------+-------------+------+-----+---------+-------+
+| Field   | Type        | Null | Key | Default | Extra |
++---------+-------------+------+-----+---------+-------+
+| UsrCod  | int(11)     | NO   | PRI | NULL    |       |
+| Year    | smallint(6) | NO   | PRI | NULL    |       |
+| CrsCod  | int(11)     | NO   | PRI | NULL    |       |
+| Role    | tinyint(4)  | NO   | PRI | NULL    |       |
+| ActCod  | int(11)     | NO   | PRI | NULL    |       |
+| NumHits | int(11)     | NO   |     | 0       |       |
++---------+-------------+------+-----+---------+-------+
+6 rows in set (0,00 sec)
+*/
+   DB_CreateTable ("CREATE TABLE IF NOT EXISTS usr_hits ("
+			"UsrCod INT NOT NULL,"
+			"Year SMALLINT NOT NULL,"
+			"CrsCod INT NOT NULL,"
+			"Role TINYINT NOT NULL,"
+			"ActCod INT NOT NULL,"
+			"NumHits INT NOT NULL DEFAULT 0,"
+		   "UNIQUE INDEX(UsrCod,Year,CrsCod,Role,ActCod))");
+
 /***** Table usr_IDs *****/
 /*
 mysql> DESCRIBE usr_IDs;
@@ -3617,8 +3878,9 @@ mysql> DESCRIBE usr_last;
 | LastTime     | datetime                                        | NO   | MUL | NULL    |       |
 | LastAccNotif | datetime                                        | NO   |     | NULL    |       |
 | TimelineUsrs | tinyint(4)                                      | NO   |     | 0       |       |
+| MFUEpoch     | int(11)                                         | NO   |     | 0       |       |
 +--------------+-------------------------------------------------+------+-----+---------+-------+
-9 rows in set (0.01 sec)
+10 rows in set (0.01 sec)
 */
    DB_CreateTable ("CREATE TABLE IF NOT EXISTS usr_last ("
 			"UsrCod INT NOT NULL,"
@@ -3630,6 +3892,7 @@ mysql> DESCRIBE usr_last;
 			"LastTime DATETIME NOT NULL,"
 			"LastAccNotif DATETIME NOT NULL,"
 			"TimelineUsrs TINYINT NOT NULL DEFAULT 0,"
+			"MFUEpoch INT NOT NULL DEFAULT 0,"
 		   "UNIQUE INDEX(UsrCod),"
 		   "INDEX(LastTime))");
 
@@ -3652,6 +3915,32 @@ mysql> DESCRIBE usr_nicknames;
 		   "UNIQUE INDEX(UsrCod,Nickname),"
 		   "UNIQUE INDEX(Nickname))");
 
+   /***** Table usr_ranks *****/
+/*
+mysql> DESCRIBE usr_ranks;
++------------------+---------+------+-----+---------+-------+
+| Field            | Type    | Null | Key | Default | Extra |
++------------------+---------+------+-----+---------+-------+
+| UsrCod           | int(11) | NO   | PRI | NULL    |       |
+| RankClicks       | int(11) | NO   |     | 0       |       |
+| RankClicksPerDay | int(11) | NO   |     | 0       |       |
+| RankFileViews    | int(11) | NO   |     | 0       |       |
+| RankSocPub       | int(11) | NO   |     | 0       |       |
+| RankForPst       | int(11) | NO   |     | 0       |       |
+| RankMsgSnt       | int(11) | NO   |     | 0       |       |
++------------------+---------+------+-----+---------+-------+
+7 rows in set (0,00 sec)
+*/
+   DB_CreateTable ("CREATE TABLE IF NOT EXISTS usr_ranks ("
+			"UsrCod INT NOT NULL,"
+			"RankClicks INT NOT NULL DEFAULT 0,"
+			"RankClicksPerDay INT NOT NULL DEFAULT 0,"
+			"RankFileViews INT NOT NULL DEFAULT 0,"
+			"RankSocPub INT NOT NULL DEFAULT 0,"
+			"RankForPst INT NOT NULL DEFAULT 0,"
+			"RankMsgSnt INT NOT NULL DEFAULT 0,"
+		   "PRIMARY KEY(UsrCod))");
+
    /***** Table usr_report *****/
 /*
 mysql> DESCRIBE usr_report;
@@ -3779,11 +4068,330 @@ void DB_CloseDBConnection (void)
   {
    if (Gbl.DB.DatabaseIsOpen)
      {
+      DB_StoreQueryStats ();
+      DB_ExecuteDeferredQueries ();
+      DB_CloseStmts ();
       mysql_close (&Gbl.mysql);	// Close the connection to the database
       Gbl.DB.DatabaseIsOpen = false;
      }
   }
 
+/*****************************************************************************/
+/******* Defer a write query until the connection to database is closed ******/
+/*****************************************************************************/
+// Used for bookkeeping writes whose result is not needed in this request
+// (last click, counters...). All of them are sent in one round trip.
+
+void DB_DeferQuery (const char *fmt,...)
+  {
+   va_list ap;
+   int NumBytesPrinted;
+   char *Query;
+   char *DeferredQueries;
+
+   va_start (ap,fmt);
+   NumBytesPrinted = vasprintf (&Query,fmt,ap);
+   va_end (ap);
+   if (NumBytesPrinted < 0)	// -1 if no memory or any other error
+      Lay_NotEnoughMemoryExit ();
+
+   /***** Append query to deferred queries *****/
+   if ((DeferredQueries = realloc (DB_DeferredQueries,
+                                   DB_DeferredQueriesLength +
+                                   (size_t) NumBytesPrinted + 2)) == NULL)
+      Lay_NotEnoughMemoryExit ();
+   DB_DeferredQueries = DeferredQueries;
+   if (DB_DeferredQueriesLength)
+      DB_DeferredQueries[DB_DeferredQueriesLength++] = ';';
+   memcpy (&DB_DeferredQueries[DB_DeferredQueriesLength],Query,
+	   (size_t) NumBytesPrinted + 1);
+   DB_DeferredQueriesLength += (size_t) NumBytesPrinted;
+
+   /***** Free query string *****/
+   free (Query);
+  }
+
+/*****************************************************************************/
+/************* Execute deferred queries in a single round trip ***************/
+/*****************************************************************************/
+
+static void DB_ExecuteDeferredQueries (void)
+  {
+   static bool Executed = false;	// Avoid recursion on error
+   char *Queries;
+   MYSQL_RES *mysql_res;
+   int Result;
+
+   /***** Trivial check: are there queries to execute? *****/
+   if (!DB_DeferredQueries)
+      return;
+
+   /***** Detach deferred queries *****/
+   Queries = DB_DeferredQueries;
+   DB_DeferredQueries = NULL;
+   DB_DeferredQueriesLength = 0;
+   if (Executed)
+     {
+      free (Queries);
+      return;
+     }
+   Executed = true;
+
+   /***** Query database and free query string pointer.
+          Multiple statements are enabled only for these queries *****/
+   if (mysql_set_server_option (&Gbl.mysql,MYSQL_OPTION_MULTI_STATEMENTS_ON))
+      DB_ExitOnMySQLError ("can not enable multiple statements");
+   Result = mysql_query (&Gbl.mysql,Queries);	// Returns 0 on success
+   free (Queries);
+   if (Result)
+      DB_ExitOnMySQLError ("can not execute deferred queries");
+
+   /***** Get the result of each statement *****/
+   do
+     {
+      if ((mysql_res = mysql_store_result (&Gbl.mysql)))
+	 mysql_free_result (mysql_res);
+      if ((Result = mysql_next_result (&Gbl.mysql)) > 0)	// Returns 0 if more results, -1 if no more results
+	 DB_ExitOnMySQLError ("can not execute deferred queries");
+     }
+   while (Result == 0);
+
+   mysql_set_server_option (&Gbl.mysql,MYSQL_OPTION_MULTI_STATEMENTS_OFF);
+  }
+
+/*****************************************************************************/
+/*** Account a query in this request, in current action and its call site ****/
+/*****************************************************************************/
+// For prepared statements, Query has a '?' instead of each parameter
+
+static void DB_AccountQuery (const struct timeval *tvStart,
+                             const char *MsgError,const char *Query,
+			     unsigned long NumRows)
+  {
+   struct timeval tvEnd;
+   long Time;
+   long ActCod;
+   unsigned NumCallSite;
+   struct DB_CallSite *CallSite;
+   char CallSiteEscaped[2 * DB_MAX_CHARS_CALL_SITE + 1];
+   char *QueryWithoutParams;
+   char *QueryEscaped;
+   size_t Length;
+
+   if (!Cfg_DB_QUERY_STATS)
+      return;
+
+   /***** Compute elapsed time *****/
+   gettimeofday (&tvEnd,NULL);
+   Time = (tvEnd.tv_sec  - tvStart->tv_sec) * 1000000L +
+	   tvEnd.tv_usec - tvStart->tv_usec;
+
+   /***** Account query in this request *****/
+   DB_QueryStats.NumQueries++;
+   DB_QueryStats.NumRows += NumRows;
+   DB_QueryStats.Time    += Time;
+
+   /***** Account query in its call site *****/
+   ActCod = Act_GetActCod (Gbl.Action.Act);
+   for (NumCallSite = 0;
+	NumCallSite < DB_QueryStats.NumCallSites;
+	NumCallSite++)
+     {
+      CallSite = &DB_QueryStats.CallSites[NumCallSite];
+      if (CallSite->ActCod == ActCod &&
+	  CallSite->MsgError == MsgError)	// Usually a string literal
+	 break;
+     }
+   if (NumCallSite == DB_QueryStats.NumCallSites &&
+       NumCallSite < DB_MAX_CALL_SITES)
+     {
+      /* New call site */
+      CallSite = &DB_QueryStats.CallSites[NumCallSite];
+      CallSite->ActCod   = ActCod;
+      CallSite->MsgError = MsgError;
+      CallSite->NumCalls = CallSite->NumRows = 0;
+      CallSite->Time     = 0;
+      DB_QueryStats.NumCallSites++;
+     }
+   if (NumCallSite < DB_QueryStats.NumCallSites)
+     {
+      CallSite = &DB_QueryStats.CallSites[NumCallSite];
+      CallSite->NumCalls++;
+      CallSite->NumRows += NumRows;
+      CallSite->Time    += Time;
+     }
+
+   /***** Store slow query with its SQL, without parameters,
+          which may contain personal data *****/
+   if (Time >= Cfg_DB_SLOW_QUERY_TIME)
+     {
+      Length = strlen (Query);
+      if ((QueryWithoutParams = malloc (Length + 1)) == NULL ||
+	  (QueryEscaped = malloc (Length * 2 + 1)) == NULL)
+	 Lay_NotEnoughMemoryExit ();
+      DB_RemoveParamsFromQuery (QueryWithoutParams,Query);
+      mysql_real_escape_string (&Gbl.mysql,QueryEscaped,
+				QueryWithoutParams,strlen (QueryWithoutParams));
+      free (QueryWithoutParams);
+      DB_EscapeCallSite (CallSiteEscaped,MsgError);
+      DB_DeferQuery ("INSERT INTO db_slow_queries"
+		     " (ActCod,CallSite,ClickTime,NumRows,Time,Query)"
+		     " VALUES"
+		     " (%ld,'%s',NOW(),%lu,%ld,'%s')",
+		     ActCod,CallSiteEscaped,NumRows,Time,QueryEscaped);
+      free (QueryEscaped);
+     }
+  }
+
+/*****************************************************************************/
+/*********** Replace string and numeric literals in a query by '?' ***********/
+/*****************************************************************************/
+// Dst must have room for strlen (Src) + 1 bytes
+
+static void DB_RemoveParamsFromQuery (char *Dst,const char *Src)
+  {
+   char Quote;
+   bool PrevIsIdentifier = false;
+
+   while (*Src)
+     {
+      if (*Src == '\'' || *Src == '"')
+	{
+	 /* Skip string literal, with escaped or doubled quotes */
+	 Quote = *Src++;
+	 while (*Src)
+	   {
+	    if (*Src == '\\' && Src[1])
+	       Src += 2;
+	    else if (*Src == Quote)
+	      {
+	       Src++;
+	       if (*Src != Quote)	// Not a doubled quote
+		  break;
+	       Src++;
+	      }
+	    else
+	       Src++;
+	   }
+	 *Dst++ = '?';
+	 PrevIsIdentifier = false;
+	}
+      else if (isdigit ((unsigned char) *Src) && !PrevIsIdentifier)
+	{
+	 /* Skip numeric literal */
+	 while (isalnum ((unsigned char) *Src) || *Src == '.')
+	    Src++;
+	 *Dst++ = '?';
+	 PrevIsIdentifier = false;
+	}
+      else
+	{
+	 PrevIsIdentifier = isalnum ((unsigned char) *Src) || *Src == '_';
+	 *Dst++ = *Src++;
+	}
+     }
+   *Dst = '\0';
+  }
+
+/*****************************************************************************/
+/****************** Remove old queries stored as slow ones *******************/
+/*****************************************************************************/
+
+void DB_RemoveOldSlowQueries (void)
+  {
+   DB_QueryDELETE ("can not remove old slow queries",
+		   "DELETE LOW_PRIORITY FROM db_slow_queries"
+                   " WHERE ClickTime<FROM_UNIXTIME(UNIX_TIMESTAMP()-%lu)",
+		   (unsigned long) Cfg_TIME_TO_DELETE_SLOW_QUERIES);
+  }
+
+/*****************************************************************************/
+/***** Store queries made in this request, per action and per call site ******/
+/*****************************************************************************/
+// Deferred queries, including these ones, are not accounted
+
+static void DB_StoreQueryStats (void)
+  {
+   unsigned NumCallSite;
+   const struct DB_CallSite *CallSite;
+   char CallSiteEscaped[2 * DB_MAX_CHARS_CALL_SITE + 1];
+
+   if (!Cfg_DB_QUERY_STATS ||
+       !DB_QueryStats.NumQueries)
+      return;
+
+   /***** Store queries made in this request in current action *****/
+   DB_DeferQuery ("INSERT INTO db_act_stats"
+		  " (ActCod,NumRequests,NumQueries,NumRows,Time)"
+		  " VALUES"
+		  " (%ld,1,%lu,%lu,%ld)"
+		  " ON DUPLICATE KEY UPDATE"
+		  " NumRequests=NumRequests+1,"
+		  "NumQueries=NumQueries+VALUES(NumQueries),"
+		  "NumRows=NumRows+VALUES(NumRows),"
+		  "Time=Time+VALUES(Time)",
+		  Act_GetActCod (Gbl.Action.Act),
+		  DB_QueryStats.NumQueries,
+		  DB_QueryStats.NumRows,
+		  DB_QueryStats.Time);
+
+   /***** Store queries made in this request in each call site *****/
+   for (NumCallSite = 0;
+	NumCallSite < DB_QueryStats.NumCallSites;
+	NumCallSite++)
+     {
+      CallSite = &DB_QueryStats.CallSites[NumCallSite];
+      DB_EscapeCallSite (CallSiteEscaped,CallSite->MsgError);
+      DB_DeferQuery ("INSERT INTO db_query_stats"
+		     " (ActCod,CallSite,NumCalls,NumRows,Time)"
+		     " VALUES"
+		     " (%ld,'%s',%lu,%lu,%ld)"
+		     " ON DUPLICATE KEY UPDATE"
+		     " NumCalls=NumCalls+VALUES(NumCalls),"
+		     "NumRows=NumRows+VALUES(NumRows),"
+		     "Time=Time+VALUES(Time)",
+		     CallSite->ActCod,CallSiteEscaped,
+		     CallSite->NumCalls,CallSite->NumRows,CallSite->Time);
+     }
+
+   /***** Reset stats to avoid storing them twice *****/
+   memset (&DB_QueryStats,0,sizeof (DB_QueryStats));
+  }
+
+/*****************************************************************************/
+/************ Escape call site description to be stored in database **********/
+/*****************************************************************************/
+
+static void DB_EscapeCallSite (char CallSite[2 * DB_MAX_CHARS_CALL_SITE + 1],
+			       const char *MsgError)
+  {
+   size_t Length;
+
+   Length = strlen (MsgError);
+   if (Length > DB_MAX_CHARS_CALL_SITE)
+      Length = DB_MAX_CHARS_CALL_SITE;
+   mysql_real_escape_string (&Gbl.mysql,CallSite,MsgError,Length);
+  }
+
+/*****************************************************************************/
+/******** Close statements prepared in current connection to database ********/
+/*****************************************************************************/
+
+static void DB_CloseStmts (void)
+  {
+   struct DB_Stmt *Stmt;
+
+   for (Stmt = DB_PreparedStmts;
+	Stmt != NULL;
+	Stmt = Stmt->Next)
+     {
+      DB_StmtFreeResult (Stmt);
+      mysql_stmt_close (Stmt->Handle);
+      Stmt->Handle = NULL;
+     }
+   DB_PreparedStmts = NULL;
+  }
+
 /*****************************************************************************/
 /********************** Build a query to be used later ***********************/
 /*****************************************************************************/
@@ -3803,6 +4411,36 @@ void DB_BuildQuery (char **Query,const char *fmt,...)
       Lay_NotEnoughMemoryExit ();
   }
 
+/*****************************************************************************/
+/********************* Add text to a query being built ***********************/
+/*****************************************************************************/
+// Used to build queries with a variable number of rows
+
+void DB_AddToQuery (char **Query,const char *fmt,...)
+  {
+   va_list ap;
+   int NumBytesPrinted;
+   char *Txt;
+   char *NewQuery;
+   size_t Length;
+
+   va_start (ap,fmt);
+   NumBytesPrinted = vasprintf (&Txt,fmt,ap);
+   va_end (ap);
+   if (NumBytesPrinted < 0)	// -1 if no memory or any other error
+      Lay_NotEnoughMemoryExit ();
+
+   /***** Append text to query *****/
+   Length = *Query ? strlen (*Query) :
+		     0;
+   if ((NewQuery = realloc (*Query,Length + (size_t) NumBytesPrinted + 1)) == NULL)
+      Lay_NotEnoughMemoryExit ();
+   memcpy (&NewQuery[Length],Txt,(size_t) NumBytesPrinted + 1);
+   *Query = NewQuery;
+
+   free (Txt);
+  }
+
 /*****************************************************************************/
 /******************** Make a SELECT query from database **********************/
 /*****************************************************************************/
@@ -3828,24 +4466,34 @@ static unsigned long DB_QuerySELECTusingQueryStr (char *Query,
 						  const char *MsgError)
   {
    int Result;
+   struct timeval tvStart;
+   unsigned long NumRows = 0;
 
    /***** Check that query string pointer
           does point to an allocated string *****/
    if (Query == NULL)
       Lay_ShowErrorAndExit ("Wrong query string.");
 
-   /***** Query database and free query string pointer *****/
-   Result = mysql_query (&Gbl.mysql,Query);	// Returns 0 on success
+   /***** Query database and store query result *****/
+   gettimeofday (&tvStart,NULL);
+   if ((Result = mysql_query (&Gbl.mysql,Query)) == 0)	// Returns 0 on success
+     {
+      if ((*mysql_res = mysql_store_result (&Gbl.mysql)) == NULL)
+	 Result = 1;
+      else
+	{
+	 NumRows = (unsigned long) mysql_num_rows (*mysql_res);
+	 DB_AccountQuery (&tvStart,MsgError,Query,NumRows);
+	}
+     }
+
+   /***** Free query string pointer *****/
    free (Query);
    if (Result)
       DB_ExitOnMySQLError (MsgError);
 
-   /***** Store query result *****/
-   if ((*mysql_res = mysql_store_result (&Gbl.mysql)) == NULL)
-      DB_ExitOnMySQLError (MsgError);
-
    /***** Return number of rows of result *****/
-   return (unsigned long) mysql_num_rows (*mysql_res);
+   return NumRows;
   }
 
 /*****************************************************************************/
@@ -3899,6 +4547,7 @@ void DB_QueryINSERT (const char *MsgError,const char *fmt,...)
    int NumBytesPrinted;
    char *Query;
    int Result;
+   struct timeval tvStart;
 
    va_start (ap,fmt);
    NumBytesPrinted = vasprintf (&Query,fmt,ap);
@@ -3907,7 +4556,11 @@ void DB_QueryINSERT (const char *MsgError,const char *fmt,...)
       Lay_NotEnoughMemoryExit ();
 
    /***** Query database and free query string pointer *****/
+   gettimeofday (&tvStart,NULL);
    Result = mysql_query (&Gbl.mysql,Query);	// Returns 0 on success
+   if (!Result)
+      DB_AccountQuery (&tvStart,MsgError,Query,
+		       (unsigned long) mysql_affected_rows (&Gbl.mysql));
    free (Query);
    if (Result)
       DB_ExitOnMySQLError (MsgError);
@@ -3923,6 +4576,7 @@ long DB_QueryINSERTandReturnCode (const char *MsgError,const char *fmt,...)
    int NumBytesPrinted;
    char *Query;
    int Result;
+   struct timeval tvStart;
 
    va_start (ap,fmt);
    NumBytesPrinted = vasprintf (&Query,fmt,ap);
@@ -3931,7 +4585,11 @@ long DB_QueryINSERTandReturnCode (const char *MsgError,const char *fmt,...)
       Lay_NotEnoughMemoryExit ();
 
    /***** Query database and free query string pointer *****/
+   gettimeofday (&tvStart,NULL);
    Result = mysql_query (&Gbl.mysql,Query);	// Returns 0 on success
+   if (!Result)
+      DB_AccountQuery (&tvStart,MsgError,Query,
+		       (unsigned long) mysql_affected_rows (&Gbl.mysql));
    free (Query);
    if (Result)
       DB_ExitOnMySQLError (MsgError);
@@ -3950,6 +4608,7 @@ void DB_QueryREPLACE (const char *MsgError,const char *fmt,...)
    int NumBytesPrinted;
    char *Query;
    int Result;
+   struct timeval tvStart;
 
    va_start (ap,fmt);
    NumBytesPrinted = vasprintf (&Query,fmt,ap);
@@ -3958,7 +4617,11 @@ void DB_QueryREPLACE (const char *MsgError,const char *fmt,...)
       Lay_NotEnoughMemoryExit ();
 
    /***** Query database and free query string pointer *****/
+   gettimeofday (&tvStart,NULL);
    Result = mysql_query (&Gbl.mysql,Query);	// Returns 0 on success
+   if (!Result)
+      DB_AccountQuery (&tvStart,MsgError,Query,
+		       (unsigned long) mysql_affected_rows (&Gbl.mysql));
    free (Query);
    if (Result)
       DB_ExitOnMySQLError (MsgError);
@@ -3974,6 +4637,7 @@ void DB_QueryUPDATE (const char *MsgError,const char *fmt,...)
    int NumBytesPrinted;
    char *Query;
    int Result;
+   struct timeval tvStart;
 
    va_start (ap,fmt);
    NumBytesPrinted = vasprintf (&Query,fmt,ap);
@@ -3982,7 +4646,11 @@ void DB_QueryUPDATE (const char *MsgError,const char *fmt,...)
       Lay_NotEnoughMemoryExit ();
 
    /***** Query database and free query string pointer *****/
+   gettimeofday (&tvStart,NULL);
    Result = mysql_query (&Gbl.mysql,Query);	// Returns 0 on success
+   if (!Result)
+      DB_AccountQuery (&tvStart,MsgError,Query,
+		       (unsigned long) mysql_affected_rows (&Gbl.mysql));
    free (Query);
    if (Result)
       DB_ExitOnMySQLError (MsgError);
@@ -3998,6 +4666,7 @@ void DB_QueryDELETE (const char *MsgError,const char *fmt,...)
    int NumBytesPrinted;
    char *Query;
    int Result;
+   struct timeval tvStart;
 
    va_start (ap,fmt);
    NumBytesPrinted = vasprintf (&Query,fmt,ap);
@@ -4006,7 +4675,11 @@ void DB_QueryDELETE (const char *MsgError,const char *fmt,...)
       Lay_NotEnoughMemoryExit ();
 
    /***** Query database and free query string pointer *****/
+   gettimeofday (&tvStart,NULL);
    Result = mysql_query (&Gbl.mysql,Query);	// Returns 0 on success
+   if (!Result)
+      DB_AccountQuery (&tvStart,MsgError,Query,
+		       (unsigned long) mysql_affected_rows (&Gbl.mysql));
    free (Query);
    if (Result)
       DB_ExitOnMySQLError (MsgError);
@@ -4022,6 +4695,7 @@ void DB_Query (const char *MsgError,const char *fmt,...)
    int NumBytesPrinted;
    char *Query;
    int Result;
+   struct timeval tvStart;
 
    va_start (ap,fmt);
    NumBytesPrinted = vasprintf (&Query,fmt,ap);
@@ -4030,12 +4704,246 @@ void DB_Query (const char *MsgError,const char *fmt,...)
       Lay_NotEnoughMemoryExit ();
 
    /***** Query database and free query string pointer *****/
+   gettimeofday (&tvStart,NULL);
    Result = mysql_query (&Gbl.mysql,Query);	// Returns 0 on success
+   if (!Result)
+      DB_AccountQuery (&tvStart,MsgError,Query,
+		       (unsigned long) mysql_affected_rows (&Gbl.mysql));
    free (Query);
    if (Result)
       DB_ExitOnMySQLError (MsgError);
   }
 
+/*****************************************************************************/
+/****************** Make a SELECT prepared query in database *****************/
+/*****************************************************************************/
+// Rows are got with DB_StmtFetchRow and must be freed with DB_StmtFreeResult
+
+unsigned long DB_StmtQuerySELECT (struct DB_Stmt *Stmt,const char *MsgError,...)
+  {
+   va_list ap;
+   MYSQL_RES *Metadata;
+   MYSQL_FIELD *Fields;
+   struct DB_StmtResult *Result;
+   unsigned NumField;
+   unsigned long Size;
+   struct timeval tvStart;
+   unsigned long NumRows;
+
+   /***** Execute statement *****/
+   va_start (ap,MsgError);
+   DB_StmtExecute (Stmt,MsgError,ap,&tvStart);
+   va_end (ap);
+
+   /***** Store result in client *****/
+   if (mysql_stmt_store_result (Stmt->Handle))
+      DB_ExitOnStmtError (Stmt,MsgError);
+   if ((Metadata = mysql_stmt_result_metadata (Stmt->Handle)) == NULL)
+      DB_ExitOnStmtError (Stmt,MsgError);
+
+   /***** Allocate buffers for columns *****/
+   if ((Result = calloc (1,sizeof (*Result))) == NULL)
+      Lay_NotEnoughMemoryExit ();
+   Result->NumFields = mysql_num_fields (Metadata);
+   if ((Result->Bind    = calloc (Result->NumFields,sizeof (*Result->Bind   ))) == NULL ||
+       (Result->Buffers = calloc (Result->NumFields,sizeof (*Result->Buffers))) == NULL ||
+       (Result->Lengths = calloc (Result->NumFields,sizeof (*Result->Lengths))) == NULL ||
+       (Result->IsNull  = calloc (Result->NumFields,sizeof (*Result->IsNull ))) == NULL ||
+       (Result->Row     = calloc (Result->NumFields,sizeof (*Result->Row    ))) == NULL)
+      Lay_NotEnoughMemoryExit ();
+   Stmt->Result = Result;
+
+   Fields = mysql_fetch_fields (Metadata);
+   for (NumField = 0;
+	NumField < Result->NumFields;
+	NumField++)
+     {
+      /* Long columns (text) use the maximum length in result,
+         short columns (numbers, dates...) use their declared length */
+      Size = Fields[NumField].max_length;
+      if (Fields[NumField].length < 256 &&
+	  Fields[NumField].length > Size)
+	 Size = Fields[NumField].length;
+      Size++;	// For the ending '\0'
+      if ((Result->Buffers[NumField] = malloc (Size)) == NULL)
+	 Lay_NotEnoughMemoryExit ();
+
+      Result->Bind[NumField].buffer_type   = MYSQL_TYPE_STRING;
+      Result->Bind[NumField].buffer        = Result->Buffers[NumField];
+      Result->Bind[NumField].buffer_length = Size;
+      Result->Bind[NumField].length        = &Result->Lengths[NumField];
+      Result->Bind[NumField].is_null       = &Result->IsNull[NumField];
+     }
+   mysql_free_result (Metadata);
+
+   if (mysql_stmt_bind_result (Stmt->Handle,Result->Bind))
+      DB_ExitOnStmtError (Stmt,MsgError);
+
+   /***** Return number of rows of result *****/
+   NumRows = (unsigned long) mysql_stmt_num_rows (Stmt->Handle);
+   DB_AccountQuery (&tvStart,MsgError,Stmt->Query,NumRows);
+   return NumRows;
+  }
+
+/*****************************************************************************/
+/************ Get next row of the result of a SELECT prepared query **********/
+/*****************************************************************************/
+// Return NULL if no more rows
+
+MYSQL_ROW DB_StmtFetchRow (struct DB_Stmt *Stmt)
+  {
+   struct DB_StmtResult *Result = Stmt->Result;
+   unsigned NumField;
+
+   if (!Result)
+      return NULL;
+
+   switch (mysql_stmt_fetch (Stmt->Handle))
+     {
+      case 0:
+	 for (NumField = 0;
+	      NumField < Result->NumFields;
+	      NumField++)
+	    if (Result->IsNull[NumField])
+	       Result->Row[NumField] = NULL;
+	    else
+	      {
+	       Result->Buffers[NumField][Result->Lengths[NumField]] = '\0';
+	       Result->Row[NumField] = Result->Buffers[NumField];
+	      }
+	 return Result->Row;
+      case MYSQL_NO_DATA:
+	 return NULL;
+      case MYSQL_DATA_TRUNCATED:
+	 Lay_ShowErrorAndExit ("Data truncated in prepared query.");
+	 return NULL;	// Not reached
+      default:
+	 DB_ExitOnStmtError (Stmt,"can not get row");
+	 return NULL;	// Not reached
+     }
+  }
+
+/*****************************************************************************/
+/******** Free structure that stores the result of a SELECT prepared query ***/
+/*****************************************************************************/
+
+void DB_StmtFreeResult (struct DB_Stmt *Stmt)
+  {
+   struct DB_StmtResult *Result = Stmt->Result;
+   unsigned NumField;
+
+   if (Result)
+     {
+      mysql_stmt_free_result (Stmt->Handle);
+
+      for (NumField = 0;
+	   NumField < Result->NumFields;
+	   NumField++)
+	 free (Result->Buffers[NumField]);
+      free (Result->Row);
+      free (Result->IsNull);
+      free (Result->Lengths);
+      free (Result->Buffers);
+      free (Result->Bind);
+      free (Result);
+      Stmt->Result = NULL;
+     }
+  }
+
+/*****************************************************************************/
+/**** Prepare a statement the first time it is used in this connection *******/
+/*****************************************************************************/
+
+static void DB_StmtPrepare (struct DB_Stmt *Stmt,const char *MsgError)
+  {
+   my_bool UpdateMaxLength = true;
+   size_t NumParams;
+
+   /***** Trivial check: is statement already prepared? *****/
+   if (Stmt->Handle)
+      return;
+
+   /***** Check number of parameters *****/
+   NumParams = strlen (Stmt->ParamTypes);
+   if (NumParams > DB_MAX_STMT_PARAMS)
+      Lay_ShowErrorAndExit ("Too many parameters in prepared query.");
+
+   /***** Prepare statement *****/
+   if ((Stmt->Handle = mysql_stmt_init (&Gbl.mysql)) == NULL)
+      Lay_NotEnoughMemoryExit ();
+   Stmt->Result = NULL;
+   Stmt->Next = DB_PreparedStmts;	// Closed when closing connection
+   DB_PreparedStmts = Stmt;
+   if (mysql_stmt_prepare (Stmt->Handle,Stmt->Query,strlen (Stmt->Query)))
+      DB_ExitOnStmtError (Stmt,MsgError);
+   if (mysql_stmt_param_count (Stmt->Handle) != (unsigned long) NumParams)
+      Lay_ShowErrorAndExit ("Wrong number of parameters in prepared query.");
+
+   /***** Get maximum length of columns when storing results *****/
+   mysql_stmt_attr_set (Stmt->Handle,STMT_ATTR_UPDATE_MAX_LENGTH,&UpdateMaxLength);
+  }
+
+/*****************************************************************************/
+/*************** Bind parameters and execute a prepared statement ************/
+/*****************************************************************************/
+
+static void DB_StmtExecute (struct DB_Stmt *Stmt,const char *MsgError,
+                            va_list ap,struct timeval *tvStart)
+  {
+   MYSQL_BIND Params[DB_MAX_STMT_PARAMS];
+   long long Nums[DB_MAX_STMT_PARAMS];
+   unsigned long Lengths[DB_MAX_STMT_PARAMS];
+   unsigned NumParam;
+   char *Str;
+
+   /***** Prepare statement if not yet prepared *****/
+   DB_StmtPrepare (Stmt,MsgError);
+
+   /***** Free result of previous execution if not yet freed
+          (statements are not re-entrant) *****/
+   DB_StmtFreeResult (Stmt);
+
+   /***** Bind parameters *****/
+   if (Stmt->ParamTypes[0])
+     {
+      memset (Params,0,sizeof (Params));
+      for (NumParam = 0;
+	   Stmt->ParamTypes[NumParam];
+	   NumParam++)
+	 switch (Stmt->ParamTypes[NumParam])
+	   {
+	    case 'l':
+	       Nums[NumParam] = (long long) va_arg (ap,long);
+	       Params[NumParam].buffer_type = MYSQL_TYPE_LONGLONG;
+	       Params[NumParam].buffer      = &Nums[NumParam];
+	       break;
+	    case 'u':
+	       Nums[NumParam] = (long long) va_arg (ap,unsigned);
+	       Params[NumParam].buffer_type = MYSQL_TYPE_LONGLONG;
+	       Params[NumParam].buffer      = &Nums[NumParam];
+	       break;
+	    case 's':
+	       Str = va_arg (ap,char *);
+	       Lengths[NumParam] = (unsigned long) strlen (Str);
+	       Params[NumParam].buffer_type   = MYSQL_TYPE_STRING;
+	       Params[NumParam].buffer        = Str;
+	       Params[NumParam].buffer_length = Lengths[NumParam];
+	       Params[NumParam].length        = &Lengths[NumParam];
+	       break;
+	    default:
+	       Lay_ShowErrorAndExit ("Wrong type of parameter in prepared query.");
+	       break;
+	   }
+      if (mysql_stmt_bind_param (Stmt->Handle,Params))
+	 DB_ExitOnStmtError (Stmt,MsgError);
+     }
+
+   /***** Execute statement *****/
+   gettimeofday (tvStart,NULL);
+   if (mysql_stmt_execute (Stmt->Handle))
+      DB_ExitOnStmtError (Stmt,MsgError);
+  }
+
 /*****************************************************************************/
 /********** Free structure that stores the result of a SELECT query **********/
 /*****************************************************************************/
@@ -4062,3 +4970,16 @@ void DB_ExitOnMySQLError (const char *Message)
              Message,mysql_error (&Gbl.mysql));
    Lay_ShowErrorAndExit (BigErrorMsg);
   }
+
+/*****************************************************************************/
+/********** Abort program due to an error in a prepared statement ************/
+/*****************************************************************************/
+
+static void DB_ExitOnStmtError (const struct DB_Stmt *Stmt,const char *MsgError)
+  {
+   char BigErrorMsg[64 * 1024];
+
+   snprintf (BigErrorMsg,sizeof (BigErrorMsg),"Database error: %s (%s).",
+             MsgError,mysql_stmt_error (Stmt->Handle));
+   Lay_ShowErrorAndExit (BigErrorMsg);
+  }
@@ -29,6 +29,40 @@
 
 #include <mysql/mysql.h>	// To access MySQL databases
 
+/*****************************************************************************/
+/***************************** Public constants ******************************/
+/*****************************************************************************/
+
+#define DB_MAX_STMT_PARAMS 16	// Maximum number of parameters in a prepared statement
+
+/*****************************************************************************/
+/******************************* Public types ********************************/
+/*****************************************************************************/
+
+struct DB_StmtResult;
+
+// A prepared statement is declared static in the function using it,
+// so it is prepared only the first time it is executed in a connection:
+//    static struct DB_Stmt Stmt = DB_STMT ("SELECT ... WHERE UsrCod=?","l");
+// Preparing costs one more round trip to the server, so use it only
+// for queries executed many times in one request; a query executed once
+// per request is faster as a text query.
+// A static statement is not re-entrant: executing it again (for example
+// from a function called while fetching its rows) frees the pending result
+// Parameters are bound in binary form, but columns of the result are got
+// as strings, so rows are read as in text queries
+struct DB_Stmt
+  {
+   const char *Query;		// Query with a '?' for each parameter
+   const char *ParamTypes;	// One char for each parameter:
+				// 'l' = long, 'u' = unsigned, 's' = string
+   MYSQL_STMT *Handle;		// NULL if not yet prepared in this connection
+   struct DB_StmtResult *Result;// Result of last SELECT, NULL if not pending
+   struct DB_Stmt *Next;	// Next statement prepared in this connection
+  };
+
+#define DB_STMT(Query,ParamTypes) {(Query),(ParamTypes),NULL,NULL,NULL}
+
 /*****************************************************************************/
 /***************************** Public prototypes *****************************/
 /*****************************************************************************/
@@ -37,7 +71,12 @@ void DB_CreateTablesIfNotExist (void);
 void DB_OpenDBConnection (void);
 void DB_CloseDBConnection (void);
 
+void DB_DeferQuery (const char *fmt,...);
+
+void DB_RemoveOldSlowQueries (void);
+
 void DB_BuildQuery (char **Query,const char *fmt,...);
+void DB_AddToQuery (char **Query,const char *fmt,...);
 
 unsigned long DB_QuerySELECT (MYSQL_RES **mysql_res,const char *MsgError,
                               const char *fmt,...);
@@ -56,6 +95,10 @@ void DB_QueryDELETE (const char *MsgError,const char *fmt,...);
 
 void DB_Query (const char *MsgError,const char *fmt,...);
 
+unsigned long DB_StmtQuerySELECT (struct DB_Stmt *Stmt,const char *MsgError,...);
+MYSQL_ROW DB_StmtFetchRow (struct DB_Stmt *Stmt);
+void DB_StmtFreeResult (struct DB_Stmt *Stmt);
+
 void DB_FreeMySQLResult (MYSQL_RES **mysql_res);
 void DB_ExitOnMySQLError (const char *Message);
 
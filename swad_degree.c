@@ -95,8 +95,6 @@ static void Deg_PutIconsEditingDegrees (__attribute__((unused)) void *Args);
 static void Deg_ReceiveFormRequestOrCreateDeg (unsigned Status);
 static void Deg_PutParamOtherDegCod (void *DegCod);
 
-static void Deg_GetDataOfDegreeFromRow (struct Deg_Degree *Deg,MYSQL_ROW row);
-
 static void Deg_UpdateDegNameDB (long DegCod,const char *FieldName,const char *NewDegName);
 
 static void Deg_ShowAlertAndButtonToGoToDeg (void);
@@ -1367,7 +1365,7 @@ bool Deg_GetDataOfDegreeByCod (struct Deg_Degree *Deg)
 /********** Get data of a degree from a row resulting of a query *************/
 /*****************************************************************************/
 
-static void Deg_GetDataOfDegreeFromRow (struct Deg_Degree *Deg,MYSQL_ROW row)
+void Deg_GetDataOfDegreeFromRow (struct Deg_Degree *Deg,MYSQL_ROW row)
   {
    /***** Get degree code (row[0]) *****/
    if ((Deg->DegCod = Str_ConvertStrCodToLongCod (row[0])) < 0)
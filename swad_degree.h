@@ -115,6 +115,7 @@ void Deg_PutParamDegCod (long DegCod);
 long Deg_GetAndCheckParamOtherDegCod (long MinCodAllowed);
 
 bool Deg_GetDataOfDegreeByCod (struct Deg_Degree *Deg);
+void Deg_GetDataOfDegreeFromRow (struct Deg_Degree *Deg,MYSQL_ROW row);
 void Deg_GetShortNameOfDegreeByCod (struct Deg_Degree *Deg);
 long Deg_GetCtrCodOfDegreeByCod (long DegCod);
 long Deg_GetInsCodOfDegreeByCod (long DegCod);
@@ -383,7 +383,7 @@ void ExaAnn_ReceiveExamAnn2 (void)
    TL_Not_StoreAndPublishNote (TL_NOTE_EXAM_ANNOUNCEMENT,ExamAnns->HighlightExaCod);
 
    /***** Update RSS of current course *****/
-   RSS_UpdateRSSFileForACrs (&Gbl.Hierarchy.Crs);
+   RSS_MarkRSSFileForACrsAsChanged (Gbl.Hierarchy.Crs.CrsCod);
 
    /***** Show exam announcements *****/
    ExaAnn_ListExamAnnsEdit ();
@@ -501,7 +501,7 @@ void ExaAnn_RemoveExamAnn1 (void)
    TL_Not_MarkNoteAsUnavailable (TL_NOTE_EXAM_ANNOUNCEMENT,ExaCod);
 
    /***** Update RSS of current course *****/
-   RSS_UpdateRSSFileForACrs (&Gbl.Hierarchy.Crs);
+   RSS_MarkRSSFileForACrsAsChanged (Gbl.Hierarchy.Crs.CrsCod);
   }
 
 void ExaAnn_RemoveExamAnn2 (void)
@@ -29,6 +29,7 @@
 #include <linux/limits.h>	// For PATH_MAX
 #include <stddef.h>		// For NULL
 #include <stdio.h>		// For asprintf
+#include <stdlib.h>		// For calloc, free, bsearch
 #include <string.h>		// For string functions
 
 #include "swad_box.h"
@@ -44,6 +45,7 @@
 #include "swad_global.h"
 #include "swad_ID.h"
 #include "swad_photo.h"
+#include "swad_random.h"
 
 /*****************************************************************************/
 /************** External global variables from others modules ****************/
@@ -55,10 +57,19 @@ extern struct Globals Gbl;
 /***************************** Private constants *****************************/
 /*****************************************************************************/
 
+#define ExaPrn_MAX_ROWS_PER_REGRADE_QUERY	256	// Number of questions written back in each multi-row query
+#define ExaPrn_MAX_BYTES_REGRADE_ROW		128	// SELECT PrnCod AS PrnCod,QstCod AS QstCod,'Score' AS Score
+
 /*****************************************************************************/
 /******************************* Private types *******************************/
 /*****************************************************************************/
 
+struct ExaPrn_AnswerKeys
+  {
+   unsigned Num;			// Number of questions
+   struct Tst_Question *Questions;	// Correct answers of questions, sorted by QstCod
+  };
+
 /*****************************************************************************/
 /***************************** Private variables *****************************/
 /*****************************************************************************/
@@ -149,6 +160,14 @@ static void ExaPrn_GetNumQstsNotBlank (struct ExaPrn_Print *Print);
 static void ExaPrn_ComputeTotalScoreOfPrint (struct ExaPrn_Print *Print);
 static void ExaPrn_UpdatePrintInDB (const struct ExaPrn_Print *Print);
 
+static void ExaPrn_GetAnswerKeysOfSession (long SesCod,
+                                           struct ExaPrn_AnswerKeys *Keys);
+static void ExaPrn_CheckAnswerKey (struct Tst_Question *Key);
+static void ExaPrn_FreeAnswerKeys (struct ExaPrn_AnswerKeys *Keys);
+static int ExaPrn_CompareAnswerKeys (const void *p1,const void *p2);
+static void ExaPrn_StoreRegradedScores (const char *Rows);
+static void ExaPrn_UpdateScoresOfPrintsInSession (long SesCod);
+
 /*****************************************************************************/
 /**************************** Reset exam print *******************************/
 /*****************************************************************************/
@@ -429,23 +448,30 @@ static unsigned ExaPrn_GetSomeQstsFromSetToPrint (struct ExaPrn_Print *Print,
   {
    MYSQL_RES *mysql_res;
    MYSQL_ROW row;
+   MYSQL_ROW SampleRows[ExaPrn_MAX_QUESTIONS_PER_EXAM_PRINT];
+   unsigned NumCandidates;
    unsigned NumQstsInSet;
    unsigned NumQstInSet;
    Tst_AnswerType_t AnswerType;
    bool Shuffle;
 
-   /***** Get questions from database *****/
-   NumQstsInSet = (unsigned)
-		  DB_QuerySELECT (&mysql_res,"can not get questions from set",
-				  "SELECT QstCod,"	// row[0]
-					 "AnsType,"	// row[1]
-					 "Shuffle"	// row[2]
-				  " FROM exa_set_questions"
-				  " WHERE SetCod=%ld"
-				  " ORDER BY RAND()"	// Don't use RAND(NOW()) because the same ordering will be repeated across sets
-				  " LIMIT %u",
-				  Set->SetCod,
-				  Set->NumQstsToPrint);
+   /***** Get candidate questions from database *****/
+   // Don't use ORDER BY RAND(): all the questions in set would be sorted
+   NumCandidates = (unsigned)
+		   DB_QuerySELECT (&mysql_res,"can not get questions from set",
+				   "SELECT QstCod,"	// row[0]
+					  "AnsType,"	// row[1]
+					  "Shuffle"	// row[2]
+				   " FROM exa_set_questions"
+				   " WHERE SetCod=%ld",
+				   Set->SetCod);
+
+   /***** Select a random sample of questions from candidates *****/
+   if (*NumQstInPrint + (Set->NumQstsToPrint < NumCandidates ? Set->NumQstsToPrint :
+							       NumCandidates) > ExaPrn_MAX_QUESTIONS_PER_EXAM_PRINT)
+      Lay_ShowErrorAndExit ("Wrong number of questions.");
+   NumQstsInSet = Rnd_GetSampleOfRows (mysql_res,NumCandidates,
+				       Set->NumQstsToPrint,SampleRows);
 
    /***** Questions in this set *****/
    for (NumQstInSet = 0;
@@ -455,7 +481,7 @@ static unsigned ExaPrn_GetSomeQstsFromSetToPrint (struct ExaPrn_Print *Print,
       Gbl.RowEvenOdd = 1 - Gbl.RowEvenOdd;
 
       /***** Get question data *****/
-      row = mysql_fetch_row (mysql_res);
+      row = SampleRows[NumQstInSet];
       /*
       row[0] QstCod
       row[1] AnsType
@@ -503,6 +529,9 @@ static unsigned ExaPrn_GetSomeQstsFromSetToPrint (struct ExaPrn_Print *Print,
       Print->PrintedQuestions[*NumQstInPrint].Score = 0.0;
      }
 
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+
    return NumQstsInSet;
   }
 
@@ -513,62 +542,8 @@ static unsigned ExaPrn_GetSomeQstsFromSetToPrint (struct ExaPrn_Print *Print,
 static void ExaPrn_GenerateChoiceIndexes (struct TstPrn_PrintedQuestion *PrintedQuestion,
 					  bool Shuffle)
   {
-   struct Tst_Question Question;
-   unsigned NumOpt;
-   MYSQL_RES *mysql_res;
-   MYSQL_ROW row;
-   unsigned Index;
-   bool ErrorInIndex;
-   char StrInd[1 + Cns_MAX_DECIMAL_DIGITS_UINT + 1];
-
-   /***** Create test question *****/
-   Tst_QstConstructor (&Question);
-   Question.QstCod = PrintedQuestion->QstCod;
-
-   /***** Get answers of question from database *****/
-   ExaSet_GetAnswersQst (&Question,&mysql_res,Shuffle);
-   /*
-   row[0] AnsInd
-   row[1] Answer
-   row[2] Feedback
-   row[3] MedCod
-   row[4] Correct
-   */
-
-   for (NumOpt = 0;
-	NumOpt < Question.Answer.NumOptions;
-	NumOpt++)
-     {
-      /***** Get next answer *****/
-      row = mysql_fetch_row (mysql_res);
-
-      /***** Assign index (row[0]).
-             Index is 0,1,2,3... if no shuffle
-             or 1,3,0,2... (example) if shuffle *****/
-      ErrorInIndex = false;
-      if (sscanf (row[0],"%u",&Index) == 1)
-        {
-         if (Index >= Tst_MAX_OPTIONS_PER_QUESTION)
-            ErrorInIndex = true;
-        }
-      else
-         ErrorInIndex = true;
-      if (ErrorInIndex)
-         Lay_ShowErrorAndExit ("Wrong index of answer.");
-
-      if (NumOpt == 0)
-	 snprintf (StrInd,sizeof (StrInd),"%u",Index);
-      else
-	 snprintf (StrInd,sizeof (StrInd),",%u",Index);
-      Str_Concat (PrintedQuestion->StrIndexes,StrInd,
-                  sizeof (PrintedQuestion->StrIndexes) - 1);
-     }
-
-   /***** Free structure that stores the query result *****/
-   DB_FreeMySQLResult (&mysql_res);
-
-   /***** Destroy test question *****/
-   Tst_QstDestructor (&Question);
+   Tst_GetChoiceIndexesFromDB ("exa_set_answers",PrintedQuestion->QstCod,Shuffle,
+			       PrintedQuestion->StrIndexes);
   }
 
 /*****************************************************************************/
@@ -1551,6 +1526,368 @@ static void ExaPrn_UpdatePrintInDB (const struct ExaPrn_Print *Print)
    Str_SetDecimalPointToLocal ();	// Return to local system
   }
 
+/*****************************************************************************/
+/************* Regrade all the exam prints of an exam session ****************/
+/*****************************************************************************/
+// Correct answers are read once for all the questions in the session,
+// every answered question is scored in memory,
+// and scores are written back in a few multi-row queries
+
+void ExaPrn_RegradePrintsInSession (long SesCod,
+                                    unsigned *NumPrints,unsigned *NumQsts)
+  {
+   void (*ExaPrn_ComputeAnsScore[Tst_NUM_ANS_TYPES]) (struct TstPrn_PrintedQuestion *PrintedQuestion,
+				                      const struct Tst_Question *Question) =
+    {
+     [Tst_ANS_INT            ] = TstPrn_ComputeIntAnsScore,
+     [Tst_ANS_FLOAT          ] = TstPrn_ComputeFltAnsScore,
+     [Tst_ANS_TRUE_FALSE     ] = TstPrn_ComputeTF_AnsScore,
+     [Tst_ANS_UNIQUE_CHOICE  ] = TstPrn_ComputeChoAnsScore,
+     [Tst_ANS_MULTIPLE_CHOICE] = TstPrn_ComputeChoAnsScore,
+     [Tst_ANS_TEXT           ] = TstPrn_ComputeTxtAnsScore,
+    };
+   struct ExaPrn_AnswerKeys Keys;
+   struct Tst_Question KeyToFind;
+   const struct Tst_Question *Key;
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   unsigned long NumRows;
+   unsigned long NumRow;
+   long PrnCod;
+   long LastPrnCod = -1L;
+   struct TstPrn_PrintedQuestion PrintedQuestion;
+   char *Rows;
+   size_t RowsSize;
+   unsigned NumRowsInQuery = 0;
+   char Row[ExaPrn_MAX_BYTES_REGRADE_ROW + 1];
+
+   /***** Reset counters *****/
+   *NumPrints = 0;
+   *NumQsts   = 0;
+
+   /***** Get correct answers of all the questions in the session *****/
+   ExaPrn_GetAnswerKeysOfSession (SesCod,&Keys);
+
+   /***** Get questions and answers of all the prints in the session *****/
+   NumRows = DB_QuerySELECT (&mysql_res,"can not get questions of exam prints",
+			     "SELECT exa_print_questions.PrnCod,"	// row[0]
+				    "exa_print_questions.QstCod,"	// row[1]
+				    "exa_print_questions.SetCod,"	// row[2]
+				    "exa_print_questions.Indexes,"	// row[3]
+				    "exa_print_questions.Answers"	// row[4]
+			     " FROM exa_prints,exa_print_questions"
+			     " WHERE exa_prints.SesCod=%ld"
+			     " AND exa_prints.PrnCod=exa_print_questions.PrnCod"
+			     " ORDER BY exa_print_questions.PrnCod,"
+				       "exa_print_questions.QstInd",
+			     SesCod);
+
+   /***** Allocate space for the rows of a multi-row query *****/
+   RowsSize = ExaPrn_MAX_ROWS_PER_REGRADE_QUERY * (ExaPrn_MAX_BYTES_REGRADE_ROW + 1);
+   if ((Rows = malloc (RowsSize + 1)) == NULL)
+      Lay_NotEnoughMemoryExit ();
+   Rows[0] = '\0';
+
+   /***** Score each question of each print *****/
+   for (NumRow = 0;
+	NumRow < NumRows;
+	NumRow++)
+     {
+      row = mysql_fetch_row (mysql_res);
+
+      /* Get print code (row[0]), question code (row[1])
+         and set code (row[2]) */
+      PrnCod                 = Str_ConvertStrCodToLongCod (row[0]);
+      PrintedQuestion.QstCod = Str_ConvertStrCodToLongCod (row[1]);
+      PrintedQuestion.SetCod = Str_ConvertStrCodToLongCod (row[2]);
+      if (PrnCod != LastPrnCod)
+	{
+	 (*NumPrints)++;
+	 LastPrnCod = PrnCod;
+	}
+
+      /* Get indexes for this question (row[3])
+         and answers selected by user for this question (row[4]) */
+      Str_Copy (PrintedQuestion.StrIndexes,row[3],
+                Tst_MAX_BYTES_INDEXES_ONE_QST);
+      Str_Copy (PrintedQuestion.StrAnswers,row[4],
+                Tst_MAX_BYTES_ANSWERS_ONE_QST);
+
+      /* Find correct answer of this question */
+      KeyToFind.QstCod = PrintedQuestion.QstCod;
+      if ((Key = bsearch (&KeyToFind,Keys.Questions,Keys.Num,
+	                  sizeof (Keys.Questions[0]),
+			  ExaPrn_CompareAnswerKeys)) == NULL)
+	 continue;	// Question without answers in set ==> keep current score
+      if (Key->Answer.Type >= Tst_NUM_ANS_TYPES)
+	 continue;	// Unknown type of answer ==> keep current score
+
+      /* Compute question score */
+      ExaPrn_ComputeAnsScore[Key->Answer.Type] (&PrintedQuestion,Key);
+
+      /* Add question score to query */
+      Str_SetDecimalPointToUS ();	// To print the floating point as a dot
+      if (NumRowsInQuery)
+	 snprintf (Row,sizeof (Row)," UNION ALL SELECT %ld,%ld,'%.15lg'",
+		   PrnCod,PrintedQuestion.QstCod,PrintedQuestion.Score);
+      else
+	 snprintf (Row,sizeof (Row),"SELECT %ld AS PrnCod,"
+					   "%ld AS QstCod,"
+					   "'%.15lg' AS Score",
+		   PrnCod,PrintedQuestion.QstCod,PrintedQuestion.Score);
+      Str_SetDecimalPointToLocal ();	// Return to local system
+      Str_Concat (Rows,Row,RowsSize);
+      if (++NumRowsInQuery == ExaPrn_MAX_ROWS_PER_REGRADE_QUERY)
+	{
+	 ExaPrn_StoreRegradedScores (Rows);
+	 Rows[0] = '\0';
+	 NumRowsInQuery = 0;
+	}
+      (*NumQsts)++;
+     }
+   if (NumRowsInQuery)
+      ExaPrn_StoreRegradedScores (Rows);
+
+   /***** Free memory used for the query *****/
+   free (Rows);
+
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+
+   /***** Free correct answers *****/
+   ExaPrn_FreeAnswerKeys (&Keys);
+
+   /***** Update total scores of all the prints in one query *****/
+   if (*NumQsts)
+      ExaPrn_UpdateScoresOfPrintsInSession (SesCod);
+  }
+
+/*****************************************************************************/
+/******** Get correct answers of all the questions in an exam session ********/
+/*****************************************************************************/
+
+static void ExaPrn_GetAnswerKeysOfSession (long SesCod,
+                                           struct ExaPrn_AnswerKeys *Keys)
+  {
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   unsigned long NumRows;
+   unsigned long NumRow;
+   long QstCod;
+   long LastQstCod;
+   struct Tst_Question *Key = NULL;
+   unsigned NumOpt;
+   unsigned NumKey;
+
+   /***** Reset answer keys *****/
+   Keys->Num       = 0;
+   Keys->Questions = NULL;
+
+   /***** Get answers of all the questions used in the prints of the session
+          (one row per answer, sorted by question code) *****/
+   NumRows = DB_QuerySELECT (&mysql_res,"can not get answers of questions",
+			     "SELECT exa_set_questions.QstCod,"	// row[0]
+				    "exa_set_questions.AnsType,"	// row[1]
+				    "exa_set_answers.Answer,"		// row[2]
+				    "exa_set_answers.Correct"		// row[3]
+			     " FROM exa_set_questions,exa_set_answers"
+			     " WHERE exa_set_questions.QstCod IN"
+			     " (SELECT DISTINCT exa_print_questions.QstCod"
+			     " FROM exa_prints,exa_print_questions"
+			     " WHERE exa_prints.SesCod=%ld"
+			     " AND exa_prints.PrnCod=exa_print_questions.PrnCod)"
+			     " AND exa_set_questions.QstCod=exa_set_answers.QstCod"
+			     " ORDER BY exa_set_questions.QstCod,"
+				       "exa_set_answers.AnsInd",
+			     SesCod);
+   if (NumRows == 0)
+     {
+      DB_FreeMySQLResult (&mysql_res);
+      return;
+     }
+
+   /***** Count number of different questions *****/
+   for (NumRow = 0, LastQstCod = -1L;
+	NumRow < NumRows;
+	NumRow++)
+     {
+      row = mysql_fetch_row (mysql_res);
+      if ((QstCod = Str_ConvertStrCodToLongCod (row[0])) != LastQstCod)
+	{
+	 Keys->Num++;
+	 LastQstCod = QstCod;
+	}
+     }
+
+   /***** Allocate memory for the answer keys *****/
+   if ((Keys->Questions = calloc (Keys->Num,sizeof (Keys->Questions[0]))) == NULL)
+      Lay_NotEnoughMemoryExit ();
+
+   /***** Fill answer keys *****/
+   mysql_data_seek (mysql_res,0);
+   for (NumRow = 0, NumKey = 0, LastQstCod = -1L;
+	NumRow < NumRows;
+	NumRow++)
+     {
+      row = mysql_fetch_row (mysql_res);
+
+      /* Get question code (row[0]) and answer type (row[1])
+         when a new question begins */
+      if ((QstCod = Str_ConvertStrCodToLongCod (row[0])) != LastQstCod)
+	{
+	 Key = &Keys->Questions[NumKey++];	// Memory set to zero by calloc
+	 Key->QstCod = QstCod;
+	 Key->Answer.Type = Tst_ConvertFromStrAnsTypDBToAnsTyp (row[1]);
+	 LastQstCod = QstCod;
+	}
+
+      /* Get this answer (row[2]) and its correctness (row[3]) */
+      if ((NumOpt = Key->Answer.NumOptions++) >= Tst_MAX_OPTIONS_PER_QUESTION)
+	 Lay_ShowErrorAndExit ("Wrong number of answers.");
+      switch (Key->Answer.Type)
+	{
+	 case Tst_ANS_INT:
+	    if (sscanf (row[2],"%ld",&Key->Answer.Integer) != 1)
+	       Lay_ShowErrorAndExit ("Wrong integer answer.");
+	    break;
+	 case Tst_ANS_FLOAT:
+	    if (NumOpt < 2)
+	       Key->Answer.FloatingPoint[NumOpt] = Str_GetDoubleFromStr (row[2]);
+	    break;
+	 case Tst_ANS_TRUE_FALSE:
+	    Key->Answer.TF = row[2][0];
+	    break;
+	 case Tst_ANS_UNIQUE_CHOICE:
+	 case Tst_ANS_MULTIPLE_CHOICE:
+	    Key->Answer.Options[NumOpt].Correct = (row[3][0] == 'Y');
+	    break;
+	 case Tst_ANS_TEXT:
+	    if (!Tst_AllocateTextChoiceAnswer (Key,NumOpt))
+	       /* Abort on error */
+	       Ale_ShowAlertsAndExit ();
+	    Str_Copy (Key->Answer.Options[NumOpt].Text,row[2],
+		      Tst_MAX_BYTES_ANSWER_OR_FEEDBACK);
+	    break;
+	 default:
+	    break;
+	}
+     }
+
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+
+   /***** Check number of answers and change format of answers *****/
+   for (NumKey = 0;
+	NumKey < Keys->Num;
+	NumKey++)
+      ExaPrn_CheckAnswerKey (&Keys->Questions[NumKey]);
+  }
+
+/*****************************************************************************/
+/********* Check correct answers of a question got from the database *********/
+/*****************************************************************************/
+
+static void ExaPrn_CheckAnswerKey (struct Tst_Question *Key)
+  {
+   double Tmp;
+
+   switch (Key->Answer.Type)
+     {
+      case Tst_ANS_INT:
+      case Tst_ANS_TRUE_FALSE:
+	 Tst_CheckIfNumberOfAnswersIsOne (Key);
+	 break;
+      case Tst_ANS_FLOAT:
+	 if (Key->Answer.NumOptions != 2)
+	    Lay_ShowErrorAndExit ("Wrong float range.");
+	 if (Key->Answer.FloatingPoint[0] >
+	     Key->Answer.FloatingPoint[1]) 	// The maximum and the minimum are swapped
+	   {
+	    /* Swap maximum and minimum */
+	    Tmp = Key->Answer.FloatingPoint[0];
+	    Key->Answer.FloatingPoint[0] = Key->Answer.FloatingPoint[1];
+	    Key->Answer.FloatingPoint[1] = Tmp;
+	   }
+	 break;
+      case Tst_ANS_TEXT:
+	 Tst_ChangeFormatAnswersText (Key);
+	 break;
+      default:
+	 break;
+     }
+  }
+
+/*****************************************************************************/
+/***************** Free memory used to store answer keys *********************/
+/*****************************************************************************/
+
+static void ExaPrn_FreeAnswerKeys (struct ExaPrn_AnswerKeys *Keys)
+  {
+   unsigned NumKey;
+
+   if (Keys->Questions)
+     {
+      for (NumKey = 0;
+	   NumKey < Keys->Num;
+	   NumKey++)
+	 Tst_FreeTextChoiceAnswers (&Keys->Questions[NumKey]);
+      free (Keys->Questions);
+      Keys->Questions = NULL;
+     }
+   Keys->Num = 0;
+  }
+
+/*****************************************************************************/
+/********* Compare two answer keys by question code (used in bsearch) ********/
+/*****************************************************************************/
+
+static int ExaPrn_CompareAnswerKeys (const void *p1,const void *p2)
+  {
+   long QstCod1 = ((const struct Tst_Question *) p1)->QstCod;
+   long QstCod2 = ((const struct Tst_Question *) p2)->QstCod;
+
+   return (QstCod1 > QstCod2) - (QstCod1 < QstCod2);
+  }
+
+/*****************************************************************************/
+/*********** Store scores of several questions of exam prints ****************/
+/*****************************************************************************/
+// Rows is a derived table (PrnCod,QstCod,Score) built with UNION ALL.
+// Only existing questions of prints are updated; no row is ever inserted
+
+static void ExaPrn_StoreRegradedScores (const char *Rows)
+  {
+   DB_QueryUPDATE ("can not update scores of exam prints",
+		   "UPDATE exa_print_questions,"
+		   "(%s) AS new_scores"
+		   " SET exa_print_questions.Score=new_scores.Score"
+		   " WHERE exa_print_questions.PrnCod=new_scores.PrnCod"
+		   " AND exa_print_questions.QstCod=new_scores.QstCod",
+		   Rows);
+  }
+
+/*****************************************************************************/
+/******* Update number of questions not blank and total score of all *********/
+/*********************** the exam prints in a session ************************/
+/*****************************************************************************/
+
+static void ExaPrn_UpdateScoresOfPrintsInSession (long SesCod)
+  {
+   DB_QueryUPDATE ("can not update exam prints",
+		   "UPDATE exa_prints,"
+		   "(SELECT exa_print_questions.PrnCod AS PrnCod,"
+		           "SUM(exa_print_questions.Answers<>'') AS NumQstsNotBlank,"
+		           "SUM(exa_print_questions.Score) AS Score"
+		   " FROM exa_prints,exa_print_questions"
+		   " WHERE exa_prints.SesCod=%ld"
+		   " AND exa_prints.PrnCod=exa_print_questions.PrnCod"
+		   " GROUP BY exa_print_questions.PrnCod) AS totals"
+		   " SET exa_prints.NumQstsNotBlank=totals.NumQstsNotBlank,"
+		        "exa_prints.Score=totals.Score"
+		   " WHERE exa_prints.PrnCod=totals.PrnCod",
+		   SesCod);
+  }
+
 /*****************************************************************************/
 /********************** Remove exam prints made by a user ********************/
 /*****************************************************************************/
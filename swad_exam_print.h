@@ -90,6 +90,9 @@ void ExaPrn_ReceivePrintAnswer (void);
 void ExaPrn_ComputeAnswerScore (struct TstPrn_PrintedQuestion *PrintedQuestion,
 				struct Tst_Question *Question);
 
+void ExaPrn_RegradePrintsInSession (long SesCod,
+                                    unsigned *NumPrints,unsigned *NumQsts);
+
 void ExaPrn_RemovePrintsMadeByUsrInAllCrss (long UsrCod);
 void ExaPrn_RemovePrintsMadeByUsrInCrs (long UsrCod,long CrsCod);
 void ExaPrn_RemoveCrsPrints (long CrsCod);
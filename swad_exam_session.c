@@ -30,6 +30,7 @@
 #include <stddef.h>		// For NULL
 #include <stdio.h>		// For asprintf
 #include <string.h>		// For string functions
+#include <sys/time.h>		// For gettimeofday
 
 #include "swad_database.h"
 #include "swad_date.h"
@@ -532,6 +533,8 @@ static void ExaSes_ListOneOrMoreSessionsIcons (struct Exa_Exams *Exams,
                                                const struct ExaSes_Session *Session,
 					       const char *Anchor)
   {
+   extern const char *Txt_Regrade;
+
    /***** Begin cell *****/
    HTM_TD_Begin ("class=\"BT%u\"",Gbl.RowEvenOdd);
 
@@ -554,6 +557,12 @@ static void ExaSes_ListOneOrMoreSessionsIcons (struct Exa_Exams *Exams,
    Ico_PutContextualIconToEdit (ActEdiOneExaSes,Anchor,
                                 ExaSes_PutParamsEdit,Exams);
 
+   /***** Icon to regrade the exam session *****/
+   Lay_PutContextualLinkOnlyIcon (ActRegExaSes,Anchor,
+				  ExaSes_PutParamsEdit,Exams,
+				  "spell-check.svg",
+				  Txt_Regrade);
+
    /***** End cell *****/
    HTM_TD_End ();
   }
@@ -1192,6 +1201,50 @@ void ExaSes_UnhideSession (void)
 	                false);	// Do not put form for session
   }
 
+/*****************************************************************************/
+/*********** Regrade all the exam prints of an exam session, useful **********/
+/*********** after correcting a wrong answer in a question        ************/
+/*****************************************************************************/
+
+void ExaSes_RegradeSession (void)
+  {
+   extern const char *Txt_X_exam_prints_with_Y_questions_have_been_regraded_in_Z_seconds;
+   struct Exa_Exams Exams;
+   struct Exa_Exam Exam;
+   struct ExaSes_Session Session;
+   struct timeval tvStart;
+   struct timeval tvEnd;
+   unsigned NumPrints;
+   unsigned NumQsts;
+
+   /***** Reset exams context *****/
+   Exa_ResetExams (&Exams);
+   Exa_ResetExam (&Exam);
+   ExaSes_ResetSession (&Session);
+
+   /***** Get and check parameters *****/
+   ExaSes_GetAndCheckParameters (&Exams,&Exam,&Session);
+
+   /***** Check if I can edit this exam session *****/
+   if (!ExaSes_CheckIfICanEditThisSession (&Session))
+      Lay_NoPermissionExit ();
+
+   /***** Regrade all the prints in this session *****/
+   gettimeofday (&tvStart,NULL);
+   ExaPrn_RegradePrintsInSession (Session.SesCod,&NumPrints,&NumQsts);
+   gettimeofday (&tvEnd,NULL);
+
+   /***** Write number of prints and questions regraded, and time spent *****/
+   Ale_ShowAlert (Ale_SUCCESS,Txt_X_exam_prints_with_Y_questions_have_been_regraded_in_Z_seconds,
+                  NumPrints,NumQsts,
+		  (double) (tvEnd.tv_sec  - tvStart.tv_sec) +
+		  (double) (tvEnd.tv_usec - tvStart.tv_usec) / 1E6);
+
+   /***** Show current exam *****/
+   Exa_ShowOnlyOneExam (&Exams,&Exam,&Session,
+	                false);	// Do not put form for session
+  }
+
 /*****************************************************************************/
 /******************* Params used to edit an exam session *********************/
 /*****************************************************************************/
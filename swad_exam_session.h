@@ -67,6 +67,7 @@ void ExaSes_RemoveUsrFromSessionTablesInCrs (long UsrCod,long CrsCod);
 
 void ExaSes_HideSession (void);
 void ExaSes_UnhideSession (void);
+void ExaSes_RegradeSession (void);
 
 void ExaSes_PutParamsEdit (void *Exams);
 void ExaSes_PutParamSesCod (long SesCod);
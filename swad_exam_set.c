@@ -1441,8 +1441,7 @@ void ExaSet_GetQstDataFromDB (struct Tst_Question *Question)
       DB_FreeMySQLResult (&mysql_res);
 
       /***** Get the answers from the database *****/
-      ExaSet_GetAnswersQst (Question,&mysql_res,
-			    false);	// Don't shuffle
+      ExaSet_GetAnswersQst (Question,&mysql_res);
       /*
       row[0] AnsInd
       row[1] Answer
@@ -1520,8 +1519,7 @@ void ExaSet_GetQstDataFromDB (struct Tst_Question *Question)
 /*************** Get answers of a test question from database ****************/
 /*****************************************************************************/
 
-void ExaSet_GetAnswersQst (struct Tst_Question *Question,MYSQL_RES **mysql_res,
-                           bool Shuffle)
+void ExaSet_GetAnswersQst (struct Tst_Question *Question,MYSQL_RES **mysql_res)
   {
    /***** Get answers of a question from database *****/
    Question->Answer.NumOptions = (unsigned)
@@ -1533,10 +1531,8 @@ void ExaSet_GetAnswersQst (struct Tst_Question *Question,MYSQL_RES **mysql_res,
 			  "Correct"		// row[4]
 		   " FROM exa_set_answers"
 		   " WHERE QstCod=%ld"
-		   " ORDER BY %s",
-		   Question->QstCod,
-		   Shuffle ? "RAND()" :
-		             "AnsInd");
+		   " ORDER BY AnsInd",
+		   Question->QstCod);
    if (!Question->Answer.NumOptions)
       Ale_ShowAlert (Ale_ERROR,"Error when getting answers of a question.");
   }
@@ -1734,8 +1730,7 @@ static void ExaSet_CopyQstFromBankToExamSet (struct ExaSet_Set *Set,long QstCod)
 						 CloneMedCod);
 
       /***** Get the answers from the database *****/
-      Tst_GetAnswersQst (&Question,&mysql_res,
-			 false);	// Don't shuffle
+      Tst_GetAnswersQst (&Question,&mysql_res);
       /*
       row[0] AnsInd
       row[1] Answer
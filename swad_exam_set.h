@@ -63,8 +63,7 @@ void ExaSet_ResetSet (struct ExaSet_Set *Set);
 
 Tst_AnswerType_t ExaSet_GetQstAnswerTypeFromDB (long QstCod);
 void ExaSet_GetQstDataFromDB (struct Tst_Question *Question);
-void ExaSet_GetAnswersQst (struct Tst_Question *Question,MYSQL_RES **mysql_res,
-                           bool Shuffle);
+void ExaSet_GetAnswersQst (struct Tst_Question *Question,MYSQL_RES **mysql_res);
 
 void ExaSet_AddQstsToSet (void);
 
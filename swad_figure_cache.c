@@ -110,6 +110,22 @@ bool FigCch_GetFigureFromCache (FigCch_FigureCached_t Figure,
       [Hie_Lvl_DEG] = (time_t) ( 1UL * 60UL * 60UL),	// Degree
       [Hie_Lvl_CRS] = (time_t) (              60UL),	// Course
      };
+
+   return FigCch_GetFigureFromCacheNotOlderThan (Figure,Scope,Cod,Type,ValuePtr,
+                                                 TimeCached[Scope]);
+  }
+
+/*****************************************************************************/
+/******* Get figure from cache if updated not before than a given time *******/
+/*****************************************************************************/
+// Return true is figure is found (if figure is cached and updated
+// less than TimeCached seconds ago)
+
+bool FigCch_GetFigureFromCacheNotOlderThan (FigCch_FigureCached_t Figure,
+                                            Hie_Lvl_Level_t Scope,long Cod,
+                                            FigCch_Type_t Type,void *ValuePtr,
+                                            time_t TimeCached)
+  {
    static const char *Field[FigCch_NUM_TYPES] =
      {
       [FigCch_UNSIGNED] = "ValueInt",
@@ -143,7 +159,7 @@ bool FigCch_GetFigureFromCache (FigCch_FigureCached_t Figure,
 		       " AND LastUpdate>FROM_UNIXTIME(UNIX_TIMESTAMP()-%lu)",
 		       Field[Type],
 		       (unsigned) Figure,Sco_GetDBStrFromScope (Scope),Cod,
-		       TimeCached[Scope]))
+		       TimeCached))
      {
       /* Get row */
       row = mysql_fetch_row (mysql_res);
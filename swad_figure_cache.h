@@ -28,6 +28,7 @@
 /*****************************************************************************/
 
 #include <stdbool.h>		// For boolean type
+#include <time.h>		// For time_t
 
 #include "swad_hierarchy_level.h"
 
@@ -97,6 +98,13 @@ typedef enum
    FigCch_NUM_USRS_BELONG_CTY	= 46,	// Number of users who claim to belong to country
    FigCch_NUM_USRS_BELONG_INS	= 47,	// Number of users who claim to belong to institution
    FigCch_NUM_USRS_BELONG_CTR	= 48,	// Number of users who claim to belong to centre
+   //--------------------------------------------------------------------------
+   FigCch_NUM_USRS_RANK_CLICKS	= 49,	// Number of users in ranking of clicks
+   FigCch_NUM_USRS_RANK_CLICKS_DAY	= 50,	// Number of users in ranking of clicks per day
+   FigCch_NUM_USRS_RANK_FILE_VIEWS	= 51,	// Number of users in ranking of file views
+   FigCch_NUM_USRS_RANK_SOC_PUB	= 52,	// Number of users in ranking of social publications
+   FigCch_NUM_USRS_RANK_FOR_PST	= 53,	// Number of users in ranking of forum posts
+   FigCch_NUM_USRS_RANK_MSG_SNT	= 54,	// Number of users in ranking of messages sent
   } FigCch_FigureCached_t;
 
 #define FigCch_NUM_TYPES 2
@@ -116,5 +124,9 @@ void FigCch_UpdateFigureIntoCache (FigCch_FigureCached_t Figure,
 bool FigCch_GetFigureFromCache (FigCch_FigureCached_t Figure,
                                 Hie_Lvl_Level_t Scope,long Cod,
                                 FigCch_Type_t Type,void *ValuePtr);
+bool FigCch_GetFigureFromCacheNotOlderThan (FigCch_FigureCached_t Figure,
+                                            Hie_Lvl_Level_t Scope,long Cod,
+                                            FigCch_Type_t Type,void *ValuePtr,
+                                            time_t TimeCached);
 
 #endif
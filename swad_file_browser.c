@@ -50,6 +50,7 @@
 #include "swad_hierarchy.h"
 #include "swad_HTML.h"
 #include "swad_ID.h"
+#include "swad_indicator.h"
 #include "swad_logo.h"
 #include "swad_mark.h"
 #include "swad_notification.h"
@@ -4157,6 +4158,28 @@ static void Brw_StoreSizeOfFileTreeInDB (void)
 	            Gbl.FileBrowser.Size.NumFolds,
 	            Gbl.FileBrowser.Size.NumFiles,
 	            Gbl.FileBrowser.Size.TotalSiz);
+
+   /***** Update stored indicators of the course
+          depending on the number of files in this zone *****/
+   switch (Brw_FileBrowserForDB_files[Gbl.FileBrowser.Type])
+     {
+      case Brw_ADMI_DOC_CRS:
+      case Brw_ADMI_DOC_GRP:
+	 Ind_UpdateIndicatorsCrs (Gbl.Hierarchy.Crs.CrsCod,Ind_COUNTER_FILES_DOCUM);
+	 break;
+      case Brw_ADMI_SHR_CRS:
+      case Brw_ADMI_SHR_GRP:
+	 Ind_UpdateIndicatorsCrs (Gbl.Hierarchy.Crs.CrsCod,Ind_COUNTER_FILES_SHARE);
+	 break;
+      case Brw_ADMI_ASG_USR:
+	 Ind_UpdateIndicatorsCrs (Gbl.Hierarchy.Crs.CrsCod,Ind_COUNTER_FILES_ASSIG);
+	 break;
+      case Brw_ADMI_WRK_USR:
+	 Ind_UpdateIndicatorsCrs (Gbl.Hierarchy.Crs.CrsCod,Ind_COUNTER_FILES_WORKS);
+	 break;
+      default:
+	 break;
+     }
   }
 
 /*****************************************************************************/
@@ -4363,6 +4386,14 @@ void Brw_RemoveCrsFilesFromDB (long CrsCod)
 		   " AND files.FilCod=marks_properties.FilCod",
 	           (unsigned) Brw_ADMI_MRK_CRS,
 	           CrsCod);
+   DB_QueryDELETE ("can not remove the indexes of marks"
+		   " associated to a course",
+		   "DELETE FROM marks_rows USING files,marks_rows"
+		   " WHERE files.FileBrowser=%u"
+		   " AND files.Cod=%ld"
+		   " AND files.FilCod=marks_rows.FilCod",
+	           (unsigned) Brw_ADMI_MRK_CRS,
+	           CrsCod);
 
    /***** Remove from database the entries that store the file views *****/
    /* Remove from course file zones */
@@ -4592,6 +4623,14 @@ void Brw_RemoveGrpFilesFromDB (long GrpCod)
 		   " AND files.FilCod=marks_properties.FilCod",
 	           (unsigned) Brw_ADMI_MRK_GRP,
 	           GrpCod);
+   DB_QueryDELETE ("can not remove the indexes of marks"
+		   " associated to a group",
+		   "DELETE FROM marks_rows USING files,marks_rows"
+		   " WHERE files.FileBrowser=%u"
+		   " AND files.Cod=%ld"
+		   " AND files.FilCod=marks_rows.FilCod",
+	           (unsigned) Brw_ADMI_MRK_GRP,
+	           GrpCod);
 
    /***** Remove from database the entries that store the file views *****/
    DB_QueryDELETE ("can not remove file views to files of a group",
@@ -8143,6 +8182,8 @@ static bool Brw_PasteTreeIntoFolder (unsigned LevelOrg,
 						                       Txt_The_copy_has_stopped_when_trying_to_paste_the_link_X_because_it_would_exceed_the_disk_quota,
 			         FileNameToShow);
 		  CopyIsGoingSuccessful = false;
+		  if (AdminMarks)
+		     Mrk_FreeIndex (&Marks);
 		 }
 	       else	// Quota not exceeded
 		 {
@@ -8861,6 +8902,8 @@ static bool Brw_RcvFileInFileBrw (Brw_UploadType_t UploadType)
         	        Ale_CreateAlert (Ale_WARNING,NULL,
         	                         Txt_UPLOAD_FILE_could_not_create_file_NO_HTML,
                                          Gbl.FileBrowser.NewFilFolLnkName);
+			if (AdminMarks)
+			   Mrk_FreeIndex (&Marks);
 	               }
                      else			// Success
 	               {
@@ -8873,6 +8916,8 @@ static bool Brw_RcvFileInFileBrw (Brw_UploadType_t UploadType)
         	           Ale_CreateAlert (Ale_WARNING,NULL,
         	        	            Txt_UPLOAD_FILE_X_quota_exceeded_NO_HTML,
 		                            Gbl.FileBrowser.NewFilFolLnkName);
+			   if (AdminMarks)
+			      Mrk_FreeIndex (&Marks);
 	                  }
 	                else
                           {
@@ -11097,6 +11142,7 @@ static void Brw_RemoveOneFileOrFolderFromDB (const char Path[PATH_MAX + 1])
    /***** Remove from database the entries that store the marks properties *****/
    if (FileBrowser == Brw_ADMI_MRK_CRS ||
        FileBrowser == Brw_ADMI_MRK_GRP)
+     {
       DB_QueryDELETE ("can not remove properties of marks from database",
 		      "DELETE FROM marks_properties"
 		      " USING files,marks_properties"
@@ -11104,6 +11150,14 @@ static void Brw_RemoveOneFileOrFolderFromDB (const char Path[PATH_MAX + 1])
 		      " AND files.Path='%s'"
 		      " AND files.FilCod=marks_properties.FilCod",
 	              (unsigned) FileBrowser,Cod,Path);
+      DB_QueryDELETE ("can not remove indexes of marks from database",
+		      "DELETE FROM marks_rows"
+		      " USING files,marks_rows"
+		      " WHERE files.FileBrowser=%u AND files.Cod=%ld"
+		      " AND files.Path='%s'"
+		      " AND files.FilCod=marks_rows.FilCod",
+	              (unsigned) FileBrowser,Cod,Path);
+     }
 
    /***** Remove from database the entries that store the file views *****/
    DB_QueryDELETE ("can not remove file views from database",
@@ -11141,6 +11195,7 @@ static void Brw_RemoveChildrenOfFolderFromDB (const char Path[PATH_MAX + 1])
    /***** Remove from database the entries that store the marks properties *****/
    if (FileBrowser == Brw_ADMI_MRK_CRS ||
        FileBrowser == Brw_ADMI_MRK_GRP)
+     {
       DB_QueryDELETE ("can not remove properties of marks from database",
 		      "DELETE FROM marks_properties"
 		      " USING files,marks_properties"
@@ -11148,6 +11203,14 @@ static void Brw_RemoveChildrenOfFolderFromDB (const char Path[PATH_MAX + 1])
 		      " AND files.Path LIKE '%s/%%'"
 		      " AND files.FilCod=marks_properties.FilCod",
 	              (unsigned) FileBrowser,Cod,Path);
+      DB_QueryDELETE ("can not remove indexes of marks from database",
+		      "DELETE FROM marks_rows"
+		      " USING files,marks_rows"
+		      " WHERE files.FileBrowser=%u AND files.Cod=%ld"
+		      " AND files.Path LIKE '%s/%%'"
+		      " AND files.FilCod=marks_rows.FilCod",
+	              (unsigned) FileBrowser,Cod,Path);
+     }
 
    /***** Remove from database the entries that store the file views *****/
    DB_QueryDELETE ("can not remove file views from database",
@@ -43,6 +43,7 @@
 #include "swad_global.h"
 #include "swad_hierarchy.h"
 #include "swad_HTML.h"
+#include "swad_indicator.h"
 #include "swad_layout.h"
 #include "swad_logo.h"
 #include "swad_message.h"
@@ -321,10 +322,6 @@ static long For_GetLastPstCod (long ThrCod);
 
 static void For_UpdateThrReadTime (long ThrCod,
                                    time_t CreatTimeUTCOfTheMostRecentPostRead);
-static unsigned For_GetNumOfReadersOfThr (long ThrCod);
-static unsigned For_GetNumOfWritersInThr (long ThrCod);
-static unsigned For_GetNumPstsInThr (long ThrCod);
-static unsigned For_GetNumMyPstInThr (long ThrCod);
 static time_t For_GetThrReadTime (long ThrCod);
 static void For_DeleteThrFromReadThrs (long ThrCod);
 static void For_ShowPostsOfAThread (struct For_Forums *Forums,
@@ -379,8 +376,6 @@ static unsigned For_GetNumThrsWithNewPstsInForum (const struct For_Forum *Forum,
                                                   unsigned NumThreads);
 static unsigned For_GetNumOfThreadsInForumNewerThan (const struct For_Forum *Forum,
                                                      const char *Time);
-static unsigned For_GetNumOfUnreadPostsInThr (long ThrCod,unsigned NumPostsInThr);
-static unsigned For_GetNumOfPostsInThrNewerThan (long ThrCod,const char *Time);
 
 static void For_WriteNumberOfThrs (unsigned NumThrs);
 static void For_ShowForumThreadsHighlightingOneThread (struct For_Forums *Forums,
@@ -392,7 +387,9 @@ static void For_ListForumThrs (struct For_Forums *Forums,
 	                       long ThrCods[Pag_ITEMS_PER_PAGE],
                                long ThrCodHighlighted,
                                struct Pagination *PaginationThrs);
-static void For_GetThreadData (struct For_Thread *Thr);
+static void For_GetThreadsData (unsigned NumThrs,struct For_Thread Thrs[Pag_ITEMS_PER_PAGE]);
+static struct For_Thread *For_GetThreadFromList (unsigned NumThrs,struct For_Thread Thrs[Pag_ITEMS_PER_PAGE],
+                                                 const char *ThrCodStr);
 
 static void For_GetParamsForums (struct For_Forums *Forums);
 static void For_SetForumType (struct For_Forums *Forums);
@@ -409,6 +406,8 @@ static bool For_CheckIfICanMoveThreads (void);
 static long For_GetThrInMyClipboard (void);
 static bool For_CheckIfThrBelongsToForum (long ThrCod,const struct For_Forum *Forum);
 static void For_MoveThrToCurrentForum (const struct For_Forums *Forums);
+static void For_GetForumOfThr (long ThrCod,struct For_Forum *Forum);
+static void For_UpdateIndicatorsCrs (const struct For_Forum *Forum);
 static void For_InsertThrInClipboard (long ThrCod);
 static void For_RemoveExpiredThrsClipboards (void);
 static void For_RemoveThrCodFromThrClipboard (long ThrCod);
@@ -768,27 +767,43 @@ void For_GetForumTypeAndLocationOfAPost (long PstCod,struct For_Forum *Forum)
 /*****************************************************************************/
 /********* Modify the codes of the first and last posts of a thread **********/
 /*****************************************************************************/
+// The summary of the thread (number of posts and writers) is updated too
 
 static void For_UpdateThrFirstAndLastPst (long ThrCod,long FirstPstCod,long LastPstCod)
   {
    /***** Update the code of the first and last posts of a thread *****/
    DB_QueryUPDATE ("can not update a thread of a forum",
-		   "UPDATE forum_thread SET FirstPstCod=%ld,LastPstCod=%ld"
+		   "UPDATE forum_thread SET FirstPstCod=%ld,LastPstCod=%ld,"
+		   "NumPsts=(SELECT COUNT(*) FROM forum_post"
+		   " WHERE ThrCod=%ld),"
+		   "NumWriters=(SELECT COUNT(DISTINCT UsrCod) FROM forum_post"
+		   " WHERE ThrCod=%ld)"
 		   " WHERE ThrCod=%ld",
-                   FirstPstCod,LastPstCod,ThrCod);
+                   FirstPstCod,LastPstCod,
+                   ThrCod,
+                   ThrCod,
+                   ThrCod);
   }
 
 /*****************************************************************************/
 /************** Modify the code of the last post of a thread *****************/
 /*****************************************************************************/
+// The summary of the thread (number of posts and writers) is updated too
 
 static void For_UpdateThrLastPst (long ThrCod,long LastPstCod)
   {
    /***** Update the code of the last post of a thread *****/
    DB_QueryUPDATE ("can not update a thread of a forum",
-		   "UPDATE forum_thread SET LastPstCod=%ld"
+		   "UPDATE forum_thread SET LastPstCod=%ld,"
+		   "NumPsts=(SELECT COUNT(*) FROM forum_post"
+		   " WHERE ThrCod=%ld),"
+		   "NumWriters=(SELECT COUNT(DISTINCT UsrCod) FROM forum_post"
+		   " WHERE ThrCod=%ld)"
 		   " WHERE ThrCod=%ld",
-                   LastPstCod,ThrCod);
+                   LastPstCod,
+                   ThrCod,
+                   ThrCod,
+                   ThrCod);
   }
 
 /*****************************************************************************/
@@ -839,81 +854,6 @@ static void For_UpdateThrReadTime (long ThrCod,
 	            (long) CreatTimeUTCOfTheMostRecentPostRead);
   }
 
-/*****************************************************************************/
-/**************** Get number of users that have read a thread ****************/
-/*****************************************************************************/
-
-static unsigned For_GetNumOfReadersOfThr (long ThrCod)
-  {
-   /***** Get number of distinct readers of a thread from database *****/
-   return
-   (unsigned) DB_QueryCOUNT ("can not get the number of readers"
-	                     " of a thread of a forum",
-			     "SELECT COUNT(*) FROM forum_thr_read"
-			     " WHERE ThrCod=%ld",
-			     ThrCod);
-  }
-
-/*****************************************************************************/
-/********** Get number of users that have write posts in a thread ************/
-/*****************************************************************************/
-
-static unsigned For_GetNumOfWritersInThr (long ThrCod)
-  {
-   MYSQL_RES *mysql_res;
-   MYSQL_ROW row;
-   unsigned NumWriters;
-
-   /***** Get number of distinct writers in a thread from database *****/
-   DB_QuerySELECT (&mysql_res,"can not get the number of writers"
-	                      " in a thread of a forum",
-		   "SELECT COUNT(DISTINCT UsrCod) FROM forum_post"
-		   " WHERE ThrCod=%ld",
-                   ThrCod);
-
-   /* Get row with number of writers */
-   row = mysql_fetch_row (mysql_res);
-
-   /* Get number of writers (row[0]) */
-   if (sscanf (row[0],"%u",&NumWriters) != 1)
-      Lay_ShowErrorAndExit ("Error when getting the number of writers in a thread of a forum.");
-
-   /***** Free structure that stores the query result *****/
-   DB_FreeMySQLResult (&mysql_res);
-
-   return NumWriters;
-  }
-
-/*****************************************************************************/
-/********************** Get number of posts in a thread **********************/
-/*****************************************************************************/
-
-static unsigned For_GetNumPstsInThr (long ThrCod)
-  {
-   /***** Get number of posts in a thread from database *****/
-   return
-   (unsigned) DB_QueryCOUNT ("can not get the number of posts"
-	                     " in a thread of a forum",
-			     "SELECT COUNT(*) FROM forum_post"
-			     " WHERE ThrCod=%ld",
-			     ThrCod);
-  }
-
-/*****************************************************************************/
-/************** Get whether there are posts of mine in a thread **************/
-/*****************************************************************************/
-
-static unsigned For_GetNumMyPstInThr (long ThrCod)
-  {
-   /***** Get if I have write posts in a thread from database *****/
-   return
-   (unsigned) DB_QueryCOUNT ("can not check if you have written"
-	                     " posts in a thead of a forum",
-			     "SELECT COUNT(*) FROM forum_post"
-			     " WHERE ThrCod=%ld AND UsrCod=%ld",
-			     ThrCod,Gbl.Usrs.Me.UsrDat.UsrCod);
-  }
-
 /*****************************************************************************/
 /*********************** Get number of posts from a user *********************/
 /*****************************************************************************/
@@ -1013,7 +953,7 @@ static void For_ShowPostsOfAThread (struct For_Forums *Forums,
    Thread.ThrCod =
    Forums->Thread.Current =
    Forums->Thread.Selected;
-   For_GetThreadData (&Thread);
+   For_GetThreadsData (1,&Thread);
 
    /***** Get if there is a thread ready to be moved *****/
    if (For_CheckIfICanMoveThreads ())
@@ -2312,53 +2252,6 @@ static unsigned For_GetNumOfThreadsInForumNewerThan (const struct For_Forum *For
 			     (unsigned) Forum->Type,SubQuery,Time);
   }
 
-/*****************************************************************************/
-/** Get number of unread posts in a thread since my last read of that thread */
-/*****************************************************************************/
-
-static unsigned For_GetNumOfUnreadPostsInThr (long ThrCod,unsigned NumPostsInThr)
-  {
-   MYSQL_RES *mysql_res;
-   MYSQL_ROW row;
-   unsigned long NumRows;
-   unsigned NumUnreadPosts = NumPostsInThr;	// By default, all the posts are unread by me
-
-   /***** Get last time I read this thread from database *****/
-   NumRows = DB_QuerySELECT (&mysql_res,"can not get the date of reading"
-					" of a thread",
-			     "SELECT ReadTime FROM forum_thr_read"
-			     " WHERE ThrCod=%ld AND UsrCod=%ld",
-			     ThrCod,Gbl.Usrs.Me.UsrDat.UsrCod);
-
-   /***** Get if last time I read this thread exists in database *****/
-   if (NumRows)
-     {
-      /***** Get the number of posts in thread with a modify time > newest read time for me (row[0]) *****/
-      row = mysql_fetch_row (mysql_res);
-      NumUnreadPosts = For_GetNumOfPostsInThrNewerThan (ThrCod,row[0]);
-     }
-
-   /***** Free structure that stores the query result *****/
-   DB_FreeMySQLResult (&mysql_res);
-
-   return NumUnreadPosts;
-  }
-
-/*****************************************************************************/
-/**** Get number of posts in thread with a modify time > a specified time ****/
-/*****************************************************************************/
-
-static unsigned For_GetNumOfPostsInThrNewerThan (long ThrCod,const char *Time)
-  {
-   /***** Get the number of posts in thread with a modify time > a specified time from database *****/
-   return
-   (unsigned) DB_QueryCOUNT ("can not check if there are new posts"
-			     " in a thread of a forum",
-			     "SELECT COUNT(*) FROM forum_post"
-			     " WHERE ThrCod=%ld AND ModifTime>'%s'",
-			     ThrCod,Time);
-  }
-
 /*****************************************************************************/
 /************** Get and write total number of threads and posts **************/
 /*****************************************************************************/
@@ -3280,7 +3173,9 @@ static void For_ListForumThrs (struct For_Forums *Forums,
    extern const char *Txt_No_new_posts;
    unsigned NumThr;
    unsigned NumThrInScreen;	// From 0 to Pag_ITEMS_PER_PAGE-1
-   struct For_Thread Thr;
+   unsigned NumThrsInScreen;
+   struct For_Thread Thrs[Pag_ITEMS_PER_PAGE];
+   struct For_Thread *Thr;
    unsigned UniqueId;
    char *Id;
    struct UsrData UsrDat;
@@ -3297,6 +3192,13 @@ static void For_ListForumThrs (struct For_Forums *Forums,
    if ((ICanMoveThreads = For_CheckIfICanMoveThreads ()))
       ThreadInMyClipboard = For_GetThrInMyClipboard ();
 
+   /***** Get the data of all the threads in this page *****/
+   for (NumThr  = PaginationThrs->FirstItemVisible, NumThrsInScreen = 0;
+        NumThr <= PaginationThrs->LastItemVisible;
+        NumThr++, NumThrsInScreen++)
+      Thrs[NumThrsInScreen].ThrCod = ThrCods[NumThrsInScreen];
+   For_GetThreadsData (NumThrsInScreen,Thrs);
+
    /***** Initialize structure with user's data *****/
    Usr_UsrDataConstructor (&UsrDat);
 
@@ -3305,21 +3207,19 @@ static void For_ListForumThrs (struct For_Forums *Forums,
         NumThr <= PaginationThrs->LastItemVisible;
         NumThr++, NumThrInScreen++, Gbl.RowEvenOdd = 1 - Gbl.RowEvenOdd)
      {
-      /***** Get the data of this thread *****/
-      Thr.ThrCod = ThrCods[NumThrInScreen];
-      For_GetThreadData (&Thr);
-      Forums->Thread.Current = Thr.ThrCod;
-      Style = (Thr.NumUnreadPosts ? "AUTHOR_TXT_NEW" :
+      Thr = &Thrs[NumThrInScreen];
+      Forums->Thread.Current = Thr->ThrCod;
+      Style = (Thr->NumUnreadPosts ? "AUTHOR_TXT_NEW" :
 	                            "AUTHOR_TXT");
-      BgColor =  (Thr.ThrCod == ThreadInMyClipboard) ? "LIGHT_GREEN" :
-	        ((Thr.ThrCod == ThrCodHighlighted)   ? "LIGHT_BLUE" :
+      BgColor =  (Thr->ThrCod == ThreadInMyClipboard) ? "LIGHT_GREEN" :
+	        ((Thr->ThrCod == ThrCodHighlighted)   ? "LIGHT_BLUE" :
                                                        Gbl.ColorRows[Gbl.RowEvenOdd]);
 
       /***** Show my photo if I have any posts in this thread *****/
       HTM_TR_Begin (NULL);
 
       HTM_TD_Begin ("class=\"BT %s\"",BgColor);
-      if (Thr.NumMyPosts)
+      if (Thr->NumMyPosts)
          HTM_IMG (Gbl.Usrs.Me.PhotoURL[0] ? Gbl.Usrs.Me.PhotoURL :
                                             Cfg_URL_ICON_PUBLIC,
 		  Gbl.Usrs.Me.PhotoURL[0] ? NULL :
@@ -3330,9 +3230,9 @@ static void For_ListForumThrs (struct For_Forums *Forums,
 
       /***** Put an icon with thread status *****/
       HTM_TD_Begin ("class=\"CONTEXT_COL %s\"",BgColor);
-      Ico_PutIcon (Thr.NumUnreadPosts ? "envelope.svg" :
+      Ico_PutIcon (Thr->NumUnreadPosts ? "envelope.svg" :
         	                        "envelope-open-text.svg",
-		   Thr.NumUnreadPosts ? Txt_There_are_new_posts :
+		   Thr->NumUnreadPosts ? Txt_There_are_new_posts :
                                         Txt_No_new_posts,
 		   "ICO16x16");
 
@@ -3356,7 +3256,7 @@ static void For_ListForumThrs (struct For_Forums *Forums,
                                       Forums->ForumSet,
 				      Forums->ThreadsOrder,
 				      Forums->Forum.Location,
-				      Thr.ThrCod,
+				      Thr->ThrCod,
 				      -1L);
          Ico_PutIconCut ();
          Frm_EndForm ();
@@ -3366,16 +3266,16 @@ static void For_ListForumThrs (struct For_Forums *Forums,
 
       /***** Write subject and links to thread pages *****/
       HTM_TD_Begin ("class=\"LT %s\"",BgColor);
-      PaginationPsts.NumItems = Thr.NumPosts;
+      PaginationPsts.NumItems = Thr->NumPosts;
       PaginationPsts.CurrentPage = 1;	// First page
       Pag_CalculatePagination (&PaginationPsts);
       PaginationPsts.Anchor = For_FORUM_POSTS_SECTION_ID;
       Pag_WriteLinksToPages (Pag_POSTS_FORUM,
                              &PaginationPsts,
-                             Forums,Thr.ThrCod,
-                             Thr.Enabled[Dat_START_TIME],
-                             Thr.Subject,
-                             Thr.NumUnreadPosts ? The_ClassFormInBoxBold[Gbl.Prefs.Theme] :
+                             Forums,Thr->ThrCod,
+                             Thr->Enabled[Dat_START_TIME],
+                             Thr->Subject,
+                             Thr->NumUnreadPosts ? The_ClassFormInBoxBold[Gbl.Prefs.Theme] :
                                                   The_ClassFormInBox[Gbl.Prefs.Theme],
                              true);
       HTM_TD_End ();
@@ -3385,17 +3285,17 @@ static void For_ListForumThrs (struct For_Forums *Forums,
 	   Order <= Dat_END_TIME;
 	   Order++)
         {
-         if (Order == Dat_START_TIME || Thr.NumPosts > 1)	// Don't write twice the same author when thread has only one thread
+         if (Order == Dat_START_TIME || Thr->NumPosts > 1)	// Don't write twice the same author when thread has only one thread
            {
             /* Write the author of first or last message */
-            UsrDat.UsrCod = Thr.UsrCod[Order];
+            UsrDat.UsrCod = Thr->UsrCod[Order];
             Usr_ChkUsrCodAndGetAllUsrDataFromUsrCod (&UsrDat,Usr_DONT_GET_PREFS);
 	    HTM_TD_Begin ("class=\"%s LT %s\"",Style,BgColor);
-            Msg_WriteMsgAuthor (&UsrDat,Thr.Enabled[Order],BgColor);
+            Msg_WriteMsgAuthor (&UsrDat,Thr->Enabled[Order],BgColor);
 	    HTM_TD_End ();
 
             /* Write the date of first or last message (it's in YYYYMMDDHHMMSS format) */
-            TimeUTC = Thr.WriteTime[Order];
+            TimeUTC = Thr->WriteTime[Order];
 	    UniqueId++;
 	    if (asprintf (&Id,"thr_date_%u",UniqueId) < 0)
 	       Lay_NotEnoughMemoryExit ();
@@ -3418,22 +3318,22 @@ static void For_ListForumThrs (struct For_Forums *Forums,
 
       /***** Write number of posts in this thread *****/
       HTM_TD_Begin ("class=\"%s RT %s\"",Style,BgColor);
-      HTM_TxtF ("%u&nbsp;",Thr.NumPosts);
+      HTM_TxtF ("%u&nbsp;",Thr->NumPosts);
       HTM_TD_End ();
 
       /***** Write number of new posts in this thread *****/
       HTM_TD_Begin ("class=\"%s RT %s\"",Style,BgColor);
-      HTM_TxtF ("%u&nbsp;",Thr.NumUnreadPosts);
+      HTM_TxtF ("%u&nbsp;",Thr->NumUnreadPosts);
       HTM_TD_End ();
 
       /***** Write number of users who have write posts in this thread *****/
       HTM_TD_Begin ("class=\"%s RT %s\"",Style,BgColor);
-      HTM_TxtF ("%u&nbsp;",Thr.NumWriters);
+      HTM_TxtF ("%u&nbsp;",Thr->NumWriters);
       HTM_TD_End ();
 
       /***** Write number of users who have read this thread *****/
       HTM_TD_Begin ("class=\"%s RT %s\"",Style,BgColor);
-      HTM_TxtF ("%u&nbsp;",Thr.NumReaders);
+      HTM_TxtF ("%u&nbsp;",Thr->NumReaders);
       HTM_TD_End ();
 
       HTM_TR_End ();
@@ -3444,90 +3344,188 @@ static void For_ListForumThrs (struct For_Forums *Forums,
   }
 
 /*****************************************************************************/
-/***************************** Get data of a thread **************************/
+/************************** Get data of some threads *************************/
 /*****************************************************************************/
+// Thrs[NumThr].ThrCod must be filled before calling this function.
+// The data of all the threads are got in two queries,
+// independently of the number of threads.
 
-static void For_GetThreadData (struct For_Thread *Thr)
+static void For_GetThreadsData (unsigned NumThrs,struct For_Thread Thrs[Pag_ITEMS_PER_PAGE])
   {
    extern const char *Txt_no_subject;
+   char ThrCodsStr[Pag_ITEMS_PER_PAGE * (Cns_MAX_DECIMAL_DIGITS_LONG + 1)];
+   char ThrCodStr[1 + Cns_MAX_DECIMAL_DIGITS_LONG + 1];
    MYSQL_RES *mysql_res;
    MYSQL_ROW row;
-   unsigned long NumRows;
-   Dat_StartEndTime_t Order;
+   unsigned NumThr;
+   unsigned NumRows;
+   unsigned NumRow;
+   struct For_Thread *Thr;
 
-   /***** Get data of a thread from database *****/
-   NumRows = DB_QuerySELECT (&mysql_res,"can not get data"
-					" of a thread of a forum",
-			     "SELECT m0.PstCod,m1.PstCod,m0.UsrCod,m1.UsrCod,"
-			     "UNIX_TIMESTAMP(m0.CreatTime),"
-			     "UNIX_TIMESTAMP(m1.CreatTime),"
-			     "m0.Subject"
-			     " FROM forum_thread,forum_post AS m0,forum_post AS m1"
-			     " WHERE forum_thread.ThrCod=%ld"
-			     " AND forum_thread.FirstPstCod=m0.PstCod"
-			     " AND forum_thread.LastPstCod=m1.PstCod",
-			     Thr->ThrCod);
-
-   /***** The result of the query should have one row *****/
-   if (NumRows != 1)
-      Lay_ShowErrorAndExit ("Error when getting data of a thread of a forum.");
-   row = mysql_fetch_row (mysql_res);
+   if (NumThrs == 0 || NumThrs > Pag_ITEMS_PER_PAGE)
+      Lay_ShowErrorAndExit ("Wrong number of threads.");
+
+   /***** Build list of thread codes separated by commas *****/
+   ThrCodsStr[0] = '\0';
+   for (NumThr = 0;
+	NumThr < NumThrs;
+	NumThr++)
+     {
+      snprintf (ThrCodStr,sizeof (ThrCodStr),
+	        NumThr ? ",%ld" :
+	        	 "%ld",
+	        Thrs[NumThr].ThrCod);
+      Str_Concat (ThrCodsStr,ThrCodStr,sizeof (ThrCodsStr) - 1);
+
+      /* Reset data related to me,
+         because threads with no posts of mine
+         do not appear in the second query */
+      Thrs[NumThr].NumUnreadPosts = 0;
+      Thrs[NumThr].NumMyPosts     = 0;
+     }
+
+   /***** Get summaries of threads from database *****/
+   NumRows = (unsigned)
+   DB_QuerySELECT (&mysql_res,"can not get data of threads of a forum",
+		   "SELECT forum_thread.ThrCod,"				// row[ 0]
+			  "m0.PstCod,m1.PstCod,"			// row[ 1], row[ 2]
+			  "m0.UsrCod,m1.UsrCod,"			// row[ 3], row[ 4]
+			  "UNIX_TIMESTAMP(m0.CreatTime),"		// row[ 5]
+			  "UNIX_TIMESTAMP(m1.CreatTime),"		// row[ 6]
+			  "m0.Subject,"					// row[ 7]
+			  "d0.PstCod IS NULL,d1.PstCod IS NULL,"	// row[ 8], row[ 9]
+			  "forum_thread.NumPsts,"			// row[10]
+			  "forum_thread.NumWriters,"			// row[11]
+			  "(SELECT COUNT(*) FROM forum_thr_read"
+			  " WHERE forum_thr_read.ThrCod=forum_thread.ThrCod)"	// row[12]
+		   " FROM forum_thread"
+		   " JOIN forum_post AS m0"
+		   " ON forum_thread.FirstPstCod=m0.PstCod"
+		   " JOIN forum_post AS m1"
+		   " ON forum_thread.LastPstCod=m1.PstCod"
+		   " LEFT JOIN forum_disabled_post AS d0"
+		   " ON m0.PstCod=d0.PstCod"
+		   " LEFT JOIN forum_disabled_post AS d1"
+		   " ON m1.PstCod=d1.PstCod"
+		   " WHERE forum_thread.ThrCod IN (%s)",
+		   ThrCodsStr);
+
+   /***** The result of the query should have one row per thread *****/
+   if (NumRows != NumThrs)
+      Lay_ShowErrorAndExit ("Error when getting data of threads of a forum.");
+
+   for (NumRow = 0;
+	NumRow < NumRows;
+	NumRow++)
+     {
+      row = mysql_fetch_row (mysql_res);
 
-   /***** Get the code of the first post in this thread (row[0]) *****/
-   Thr->PstCod[Dat_START_TIME] = Str_ConvertStrCodToLongCod (row[0]);
+      /***** Get the thread this row belongs to (row[0]) *****/
+      Thr = For_GetThreadFromList (NumThrs,Thrs,row[0]);
 
-   /***** Get the code of the last  post in this thread (row[1]) *****/
-   Thr->PstCod[Dat_END_TIME ] = Str_ConvertStrCodToLongCod (row[1]);
+      /***** Get the code of the first post in this thread (row[1]) *****/
+      if (sscanf (row[1],"%ld",&(Thr->PstCod[Dat_START_TIME])) != 1)
+	 Lay_ShowErrorAndExit ("Wrong code of post.");
 
-   /***** Get the code of the first message in this thread (row[0]) *****/
-   if (sscanf (row[0],"%ld",&(Thr->PstCod[Dat_START_TIME])) != 1)
-      Lay_ShowErrorAndExit ("Wrong code of post.");
+      /***** Get the code of the last  post in this thread (row[2]) *****/
+      if (sscanf (row[2],"%ld",&(Thr->PstCod[Dat_END_TIME  ])) != 1)
+	 Lay_ShowErrorAndExit ("Wrong code of post.");
 
-   /***** Get the code of the last message in this thread (row[1]) *****/
-   if (sscanf (row[1],"%ld",&(Thr->PstCod[Dat_END_TIME])) != 1)
-      Lay_ShowErrorAndExit ("Wrong code of post.");
+      /***** Get the author of the first post in this thread (row[3]) *****/
+      Thr->UsrCod[Dat_START_TIME] = Str_ConvertStrCodToLongCod (row[3]);
 
-   /***** Get the author of the first post in this thread (row[2]) *****/
-   Thr->UsrCod[Dat_START_TIME] = Str_ConvertStrCodToLongCod (row[2]);
+      /***** Get the author of the last  post in this thread (row[4]) *****/
+      Thr->UsrCod[Dat_END_TIME  ] = Str_ConvertStrCodToLongCod (row[4]);
 
-   /***** Get the author of the last  post in this thread (row[3]) *****/
-   Thr->UsrCod[Dat_END_TIME  ] = Str_ConvertStrCodToLongCod (row[3]);
+      /***** Get the date of the first post in this thread (row[5]) *****/
+      Thr->WriteTime[Dat_START_TIME] = Dat_GetUNIXTimeFromStr (row[5]);
 
-   /***** Get the date of the first post in this thread (row[4]) *****/
-   Thr->WriteTime[Dat_START_TIME] = Dat_GetUNIXTimeFromStr (row[4]);
+      /***** Get the date of the last  post in this thread (row[6]) *****/
+      Thr->WriteTime[Dat_END_TIME  ] = Dat_GetUNIXTimeFromStr (row[6]);
 
-   /***** Get the date of the last  post in this thread (row[5]) *****/
-   Thr->WriteTime[Dat_END_TIME  ] = Dat_GetUNIXTimeFromStr (row[5]);
+      /***** Get the subject of this thread (row[7]) *****/
+      Str_Copy (Thr->Subject,row[7],sizeof (Thr->Subject) - 1);
+      if (!Thr->Subject[0])
+	 snprintf (Thr->Subject,sizeof (Thr->Subject),"[%s]",Txt_no_subject);
 
-   /***** Get the subject of this thread (row[6]) *****/
-   Str_Copy (Thr->Subject,row[6],sizeof (Thr->Subject) - 1);
-   if (!Thr->Subject[0])
-      snprintf (Thr->Subject,sizeof (Thr->Subject),"[%s]",Txt_no_subject);
+      /***** Get if first or last posts are enabled (row[8], row[9]) *****/
+      Thr->Enabled[Dat_START_TIME] = (row[8][0] == '1');
+      Thr->Enabled[Dat_END_TIME  ] = (row[9][0] == '1');
+
+      /***** Get number of posts in this thread (row[10]) *****/
+      if (sscanf (row[10],"%u",&Thr->NumPosts) != 1)
+	 Thr->NumPosts = 0;
+
+      /***** Get number of users who have write posts in this thread (row[11]) *****/
+      if (sscanf (row[11],"%u",&Thr->NumWriters) != 1)
+	 Thr->NumWriters = 0;
+
+      /***** Get number of users who have read this thread (row[12]) *****/
+      if (sscanf (row[12],"%u",&Thr->NumReaders) != 1)
+	 Thr->NumReaders = 0;
+     }
 
    /***** Free structure that stores the query result *****/
    DB_FreeMySQLResult (&mysql_res);
 
-   /***** Get if first or last message are enabled *****/
-   for (Order = Dat_START_TIME;
-	Order <= Dat_END_TIME;
-	Order++)
-      Thr->Enabled[Order] = For_GetIfPstIsEnabled (Thr->PstCod[Order]);
-      // Thr->Enabled[Order] = true;
+   /***** Get number of posts written by me
+          and number of posts unread by me in these threads *****/
+   NumRows = (unsigned)
+   DB_QuerySELECT (&mysql_res,"can not get data of threads of a forum",
+		   "SELECT forum_post.ThrCod,"				// row[0]
+			  "SUM(forum_post.UsrCod=%ld),"			// row[1]
+			  "SUM(forum_thr_read.ReadTime IS NULL"
+			  " OR forum_post.ModifTime>forum_thr_read.ReadTime)"	// row[2]
+		   " FROM forum_post"
+		   " LEFT JOIN forum_thr_read"
+		   " ON (forum_post.ThrCod=forum_thr_read.ThrCod"
+		   " AND forum_thr_read.UsrCod=%ld)"
+		   " WHERE forum_post.ThrCod IN (%s)"
+		   " GROUP BY forum_post.ThrCod",
+		   Gbl.Usrs.Me.UsrDat.UsrCod,
+		   Gbl.Usrs.Me.UsrDat.UsrCod,
+		   ThrCodsStr);
+   for (NumRow = 0;
+	NumRow < NumRows;
+	NumRow++)
+     {
+      row = mysql_fetch_row (mysql_res);
+
+      /***** Get the thread this row belongs to (row[0]) *****/
+      Thr = For_GetThreadFromList (NumThrs,Thrs,row[0]);
+
+      /***** Get number of posts that I have written in this thread (row[1]) *****/
+      if (sscanf (row[1],"%u",&Thr->NumMyPosts) != 1)
+	 Thr->NumMyPosts = 0;
+
+      /***** Get number of unread (by me) posts in this thread (row[2]) *****/
+      if (sscanf (row[2],"%u",&Thr->NumUnreadPosts) != 1)
+	 Thr->NumUnreadPosts = 0;
+     }
 
-   /***** Get number of posts in this thread *****/
-   Thr->NumPosts = For_GetNumPstsInThr (Thr->ThrCod);
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+  }
 
-   /***** Get number of unread (by me) posts in this thread *****/
-   Thr->NumUnreadPosts = For_GetNumOfUnreadPostsInThr (Thr->ThrCod,Thr->NumPosts);
+/*****************************************************************************/
+/************* Get a thread from a list given its code as string *************/
+/*****************************************************************************/
 
-   /***** Get number of posts that I have written in this thread *****/
-   Thr->NumMyPosts = For_GetNumMyPstInThr (Thr->ThrCod);
+static struct For_Thread *For_GetThreadFromList (unsigned NumThrs,struct For_Thread Thrs[Pag_ITEMS_PER_PAGE],
+                                                 const char *ThrCodStr)
+  {
+   long ThrCod;
+   unsigned NumThr;
 
-   /***** Get number of users who have write posts in this thread *****/
-   Thr->NumWriters = For_GetNumOfWritersInThr (Thr->ThrCod);
+   if ((ThrCod = Str_ConvertStrCodToLongCod (ThrCodStr)) > 0)
+      for (NumThr = 0;
+	   NumThr < NumThrs;
+	   NumThr++)
+	 if (Thrs[NumThr].ThrCod == ThrCod)
+	    return &Thrs[NumThr];
 
-   /***** Get number of users who have read this thread *****/
-   Thr->NumReaders = For_GetNumOfReadersOfThr (Thr->ThrCod);
+   Lay_ShowErrorAndExit ("Wrong code of thread.");
+   return NULL;	// Not reached
   }
 
 /*****************************************************************************/
@@ -3971,6 +3969,9 @@ void For_ReceiveForumPost (void)
    /***** Free media *****/
    Med_MediaDestructor (&Media);
 
+   /***** Update stored indicators of the course *****/
+   For_UpdateIndicatorsCrs (&Forums.Forum);
+
    /***** Increment number of forum posts in my user's figures *****/
    Prf_IncrementNumForPstUsr (Gbl.Usrs.Me.UsrDat.UsrCod);
 
@@ -4075,6 +4076,9 @@ void For_RemovePost (void)
    /***** Free image *****/
    Med_MediaDestructor (&Media);
 
+   /***** Update stored indicators of the course *****/
+   For_UpdateIndicatorsCrs (&Forums.Forum);
+
    /***** Mark possible notifications as removed *****/
    Ntf_MarkNotifAsRemoved (Ntf_EVENT_FORUM_POST_COURSE,Forums.PstCod);
    Ntf_MarkNotifAsRemoved (Ntf_EVENT_FORUM_REPLY      ,Forums.PstCod);
@@ -4189,6 +4193,9 @@ void For_RemoveThread (void)
       /***** Remove the thread and all its posts *****/
       For_RemoveThreadAndItsPsts (Forums.Thread.Current);
 
+      /***** Update stored indicators of the course *****/
+      For_UpdateIndicatorsCrs (&Forums.Forum);
+
       /***** Show forum list again *****/
       For_ShowForumList (&Forums);
 
@@ -4370,6 +4377,11 @@ static bool For_CheckIfThrBelongsToForum (long ThrCod,const struct For_Forum *Fo
 
 static void For_MoveThrToCurrentForum (const struct For_Forums *Forums)
   {
+   struct For_Forum OldForum;
+
+   /***** Get forum where the thread is now *****/
+   For_GetForumOfThr (Forums->Thread.Current,&OldForum);
+
    /***** Move a thread to current forum *****/
    switch (Forums->Forum.Type)
      {
@@ -4428,6 +4440,59 @@ static void For_MoveThrToCurrentForum (const struct For_Forums *Forums)
 	 Lay_ShowErrorAndExit ("Wrong forum.");
 	 break;
      }
+
+   /***** Update stored indicators of the courses *****/
+   For_UpdateIndicatorsCrs (&OldForum);
+   For_UpdateIndicatorsCrs (&Forums->Forum);
+  }
+
+/*****************************************************************************/
+/************************ Get the forum of a thread **************************/
+/*****************************************************************************/
+
+static void For_GetForumOfThr (long ThrCod,struct For_Forum *Forum)
+  {
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   unsigned UnsignedNum;
+   long LongNum;
+
+   /***** Set default forum type and location *****/
+   Forum->Type = For_FORUM_UNKNOWN;
+   Forum->Location = -1L;
+
+   /***** Get forum type and location of a thread *****/
+   if (DB_QuerySELECT (&mysql_res,"can not get forum type and location",
+		       "SELECT ForumType,Location"
+		       " FROM forum_thread"
+		       " WHERE ThrCod=%ld",
+		       ThrCod))
+     {
+      row = mysql_fetch_row (mysql_res);
+
+      /* Get forum type (row[0]) */
+      if (sscanf (row[0],"%u",&UnsignedNum) == 1)
+	 if (UnsignedNum < For_NUM_TYPES_FORUM)
+	    Forum->Type = (For_ForumType_t) UnsignedNum;
+
+      /* Get forum location (row[1]) */
+      if (sscanf (row[1],"%ld",&LongNum) == 1)
+         Forum->Location = LongNum;
+     }
+
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+  }
+
+/*****************************************************************************/
+/******* Update stored indicators of a course when its forum changes *********/
+/*****************************************************************************/
+// Only the forum of users in a course counts for indicators
+
+static void For_UpdateIndicatorsCrs (const struct For_Forum *Forum)
+  {
+   if (Forum->Type == For_FORUM_COURSE_USRS)
+      Ind_UpdateIndicatorsCrs (Forum->Location,Ind_COUNTER_FORUM);
   }
 
 /*****************************************************************************/
@@ -88,7 +88,7 @@ void Gbl_InitializeGlobals (void)
   {
    extern const char *Ico_IconSetId[Ico_NUM_ICON_SETS];
    extern const char *The_ThemeId[The_NUM_THEMES];
-   extern const unsigned Txt_Current_CGI_SWAD_Language;
+   extern unsigned Txt_Current_CGI_SWAD_Language;
    Rol_Role_t Role;
 
    Gbl.Layout.WritingHTMLStart =
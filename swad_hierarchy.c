@@ -54,10 +54,15 @@ extern struct Globals Gbl;
 /*************************** Private constants *******************************/
 /*****************************************************************************/
 
+#define Hie_MAX_BYTES_QUERY_FIELDS	(1024 - 1)
+#define Hie_MAX_BYTES_QUERY_JOINS	( 256 - 1)
+
 /*****************************************************************************/
 /*************************** Private prototypes ******************************/
 /*****************************************************************************/
 
+static bool Hie_GetDataOfHierarchy (void);
+
 /*****************************************************************************/
 /********** List pending institutions, centres, degrees and courses **********/
 /*****************************************************************************/
@@ -518,49 +523,10 @@ void Hie_SetHierarchyFromUsrLastHierarchy (void)
 
 void Hie_InitHierarchy (void)
   {
-   /***** If course code is available, get course data *****/
-   if (Gbl.Hierarchy.Crs.CrsCod > 0)
-     {
-      if (Crs_GetDataOfCourseByCod (&Gbl.Hierarchy.Crs))	// Course found
-         Gbl.Hierarchy.Deg.DegCod = Gbl.Hierarchy.Crs.DegCod;
-      else
-         Hie_ResetHierarchy ();
-     }
-
-   /***** If degree code is available, get degree data *****/
-   if (Gbl.Hierarchy.Deg.DegCod > 0)
-     {
-      if (Deg_GetDataOfDegreeByCod (&Gbl.Hierarchy.Deg))	// Degree found
-	{
-	 Gbl.Hierarchy.Ctr.CtrCod = Gbl.Hierarchy.Deg.CtrCod;
-         Gbl.Hierarchy.Ins.InsCod = Deg_GetInsCodOfDegreeByCod (Gbl.Hierarchy.Deg.DegCod);
-	}
-      else
-         Hie_ResetHierarchy ();
-     }
-
-   /***** If centre code is available, get centre data *****/
-   if (Gbl.Hierarchy.Ctr.CtrCod > 0)
-     {
-      if (Ctr_GetDataOfCentreByCod (&Gbl.Hierarchy.Ctr))	// Centre found
-         Gbl.Hierarchy.Ins.InsCod = Gbl.Hierarchy.Ctr.InsCod;
-      else
-         Hie_ResetHierarchy ();
-     }
-
-   /***** If institution code is available, get institution data *****/
-   if (Gbl.Hierarchy.Ins.InsCod > 0)
-     {
-      if (Ins_GetDataOfInstitutionByCod (&Gbl.Hierarchy.Ins))	// Institution found
-	 Gbl.Hierarchy.Cty.CtyCod = Gbl.Hierarchy.Ins.CtyCod;
-      else
-         Hie_ResetHierarchy ();
-     }
-
-   /***** If country code is available, get country data *****/
-   if (Gbl.Hierarchy.Cty.CtyCod > 0)
-      if (!Cty_GetDataOfCountryByCod (&Gbl.Hierarchy.Cty))		// Country not found
-         Hie_ResetHierarchy ();
+   /***** Get data of course, degree, centre, institution and country,
+          starting from the most specific code available *****/
+   if (!Hie_GetDataOfHierarchy ())	// Any of them not found
+      Hie_ResetHierarchy ();
 
    /***** Set current hierarchy level and code
           depending on course code, degree code, etc. *****/
@@ -618,6 +584,201 @@ void Hie_InitHierarchy (void)
      }
   }
 
+/*****************************************************************************/
+/********** Get data of current course, degree, centre, institution **********/
+/********** and country in one query, from the most specific code   **********/
+/*****************************************************************************/
+// Return false if any of the levels is not found
+
+static bool Hie_GetDataOfHierarchy (void)
+  {
+   extern const char *Lan_STR_LANG_ID[1 + Lan_NUM_LANGUAGES];
+   static const char *Fields[Hie_Lvl_NUM_LEVELS] =
+     {
+      [Hie_Lvl_CRS] = "courses.CrsCod,"			// Same order as in...
+		      "courses.DegCod,"			// ...Crs_GetDataOfCourseByCod
+		      "courses.Year,"
+		      "courses.InsCrsCod,"
+		      "courses.Status,"
+		      "courses.RequesterUsrCod,"
+		      "courses.ShortName,"
+		      "courses.FullName,",
+      [Hie_Lvl_DEG] = "degrees.DegCod,"			// Same order as in...
+		      "degrees.CtrCod,"			// ...Deg_GetDataOfDegreeByCod
+		      "degrees.DegTypCod,"
+		      "degrees.Status,"
+		      "degrees.RequesterUsrCod,"
+		      "degrees.ShortName,"
+		      "degrees.FullName,"
+		      "degrees.WWW,",
+      [Hie_Lvl_CTR] = "centres.CtrCod,"			// Same order as in...
+		      "centres.InsCod,"			// ...Ctr_GetDataOfCentreByCod
+		      "centres.PlcCod,"
+		      "centres.Status,"
+		      "centres.RequesterUsrCod,"
+		      "centres.Latitude,"
+		      "centres.Longitude,"
+		      "centres.Altitude,"
+		      "centres.ShortName,"
+		      "centres.FullName,"
+		      "centres.WWW,",
+      [Hie_Lvl_INS] = "institutions.InsCod,"		// Same order as in...
+		      "institutions.CtyCod,"		// ...Ins_GetDataOfInstitutionByCod
+		      "institutions.Status,"
+		      "institutions.RequesterUsrCod,"
+		      "institutions.ShortName,"
+		      "institutions.FullName,"
+		      "institutions.WWW,",
+     };
+   static const unsigned NumFields[Hie_Lvl_NUM_LEVELS] =
+     {
+      [Hie_Lvl_CRS] =  8,
+      [Hie_Lvl_DEG] =  8,
+      [Hie_Lvl_CTR] = 11,
+      [Hie_Lvl_INS] =  7,
+     };
+   static const char *Table[Hie_Lvl_NUM_LEVELS] =
+     {
+      [Hie_Lvl_CRS] = "courses",
+      [Hie_Lvl_DEG] = "degrees",
+      [Hie_Lvl_CTR] = "centres",
+      [Hie_Lvl_INS] = "institutions",
+      [Hie_Lvl_CTY] = "countries",
+     };
+   static const char *JoinParent[Hie_Lvl_NUM_LEVELS] =
+     {
+      [Hie_Lvl_CRS] = " JOIN degrees"
+		      " ON courses.DegCod=degrees.DegCod",
+      [Hie_Lvl_DEG] = " JOIN centres"
+		      " ON degrees.CtrCod=centres.CtrCod",
+      [Hie_Lvl_CTR] = " JOIN institutions"
+		      " ON centres.InsCod=institutions.InsCod",
+      [Hie_Lvl_INS] = " LEFT JOIN countries"	// Country may be unknown
+		      " ON institutions.CtyCod=countries.CtyCod",
+     };
+   static const char *CodField[Hie_Lvl_NUM_LEVELS] =
+     {
+      [Hie_Lvl_CRS] = "courses.CrsCod",
+      [Hie_Lvl_DEG] = "degrees.DegCod",
+      [Hie_Lvl_CTR] = "centres.CtrCod",
+      [Hie_Lvl_INS] = "institutions.InsCod",
+      [Hie_Lvl_CTY] = "countries.CtyCod",
+     };
+   char QueryFields[Hie_MAX_BYTES_QUERY_FIELDS + 1];
+   char QueryJoins[Hie_MAX_BYTES_QUERY_JOINS + 1];
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   Hie_Lvl_Level_t Start;
+   Hie_Lvl_Level_t Level;
+   long Cod;
+   unsigned Col;
+   bool Found = true;
+
+   /***** Get the most specific level with a code available *****/
+   if      (Gbl.Hierarchy.Crs.CrsCod > 0)
+     {
+      Start = Hie_Lvl_CRS;
+      Cod = Gbl.Hierarchy.Crs.CrsCod;
+     }
+   else if (Gbl.Hierarchy.Deg.DegCod > 0)
+     {
+      Start = Hie_Lvl_DEG;
+      Cod = Gbl.Hierarchy.Deg.DegCod;
+     }
+   else if (Gbl.Hierarchy.Ctr.CtrCod > 0)
+     {
+      Start = Hie_Lvl_CTR;
+      Cod = Gbl.Hierarchy.Ctr.CtrCod;
+     }
+   else if (Gbl.Hierarchy.Ins.InsCod > 0)
+     {
+      Start = Hie_Lvl_INS;
+      Cod = Gbl.Hierarchy.Ins.InsCod;
+     }
+   else if (Gbl.Hierarchy.Cty.CtyCod > 0)
+     {
+      Start = Hie_Lvl_CTY;
+      Cod = Gbl.Hierarchy.Cty.CtyCod;
+     }
+   else
+      return true;	// Nothing to get
+
+   /***** Build fields and joins from start level up to country *****/
+   QueryFields[0] = '\0';
+   QueryJoins[0]  = '\0';
+   for (Level  = Start;
+	Level >= Hie_Lvl_INS;
+	Level--)
+     {
+      Str_Concat (QueryFields,Fields[Level],sizeof (QueryFields) - 1);
+      Str_Concat (QueryJoins,JoinParent[Level],sizeof (QueryJoins) - 1);
+     }
+
+   /***** Get data of all the levels from database *****/
+   if (DB_QuerySELECT (&mysql_res,"can not get data of hierarchy",
+		       "SELECT %s"
+			      "countries.Alpha2,"
+			      "countries.Name_%s,"
+			      "countries.WWW_%s"
+		       " FROM %s%s"
+		       " WHERE %s=%ld",
+		       QueryFields,
+		       Lan_STR_LANG_ID[Gbl.Prefs.Language],
+		       Lan_STR_LANG_ID[Gbl.Prefs.Language],
+		       Table[Start],QueryJoins,
+		       CodField[Start],Cod))
+     {
+      row = mysql_fetch_row (mysql_res);
+
+      /***** Get data of each level below country *****/
+      for (Level  = Start, Col = 0;
+	   Level >= Hie_Lvl_INS;
+	   Col += NumFields[Level], Level--)
+	 switch (Level)
+	   {
+	    case Hie_Lvl_CRS:
+	       Crs_GetDataOfCourseFromRow (&Gbl.Hierarchy.Crs,&row[Col]);
+	       Gbl.Hierarchy.Deg.DegCod = Gbl.Hierarchy.Crs.DegCod;
+	       break;
+	    case Hie_Lvl_DEG:
+	       Deg_GetDataOfDegreeFromRow (&Gbl.Hierarchy.Deg,&row[Col]);
+	       Gbl.Hierarchy.Ctr.CtrCod = Gbl.Hierarchy.Deg.CtrCod;
+	       break;
+	    case Hie_Lvl_CTR:
+	       Ctr_GetDataOfCentreFromRow (&Gbl.Hierarchy.Ctr,&row[Col]);
+	       Gbl.Hierarchy.Ctr.NumUsrsWhoClaimToBelongToCtr.Valid = false;
+	       Gbl.Hierarchy.Ins.InsCod = Gbl.Hierarchy.Ctr.InsCod;
+	       break;
+	    case Hie_Lvl_INS:
+	       Ins_GetDataOfInstitFromRow (&Gbl.Hierarchy.Ins,&row[Col]);
+	       Gbl.Hierarchy.Ins.NumUsrsWhoClaimToBelongToIns.Valid = false;
+	       Gbl.Hierarchy.Cty.CtyCod = Gbl.Hierarchy.Ins.CtyCod;
+	       break;
+	    default:
+	       break;
+	   }
+
+      /***** Get data of country *****/
+      if (Gbl.Hierarchy.Cty.CtyCod > 0)
+	{
+	 if (row[Col])	// Country found
+	   {
+	    Cty_GetDataOfCountryFromRow (&Gbl.Hierarchy.Cty,&row[Col]);
+	    Gbl.Hierarchy.Cty.NumUsrsWhoClaimToBelongToCty.Valid = false;
+	   }
+	 else
+	    Found = false;
+	}
+     }
+   else
+      Found = false;
+
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+
+   return Found;
+  }
+
 /*****************************************************************************/
 /******* Reset current country, institution, centre, degree and course *******/
 /*****************************************************************************/
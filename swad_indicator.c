@@ -51,6 +51,22 @@ extern struct Globals Gbl;
 /**************************** Private constants ******************************/
 /*****************************************************************************/
 
+/***** Fields of stored indicators got when listing courses *****/
+#define Ind_FIELDS_CRS_INDICATORS "crs_indicators.NumFilesDocum,"	\
+				  "crs_indicators.NumFilesShare,"	\
+				  "crs_indicators.NumFilesAssig,"	\
+				  "crs_indicators.NumFilesWorks,"	\
+				  "crs_indicators.SyllabusLecSrc,"	\
+				  "crs_indicators.SyllabusPraSrc,"	\
+				  "crs_indicators.TeachingGuideSrc,"	\
+				  "crs_indicators.AssessmentSrc,"	\
+				  "crs_indicators.NumAssignments,"	\
+				  "crs_indicators.NumThreads,"		\
+				  "crs_indicators.NumPosts,"		\
+				  "crs_indicators.NumMsgsSentByTchs"
+#define Ind_JOIN_CRS_INDICATORS " LEFT JOIN crs_indicators"		\
+				" ON courses.CrsCod=crs_indicators.CrsCod"
+
 /*****************************************************************************/
 /******************************* Private types *******************************/
 /*****************************************************************************/
@@ -67,6 +83,10 @@ typedef enum
 
 static void Ind_GetParamsIndicators (struct Ind_Indicators *Indicators);
 static void Ind_GetParamNumIndicators (struct Ind_Indicators *Indicators);
+static void Ind_PutParamsIndicators (const struct Ind_Indicators *Indicators);
+static unsigned Ind_GetTableOfCoursesWithIndicators (const struct Ind_Indicators *Indicators,
+                                                     MYSQL_RES **mysql_res,
+                                                     unsigned *NumCrssWithDrift);
 static unsigned Ind_GetTableOfCourses (const struct Ind_Indicators *Indicators,
                                        MYSQL_RES **mysql_res);
 static bool Ind_GetIfShowBigList (struct Ind_Indicators *Indicators,
@@ -83,8 +103,18 @@ static void Ind_ShowNumCoursesWithIndicators (const struct Ind_Indicators *Indic
 static void Ind_ShowTableOfCoursesWithIndicators (const struct Ind_Indicators *Indicators,
 	                                          Ind_IndicatorsLayout_t IndicatorsLayout,
                                                   unsigned NumCrss,MYSQL_RES *mysql_res);
-static unsigned Ind_GetAndUpdateNumIndicatorsCrs (long CrsCod);
-static void Ind_StoreIndicatorsCrsIntoDB (long CrsCod,unsigned NumIndicators);
+static unsigned Ind_ComputeIndicatorsOfCourses (unsigned NumCrss,MYSQL_RES *mysql_res,
+                                                bool Verify,unsigned *NumCrssWithDrift);
+static bool Ind_GetIndicatorsCrsFromRow (MYSQL_ROW row,struct Ind_IndicatorsCrs *IndicatorsCrs);
+static bool Ind_GetIndicatorsCrsFromDB (long CrsCod,struct Ind_IndicatorsCrs *IndicatorsCrs);
+static void Ind_ComputeIndicatorsCrs (long CrsCod,struct Ind_IndicatorsCrs *IndicatorsCrs);
+static void Ind_ComputeCounterCrs (long CrsCod,Ind_Counter_t Counter,
+                                   struct Ind_IndicatorsCrs *IndicatorsCrs);
+static void Ind_SetIndicatorsCrs (struct Ind_IndicatorsCrs *IndicatorsCrs);
+static bool Ind_CheckIfCountersAreEqual (const struct Ind_IndicatorsCrs *IndicatorsCrs1,
+                                         const struct Ind_IndicatorsCrs *IndicatorsCrs2);
+static void Ind_StoreIndicatorsCrsIntoDB (long CrsCod,
+                                          const struct Ind_IndicatorsCrs *IndicatorsCrs);
 static unsigned long Ind_GetNumFilesInDocumZonesOfCrsFromDB (long CrsCod);
 static unsigned long Ind_GetNumFilesInShareZonesOfCrsFromDB (long CrsCod);
 static unsigned long Ind_GetNumFilesInAssigZonesOfCrsFromDB (long CrsCod);
@@ -106,9 +136,11 @@ void Ind_ReqIndicatorsCourses (void)
    extern const char *Txt_Number_of_indicators;
    extern const char *Txt_Indicators_of_courses;
    extern const char *Txt_Show_more_details;
+   extern const char *Txt_Check;
    struct Ind_Indicators Indicators;
    MYSQL_RES *mysql_res;
    unsigned NumCrss;
+   unsigned NumCrssWithDrift;
    unsigned NumCrssWithIndicatorYes[1 + Ind_NUM_INDICATORS];
    unsigned NumCrssToList;
    unsigned Ind;
@@ -179,7 +211,8 @@ void Ind_ReqIndicatorsCourses (void)
       If Indicators.NumIndicators >= 0 ==> only those courses in result
                                          with Indicators.NumIndicators set to yes
                                          will be listed */
-   NumCrss = Ind_GetTableOfCourses (&Indicators,&mysql_res);
+   NumCrss = Ind_GetTableOfCoursesWithIndicators (&Indicators,&mysql_res,
+                                                  &NumCrssWithDrift);
 
    /***** Get vector with numbers of courses with 0, 1, 2... indicators set to yes *****/
    Ind_GetNumCoursesWithIndicators (NumCrssWithIndicatorYes,NumCrss,mysql_res);
@@ -214,13 +247,19 @@ void Ind_ReqIndicatorsCourses (void)
 
       /* Button to show more details */
       Frm_StartForm (ActSeeAllStaCrs);
-      Sco_PutParamScope ("ScopeInd",Gbl.Scope.Current);
-      Par_PutHiddenParamLong (NULL,"OthDegTypCod",Indicators.DegTypCod);
-      Par_PutHiddenParamLong (NULL,Dpt_PARAM_DPT_COD_NAME,Indicators.DptCod);
-      if (Indicators.StrIndicatorsSelected[0])
-         Par_PutHiddenParamString (NULL,"Indicators",Indicators.StrIndicatorsSelected);
+      Ind_PutParamsIndicators (&Indicators);
       Btn_PutConfirmButton (Txt_Show_more_details);
       Frm_EndForm ();
+
+      /* Button to check stored indicators recomputing them from scratch */
+      if (Gbl.Usrs.Me.Role.Logged == Rol_SYS_ADM)
+	{
+	 Frm_StartForm (ActSeeAllStaCrs);
+	 Ind_PutParamsIndicators (&Indicators);
+	 Par_PutHiddenParamChar ("Verify",'Y');
+	 Btn_PutConfirmButton (Txt_Check);
+	 Frm_EndForm ();
+	}
      }
 
    /***** End box *****/
@@ -256,6 +295,10 @@ static void Ind_GetParamsIndicators (struct Ind_Indicators *Indicators)
 
    /***** Get number of indicators *****/
    Ind_GetParamNumIndicators (Indicators);
+
+   /***** Get if stored indicators must be checked (only system admins) *****/
+   Indicators->Verify = (Gbl.Usrs.Me.Role.Logged == Rol_SYS_ADM) &&
+	                Par_GetParToBool ("Verify");
   }
 
 /*****************************************************************************/
@@ -264,16 +307,26 @@ static void Ind_GetParamsIndicators (struct Ind_Indicators *Indicators)
 
 void Ind_ShowIndicatorsCourses (void)
   {
+   extern const char *Txt_Indicators_of_X_of_Y_courses_were_outdated_and_have_been_updated;
    struct Ind_Indicators Indicators;
    MYSQL_RES *mysql_res;
    unsigned NumCrss;
+   unsigned NumCrssWithDrift;
    unsigned NumCrssWithIndicatorYes[1 + Ind_NUM_INDICATORS];
 
    /***** Get parameters *****/
    Ind_GetParamsIndicators (&Indicators);
 
    /***** Get courses from database *****/
-   NumCrss = Ind_GetTableOfCourses (&Indicators,&mysql_res);
+   NumCrss = Ind_GetTableOfCoursesWithIndicators (&Indicators,&mysql_res,
+                                                  &NumCrssWithDrift);
+
+   /***** Show result of checking stored indicators *****/
+   if (Indicators.Verify)
+      Ale_ShowAlert (NumCrssWithDrift ? Ale_WARNING :
+	                                Ale_SUCCESS,
+		     Txt_Indicators_of_X_of_Y_courses_were_outdated_and_have_been_updated,
+		     NumCrssWithDrift,NumCrss);
 
    /***** Get vector with numbers of courses with 0, 1, 2... indicators set to yes *****/
    Ind_GetNumCoursesWithIndicators (NumCrssWithIndicatorYes,NumCrss,mysql_res);
@@ -336,6 +389,49 @@ static void Ind_GetParamNumIndicators (struct Ind_Indicators *Indicators)
 	 Indicators->IndicatorsSelected[Ind] = true;
   }
 
+/*****************************************************************************/
+/********** Put hidden parameters to show indicators of courses **************/
+/*****************************************************************************/
+
+static void Ind_PutParamsIndicators (const struct Ind_Indicators *Indicators)
+  {
+   Sco_PutParamScope ("ScopeInd",Gbl.Scope.Current);
+   Par_PutHiddenParamLong (NULL,"OthDegTypCod",Indicators->DegTypCod);
+   Par_PutHiddenParamLong (NULL,Dpt_PARAM_DPT_COD_NAME,Indicators->DptCod);
+   if (Indicators->StrIndicatorsSelected[0])
+      Par_PutHiddenParamString (NULL,"Indicators",Indicators->StrIndicatorsSelected);
+  }
+
+/*****************************************************************************/
+/************** Get table of courses with their stored indicators ************/
+/*****************************************************************************/
+// Indicators not yet stored are computed and stored before listing courses.
+// If verification is requested, indicators of all courses are recomputed
+// from scratch and the stored ones that differ are updated.
+// Return the number of courses found
+
+static unsigned Ind_GetTableOfCoursesWithIndicators (const struct Ind_Indicators *Indicators,
+                                                     MYSQL_RES **mysql_res,
+                                                     unsigned *NumCrssWithDrift)
+  {
+   unsigned NumCrss;
+
+   /***** Get courses from database *****/
+   NumCrss = Ind_GetTableOfCourses (Indicators,mysql_res);
+
+   /***** Compute indicators not yet stored
+          and check stored ones if verification is requested *****/
+   if (Ind_ComputeIndicatorsOfCourses (NumCrss,*mysql_res,
+                                       Indicators->Verify,NumCrssWithDrift))
+     {
+      /* Some indicators have been stored ==> get courses again */
+      DB_FreeMySQLResult (mysql_res);
+      NumCrss = Ind_GetTableOfCourses (Indicators,mysql_res);
+     }
+
+   return NumCrss;
+  }
+
 /*****************************************************************************/
 /******************* Build query to get table of courses *********************/
 /*****************************************************************************/
@@ -354,8 +450,11 @@ static unsigned Ind_GetTableOfCourses (const struct Ind_Indicators *Indicators,
             if (Indicators->DegTypCod > 0)
                NumCrss =
                (unsigned) DB_QuerySELECT (mysql_res,"can not get courses",
-					  "SELECT DISTINCTROW degrees.FullName,courses.FullName,courses.CrsCod,courses.InsCrsCod"
-					  " FROM degrees,courses,crs_usr,usr_data"
+					  "SELECT DISTINCTROW degrees.FullName,courses.FullName,courses.CrsCod,courses.InsCrsCod,"
+					  Ind_FIELDS_CRS_INDICATORS
+					  " FROM degrees,courses"
+					  Ind_JOIN_CRS_INDICATORS
+					  ",crs_usr,usr_data"
 					  " WHERE degrees.DegTypCod=%ld"
 					  " AND degrees.DegCod=courses.DegCod"
 					  " AND courses.CrsCod=crs_usr.CrsCod"
@@ -369,8 +468,11 @@ static unsigned Ind_GetTableOfCourses (const struct Ind_Indicators *Indicators,
             else
                NumCrss =
                (unsigned) DB_QuerySELECT (mysql_res,"can not get courses",
-					  "SELECT DISTINCTROW degrees.FullName,courses.FullName,courses.CrsCod,courses.InsCrsCod"
-					  " FROM degrees,courses,crs_usr,usr_data"
+					  "SELECT DISTINCTROW degrees.FullName,courses.FullName,courses.CrsCod,courses.InsCrsCod,"
+					  Ind_FIELDS_CRS_INDICATORS
+					  " FROM degrees,courses"
+					  Ind_JOIN_CRS_INDICATORS
+					  ",crs_usr,usr_data"
 					  " WHERE degrees.DegCod=courses.DegCod"
 					  " AND courses.CrsCod=crs_usr.CrsCod"
 					  " AND crs_usr.Role=%u"
@@ -385,8 +487,10 @@ static unsigned Ind_GetTableOfCourses (const struct Ind_Indicators *Indicators,
             if (Indicators->DegTypCod > 0)
                NumCrss =
                (unsigned) DB_QuerySELECT (mysql_res,"can not get courses",
-					  "SELECT degrees.FullName,courses.FullName,courses.CrsCod,courses.InsCrsCod"
+					  "SELECT degrees.FullName,courses.FullName,courses.CrsCod,courses.InsCrsCod,"
+					  Ind_FIELDS_CRS_INDICATORS
 					  " FROM degrees,courses"
+					  Ind_JOIN_CRS_INDICATORS
 					  " WHERE degrees.DegTypCod=%ld"
 					  " AND degrees.DegCod=courses.DegCod"
 					  " ORDER BY degrees.FullName,courses.FullName",
@@ -394,8 +498,10 @@ static unsigned Ind_GetTableOfCourses (const struct Ind_Indicators *Indicators,
             else
                NumCrss =
                (unsigned) DB_QuerySELECT (mysql_res,"can not get courses",
-					  "SELECT degrees.FullName,courses.FullName,courses.CrsCod,courses.InsCrsCod"
+					  "SELECT degrees.FullName,courses.FullName,courses.CrsCod,courses.InsCrsCod,"
+					  Ind_FIELDS_CRS_INDICATORS
 					  " FROM degrees,courses"
+					  Ind_JOIN_CRS_INDICATORS
 					  " WHERE degrees.DegCod=courses.DegCod"
 					  " ORDER BY degrees.FullName,courses.FullName");
            }
@@ -404,8 +510,11 @@ static unsigned Ind_GetTableOfCourses (const struct Ind_Indicators *Indicators,
          if (Indicators->DptCod >= 0)	// 0 means another department
             NumCrss =
             (unsigned) DB_QuerySELECT (mysql_res,"can not get courses",
-				       "SELECT DISTINCTROW degrees.FullName,courses.FullName,courses.CrsCod,courses.InsCrsCod"
-				       " FROM institutions,centres,degrees,courses,crs_usr,usr_data"
+				       "SELECT DISTINCTROW degrees.FullName,courses.FullName,courses.CrsCod,courses.InsCrsCod,"
+				       Ind_FIELDS_CRS_INDICATORS
+				       " FROM institutions,centres,degrees,courses"
+				       Ind_JOIN_CRS_INDICATORS
+				       ",crs_usr,usr_data"
 				       " WHERE institutions.CtyCod=%ld"
 				       " AND institutions.InsCod=centres.InsCod"
 				       " AND centres.CtrCod=degrees.CtrCod"
@@ -421,8 +530,10 @@ static unsigned Ind_GetTableOfCourses (const struct Ind_Indicators *Indicators,
          else
             NumCrss =
             (unsigned) DB_QuerySELECT (mysql_res,"can not get courses",
-				       "SELECT degrees.FullName,courses.FullName,courses.CrsCod,courses.InsCrsCod"
+				       "SELECT degrees.FullName,courses.FullName,courses.CrsCod,courses.InsCrsCod,"
+				       Ind_FIELDS_CRS_INDICATORS
 				       " FROM institutions,centres,degrees,courses"
+				       Ind_JOIN_CRS_INDICATORS
 				       " WHERE institutions.CtyCod=%ld"
 				       " AND institutions.InsCod=centres.InsCod"
 				       " AND centres.CtrCod=degrees.CtrCod"
@@ -434,8 +545,11 @@ static unsigned Ind_GetTableOfCourses (const struct Ind_Indicators *Indicators,
          if (Indicators->DptCod >= 0)	// 0 means another department
             NumCrss =
             (unsigned) DB_QuerySELECT (mysql_res,"can not get courses",
-				       "SELECT DISTINCTROW degrees.FullName,courses.FullName,courses.CrsCod,courses.InsCrsCod"
-				       " FROM centres,degrees,courses,crs_usr,usr_data"
+				       "SELECT DISTINCTROW degrees.FullName,courses.FullName,courses.CrsCod,courses.InsCrsCod,"
+				       Ind_FIELDS_CRS_INDICATORS
+				       " FROM centres,degrees,courses"
+				       Ind_JOIN_CRS_INDICATORS
+				       ",crs_usr,usr_data"
 				       " WHERE centres.InsCod=%ld"
 				       " AND centres.CtrCod=degrees.CtrCod"
 				       " AND degrees.DegCod=courses.DegCod"
@@ -450,8 +564,10 @@ static unsigned Ind_GetTableOfCourses (const struct Ind_Indicators *Indicators,
          else
             NumCrss =
             (unsigned) DB_QuerySELECT (mysql_res,"can not get courses",
-				       "SELECT degrees.FullName,courses.FullName,courses.CrsCod,courses.InsCrsCod"
+				       "SELECT degrees.FullName,courses.FullName,courses.CrsCod,courses.InsCrsCod,"
+				       Ind_FIELDS_CRS_INDICATORS
 				       " FROM centres,degrees,courses"
+				       Ind_JOIN_CRS_INDICATORS
 				       " WHERE centres.InsCod=%ld"
 				       " AND centres.CtrCod=degrees.CtrCod"
 				       " AND degrees.DegCod=courses.DegCod"
@@ -462,8 +578,11 @@ static unsigned Ind_GetTableOfCourses (const struct Ind_Indicators *Indicators,
          if (Indicators->DptCod >= 0)	// 0 means another department
             NumCrss =
             (unsigned) DB_QuerySELECT (mysql_res,"can not get courses",
-				       "SELECT DISTINCTROW degrees.FullName,courses.FullName,courses.CrsCod,courses.InsCrsCod"
-				       " FROM degrees,courses,crs_usr,usr_data"
+				       "SELECT DISTINCTROW degrees.FullName,courses.FullName,courses.CrsCod,courses.InsCrsCod,"
+				       Ind_FIELDS_CRS_INDICATORS
+				       " FROM degrees,courses"
+				       Ind_JOIN_CRS_INDICATORS
+				       ",crs_usr,usr_data"
 				       " WHERE degrees.CtrCod=%ld"
 				       " AND degrees.DegCod=courses.DegCod"
 				       " AND courses.CrsCod=crs_usr.CrsCod"
@@ -477,8 +596,10 @@ static unsigned Ind_GetTableOfCourses (const struct Ind_Indicators *Indicators,
          else
             NumCrss =
             (unsigned) DB_QuerySELECT (mysql_res,"can not get courses",
-				       "SELECT degrees.FullName,courses.FullName,courses.CrsCod,courses.InsCrsCod"
+				       "SELECT degrees.FullName,courses.FullName,courses.CrsCod,courses.InsCrsCod,"
+				       Ind_FIELDS_CRS_INDICATORS
 				       " FROM degrees,courses"
+				       Ind_JOIN_CRS_INDICATORS
 				       " WHERE degrees.CtrCod=%ld"
 				       " AND degrees.DegCod=courses.DegCod"
 				       " ORDER BY degrees.FullName,courses.FullName",
@@ -488,8 +609,11 @@ static unsigned Ind_GetTableOfCourses (const struct Ind_Indicators *Indicators,
          if (Indicators->DptCod >= 0)	// 0 means another department
             NumCrss =
             (unsigned) DB_QuerySELECT (mysql_res,"can not get courses",
-				       "SELECT DISTINCTROW degrees.FullName,courses.FullName,courses.CrsCod,courses.InsCrsCod"
-				       " FROM degrees,courses,crs_usr,usr_data"
+				       "SELECT DISTINCTROW degrees.FullName,courses.FullName,courses.CrsCod,courses.InsCrsCod,"
+				       Ind_FIELDS_CRS_INDICATORS
+				       " FROM degrees,courses"
+				       Ind_JOIN_CRS_INDICATORS
+				       ",crs_usr,usr_data"
 				       " WHERE degrees.DegCod=%ld"
 				       " AND degrees.DegCod=courses.DegCod"
 				       " AND courses.CrsCod=crs_usr.CrsCod"
@@ -503,8 +627,10 @@ static unsigned Ind_GetTableOfCourses (const struct Ind_Indicators *Indicators,
          else
             NumCrss =
             (unsigned) DB_QuerySELECT (mysql_res,"can not get courses",
-				       "SELECT degrees.FullName,courses.FullName,courses.CrsCod,courses.InsCrsCod"
+				       "SELECT degrees.FullName,courses.FullName,courses.CrsCod,courses.InsCrsCod,"
+				       Ind_FIELDS_CRS_INDICATORS
 				       " FROM degrees,courses"
+				       Ind_JOIN_CRS_INDICATORS
 				       " WHERE degrees.DegCod=%ld"
 				       " AND degrees.DegCod=courses.DegCod"
 				       " ORDER BY degrees.FullName,courses.FullName",
@@ -514,8 +640,11 @@ static unsigned Ind_GetTableOfCourses (const struct Ind_Indicators *Indicators,
          if (Indicators->DptCod >= 0)	// 0 means another department
             NumCrss =
             (unsigned) DB_QuerySELECT (mysql_res,"can not get courses",
-				       "SELECT DISTINCTROW degrees.FullName,courses.FullName,courses.CrsCod,courses.InsCrsCod"
-				       " FROM degrees,courses,crs_usr,usr_data"
+				       "SELECT DISTINCTROW degrees.FullName,courses.FullName,courses.CrsCod,courses.InsCrsCod,"
+				       Ind_FIELDS_CRS_INDICATORS
+				       " FROM degrees,courses"
+				       Ind_JOIN_CRS_INDICATORS
+				       ",crs_usr,usr_data"
 				       " WHERE courses.CrsCod=%ld"
 				       " AND degrees.DegCod=courses.DegCod"
 				       " AND courses.CrsCod=crs_usr.CrsCod"
@@ -531,8 +660,10 @@ static unsigned Ind_GetTableOfCourses (const struct Ind_Indicators *Indicators,
          else
             NumCrss =
             (unsigned) DB_QuerySELECT (mysql_res,"can not get courses",
-				       "SELECT degrees.FullName,courses.FullName,courses.CrsCod,courses.InsCrsCod"
+				       "SELECT degrees.FullName,courses.FullName,courses.CrsCod,courses.InsCrsCod,"
+				       Ind_FIELDS_CRS_INDICATORS
 				       " FROM degrees,courses"
+				       Ind_JOIN_CRS_INDICATORS
 				       " WHERE courses.CrsCod=%ld"
 				       " AND degrees.DegCod=courses.DegCod"
 				       " ORDER BY degrees.FullName,courses.FullName",
@@ -606,9 +737,8 @@ static void Ind_GetNumCoursesWithIndicators (unsigned NumCrssWithIndicatorYes[1
   {
    MYSQL_ROW row;
    unsigned NumCrs;
-   long CrsCod;
    unsigned Ind;
-   unsigned NumIndicators;
+   struct Ind_IndicatorsCrs IndicatorsCrs;
 
    /***** Reset counters of courses with each number of indicators *****/
    for (Ind = 0;
@@ -617,20 +747,18 @@ static void Ind_GetNumCoursesWithIndicators (unsigned NumCrssWithIndicatorYes[1
       NumCrssWithIndicatorYes[Ind] = 0;
 
    /***** List courses *****/
-   for (Gbl.RowEvenOdd = 1, NumCrs = 0;
+   mysql_data_seek (mysql_res,0);
+   for (NumCrs = 0;
 	NumCrs < NumCrss;
-	NumCrs++, Gbl.RowEvenOdd = 1 - Gbl.RowEvenOdd)
+	NumCrs++)
      {
       /* Get next course */
       row = mysql_fetch_row (mysql_res);
 
-      /* Get course code (row[2]) */
-      if ((CrsCod = Str_ConvertStrCodToLongCod (row[2])) < 0)
-         Lay_ShowErrorAndExit ("Wrong code of course.");
-
-      /* Get stored number of indicators of this course */
-      NumIndicators = Ind_GetAndUpdateNumIndicatorsCrs (CrsCod);
-      NumCrssWithIndicatorYes[NumIndicators]++;
+      /* Get stored indicators of this course */
+      if (!Ind_GetIndicatorsCrsFromRow (&row[4],&IndicatorsCrs))
+         Lay_ShowErrorAndExit ("Indicators of a course are not computed.");
+      NumCrssWithIndicatorYes[IndicatorsCrs.NumIndicators]++;
      }
   }
 
@@ -762,7 +890,6 @@ static void Ind_ShowTableOfCoursesWithIndicators (const struct Ind_Indicators *I
    long CrsCod;
    unsigned NumTchs;
    unsigned NumStds;
-   unsigned NumIndicators;
    struct Ind_IndicatorsCrs IndicatorsCrs;
    long ActCod;
 
@@ -896,345 +1023,339 @@ static void Ind_ShowTableOfCoursesWithIndicators (const struct Ind_Indicators *I
       if ((CrsCod = Str_ConvertStrCodToLongCod (row[2])) < 0)
          Lay_ShowErrorAndExit ("Wrong code of course.");
 
-      /* Get stored number of indicators of this course */
-      NumIndicators = Ind_GetAndUpdateNumIndicatorsCrs (CrsCod);
-      if (Indicators->IndicatorsSelected[NumIndicators])
+      /* Get stored indicators of this course */
+      if (!Ind_GetIndicatorsCrsFromRow (&row[4],&IndicatorsCrs))
+         Lay_ShowErrorAndExit ("Indicators of a course are not computed.");
+      if (Indicators->IndicatorsSelected[IndicatorsCrs.NumIndicators])
 	{
-	 /* Compute and store indicators */
-	 Ind_ComputeAndStoreIndicatorsCrs (CrsCod,(int) NumIndicators,&IndicatorsCrs);
+	 ActCod = Act_GetActCod (ActReqStaCrs);
 
-	 /* The number of indicators may have changed */
-	 if (Indicators->IndicatorsSelected[IndicatorsCrs.NumIndicators])
+	 /* Write a row for this course */
+	 switch (IndicatorsLayout)
 	   {
-            ActCod = Act_GetActCod (ActReqStaCrs);
-
-	    /* Write a row for this course */
-	    switch (IndicatorsLayout)
-	      {
-	       case Ind_INDICATORS_BRIEF:
-		  HTM_TR_Begin (NULL);
-
-		  HTM_TD_Begin ("class=\"%s LM COLOR%u\"",
-			        IndicatorsCrs.CourseAllOK ? "DAT_SMALL_GREEN" :
-			        (IndicatorsCrs.CoursePartiallyOK ? "DAT_SMALL" :
-							           "DAT_SMALL_RED"),
-			        Gbl.RowEvenOdd);
-		  HTM_Txt (row[0]);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"%s LM COLOR%u\"",
-			        IndicatorsCrs.CourseAllOK ? "DAT_SMALL_GREEN" :
-			        (IndicatorsCrs.CoursePartiallyOK ? "DAT_SMALL" :
-							           "DAT_SMALL_RED"),
-			        Gbl.RowEvenOdd);
-		  HTM_Txt (row[1]);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"%s LM COLOR%u\"",
-			        IndicatorsCrs.CourseAllOK ? "DAT_SMALL_GREEN" :
-			        (IndicatorsCrs.CoursePartiallyOK ? "DAT_SMALL" :
-							           "DAT_SMALL_RED"),
-			        Gbl.RowEvenOdd);
-		  HTM_Txt (row[3]);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"DAT_SMALL LM COLOR%u\"",Gbl.RowEvenOdd);
-		  HTM_A_Begin ("href=\"%s/?crs=%ld&amp;act=%ld\" target=\"_blank\"",
-			       Cfg_URL_SWAD_CGI,CrsCod,ActCod);
-		  HTM_TxtF ("%s/?crs=%ld&amp;act=%ld",
+	    case Ind_INDICATORS_BRIEF:
+	       HTM_TR_Begin (NULL);
+
+	       HTM_TD_Begin ("class=\"%s LM COLOR%u\"",
+			     IndicatorsCrs.CourseAllOK ? "DAT_SMALL_GREEN" :
+			     (IndicatorsCrs.CoursePartiallyOK ? "DAT_SMALL" :
+								"DAT_SMALL_RED"),
+			     Gbl.RowEvenOdd);
+	       HTM_Txt (row[0]);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"%s LM COLOR%u\"",
+			     IndicatorsCrs.CourseAllOK ? "DAT_SMALL_GREEN" :
+			     (IndicatorsCrs.CoursePartiallyOK ? "DAT_SMALL" :
+								"DAT_SMALL_RED"),
+			     Gbl.RowEvenOdd);
+	       HTM_Txt (row[1]);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"%s LM COLOR%u\"",
+			     IndicatorsCrs.CourseAllOK ? "DAT_SMALL_GREEN" :
+			     (IndicatorsCrs.CoursePartiallyOK ? "DAT_SMALL" :
+								"DAT_SMALL_RED"),
+			     Gbl.RowEvenOdd);
+	       HTM_Txt (row[3]);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"DAT_SMALL LM COLOR%u\"",Gbl.RowEvenOdd);
+	       HTM_A_Begin ("href=\"%s/?crs=%ld&amp;act=%ld\" target=\"_blank\"",
 			    Cfg_URL_SWAD_CGI,CrsCod,ActCod);
-		  HTM_A_End ();
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"%s RM COLOR%u\"",
-			        IndicatorsCrs.CourseAllOK ? "DAT_SMALL_GREEN" :
-			        (IndicatorsCrs.CoursePartiallyOK ? "DAT_SMALL" :
-							           "DAT_SMALL_RED"),
-			        Gbl.RowEvenOdd);
-		  HTM_Unsigned (IndicatorsCrs.NumIndicators);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"DAT_SMALL_GREEN CM COLOR%u\"",
-			        Gbl.RowEvenOdd);
-		  if (IndicatorsCrs.ThereIsSyllabus)
-		     HTM_Txt (Txt_YES);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"DAT_SMALL_RED CM COLOR%u\"",
-			        Gbl.RowEvenOdd);
-		  if (!IndicatorsCrs.ThereIsSyllabus)
-		     HTM_Txt (Txt_NO);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"DAT_SMALL_GREEN CM COLOR%u\"",
-			        Gbl.RowEvenOdd);
-		  if (IndicatorsCrs.ThereAreAssignments)
-		     HTM_Txt (Txt_YES);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"DAT_SMALL_RED CM COLOR%u\"",
-			        Gbl.RowEvenOdd);
-		  if (!IndicatorsCrs.ThereAreAssignments)
-		     HTM_Txt (Txt_NO);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"DAT_SMALL_GREEN CM COLOR%u\"",
-			        Gbl.RowEvenOdd);
-		  if (IndicatorsCrs.ThereIsOnlineTutoring)
-		     HTM_Txt (Txt_YES);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"DAT_SMALL_RED CM COLOR%u\"",
-			        Gbl.RowEvenOdd);
-		  if (!IndicatorsCrs.ThereIsOnlineTutoring)
-		     HTM_Txt (Txt_NO);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"DAT_SMALL_GREEN CM COLOR%u\"",
-			        Gbl.RowEvenOdd);
-		  if (IndicatorsCrs.ThereAreMaterials)
-		     HTM_Txt (Txt_YES);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"DAT_SMALL_RED CM COLOR%u\"",
-			        Gbl.RowEvenOdd);
-		  if (!IndicatorsCrs.ThereAreMaterials)
-		     HTM_Txt (Txt_NO);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"DAT_SMALL_GREEN CM COLOR%u\"",
-			        Gbl.RowEvenOdd);
-		  if (IndicatorsCrs.ThereIsAssessment)
-		     HTM_Txt (Txt_YES);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"DAT_SMALL_RED CM COLOR%u\"",
-			        Gbl.RowEvenOdd);
-		  if (!IndicatorsCrs.ThereIsAssessment)
-		     HTM_Txt (Txt_NO);
-		  HTM_TD_End ();
-
-		  HTM_TR_End ();
-		  break;
-	       case Ind_INDICATORS_FULL:
-		  /* Get number of users */
-		  NumTchs = Usr_GetNumUsrsInCrss (Hie_Lvl_CRS,CrsCod,
-				                  1 << Rol_NET |	// Non-editing teachers
-						  1 << Rol_TCH);	// Teachers
-		  NumStds = Usr_GetNumUsrsInCrss (Hie_Lvl_CRS,CrsCod,
-				                  1 << Rol_STD);	// Students
-
-		  HTM_TR_Begin (NULL);
-
-		  HTM_TD_Begin ("class=\"%s LM COLOR%u\"",
-			        IndicatorsCrs.CourseAllOK ? "DAT_SMALL_GREEN" :
-			        (IndicatorsCrs.CoursePartiallyOK ? "DAT_SMALL" :
-							           "DAT_SMALL_RED"),
-			        Gbl.RowEvenOdd);
-		  HTM_Txt (row[0]);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"%s LM COLOR%u\"",
-			        IndicatorsCrs.CourseAllOK ? "DAT_SMALL_GREEN" :
-			        (IndicatorsCrs.CoursePartiallyOK ? "DAT_SMALL" :
-							           "DAT_SMALL_RED"),
-			        Gbl.RowEvenOdd);
-		  HTM_Txt (row[1]);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"%s LM COLOR%u\"",
-			        IndicatorsCrs.CourseAllOK ? "DAT_SMALL_GREEN" :
-			        (IndicatorsCrs.CoursePartiallyOK ? "DAT_SMALL" :
-							           "DAT_SMALL_RED"),
-			        Gbl.RowEvenOdd);
-		  HTM_Txt (row[3]);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"DAT_SMALL LM COLOR%u\"",Gbl.RowEvenOdd);
-		  HTM_A_Begin ("href=\"%s/?crs=%ld&amp;act=%ld\" target=\"_blank\"",
-			       Cfg_URL_SWAD_CGI,CrsCod,ActCod);
-		  HTM_TxtF ("%s/?crs=%ld&amp;act=%ld",
+	       HTM_TxtF ("%s/?crs=%ld&amp;act=%ld",
+			 Cfg_URL_SWAD_CGI,CrsCod,ActCod);
+	       HTM_A_End ();
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"%s RM COLOR%u\"",
+			     IndicatorsCrs.CourseAllOK ? "DAT_SMALL_GREEN" :
+			     (IndicatorsCrs.CoursePartiallyOK ? "DAT_SMALL" :
+								"DAT_SMALL_RED"),
+			     Gbl.RowEvenOdd);
+	       HTM_Unsigned (IndicatorsCrs.NumIndicators);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"DAT_SMALL_GREEN CM COLOR%u\"",
+			     Gbl.RowEvenOdd);
+	       if (IndicatorsCrs.ThereIsSyllabus)
+		  HTM_Txt (Txt_YES);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"DAT_SMALL_RED CM COLOR%u\"",
+			     Gbl.RowEvenOdd);
+	       if (!IndicatorsCrs.ThereIsSyllabus)
+		  HTM_Txt (Txt_NO);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"DAT_SMALL_GREEN CM COLOR%u\"",
+			     Gbl.RowEvenOdd);
+	       if (IndicatorsCrs.ThereAreAssignments)
+		  HTM_Txt (Txt_YES);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"DAT_SMALL_RED CM COLOR%u\"",
+			     Gbl.RowEvenOdd);
+	       if (!IndicatorsCrs.ThereAreAssignments)
+		  HTM_Txt (Txt_NO);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"DAT_SMALL_GREEN CM COLOR%u\"",
+			     Gbl.RowEvenOdd);
+	       if (IndicatorsCrs.ThereIsOnlineTutoring)
+		  HTM_Txt (Txt_YES);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"DAT_SMALL_RED CM COLOR%u\"",
+			     Gbl.RowEvenOdd);
+	       if (!IndicatorsCrs.ThereIsOnlineTutoring)
+		  HTM_Txt (Txt_NO);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"DAT_SMALL_GREEN CM COLOR%u\"",
+			     Gbl.RowEvenOdd);
+	       if (IndicatorsCrs.ThereAreMaterials)
+		  HTM_Txt (Txt_YES);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"DAT_SMALL_RED CM COLOR%u\"",
+			     Gbl.RowEvenOdd);
+	       if (!IndicatorsCrs.ThereAreMaterials)
+		  HTM_Txt (Txt_NO);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"DAT_SMALL_GREEN CM COLOR%u\"",
+			     Gbl.RowEvenOdd);
+	       if (IndicatorsCrs.ThereIsAssessment)
+		  HTM_Txt (Txt_YES);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"DAT_SMALL_RED CM COLOR%u\"",
+			     Gbl.RowEvenOdd);
+	       if (!IndicatorsCrs.ThereIsAssessment)
+		  HTM_Txt (Txt_NO);
+	       HTM_TD_End ();
+
+	       HTM_TR_End ();
+	       break;
+	    case Ind_INDICATORS_FULL:
+	       /* Get number of users */
+	       NumTchs = Usr_GetNumUsrsInCrss (Hie_Lvl_CRS,CrsCod,
+					       1 << Rol_NET |	// Non-editing teachers
+					       1 << Rol_TCH);	// Teachers
+	       NumStds = Usr_GetNumUsrsInCrss (Hie_Lvl_CRS,CrsCod,
+					       1 << Rol_STD);	// Students
+
+	       HTM_TR_Begin (NULL);
+
+	       HTM_TD_Begin ("class=\"%s LM COLOR%u\"",
+			     IndicatorsCrs.CourseAllOK ? "DAT_SMALL_GREEN" :
+			     (IndicatorsCrs.CoursePartiallyOK ? "DAT_SMALL" :
+								"DAT_SMALL_RED"),
+			     Gbl.RowEvenOdd);
+	       HTM_Txt (row[0]);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"%s LM COLOR%u\"",
+			     IndicatorsCrs.CourseAllOK ? "DAT_SMALL_GREEN" :
+			     (IndicatorsCrs.CoursePartiallyOK ? "DAT_SMALL" :
+								"DAT_SMALL_RED"),
+			     Gbl.RowEvenOdd);
+	       HTM_Txt (row[1]);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"%s LM COLOR%u\"",
+			     IndicatorsCrs.CourseAllOK ? "DAT_SMALL_GREEN" :
+			     (IndicatorsCrs.CoursePartiallyOK ? "DAT_SMALL" :
+								"DAT_SMALL_RED"),
+			     Gbl.RowEvenOdd);
+	       HTM_Txt (row[3]);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"DAT_SMALL LM COLOR%u\"",Gbl.RowEvenOdd);
+	       HTM_A_Begin ("href=\"%s/?crs=%ld&amp;act=%ld\" target=\"_blank\"",
 			    Cfg_URL_SWAD_CGI,CrsCod,ActCod);
-		  HTM_A_End ();
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"%s RM COLOR%u\"",
-			        NumTchs != 0 ? "DAT_SMALL_GREEN" :
-					       "DAT_SMALL_RED",
-			        Gbl.RowEvenOdd);
-		  HTM_Unsigned (NumTchs);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"%s RM COLOR%u\"",
-			        NumStds != 0 ? "DAT_SMALL_GREEN" :
-					       "DAT_SMALL_RED",
-			        Gbl.RowEvenOdd);
-		  HTM_Unsigned (NumStds);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"%s RM COLOR%u\"",
-			        IndicatorsCrs.CourseAllOK ? "DAT_SMALL_GREEN" :
-			        (IndicatorsCrs.CoursePartiallyOK ? "DAT_SMALL" :
-							           "DAT_SMALL_RED"),
-			        Gbl.RowEvenOdd);
-		  HTM_Unsigned (IndicatorsCrs.NumIndicators);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"DAT_SMALL_GREEN CM COLOR%u\"",
-			        Gbl.RowEvenOdd);
-		  if (IndicatorsCrs.ThereIsSyllabus)
-		     HTM_Txt (Txt_YES);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"DAT_SMALL_RED CM COLOR%u\"",
-			        Gbl.RowEvenOdd);
-		  if (!IndicatorsCrs.ThereIsSyllabus)
-		     HTM_Txt (Txt_NO);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"%s LM COLOR%u\"",
-			        (IndicatorsCrs.SyllabusLecSrc != Inf_INFO_SRC_NONE) ? "DAT_SMALL_GREEN" :
-										      "DAT_SMALL_RED",
-			        Gbl.RowEvenOdd);
-		  HTM_Txt (Txt_INFO_SRC_SHORT_TEXT[IndicatorsCrs.SyllabusLecSrc]);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"%s LM COLOR%u\"",
-			        (IndicatorsCrs.SyllabusPraSrc != Inf_INFO_SRC_NONE) ? "DAT_SMALL_GREEN" :
-										      "DAT_SMALL_RED",
-			        Gbl.RowEvenOdd);
-		  HTM_Txt (Txt_INFO_SRC_SHORT_TEXT[IndicatorsCrs.SyllabusPraSrc]);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"%s LM COLOR%u\">",
-			        (IndicatorsCrs.TeachingGuideSrc != Inf_INFO_SRC_NONE) ? "DAT_SMALL_GREEN" :
-										        "DAT_SMALL_RED",
-			        Gbl.RowEvenOdd);
-		  HTM_Txt (Txt_INFO_SRC_SHORT_TEXT[IndicatorsCrs.TeachingGuideSrc]);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"DAT_SMALL_GREEN CM COLOR%u\"",
-			        Gbl.RowEvenOdd);
-		  if (IndicatorsCrs.ThereAreAssignments)
-		     HTM_Txt (Txt_YES);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"DAT_SMALL_RED CM COLOR%u\"",
-			        Gbl.RowEvenOdd);
-		  if (!IndicatorsCrs.ThereAreAssignments)
-		     HTM_Txt (Txt_NO);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"%s RM COLOR%u\"",
-			        (IndicatorsCrs.NumAssignments != 0) ? "DAT_SMALL_GREEN" :
+	       HTM_TxtF ("%s/?crs=%ld&amp;act=%ld",
+			 Cfg_URL_SWAD_CGI,CrsCod,ActCod);
+	       HTM_A_End ();
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"%s RM COLOR%u\"",
+			     NumTchs != 0 ? "DAT_SMALL_GREEN" :
+					    "DAT_SMALL_RED",
+			     Gbl.RowEvenOdd);
+	       HTM_Unsigned (NumTchs);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"%s RM COLOR%u\"",
+			     NumStds != 0 ? "DAT_SMALL_GREEN" :
+					    "DAT_SMALL_RED",
+			     Gbl.RowEvenOdd);
+	       HTM_Unsigned (NumStds);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"%s RM COLOR%u\"",
+			     IndicatorsCrs.CourseAllOK ? "DAT_SMALL_GREEN" :
+			     (IndicatorsCrs.CoursePartiallyOK ? "DAT_SMALL" :
+								"DAT_SMALL_RED"),
+			     Gbl.RowEvenOdd);
+	       HTM_Unsigned (IndicatorsCrs.NumIndicators);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"DAT_SMALL_GREEN CM COLOR%u\"",
+			     Gbl.RowEvenOdd);
+	       if (IndicatorsCrs.ThereIsSyllabus)
+		  HTM_Txt (Txt_YES);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"DAT_SMALL_RED CM COLOR%u\"",
+			     Gbl.RowEvenOdd);
+	       if (!IndicatorsCrs.ThereIsSyllabus)
+		  HTM_Txt (Txt_NO);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"%s LM COLOR%u\"",
+			     (IndicatorsCrs.SyllabusLecSrc != Inf_INFO_SRC_NONE) ? "DAT_SMALL_GREEN" :
+										   "DAT_SMALL_RED",
+			     Gbl.RowEvenOdd);
+	       HTM_Txt (Txt_INFO_SRC_SHORT_TEXT[IndicatorsCrs.SyllabusLecSrc]);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"%s LM COLOR%u\"",
+			     (IndicatorsCrs.SyllabusPraSrc != Inf_INFO_SRC_NONE) ? "DAT_SMALL_GREEN" :
+										   "DAT_SMALL_RED",
+			     Gbl.RowEvenOdd);
+	       HTM_Txt (Txt_INFO_SRC_SHORT_TEXT[IndicatorsCrs.SyllabusPraSrc]);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"%s LM COLOR%u\">",
+			     (IndicatorsCrs.TeachingGuideSrc != Inf_INFO_SRC_NONE) ? "DAT_SMALL_GREEN" :
+										     "DAT_SMALL_RED",
+			     Gbl.RowEvenOdd);
+	       HTM_Txt (Txt_INFO_SRC_SHORT_TEXT[IndicatorsCrs.TeachingGuideSrc]);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"DAT_SMALL_GREEN CM COLOR%u\"",
+			     Gbl.RowEvenOdd);
+	       if (IndicatorsCrs.ThereAreAssignments)
+		  HTM_Txt (Txt_YES);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"DAT_SMALL_RED CM COLOR%u\"",
+			     Gbl.RowEvenOdd);
+	       if (!IndicatorsCrs.ThereAreAssignments)
+		  HTM_Txt (Txt_NO);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"%s RM COLOR%u\"",
+			     (IndicatorsCrs.NumAssignments != 0) ? "DAT_SMALL_GREEN" :
+								   "DAT_SMALL_RED",
+			     Gbl.RowEvenOdd);
+	       HTM_Unsigned (IndicatorsCrs.NumAssignments);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"%s RM COLOR%u\"",
+			     (IndicatorsCrs.NumFilesAssignments != 0) ? "DAT_SMALL_GREEN" :
+									"DAT_SMALL_RED",
+			     Gbl.RowEvenOdd);
+	       HTM_UnsignedLong (IndicatorsCrs.NumFilesAssignments);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"%s RM COLOR%u\"",
+			     (IndicatorsCrs.NumFilesWorks != 0) ? "DAT_SMALL_GREEN" :
+								  "DAT_SMALL_RED",
+			     Gbl.RowEvenOdd);
+	       HTM_UnsignedLong (IndicatorsCrs.NumFilesWorks);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"DAT_SMALL_GREEN CM COLOR%u\"",
+			     Gbl.RowEvenOdd);
+	       if (IndicatorsCrs.ThereIsOnlineTutoring)
+		  HTM_Txt (Txt_YES);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"DAT_SMALL_RED CM COLOR%u\"",
+			     Gbl.RowEvenOdd);
+	       if (!IndicatorsCrs.ThereIsOnlineTutoring)
+		  HTM_Txt (Txt_NO);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"%s RM COLOR%u\"",
+			     (IndicatorsCrs.NumThreads != 0) ? "DAT_SMALL_GREEN" :
+							       "DAT_SMALL_RED",
+			     Gbl.RowEvenOdd);
+	       HTM_Unsigned (IndicatorsCrs.NumThreads);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"%s RM COLOR%u\"",
+			     (IndicatorsCrs.NumPosts != 0) ? "DAT_SMALL_GREEN" :
+							     "DAT_SMALL_RED",
+			     Gbl.RowEvenOdd);
+	       HTM_Unsigned (IndicatorsCrs.NumPosts);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"%s RM COLOR%u\"",
+			     (IndicatorsCrs.NumMsgsSentByTchs != 0) ? "DAT_SMALL_GREEN" :
 								      "DAT_SMALL_RED",
-			        Gbl.RowEvenOdd);
-		  HTM_Unsigned (IndicatorsCrs.NumAssignments);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"%s RM COLOR%u\"",
-			        (IndicatorsCrs.NumFilesAssignments != 0) ? "DAT_SMALL_GREEN" :
-								           "DAT_SMALL_RED",
-			        Gbl.RowEvenOdd);
-		  HTM_UnsignedLong (IndicatorsCrs.NumFilesAssignments);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"%s RM COLOR%u\"",
-			        (IndicatorsCrs.NumFilesWorks != 0) ? "DAT_SMALL_GREEN" :
-								     "DAT_SMALL_RED",
-			        Gbl.RowEvenOdd);
-		  HTM_UnsignedLong (IndicatorsCrs.NumFilesWorks);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"DAT_SMALL_GREEN CM COLOR%u\"",
-			        Gbl.RowEvenOdd);
-		  if (IndicatorsCrs.ThereIsOnlineTutoring)
-		     HTM_Txt (Txt_YES);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"DAT_SMALL_RED CM COLOR%u\"",
-			        Gbl.RowEvenOdd);
-		  if (!IndicatorsCrs.ThereIsOnlineTutoring)
-		     HTM_Txt (Txt_NO);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"%s RM COLOR%u\"",
-			        (IndicatorsCrs.NumThreads != 0) ? "DAT_SMALL_GREEN" :
-							          "DAT_SMALL_RED",
-			        Gbl.RowEvenOdd);
-		  HTM_Unsigned (IndicatorsCrs.NumThreads);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"%s RM COLOR%u\"",
-			        (IndicatorsCrs.NumPosts != 0) ? "DAT_SMALL_GREEN" :
-							        "DAT_SMALL_RED",
-			        Gbl.RowEvenOdd);
-		  HTM_Unsigned (IndicatorsCrs.NumPosts);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"%s RM COLOR%u\"",
-			        (IndicatorsCrs.NumMsgsSentByTchs != 0) ? "DAT_SMALL_GREEN" :
-								         "DAT_SMALL_RED",
-			        Gbl.RowEvenOdd);
-		  HTM_Unsigned (IndicatorsCrs.NumMsgsSentByTchs);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"DAT_SMALL_GREEN CM COLOR%u\"",
-			        Gbl.RowEvenOdd);
-		  if (IndicatorsCrs.ThereAreMaterials)
-		     HTM_Txt (Txt_YES);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"DAT_SMALL_RED CM COLOR%u\"",
-			        Gbl.RowEvenOdd);
-		  if (!IndicatorsCrs.ThereAreMaterials)
-		     HTM_Txt (Txt_NO);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"%s RM COLOR%u\"",
-			        (IndicatorsCrs.NumFilesInDocumentZones != 0) ? "DAT_SMALL_GREEN" :
-									       "DAT_SMALL_RED",
-			        Gbl.RowEvenOdd);
-		  HTM_UnsignedLong (IndicatorsCrs.NumFilesInDocumentZones);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"%s RM COLOR%u\"",
-			        (IndicatorsCrs.NumFilesInSharedZones != 0) ? "DAT_SMALL_GREEN" :
-									     "DAT_SMALL_RED",
-			        Gbl.RowEvenOdd);
-		  HTM_UnsignedLong (IndicatorsCrs.NumFilesInSharedZones);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"DAT_SMALL_GREEN CM COLOR%u\"",
-			        Gbl.RowEvenOdd);
-		  if (IndicatorsCrs.ThereIsAssessment)
-		     HTM_Txt (Txt_YES);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"DAT_SMALL_RED CM COLOR%u\"",
-			        Gbl.RowEvenOdd);
-		  if (!IndicatorsCrs.ThereIsAssessment)
-		     HTM_Txt (Txt_NO);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"%s LM COLOR%u\"",
-			        (IndicatorsCrs.AssessmentSrc != Inf_INFO_SRC_NONE) ? "DAT_SMALL_GREEN" :
+			     Gbl.RowEvenOdd);
+	       HTM_Unsigned (IndicatorsCrs.NumMsgsSentByTchs);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"DAT_SMALL_GREEN CM COLOR%u\"",
+			     Gbl.RowEvenOdd);
+	       if (IndicatorsCrs.ThereAreMaterials)
+		  HTM_Txt (Txt_YES);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"DAT_SMALL_RED CM COLOR%u\"",
+			     Gbl.RowEvenOdd);
+	       if (!IndicatorsCrs.ThereAreMaterials)
+		  HTM_Txt (Txt_NO);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"%s RM COLOR%u\"",
+			     (IndicatorsCrs.NumFilesInDocumentZones != 0) ? "DAT_SMALL_GREEN" :
+									    "DAT_SMALL_RED",
+			     Gbl.RowEvenOdd);
+	       HTM_UnsignedLong (IndicatorsCrs.NumFilesInDocumentZones);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"%s RM COLOR%u\"",
+			     (IndicatorsCrs.NumFilesInSharedZones != 0) ? "DAT_SMALL_GREEN" :
+									  "DAT_SMALL_RED",
+			     Gbl.RowEvenOdd);
+	       HTM_UnsignedLong (IndicatorsCrs.NumFilesInSharedZones);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"DAT_SMALL_GREEN CM COLOR%u\"",
+			     Gbl.RowEvenOdd);
+	       if (IndicatorsCrs.ThereIsAssessment)
+		  HTM_Txt (Txt_YES);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"DAT_SMALL_RED CM COLOR%u\"",
+			     Gbl.RowEvenOdd);
+	       if (!IndicatorsCrs.ThereIsAssessment)
+		  HTM_Txt (Txt_NO);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"%s LM COLOR%u\"",
+			     (IndicatorsCrs.AssessmentSrc != Inf_INFO_SRC_NONE) ? "DAT_SMALL_GREEN" :
+										  "DAT_SMALL_RED",
+			     Gbl.RowEvenOdd);
+	       HTM_Txt (Txt_INFO_SRC_SHORT_TEXT[IndicatorsCrs.AssessmentSrc]);
+	       HTM_TD_End ();
+
+	       HTM_TD_Begin ("class=\"%s LM COLOR%u\"",
+			     (IndicatorsCrs.TeachingGuideSrc != Inf_INFO_SRC_NONE) ? "DAT_SMALL_GREEN" :
 										     "DAT_SMALL_RED",
-			        Gbl.RowEvenOdd);
-		  HTM_Txt (Txt_INFO_SRC_SHORT_TEXT[IndicatorsCrs.AssessmentSrc]);
-		  HTM_TD_End ();
-
-		  HTM_TD_Begin ("class=\"%s LM COLOR%u\"",
-			        (IndicatorsCrs.TeachingGuideSrc != Inf_INFO_SRC_NONE) ? "DAT_SMALL_GREEN" :
-										        "DAT_SMALL_RED",
-			        Gbl.RowEvenOdd);
-		  HTM_Txt (Txt_INFO_SRC_SHORT_TEXT[IndicatorsCrs.TeachingGuideSrc]);
-		  HTM_TD_End ();
-
-		  HTM_TR_End ();
-		  break;
-		 }
-	   }
+			     Gbl.RowEvenOdd);
+	       HTM_Txt (Txt_INFO_SRC_SHORT_TEXT[IndicatorsCrs.TeachingGuideSrc]);
+	       HTM_TD_End ();
+
+	       HTM_TR_End ();
+	       break;
+	      }
 	}
      }
 
@@ -1243,141 +1364,355 @@ static void Ind_ShowTableOfCoursesWithIndicators (const struct Ind_Indicators *I
   }
 
 /*****************************************************************************/
-/************ Get number of indicators of a course from database *************/
-/************ If not stored ==> compute and store it             *************/
+/************* Compute and store indicators of listed courses ****************/
 /*****************************************************************************/
+// Return the number of courses whose indicators have been stored
 
-static unsigned Ind_GetAndUpdateNumIndicatorsCrs (long CrsCod)
+static unsigned Ind_ComputeIndicatorsOfCourses (unsigned NumCrss,MYSQL_RES *mysql_res,
+                                                bool Verify,unsigned *NumCrssWithDrift)
   {
-   unsigned NumIndicators;
+   MYSQL_ROW row;
+   unsigned NumCrs;
+   long CrsCod;
+   bool IndicatorsAreStored;
+   struct Ind_IndicatorsCrs StoredIndicatorsCrs;
    struct Ind_IndicatorsCrs IndicatorsCrs;
-   int NumIndicatorsFromDB = Ind_GetNumIndicatorsCrsFromDB (CrsCod);
+   unsigned NumCrssStored = 0;
+
+   *NumCrssWithDrift = 0;
+
+   for (NumCrs = 0;
+	NumCrs < NumCrss;
+	NumCrs++)
+     {
+      /* Get next course */
+      row = mysql_fetch_row (mysql_res);
+
+      /* Get course code (row[2]) */
+      if ((CrsCod = Str_ConvertStrCodToLongCod (row[2])) < 0)
+         Lay_ShowErrorAndExit ("Wrong code of course.");
+
+      /* Get stored indicators of this course (row[4]...) */
+      IndicatorsAreStored = Ind_GetIndicatorsCrsFromRow (&row[4],&StoredIndicatorsCrs);
+
+      /* Compute indicators from scratch only if necessary */
+      if (!IndicatorsAreStored || Verify)
+	{
+	 Ind_ComputeIndicatorsCrs (CrsCod,&IndicatorsCrs);
+	 if (!IndicatorsAreStored)
+	   {
+	    Ind_StoreIndicatorsCrsIntoDB (CrsCod,&IndicatorsCrs);
+	    NumCrssStored++;
+	   }
+	 else if (!Ind_CheckIfCountersAreEqual (&StoredIndicatorsCrs,&IndicatorsCrs))
+	   {
+	    Ind_StoreIndicatorsCrsIntoDB (CrsCod,&IndicatorsCrs);
+	    NumCrssStored++;
+	    (*NumCrssWithDrift)++;
+	   }
+	}
+     }
+
+   return NumCrssStored;
+  }
 
-   /***** If number of indicators is not already computed ==> compute it! *****/
-   if (NumIndicatorsFromDB >= 0)
-      NumIndicators = (unsigned) NumIndicatorsFromDB;
-   else	// Number of indicators is not already computed
+/*****************************************************************************/
+/******************** Get stored indicators of a course **********************/
+/*****************************************************************************/
+// If indicators are not yet stored, they are computed and stored
+
+void Ind_GetIndicatorsCrs (long CrsCod,struct Ind_IndicatorsCrs *IndicatorsCrs)
+  {
+   if (!Ind_GetIndicatorsCrsFromDB (CrsCod,IndicatorsCrs))
      {
-      /***** Compute and store number of indicators *****/
-      Ind_ComputeAndStoreIndicatorsCrs (CrsCod,NumIndicatorsFromDB,&IndicatorsCrs);
-      NumIndicators = IndicatorsCrs.NumIndicators;
+      Ind_ComputeIndicatorsCrs (CrsCod,IndicatorsCrs);
+      Ind_StoreIndicatorsCrsIntoDB (CrsCod,IndicatorsCrs);
      }
-   return NumIndicators;
   }
 
 /*****************************************************************************/
-/************ Get number of indicators of a course from database *************/
+/************ Get stored indicators of a course from a row of query **********/
+/*****************************************************************************/
+// row[0]...row[11] must hold the fields in Ind_FIELDS_CRS_INDICATORS
+// Return false if indicators are not stored (fields are NULL)
+
+static bool Ind_GetIndicatorsCrsFromRow (MYSQL_ROW row,struct Ind_IndicatorsCrs *IndicatorsCrs)
+  {
+   unsigned UnsignedNum;
+
+   /***** Check if indicators are stored *****/
+   if (row[0] == NULL)	// May be NULL because of LEFT JOIN
+      return false;
+
+   /***** Get numbers of files (row[0], row[1], row[2], row[3]) *****/
+   if (sscanf (row[0],"%lu",&IndicatorsCrs->NumFilesInDocumentZones) != 1)
+      IndicatorsCrs->NumFilesInDocumentZones = 0;
+   if (sscanf (row[1],"%lu",&IndicatorsCrs->NumFilesInSharedZones) != 1)
+      IndicatorsCrs->NumFilesInSharedZones = 0;
+   if (sscanf (row[2],"%lu",&IndicatorsCrs->NumFilesAssignments) != 1)
+      IndicatorsCrs->NumFilesAssignments = 0;
+   if (sscanf (row[3],"%lu",&IndicatorsCrs->NumFilesWorks) != 1)
+      IndicatorsCrs->NumFilesWorks = 0;
+
+   /***** Get info sources (row[4], row[5], row[6], row[7]) *****/
+   IndicatorsCrs->SyllabusLecSrc   =
+   IndicatorsCrs->SyllabusPraSrc   =
+   IndicatorsCrs->TeachingGuideSrc =
+   IndicatorsCrs->AssessmentSrc    = Inf_INFO_SRC_NONE;
+   if (sscanf (row[4],"%u",&UnsignedNum) == 1)
+      if (UnsignedNum < Inf_NUM_INFO_SOURCES)
+	 IndicatorsCrs->SyllabusLecSrc   = (Inf_InfoSrc_t) UnsignedNum;
+   if (sscanf (row[5],"%u",&UnsignedNum) == 1)
+      if (UnsignedNum < Inf_NUM_INFO_SOURCES)
+	 IndicatorsCrs->SyllabusPraSrc   = (Inf_InfoSrc_t) UnsignedNum;
+   if (sscanf (row[6],"%u",&UnsignedNum) == 1)
+      if (UnsignedNum < Inf_NUM_INFO_SOURCES)
+	 IndicatorsCrs->TeachingGuideSrc = (Inf_InfoSrc_t) UnsignedNum;
+   if (sscanf (row[7],"%u",&UnsignedNum) == 1)
+      if (UnsignedNum < Inf_NUM_INFO_SOURCES)
+	 IndicatorsCrs->AssessmentSrc    = (Inf_InfoSrc_t) UnsignedNum;
+
+   /***** Get number of assignments (row[8]) *****/
+   if (sscanf (row[8],"%u",&IndicatorsCrs->NumAssignments) != 1)
+      IndicatorsCrs->NumAssignments = 0;
+
+   /***** Get number of threads and posts in course forum (row[9], row[10]) *****/
+   if (sscanf (row[9],"%u",&IndicatorsCrs->NumThreads) != 1)
+      IndicatorsCrs->NumThreads = 0;
+   if (sscanf (row[10],"%u",&IndicatorsCrs->NumPosts) != 1)
+      IndicatorsCrs->NumPosts = 0;
+
+   /***** Get number of messages sent by teachers (row[11]) *****/
+   if (sscanf (row[11],"%u",&IndicatorsCrs->NumMsgsSentByTchs) != 1)
+      IndicatorsCrs->NumMsgsSentByTchs = 0;
+
+   /***** Set indicators from counters *****/
+   Ind_SetIndicatorsCrs (IndicatorsCrs);
+
+   return true;
+  }
+
+/*****************************************************************************/
+/*************** Get stored indicators of a course from database *************/
 /*****************************************************************************/
-// This function returns -1 if number of indicators is not yet calculated
+// Return false if indicators are not stored
 
-int Ind_GetNumIndicatorsCrsFromDB (long CrsCod)
+static bool Ind_GetIndicatorsCrsFromDB (long CrsCod,struct Ind_IndicatorsCrs *IndicatorsCrs)
   {
    MYSQL_RES *mysql_res;
    MYSQL_ROW row;
-   int NumIndicatorsFromDB = -1;	// -1 means not yet calculated
+   bool IndicatorsAreStored = false;
 
-   /***** Get number of indicators of a course from database *****/
-   if (DB_QuerySELECT (&mysql_res,"can not get number of indicators",
-	               "SELECT NumIndicators FROM courses"
-	               " WHERE CrsCod=%ld",
+   /***** Get stored indicators of a course from database *****/
+   if (DB_QuerySELECT (&mysql_res,"can not get indicators of a course",
+		       "SELECT " Ind_FIELDS_CRS_INDICATORS
+		       " FROM crs_indicators"
+		       " WHERE CrsCod=%ld",
 		       CrsCod))
      {
-      /***** Get row *****/
       row = mysql_fetch_row (mysql_res);
-
-      /***** Get number of indicators (row[0]) *****/
-      if (sscanf (row[0],"%d",&NumIndicatorsFromDB) != 1)
-	 Lay_ShowErrorAndExit ("Error when getting number of indicators.");
+      IndicatorsAreStored = Ind_GetIndicatorsCrsFromRow (row,IndicatorsCrs);
      }
 
    /***** Free structure that stores the query result *****/
    DB_FreeMySQLResult (&mysql_res);
 
-   return NumIndicatorsFromDB;
+   return IndicatorsAreStored;
+  }
+
+/*****************************************************************************/
+/*************** Update stored indicators of a course when *******************/
+/*************** a counter of the course may have changed  *******************/
+/*****************************************************************************/
+// Only the counter affected is recomputed.
+// If indicators are not yet stored, nothing is done,
+// because they will be computed from scratch when needed.
+
+void Ind_UpdateIndicatorsCrs (long CrsCod,Ind_Counter_t Counter)
+  {
+   struct Ind_IndicatorsCrs IndicatorsCrs;
+
+   if (CrsCod > 0)
+      if (Ind_GetIndicatorsCrsFromDB (CrsCod,&IndicatorsCrs))
+	{
+	 Ind_ComputeCounterCrs (CrsCod,Counter,&IndicatorsCrs);
+	 Ind_SetIndicatorsCrs (&IndicatorsCrs);
+	 Ind_StoreIndicatorsCrsIntoDB (CrsCod,&IndicatorsCrs);
+	}
+  }
+
+/*****************************************************************************/
+/****************** Remove stored indicators of a course *********************/
+/*****************************************************************************/
+
+void Ind_RemoveIndicatorsCrs (long CrsCod)
+  {
+   /***** Remove stored indicators of a course *****/
+   DB_QueryDELETE ("can not remove indicators of a course",
+		   "DELETE FROM crs_indicators WHERE CrsCod=%ld",
+		   CrsCod);
   }
 
 /*****************************************************************************/
-/************ Store number of indicators of a course in database *************/
+/*************** Compute indicators of a course from scratch *****************/
 /*****************************************************************************/
 
-static void Ind_StoreIndicatorsCrsIntoDB (long CrsCod,unsigned NumIndicators)
+static void Ind_ComputeIndicatorsCrs (long CrsCod,struct Ind_IndicatorsCrs *IndicatorsCrs)
   {
-   /***** Store number of indicators of a course in database *****/
-   DB_QueryUPDATE ("can not store number of indicators of a course",
-		   "UPDATE courses SET NumIndicators=%u WHERE CrsCod=%ld",
-                   NumIndicators,CrsCod);
+   Ind_Counter_t Counter;
+
+   /***** Compute all the counters *****/
+   for (Counter  = (Ind_Counter_t) 0;
+	Counter <= (Ind_Counter_t) (Ind_NUM_COUNTERS - 1);
+	Counter++)
+      Ind_ComputeCounterCrs (CrsCod,Counter,IndicatorsCrs);
+
+   /***** Set indicators from counters *****/
+   Ind_SetIndicatorsCrs (IndicatorsCrs);
   }
 
 /*****************************************************************************/
-/********************* Compute indicators of a course ************************/
+/****************** Compute one of the counters of a course ******************/
 /*****************************************************************************/
-/* NumIndicatorsFromDB (number of indicators stored in database)
-   must be retrieved before calling this function.
-   If NumIndicatorsFromDB is different from number of indicators just computed
-   ==> update it into database */
 
-void Ind_ComputeAndStoreIndicatorsCrs (long CrsCod,int NumIndicatorsFromDB,
-                                       struct Ind_IndicatorsCrs *IndicatorsCrs)
+static void Ind_ComputeCounterCrs (long CrsCod,Ind_Counter_t Counter,
+                                   struct Ind_IndicatorsCrs *IndicatorsCrs)
   {
-   /***** Initialize number of indicators *****/
-   IndicatorsCrs->NumIndicators = 0;
+   unsigned NumUsrsToBeNotifiedByEMail;
+
+   switch (Counter)
+     {
+      case Ind_COUNTER_FILES_DOCUM:
+	 IndicatorsCrs->NumFilesInDocumentZones = Ind_GetNumFilesInDocumZonesOfCrsFromDB (CrsCod);
+	 break;
+      case Ind_COUNTER_FILES_SHARE:
+	 IndicatorsCrs->NumFilesInSharedZones   = Ind_GetNumFilesInShareZonesOfCrsFromDB (CrsCod);
+	 break;
+      case Ind_COUNTER_FILES_ASSIG:
+	 IndicatorsCrs->NumFilesAssignments     = Ind_GetNumFilesInAssigZonesOfCrsFromDB (CrsCod);
+	 break;
+      case Ind_COUNTER_FILES_WORKS:
+	 IndicatorsCrs->NumFilesWorks           = Ind_GetNumFilesInWorksZonesOfCrsFromDB (CrsCod);
+	 break;
+      case Ind_COUNTER_INFO_SRCS:
+	 IndicatorsCrs->SyllabusLecSrc   = Inf_GetInfoSrcFromDB (CrsCod,Inf_LECTURES);
+	 IndicatorsCrs->SyllabusPraSrc   = Inf_GetInfoSrcFromDB (CrsCod,Inf_PRACTICALS);
+	 IndicatorsCrs->TeachingGuideSrc = Inf_GetInfoSrcFromDB (CrsCod,Inf_TEACHING_GUIDE);
+	 IndicatorsCrs->AssessmentSrc    = Inf_GetInfoSrcFromDB (CrsCod,Inf_ASSESSMENT);
+	 break;
+      case Ind_COUNTER_ASSIGNMENTS:
+	 IndicatorsCrs->NumAssignments = Asg_GetNumAssignmentsInCrs (CrsCod);
+	 break;
+      case Ind_COUNTER_FORUM:
+	 IndicatorsCrs->NumThreads = For_GetNumTotalThrsInForumsOfType (For_FORUM_COURSE_USRS,-1L,-1L,-1L,-1L,CrsCod);
+	 IndicatorsCrs->NumPosts   = For_GetNumTotalPstsInForumsOfType (For_FORUM_COURSE_USRS,-1L,-1L,-1L,-1L,CrsCod,&NumUsrsToBeNotifiedByEMail);
+	 break;
+      case Ind_COUNTER_MESSAGES:
+	 IndicatorsCrs->NumMsgsSentByTchs = Msg_GetNumMsgsSentByTchsCrs (CrsCod);
+	 break;
+     }
+  }
 
-   /***** Get whether download zones are empty or not *****/
-   IndicatorsCrs->NumFilesInDocumentZones = Ind_GetNumFilesInDocumZonesOfCrsFromDB (CrsCod);
-   IndicatorsCrs->NumFilesInSharedZones   = Ind_GetNumFilesInShareZonesOfCrsFromDB (CrsCod);
+/*****************************************************************************/
+/*************** Set indicators of a course from its counters ****************/
+/*****************************************************************************/
 
+static void Ind_SetIndicatorsCrs (struct Ind_IndicatorsCrs *IndicatorsCrs)
+  {
    /***** Indicator #1: information about syllabus *****/
-   IndicatorsCrs->SyllabusLecSrc   = Inf_GetInfoSrcFromDB (CrsCod,Inf_LECTURES);
-   IndicatorsCrs->SyllabusPraSrc   = Inf_GetInfoSrcFromDB (CrsCod,Inf_PRACTICALS);
-   IndicatorsCrs->TeachingGuideSrc = Inf_GetInfoSrcFromDB (CrsCod,Inf_TEACHING_GUIDE);
    IndicatorsCrs->ThereIsSyllabus = (IndicatorsCrs->SyllabusLecSrc   != Inf_INFO_SRC_NONE) ||
                                     (IndicatorsCrs->SyllabusPraSrc   != Inf_INFO_SRC_NONE) ||
                                     (IndicatorsCrs->TeachingGuideSrc != Inf_INFO_SRC_NONE);
-   if (IndicatorsCrs->ThereIsSyllabus)
-      IndicatorsCrs->NumIndicators++;
 
    /***** Indicator #2: information about assignments *****/
-   IndicatorsCrs->NumAssignments = Asg_GetNumAssignmentsInCrs (CrsCod);
-   IndicatorsCrs->NumFilesAssignments = Ind_GetNumFilesInAssigZonesOfCrsFromDB (CrsCod);
-   IndicatorsCrs->NumFilesWorks       = Ind_GetNumFilesInWorksZonesOfCrsFromDB (CrsCod);
    IndicatorsCrs->ThereAreAssignments = (IndicatorsCrs->NumAssignments      != 0) ||
                                         (IndicatorsCrs->NumFilesAssignments != 0) ||
                                         (IndicatorsCrs->NumFilesWorks       != 0);
-   if (IndicatorsCrs->ThereAreAssignments)
-      IndicatorsCrs->NumIndicators++;
 
    /***** Indicator #3: information about online tutoring *****/
-   IndicatorsCrs->NumThreads = For_GetNumTotalThrsInForumsOfType (For_FORUM_COURSE_USRS,-1L,-1L,-1L,-1L,CrsCod);
-   IndicatorsCrs->NumPosts   = For_GetNumTotalPstsInForumsOfType (For_FORUM_COURSE_USRS,-1L,-1L,-1L,-1L,CrsCod,&(IndicatorsCrs->NumUsrsToBeNotifiedByEMail));
-   IndicatorsCrs->NumMsgsSentByTchs = Msg_GetNumMsgsSentByTchsCrs (CrsCod);
    IndicatorsCrs->ThereIsOnlineTutoring = (IndicatorsCrs->NumThreads        != 0) ||
 	                                  (IndicatorsCrs->NumPosts          != 0) ||
 	                                  (IndicatorsCrs->NumMsgsSentByTchs != 0);
-   if (IndicatorsCrs->ThereIsOnlineTutoring)
-      IndicatorsCrs->NumIndicators++;
 
    /***** Indicator #4: information about materials *****/
    IndicatorsCrs->ThereAreMaterials = (IndicatorsCrs->NumFilesInDocumentZones != 0) ||
                                       (IndicatorsCrs->NumFilesInSharedZones   != 0);
-   if (IndicatorsCrs->ThereAreMaterials)
-      IndicatorsCrs->NumIndicators++;
 
    /***** Indicator #5: information about assessment *****/
-   IndicatorsCrs->AssessmentSrc = Inf_GetInfoSrcFromDB (CrsCod,Inf_ASSESSMENT);
    IndicatorsCrs->ThereIsAssessment = (IndicatorsCrs->AssessmentSrc    != Inf_INFO_SRC_NONE) ||
                                       (IndicatorsCrs->TeachingGuideSrc != Inf_INFO_SRC_NONE);
-   if (IndicatorsCrs->ThereIsAssessment)
-      IndicatorsCrs->NumIndicators++;
+
+   /***** Bitmask and number of indicators *****/
+   IndicatorsCrs->Indicators = (IndicatorsCrs->ThereIsSyllabus       ? (1 << 0) : 0) |
+			       (IndicatorsCrs->ThereAreAssignments   ? (1 << 1) : 0) |
+			       (IndicatorsCrs->ThereIsOnlineTutoring ? (1 << 2) : 0) |
+			       (IndicatorsCrs->ThereAreMaterials     ? (1 << 3) : 0) |
+			       (IndicatorsCrs->ThereIsAssessment     ? (1 << 4) : 0);
+   IndicatorsCrs->NumIndicators = (IndicatorsCrs->ThereIsSyllabus       ? 1 : 0) +
+				  (IndicatorsCrs->ThereAreAssignments   ? 1 : 0) +
+				  (IndicatorsCrs->ThereIsOnlineTutoring ? 1 : 0) +
+				  (IndicatorsCrs->ThereAreMaterials     ? 1 : 0) +
+				  (IndicatorsCrs->ThereIsAssessment     ? 1 : 0);
 
    /***** All the indicators are OK? *****/
    IndicatorsCrs->CoursePartiallyOK = IndicatorsCrs->NumIndicators >= 1 &&
 	                              IndicatorsCrs->NumIndicators < Ind_NUM_INDICATORS;
    IndicatorsCrs->CourseAllOK       = IndicatorsCrs->NumIndicators == Ind_NUM_INDICATORS;
+  }
+
+/*****************************************************************************/
+/******************* Check if two sets of counters are equal *****************/
+/*****************************************************************************/
+
+static bool Ind_CheckIfCountersAreEqual (const struct Ind_IndicatorsCrs *IndicatorsCrs1,
+                                         const struct Ind_IndicatorsCrs *IndicatorsCrs2)
+  {
+   return IndicatorsCrs1->NumFilesInDocumentZones == IndicatorsCrs2->NumFilesInDocumentZones &&
+	  IndicatorsCrs1->NumFilesInSharedZones   == IndicatorsCrs2->NumFilesInSharedZones   &&
+	  IndicatorsCrs1->NumFilesAssignments     == IndicatorsCrs2->NumFilesAssignments     &&
+	  IndicatorsCrs1->NumFilesWorks           == IndicatorsCrs2->NumFilesWorks           &&
+	  IndicatorsCrs1->SyllabusLecSrc          == IndicatorsCrs2->SyllabusLecSrc          &&
+	  IndicatorsCrs1->SyllabusPraSrc          == IndicatorsCrs2->SyllabusPraSrc          &&
+	  IndicatorsCrs1->TeachingGuideSrc        == IndicatorsCrs2->TeachingGuideSrc        &&
+	  IndicatorsCrs1->AssessmentSrc           == IndicatorsCrs2->AssessmentSrc           &&
+	  IndicatorsCrs1->NumAssignments          == IndicatorsCrs2->NumAssignments          &&
+	  IndicatorsCrs1->NumThreads              == IndicatorsCrs2->NumThreads              &&
+	  IndicatorsCrs1->NumPosts                == IndicatorsCrs2->NumPosts                &&
+	  IndicatorsCrs1->NumMsgsSentByTchs       == IndicatorsCrs2->NumMsgsSentByTchs;
+  }
 
-   /***** Update number of indicators into database
-          if different to the stored one *****/
-   if (NumIndicatorsFromDB != (int) IndicatorsCrs->NumIndicators)
-      Ind_StoreIndicatorsCrsIntoDB (CrsCod,IndicatorsCrs->NumIndicators);
+/*****************************************************************************/
+/****************** Store indicators of a course in database *****************/
+/*****************************************************************************/
+
+static void Ind_StoreIndicatorsCrsIntoDB (long CrsCod,
+                                          const struct Ind_IndicatorsCrs *IndicatorsCrs)
+  {
+   /***** Store indicators of a course in database *****/
+   DB_QueryREPLACE ("can not store indicators of a course",
+		    "REPLACE INTO crs_indicators"
+		    " (CrsCod,Indicators,NumIndicators,"
+		    "NumFilesDocum,NumFilesShare,NumFilesAssig,NumFilesWorks,"
+		    "SyllabusLecSrc,SyllabusPraSrc,TeachingGuideSrc,AssessmentSrc,"
+		    "NumAssignments,NumThreads,NumPosts,NumMsgsSentByTchs)"
+		    " VALUES"
+		    " (%ld,%u,%u,"
+		    "%lu,%lu,%lu,%lu,"
+		    "%u,%u,%u,%u,"
+		    "%u,%u,%u,%u)",
+		    CrsCod,IndicatorsCrs->Indicators,IndicatorsCrs->NumIndicators,
+		    IndicatorsCrs->NumFilesInDocumentZones,
+		    IndicatorsCrs->NumFilesInSharedZones,
+		    IndicatorsCrs->NumFilesAssignments,
+		    IndicatorsCrs->NumFilesWorks,
+		    (unsigned) IndicatorsCrs->SyllabusLecSrc,
+		    (unsigned) IndicatorsCrs->SyllabusPraSrc,
+		    (unsigned) IndicatorsCrs->TeachingGuideSrc,
+		    (unsigned) IndicatorsCrs->AssessmentSrc,
+		    IndicatorsCrs->NumAssignments,
+		    IndicatorsCrs->NumThreads,
+		    IndicatorsCrs->NumPosts,
+		    IndicatorsCrs->NumMsgsSentByTchs);
   }
 
 /*****************************************************************************/
@@ -34,6 +34,20 @@
 #define Ind_NUM_INDICATORS 5
 #define Ind_MAX_SIZE_INDICATORS_SELECTED ((1 + Ind_NUM_INDICATORS) * (10 + 1))
 
+// Counters stored for each course, used to compute its indicators
+#define Ind_NUM_COUNTERS 8
+typedef enum
+  {
+   Ind_COUNTER_FILES_DOCUM	= 0,	// Files in documents zones
+   Ind_COUNTER_FILES_SHARE	= 1,	// Files in shared zones
+   Ind_COUNTER_FILES_ASSIG	= 2,	// Files in assignments zones
+   Ind_COUNTER_FILES_WORKS	= 3,	// Files in works zones
+   Ind_COUNTER_INFO_SRCS	= 4,	// Sources of syllabus, guide and assessment
+   Ind_COUNTER_ASSIGNMENTS	= 5,	// Assignments
+   Ind_COUNTER_FORUM		= 6,	// Threads and posts in course forum
+   Ind_COUNTER_MESSAGES		= 7,	// Messages sent by teachers
+  } Ind_Counter_t;
+
 struct Ind_IndicatorsCrs
   {
    unsigned long NumFilesInDocumentZones;
@@ -49,11 +63,11 @@ struct Ind_IndicatorsCrs
    bool ThereIsOnlineTutoring;
    unsigned NumThreads;
    unsigned NumPosts;
-   unsigned NumUsrsToBeNotifiedByEMail;
    unsigned NumMsgsSentByTchs;
    bool ThereAreMaterials;
    bool ThereIsAssessment;
    Inf_InfoSrc_t AssessmentSrc;
+   unsigned Indicators;		// Bit i is set if indicator i+1 is yes
    unsigned NumIndicators;
    bool CoursePartiallyOK;
    bool CourseAllOK;
@@ -65,6 +79,7 @@ struct Ind_Indicators
    long DptCod;
    char StrIndicatorsSelected[Ind_MAX_SIZE_INDICATORS_SELECTED + 1];
    bool IndicatorsSelected[1 + Ind_NUM_INDICATORS];
+   bool Verify;		// Recompute stored indicators from scratch?
   };
 
 /*****************************************************************************/
@@ -73,8 +88,8 @@ struct Ind_Indicators
 
 void Ind_ReqIndicatorsCourses (void);
 void Ind_ShowIndicatorsCourses (void);
-int Ind_GetNumIndicatorsCrsFromDB (long CrsCod);
-void Ind_ComputeAndStoreIndicatorsCrs (long CrsCod,int NumIndicatorsFromDB,
-                                       struct Ind_IndicatorsCrs *IndicatorsCrs);
+void Ind_GetIndicatorsCrs (long CrsCod,struct Ind_IndicatorsCrs *IndicatorsCrs);
+void Ind_UpdateIndicatorsCrs (long CrsCod,Ind_Counter_t Counter);
+void Ind_RemoveIndicatorsCrs (long CrsCod);
 
 #endif
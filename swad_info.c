@@ -32,14 +32,18 @@
 #include <stdsoap2.h>		// For SOAP_OK and soap functions
 #include <string.h>		// For string functions
 #include <unistd.h>		// For unlink
+#include <utime.h>		// For utime
 
 #include "swad_action.h"
 #include "swad_box.h"
+#include "swad_cryptography.h"
 #include "swad_database.h"
 #include "swad_form.h"
 #include "swad_global.h"
 #include "swad_HTML.h"
+#include "swad_indicator.h"
 #include "swad_info.h"
+#include "swad_markdown.h"
 #include "swad_parameter.h"
 #include "swad_string.h"
 
@@ -299,6 +303,7 @@ static bool Inf_CheckAndShowPlainTxt (void);
 
 static bool Inf_CheckRichTxt (long CrsCod,Inf_InfoType_t InfoType);
 static bool Inf_CheckAndShowRichTxt (void);
+static void Inf_WriteHTMLFromMarkdown (const char *TxtMD);
 
 /*****************************************************************************/
 /******** Show course info (theory, practices, bibliography, etc.) ***********/
@@ -1438,6 +1443,9 @@ void Inf_SetInfoSrcIntoDB (Inf_InfoSrc_t InfoSrc)
 		      Gbl.Hierarchy.Crs.CrsCod,
 		      Inf_NamesInDBForInfoType[Gbl.Crs.Info.Type],
 		      Inf_NamesInDBForInfoSrc[InfoSrc]);
+
+   /***** Update stored indicators of the course *****/
+   Ind_UpdateIndicatorsCrs (Gbl.Hierarchy.Crs.CrsCod,Ind_COUNTER_INFO_SRCS);
   }
 
 
@@ -1785,13 +1793,6 @@ static bool Inf_CheckAndShowRichTxt (void)
    extern const char *Txt_INFO_TITLE[Inf_NUM_INFO_TYPES];
    char TxtHTML[Cns_MAX_BYTES_LONG_TEXT + 1];
    char TxtMD[Cns_MAX_BYTES_LONG_TEXT + 1];
-   char PathFileMD[PATH_MAX + 1];
-   char PathFileHTML[PATH_MAX + 1];
-   FILE *FileMD;		// Temporary Markdown file
-   FILE *FileHTML;		// Temporary HTML file
-   char MathJaxURL[PATH_MAX + 1];
-   char Command[512 + PATH_MAX * 3]; // Command to call the program of preprocessing of photos
-   int ReturnCode;
    bool ICanEdit = (Gbl.Usrs.Me.Role.Logged == Rol_TCH ||
                     Gbl.Usrs.Me.Role.Logged == Rol_SYS_ADM);
    const char *Help[Inf_NUM_INFO_TYPES] =
@@ -1828,75 +1829,8 @@ static bool Inf_CheckAndShowRichTxt (void)
 
       HTM_DIV_Begin ("id=\"crs_info\" class=\"LM\"");
 
-      /***** Store text into a temporary .md file in HTML output directory *****/
-      // TODO: change to another directory?
-      /* Create a unique name for the .md file */
-      snprintf (PathFileMD,sizeof (PathFileMD),"%s/%s.md",
-	        Cfg_PATH_OUT_PRIVATE,Gbl.UniqueNameEncrypted);
-      snprintf (PathFileHTML,sizeof (PathFileHTML),"%s/%s.md.html",	// Do not use only .html because that is the output temporary file
-	        Cfg_PATH_OUT_PRIVATE,Gbl.UniqueNameEncrypted);
-
-      /* Open Markdown file for writing */
-      if ((FileMD = fopen (PathFileMD,"wb")) == NULL)
-	 Lay_ShowErrorAndExit ("Can not create temporary Markdown file.");
-
-      /* Write text into Markdown file */
-      fprintf (FileMD,"%s",TxtMD);
-
-      /* Close Markdown file */
-      fclose (FileMD);
-
       /***** Convert from Markdown to HTML *****/
-      /* MathJax 2.5.1
-#ifdef Cfg_MATHJAX_LOCAL
-      // Use the local copy of MathJax
-      snprintf (MathJaxURL,sizeof (MathJaxURL),
-	        "=%s/MathJax/MathJax.js?config=TeX-AMS-MML_HTMLorMML",
-	        Cfg_URL_SWAD_PUBLIC);
-#else
-      // Use the MathJax Content Delivery Network (CDN)
-      MathJaxURL[0] = '\0';
-#endif
-      */
-      /* MathJax 3.0.1 */
-#ifdef Cfg_MATHJAX_LOCAL
-      // Use the local copy of MathJax
-      snprintf (MathJaxURL,sizeof (MathJaxURL),"=%s/mathjax/tex-chtml.js",
-	        Cfg_URL_SWAD_PUBLIC);
-#else
-      // Use the MathJax Content Delivery Network (CDN)
-      MathJaxURL[0] = '\0';
-#endif
-      // --ascii uses only ascii characters in output
-      //         (uses numerical entities instead of UTF-8)
-      //         is mandatory in order to convert (with iconv) the UTF-8 output of pandoc to WINDOWS-1252
-      snprintf (Command,sizeof (Command),
-	        "iconv -f WINDOWS-1252 -t UTF-8 %s"
-	        " | "
-	        "pandoc --ascii --mathjax%s -f markdown_github+tex_math_dollars -t html5"
-	        " | "
-	        "iconv -f UTF-8 -t WINDOWS-1252 -o %s",
-	        PathFileMD,
-	        MathJaxURL,
-	        PathFileHTML);
-      ReturnCode = system (Command);
-      if (ReturnCode == -1)
-	 Lay_ShowErrorAndExit ("Error when running command to convert from Markdown to HTML.");
-
-      /***** Remove Markdown file *****/
-      unlink (PathFileMD);
-
-      /***** Copy HTML file just created to HTML output *****/
-      /* Open temporary HTML file for reading */
-      if ((FileHTML = fopen (PathFileHTML,"rb")) == NULL)
-	 Lay_ShowErrorAndExit ("Can not open temporary HTML file.");
-
-      /* Copy from temporary HTML file to output file */
-      Fil_FastCopyOfOpenFiles (FileHTML,Gbl.F.Out);
-
-      /* Close and remove temporary HTML file */
-      fclose (FileHTML);
-      unlink (PathFileHTML);
+      Inf_WriteHTMLFromMarkdown (TxtMD);
 
       /***** End box *****/
       HTM_DIV_End ();
@@ -1908,6 +1842,52 @@ static bool Inf_CheckAndShowRichTxt (void)
    return false;
   }
 
+/*****************************************************************************/
+/*************** Write HTML converted from Markdown into output **************/
+/*****************************************************************************/
+// The HTML is cached in a file named with a hash of the Markdown text,
+// so a text is converted only the first time it is viewed after a change
+
+static void Inf_WriteHTMLFromMarkdown (const char *TxtMD)
+  {
+   char HashMD[Cry_BYTES_ENCRYPTED_STR_SHA256_BASE64 + 1];
+   char PathFileHTML[PATH_MAX + 1];
+   char PathFileTmp[PATH_MAX + 1];
+   FILE *FileHTML;
+
+   /***** Build path to HTML file from hash of Markdown text
+          and version of converter *****/
+   Cry_EncryptSHA256Base64 (TxtMD,HashMD);
+   snprintf (PathFileHTML,sizeof (PathFileHTML),"%s/%u_%s.html",
+	     Cfg_PATH_MARKDOWN_PRIVATE,(unsigned) Mkd_VERSION,HashMD);
+
+   if ((FileHTML = fopen (PathFileHTML,"rb")))
+      /***** HTML already converted. Update its time
+             so it is not removed while it is being viewed *****/
+      utime (PathFileHTML,NULL);
+   else
+     {
+      /***** Convert from Markdown to a temporary HTML file *****/
+      Fil_CreateDirIfNotExists (Cfg_PATH_MARKDOWN_PRIVATE);
+      snprintf (PathFileTmp,sizeof (PathFileTmp),"%s/%s.tmp",
+	        Cfg_PATH_MARKDOWN_PRIVATE,Gbl.UniqueNameEncrypted);
+      if ((FileHTML = fopen (PathFileTmp,"w+b")) == NULL)
+	 Lay_ShowErrorAndExit ("Can not create temporary HTML file.");
+      Mkd_WriteHTMLFromMarkdown (TxtMD,FileHTML,Lay_NotEnoughMemoryExit);
+      fflush (FileHTML);
+
+      /***** Rename is atomic, so a concurrent view
+             never reads a partially written file *****/
+      if (rename (PathFileTmp,PathFileHTML))
+	 Lay_ShowErrorAndExit ("Can not rename temporary HTML file.");
+      rewind (FileHTML);
+     }
+
+   /***** Copy HTML file to output *****/
+   Fil_FastCopyOfOpenFiles (FileHTML,Gbl.F.Out);
+   fclose (FileHTML);
+  }
+
 /*****************************************************************************/
 /************** Edit plain text information about the course *****************/
 /*****************************************************************************/
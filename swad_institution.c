@@ -81,8 +81,6 @@ static void Ins_EditInstitutionsInternal (void);
 static void Ins_PutIconsEditingInstitutions (__attribute__((unused)) void *Args);
 static void Ins_PutIconToViewInstitutions (void);
 
-static void Ins_GetDataOfInstitFromRow (struct Ins_Instit *Ins,MYSQL_ROW row);
-
 static void Ins_GetShrtNameAndCtyOfInstitution (struct Ins_Instit *Ins,
                                                 char CtyName[Cns_HIERARCHY_MAX_BYTES_FULL_NAME + 1]);
 
@@ -832,7 +830,7 @@ bool Ins_GetDataOfInstitutionByCod (struct Ins_Instit *Ins)
 /********** Get data of a centre from a row resulting of a query *************/
 /*****************************************************************************/
 
-static void Ins_GetDataOfInstitFromRow (struct Ins_Instit *Ins,MYSQL_ROW row)
+void Ins_GetDataOfInstitFromRow (struct Ins_Instit *Ins,MYSQL_ROW row)
   {
    /***** Get institution code (row[0]) *****/
    if ((Ins->InsCod = Str_ConvertStrCodToLongCod (row[0])) < 0)
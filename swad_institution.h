@@ -104,6 +104,7 @@ void Ins_GetFullListOfInstitutions (long CtyCod);
 
 void Ins_WriteInstitutionNameAndCty (long InsCod);
 bool Ins_GetDataOfInstitutionByCod (struct Ins_Instit *Ins);
+void Ins_GetDataOfInstitFromRow (struct Ins_Instit *Ins,MYSQL_ROW row);
 void Ins_FlushCacheShortNameOfInstitution (void);
 void Ins_GetShortNameOfInstitution (struct Ins_Instit *Ins);
 void Ins_FlushCacheFullNameAndCtyOfInstitution (void);
@@ -25,7 +25,14 @@
 /********************************** Headers **********************************/
 /*****************************************************************************/
 
+#include <libgen.h>		// For basename, dirname
+#include <linux/limits.h>	// For PATH_MAX
+#include <stdio.h>		// For fprintf, snprintf
+#include <string.h>		// For strcmp, strncmp
+#include <unistd.h>		// For readlink
+
 #include "swad_box.h"
+#include "swad_config.h"
 #include "swad_database.h"
 #include "swad_figure.h"
 #include "swad_form.h"
@@ -33,6 +40,8 @@
 #include "swad_HTML.h"
 #include "swad_language.h"
 #include "swad_setting.h"
+#include "swad_string.h"
+#include "swad_text_catalog.h"
 
 /*****************************************************************************/
 /*************** External global variables from others modules ***************/
@@ -214,7 +223,7 @@ void Lan_UpdateMyLanguageToCurrentLanguage (void)
 
 Lan_Language_t Lan_GetParamLanguage (void)
   {
-   extern const unsigned Txt_Current_CGI_SWAD_Language;
+   extern unsigned Txt_Current_CGI_SWAD_Language;
 
    return (Lan_Language_t)
 	  Par_GetParToUnsignedLong ("Lan",
@@ -222,3 +231,60 @@ Lan_Language_t Lan_GetParamLanguage (void)
                                     Lan_NUM_LANGUAGES,
                                     (unsigned long) Txt_Current_CGI_SWAD_Language);
   }
+
+/*****************************************************************************/
+/************ Set language of this CGI from the name of program **************/
+/*****************************************************************************/
+// The same program is installed as swad_ca, swad_de, swad_en...
+// (usually symbolic links to swad).
+// The texts of the language built in the program are used directly.
+// The texts of other languages are loaded from a catalog file
+// in the directory of the program, which is mapped in memory.
+// Return false if the catalog of the language can not be loaded
+
+bool Lan_SetCGILanguageFromProgramName (char *ProgramName)
+  {
+   extern unsigned Txt_Current_CGI_SWAD_Language;
+   const char *Name;
+   Lan_Language_t Lan;
+   char PathProgram[PATH_MAX + 1];
+   ssize_t Length;
+   char FileName[PATH_MAX + 1];
+
+   /***** Get language from program name (swad_xx) *****/
+   if (!ProgramName)
+      return true;
+   Name = basename (ProgramName);
+   if (strncmp (Name,"swad_",5))
+      return true;
+   Name += 5;
+
+   for (Lan  = (Lan_Language_t) 1;
+	Lan <= (Lan_Language_t) Lan_NUM_LANGUAGES;
+	Lan++)
+      if (!strcmp (Name,Lan_STR_LANG_ID[Lan]))
+	{
+	 if ((unsigned) Lan != Txt_Current_CGI_SWAD_Language)
+	   {
+	    /***** Get directory of the program,
+	           independent of the working directory *****/
+	    if ((Length = readlink ("/proc/self/exe",PathProgram,PATH_MAX)) > 0)
+	       PathProgram[Length] = '\0';
+	    else
+	       Str_Copy (PathProgram,Cfg_PATH_CGI_BIN,PATH_MAX);
+
+	    /***** Load texts of this language *****/
+	    snprintf (FileName,sizeof (FileName),TxtCat_FILE_CATALOG,
+		      dirname (PathProgram),Lan_STR_LANG_ID[Lan]);
+	    if (!TxtCat_LoadCatalog (FileName))
+	      {
+	       fprintf (stderr,"swad: can not load texts from %s\n",FileName);
+	       return false;
+	      }
+	    Txt_Current_CGI_SWAD_Language = (unsigned) Lan;
+	   }
+	 return true;
+	}
+
+   return true;
+  }
@@ -66,4 +66,6 @@ void Lan_UpdateMyLanguageToCurrentLanguage (void);
 
 Lan_Language_t Lan_GetParamLanguage (void);
 
+bool Lan_SetCGILanguageFromProgramName (char *ProgramName);
+
 #endif
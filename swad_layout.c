@@ -58,6 +58,7 @@
 #include "swad_notice.h"
 #include "swad_notification.h"
 #include "swad_parameter.h"
+#include "swad_RSS.h"
 #include "swad_setting.h"
 #include "swad_tab.h"
 #include "swad_theme.h"
@@ -119,7 +120,7 @@ static void Lay_HelpTextEditor (const char *Text,const char *InlineMath,const ch
 void Lay_WriteStartOfPage (void)
   {
    extern const char *Lan_STR_LANG_ID[1 + Lan_NUM_LANGUAGES];
-   extern const unsigned Txt_Current_CGI_SWAD_Language;
+   extern unsigned Txt_Current_CGI_SWAD_Language;
    extern const char *The_TabOnBgColors[The_NUM_THEMES];
    static const char *LayoutMainZone[Mnu_NUM_MENUS] =
      {
@@ -1621,6 +1622,8 @@ void Lay_RefreshNotifsAndConnected (void)
    // We use (PID % prime-number) to do only one action as much
    if      (!(Gbl.PID %  11))
       Ntf_SendPendingNotifByEMailToAllUsrs ();	// Send pending notifications by email
+   else if (!(Gbl.PID %  13))
+      RSS_UpdateChangedRSSFiles ();		// Update RSS files of courses with new or changed items
    else if (!(Gbl.PID %  19))
       FW_PurgeFirewall ();			// Remove old clicks from firewall
    else if (!(Gbl.PID %  23))
@@ -1645,6 +1648,12 @@ void Lay_RefreshNotifsAndConnected (void)
       Fil_RemoveOldTmpFiles (Cfg_PATH_MARK_PRIVATE		,Cfg_TIME_TO_DELETE_MARKS_TMP_FILES	,false);
    else if (!(Gbl.PID % 149))
       Fil_RemoveOldTmpFiles (Cfg_PATH_TEST_PRIVATE		,Cfg_TIME_TO_DELETE_TEST_TMP_FILES	,false);
+   else if (!(Gbl.PID % 151))
+      Fil_RemoveOldTmpFiles (Cfg_PATH_MARKDOWN_PRIVATE		,Cfg_TIME_TO_DELETE_MARKDOWN_CACHE	,false);
+   else if (!(Gbl.PID % 157))
+      Fil_RemoveOldTmpFiles (Cfg_PATH_QR_PUBLIC			,Cfg_TIME_TO_DELETE_QR_CACHE		,false);
+   else if (!(Gbl.PID % 163))
+      DB_RemoveOldSlowQueries ();		// Remove old slow queries stored to analyze them
 
    /***** Send, before the HTML, the refresh time *****/
    HTM_TxtF ("%lu|",Gbl.Usrs.Connected.TimeToRefreshInMs);
@@ -38,6 +38,7 @@
 #include "swad_HTML.h"
 #include "swad_log.h"
 #include "swad_profile.h"
+#include "swad_report.h"
 #include "swad_role.h"
 #include "swad_statistic.h"
 
@@ -181,6 +182,11 @@ void Log_LogAccess (const char *Comments)
    /***** Increment my number of clicks *****/
    if (Gbl.Usrs.Me.Logged)
       Prf_IncrementNumClicksUsr (Gbl.Usrs.Me.UsrDat.UsrCod);
+
+   /***** Increment my hits per year, course, role and action *****/
+   if (Gbl.Usrs.Me.UsrDat.UsrCod > 0)
+      Rep_IncrementNumHitsUsr (Gbl.Usrs.Me.UsrDat.UsrCod,
+			       Gbl.Hierarchy.Crs.CrsCod,RoleToStore,ActCod);
   }
 
 /*****************************************************************************/
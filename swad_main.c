@@ -39,6 +39,7 @@
 #include "swad_global.h"
 #include "swad_hierarchy.h"
 #include "swad_hierarchy_level.h"
+#include "swad_language.h"
 #include "swad_MFU.h"
 #include "swad_notification.h"
 #include "swad_parameter.h"
@@ -71,10 +72,11 @@ extern struct Globals Gbl;
 /****************************** Main function ********************************/
 /*****************************************************************************/
 
-int main (void)
+int main (int argc,char *argv[])
   {
    void (*FunctionPriori) (void);
    void (*FunctionPosteriori) (void);
+   bool TextsLoaded;
 
    /*
     "touch swad.lock" in CGI directory if you want to disable SWAD
@@ -100,6 +102,10 @@ int main (void)
       exit (0);
      }
 
+   /***** Select language of texts from program name *****/
+   TextsLoaded = Lan_SetCGILanguageFromProgramName (argc > 0 ? argv[0] :
+							       NULL);
+
    /***** Initialize global variables *****/
    Gbl_InitializeGlobals ();
    Cfg_GetConfigFromFile ();
@@ -125,6 +131,11 @@ int main (void)
 	 /***** Create file for HTML output *****/
 	 Fil_CreateFileForHTMLOutput ();
 
+	 /***** Do not show pages in a language different
+	        from the one of the program name *****/
+	 if (!TextsLoaded)
+	    Lay_ShowErrorAndExit ("Can not load texts of the language.");
+
 	 /***** Remove old (expired) sessions *****/
 	 Ses_RemoveExpiredSessions ();
 
@@ -26,12 +26,15 @@
 /*****************************************************************************/
 
 #define _GNU_SOURCE 		// For asprintf
+#include <fcntl.h>		// For open
 #include <linux/limits.h>	// For PATH_MAX
 #include <malloc.h>		// For malloc
 #include <stddef.h>		// For NULL
 #include <stdio.h>		// For asprintf
+#include <stdlib.h>		// For realloc, free
 #include <string.h>		// For string functions
-#include <unistd.h>		// For unlink
+#include <sys/stat.h>		// For fstat
+#include <unistd.h>		// For unlink, pread
 
 #include "swad_database.h"
 #include "swad_form.h"
@@ -72,20 +75,41 @@ static const char *Mrk_HeadOrFootStr[2] =	// Names of columns in database, so do
 
 #define Mrk_MAX_BYTES_IN_CELL_CONTENT	1024	// Cell of a table containing one or several user's IDs
 
+#define Mrk_MAX_IDS_PER_INDEX_QUERY	256	// Number of user's IDs inserted in each multi-row query
+#define Mrk_MAX_BYTES_INDEX_ROW		(3 + ID_MAX_BYTES_USR_ID + 3 + 3 * Cns_MAX_DECIMAL_DIGITS_LONG + 3)	// ,(FilCod,'UsrID',RowStart,RowEnd)
+
+#define Mrk_SIZE_OF_COPY_BUFFER		(16 * 1024)
+
 /*****************************************************************************/
 /**************************** Private prototypes *****************************/
 /*****************************************************************************/
 
-static void Mrk_GetNumRowsHeaderAndFooter (struct MarksProperties *Marks);
+static void Mrk_GetPropertiesOfMarks (struct MarksProperties *Marks);
+static void Mrk_GetPropertiesFromRow (MYSQL_ROW row,struct MarksProperties *Marks);
 static void Mrk_ChangeNumRowsHeaderOrFooter (Brw_HeadOrFoot_t HeaderOrFooter);
+
+static void Mrk_ResetIndex (struct Mrk_Index *Index);
+static void Mrk_GetRowsOfTable (FILE *FileAllMarks,struct Mrk_Index *Index);
+static void Mrk_AddUsrIDsInCell (struct Mrk_Index *Index,unsigned *MaxUsrIDs,
+                                 unsigned NumRow,const char *CellContent);
+static void Mrk_SetHeadAndFoot (struct MarksProperties *Marks);
+static void Mrk_StoreIndexInDB (const struct MarksProperties *Marks);
+static bool Mrk_RebuildIndex (int FdAllMarks,struct MarksProperties *Marks);
+
 static bool Mrk_CheckIfCellContainsOnlyIDs (const char *CellContent);
 static bool Mrk_GetUsrMarks (FILE *FileUsrMarks,struct UsrData *UsrDat,
                              const char *PathFileAllMarks,
                              struct MarksProperties *Marks);
+static bool Mrk_GetRowOfUsr (const struct MarksProperties *Marks,
+                             const struct UsrData *UsrDat,
+                             long *RowStart,long *RowEnd);
+static bool Mrk_CopyBytesOfFile (int FdAllMarks,FILE *FileUsrMarks,
+                                 long Start,long End);
 
 /*****************************************************************************/
 /****************** Add a new entry of marks into database *******************/
 /*****************************************************************************/
+// Marks must have been filled by Mrk_CheckFileOfMarks
 
 void Mrk_AddMarksToDB (long FilCod,struct MarksProperties *Marks)
   {
@@ -100,6 +124,11 @@ void Mrk_AddMarksToDB (long FilCod,struct MarksProperties *Marks)
 	           FilCod,
 	           Marks->Header,
 	           Marks->Footer);
+
+   /***** Store index built when checking the file *****/
+   Marks->FilCod = FilCod;
+   Mrk_StoreIndexInDB (Marks);
+   Mrk_FreeIndex (Marks);
   }
 
 /*****************************************************************************/
@@ -119,7 +148,7 @@ void Mrk_GetAndWriteNumRowsHeaderAndFooter (void)
    else	// File or link
      {
       /***** Get number of rows in header or footer *****/
-      Mrk_GetNumRowsHeaderAndFooter (&Marks);
+      Mrk_GetPropertiesOfMarks (&Marks);
 
       /***** Write the number of rows of header *****/
       HTM_TD_Begin ("class=\"%s RT COLOR%u\"",
@@ -160,10 +189,11 @@ void Mrk_GetAndWriteNumRowsHeaderAndFooter (void)
   }
 
 /*****************************************************************************/
-/******** Get number of rows of header and of footer of a file of marks ******/
+/************* Get number of rows of header and of footer and ****************/
+/********************* index of the current file of marks ********************/
 /*****************************************************************************/
 
-static void Mrk_GetNumRowsHeaderAndFooter (struct MarksProperties *Marks)
+static void Mrk_GetPropertiesOfMarks (struct MarksProperties *Marks)
   {
    extern const Brw_FileBrowser_t Brw_FileBrowserForDB_files[Brw_NUM_TYPES_FILE_BROWSER];
    long Cod = Brw_GetCodForFiles ();
@@ -177,7 +207,13 @@ static void Mrk_GetNumRowsHeaderAndFooter (struct MarksProperties *Marks)
       get the number of rows of the more recent file. */
    NumRows = DB_QuerySELECT (&mysql_res,"can not get the number of rows"
 				        " in header and footer",
-			     "SELECT marks_properties.%s,marks_properties.%s"
+			     "SELECT marks_properties.FilCod,"		// row[0]
+				    "marks_properties.%s,"		// row[1]
+				    "marks_properties.%s,"		// row[2]
+				    "marks_properties.FileSize,"	// row[3]
+				    "marks_properties.FileTime,"	// row[4]
+				    "marks_properties.HeadEnd,"		// row[5]
+				    "marks_properties.FootStart"	// row[6]
 			     " FROM files,marks_properties"
 			     " WHERE files.FileBrowser=%u"
 			     " AND files.Cod=%ld"
@@ -193,25 +229,50 @@ static void Mrk_GetNumRowsHeaderAndFooter (struct MarksProperties *Marks)
    /***** The result of the query must have only one row *****/
    if (NumRows == 1)
      {
-      /***** Get number of header and footer rows *****/
+      /***** Get number of header and footer rows, and index *****/
       row = mysql_fetch_row (mysql_res);
-
-      /* Header (row[0]) */
-      if (sscanf (row[0],"%u",&(Marks->Header)) != 1)
-         Lay_ShowErrorAndExit ("Wrong number of header rows.");
-
-      /* Footer (row[1]) */
-      if (sscanf (row[1],"%u",&(Marks->Footer)) != 1)
-         Lay_ShowErrorAndExit ("Wrong number of footer rows.");
+      Mrk_GetPropertiesFromRow (row,Marks);
      }
    else	// Unknown numbers of header and footer rows
+     {
+      Marks->FilCod = -1L;
       Marks->Header =
       Marks->Footer = 0;
+      Mrk_ResetIndex (&Marks->Index);
+     }
 
    /***** Free structure that stores the query result *****/
    DB_FreeMySQLResult (&mysql_res);
   }
 
+/*****************************************************************************/
+/******** Get properties of a file of marks from a row of a query with *******/
+/******** FilCod,Header,Footer,FileSize,FileTime,HeadEnd,FootStart     *******/
+/*****************************************************************************/
+
+static void Mrk_GetPropertiesFromRow (MYSQL_ROW row,struct MarksProperties *Marks)
+  {
+   /***** Get file code (row[0]) *****/
+   Marks->FilCod = Str_ConvertStrCodToLongCod (row[0]);
+
+   /***** Header (row[1]) *****/
+   if (sscanf (row[1],"%u",&(Marks->Header)) != 1)
+      Lay_ShowErrorAndExit ("Wrong number of header rows.");
+
+   /***** Footer (row[2]) *****/
+   if (sscanf (row[2],"%u",&(Marks->Footer)) != 1)
+      Lay_ShowErrorAndExit ("Wrong number of footer rows.");
+
+   /***** Index: file size (row[3]), file time (row[4]),
+                 end of header (row[5]) and start of footer (row[6]) *****/
+   Mrk_ResetIndex (&Marks->Index);
+   if (sscanf (row[3],"%ld",&Marks->Index.FileSize) != 1 ||
+       sscanf (row[4],"%ld",&Marks->Index.FileTime) != 1 ||
+       sscanf (row[5],"%ld",&Marks->Index.HeadEnd ) != 1 ||
+       sscanf (row[6],"%ld",&Marks->Index.FootStart) != 1)
+      Marks->Index.FileSize = -1L;	// Index must be rebuilt
+  }
+
 /*****************************************************************************/
 /********* Change the number of rows of header of a file of marks ************/
 /*****************************************************************************/
@@ -251,9 +312,11 @@ static void Mrk_ChangeNumRowsHeaderOrFooter (Brw_HeadOrFoot_t HeaderOrFooter)
      {
       /***** Update properties of marks in the database *****/
       Cod = Brw_GetCodForFiles ();
+      /* Index will be rebuilt the next time the marks are shown */
       DB_QueryUPDATE ("can not update properties of marks",
 		      "UPDATE marks_properties,files"
-		      " SET marks_properties.%s=%u"
+		      " SET marks_properties.%s=%u,"
+		           "marks_properties.FileSize=-1"
 		      " WHERE files.FileBrowser=%u AND files.Cod=%ld AND files.Path='%s'"
 		      " AND files.FilCod=marks_properties.FilCod",
 		      Mrk_HeadOrFootStr[HeaderOrFooter],NumRows,
@@ -278,19 +341,21 @@ static void Mrk_ChangeNumRowsHeaderOrFooter (Brw_HeadOrFoot_t HeaderOrFooter)
 // Returns true if the format of the HTML file of marks is correct
 // Returns true if the format of the HTML file of marks is wrong
 // Gbl.Alert.Txt will contain feedback text
+// If the file is correct, Marks->Index holds the rows of the table
+// and must be freed with Mrk_AddMarksToDB or Mrk_FreeIndex
 
 bool Mrk_CheckFileOfMarks (const char *Path,struct MarksProperties *Marks)
   {
    extern const char *Txt_There_are_more_than_one_table_in_the_file_of_marks;
    extern const char *Txt_Table_not_found_in_the_file_of_marks;
-   char CellContent[Mrk_MAX_BYTES_IN_CELL_CONTENT + 1];
    FILE *FileAllMarks;
-   bool EndOfHead = false;
-   bool EndOfTable = false;
    bool FileIsCorrect = true;
-   unsigned NumRowsStds = 0;
+   bool RowsStdsFound = false;
+   unsigned NumRow;
 
+   Marks->FilCod = -1L;
    Marks->Header = Marks->Footer = 0;
+   Mrk_ResetIndex (&Marks->Index);
 
    /***** Open file with the table of marks *****/
    if ((FileAllMarks = fopen (Path,"rb")))
@@ -310,58 +375,32 @@ bool Mrk_CheckFileOfMarks (const char *Path,struct MarksProperties *Marks)
            }
          else
            {
-            /* Return to table start */
-            rewind (FileAllMarks);
-            Str_FindStrInFile (FileAllMarks,"<table",Str_NO_SKIP_HTML_COMMENTS);
-            Str_FindStrInFile (FileAllMarks,">",Str_NO_SKIP_HTML_COMMENTS);
+            /***** Get all the rows of the table in one pass *****/
+            Mrk_GetRowsOfTable (FileAllMarks,&Marks->Index);
 
             /* We assume that the structure of the table has several rows of header until the first row of students is found,
 	       then it has a number of rows of students, including some dummy rows without students,
                and finally it has several rows of footer from the last row of students until the end of the table */
 
-            /***** Count rows of header *****/
-            while (!EndOfHead)
-               if (Str_FindStrInFile (FileAllMarks,"<tr",Str_NO_SKIP_HTML_COMMENTS))   // Go to the next row
-                 {
-        	  // All user's IDs must be in the first column of the row
-		  Str_GetCellFromHTMLTableSkipComments (FileAllMarks,CellContent,Mrk_MAX_BYTES_IN_CELL_CONTENT);
-
-		  /* Check if only user's IDs
-		     or other stuff found in this table cell */
-		  if (Mrk_CheckIfCellContainsOnlyIDs (CellContent))
-		    {
-		     // Only user's IDs found in this cell
-		     EndOfHead = true;
-		     NumRowsStds++;
-		    }
-		  else
-		     // Other stuff found ==> continue in header
-		     Marks->Header++;
-                 }
-               else
-	          EndOfHead = true;	// No more rows
-
-            /***** Count rows of students and rows of footer *****/
-            while (!EndOfTable)
-               if (Str_FindStrInFile (FileAllMarks,"<tr",Str_NO_SKIP_HTML_COMMENTS))   // Go to the next row
-                 {
-        	  // All user's IDs must be in the first column of the row
-		  Str_GetCellFromHTMLTableSkipComments (FileAllMarks,CellContent,Mrk_MAX_BYTES_IN_CELL_CONTENT);
-
-		  /* Check if only user's IDs
-		     or other stuff found in this table cell */
-		  if (Mrk_CheckIfCellContainsOnlyIDs (CellContent))
-		    {
-		     // Only user's IDs found in this cell
-                     NumRowsStds++;
-                     Marks->Footer = 0;
-		    }
-		  else
-		     // Other stuff found ==> continue in header
-                     Marks->Footer++;
-                 }
+            /***** Count rows of header and rows of footer *****/
+            for (NumRow = 0;
+        	 NumRow < Marks->Index.NumRows;
+        	 NumRow++)
+               if (Marks->Index.Rows[NumRow].OnlyIDs)
+        	 {
+        	  // Only user's IDs found in the first column of this row
+        	  RowsStdsFound = true;
+        	  Marks->Footer = 0;
+        	 }
+               else if (RowsStdsFound)
+        	  // Other stuff found after rows of students ==> continue in footer
+        	  Marks->Footer++;
                else
-	          EndOfTable = true;	// No more rows
+        	  // Other stuff found before rows of students ==> continue in header
+        	  Marks->Header++;
+
+            /***** Set byte ranges of header and footer *****/
+            Mrk_SetHeadAndFoot (Marks);
            }
         }
       else
@@ -375,9 +414,300 @@ bool Mrk_CheckFileOfMarks (const char *Path,struct MarksProperties *Marks)
       fclose (FileAllMarks);
      }
 
+   if (!FileIsCorrect)
+      Mrk_FreeIndex (Marks);
+
    return FileIsCorrect;
   }
 
+/*****************************************************************************/
+/*************** Reset index of a file of marks (not built) ******************/
+/*****************************************************************************/
+
+static void Mrk_ResetIndex (struct Mrk_Index *Index)
+  {
+   Index->FileSize   = -1L;
+   Index->FileTime   = 0;
+   Index->HeadEnd    =
+   Index->FootStart  =
+   Index->TableStart =
+   Index->TableEnd   = 0;
+   Index->NumRows    = 0;
+   Index->Rows       = NULL;
+   Index->NumUsrIDs  = 0;
+   Index->UsrIDs     = NULL;
+  }
+
+/*****************************************************************************/
+/******** Free memory used to store rows and user's IDs of the index *********/
+/*****************************************************************************/
+
+void Mrk_FreeIndex (struct MarksProperties *Marks)
+  {
+   if (Marks->Index.Rows)
+     {
+      free (Marks->Index.Rows);
+      Marks->Index.Rows = NULL;
+     }
+   Marks->Index.NumRows = 0;
+
+   if (Marks->Index.UsrIDs)
+     {
+      free (Marks->Index.UsrIDs);
+      Marks->Index.UsrIDs = NULL;
+     }
+   Marks->Index.NumUsrIDs = 0;
+  }
+
+/*****************************************************************************/
+/************** Get byte ranges and user's IDs of all the rows ***************/
+/************************* of the table of marks *****************************/
+/*****************************************************************************/
+
+static void Mrk_GetRowsOfTable (FILE *FileAllMarks,struct Mrk_Index *Index)
+  {
+   char CellContent[Mrk_MAX_BYTES_IN_CELL_CONTENT + 1];
+   struct stat FileStatus;
+   unsigned MaxRows = 0;	// Allocated entries in Index->Rows
+   unsigned MaxUsrIDs = 0;	// Allocated entries in Index->UsrIDs
+   unsigned NumRow;
+   struct Mrk_Row *Row;
+   long CellEnd;
+
+   /***** Get size and modification time of the file *****/
+   if (fstat (fileno (FileAllMarks),&FileStatus))
+      Lay_ShowErrorAndExit ("Can not get properties of file of marks.");
+   Index->FileSize = (long) FileStatus.st_size;
+   Index->FileTime = (long) FileStatus.st_mtime;
+
+   /***** Jump to table start *****/
+   rewind (FileAllMarks);
+   Str_FindStrInFile (FileAllMarks,"<table",Str_NO_SKIP_HTML_COMMENTS);
+   Str_FindStrInFile (FileAllMarks,">",Str_NO_SKIP_HTML_COMMENTS);
+   Index->TableStart = ftell (FileAllMarks);
+
+   /***** Get rows *****/
+   while (Str_FindStrInFile (FileAllMarks,"<tr",Str_NO_SKIP_HTML_COMMENTS))   // Go to the next row
+     {
+      /* Allocate space for one more row */
+      if (Index->NumRows == MaxRows)
+	{
+	 MaxRows = MaxRows ? 2 * MaxRows :
+			     64;
+	 if ((Index->Rows = realloc (Index->Rows,
+	                             MaxRows * sizeof (Index->Rows[0]))) == NULL)
+	    Lay_NotEnoughMemoryExit ();
+	}
+      NumRow = Index->NumRows++;
+      Row = &Index->Rows[NumRow];
+      Row->Start = ftell (FileAllMarks) - 3;	// Offset of "<tr"
+
+      // All user's IDs must be in the first column of the row
+      Str_GetCellFromHTMLTableSkipComments (FileAllMarks,CellContent,Mrk_MAX_BYTES_IN_CELL_CONTENT);
+      Row->OnlyIDs = Mrk_CheckIfCellContainsOnlyIDs (CellContent);
+      Mrk_AddUsrIDsInCell (Index,&MaxUsrIDs,NumRow,CellContent);
+
+      /* Get end of row and return to the end of the first cell */
+      CellEnd = ftell (FileAllMarks);
+      Row->End = Str_FindStrInFile (FileAllMarks,"</tr>",Str_NO_SKIP_HTML_COMMENTS) ? ftell (FileAllMarks) :
+										    -1L;
+      fseek (FileAllMarks,CellEnd,SEEK_SET);
+     }
+
+   /***** Get table end *****/
+   Index->TableEnd = Str_FindStrInFile (FileAllMarks,"</table>",Str_NO_SKIP_HTML_COMMENTS) ? ftell (FileAllMarks) - 8 :	// Offset of "</table>"
+											     Index->FileSize;
+
+   /***** A row without "</tr>" ends where the next row begins *****/
+   for (NumRow = 0;
+	NumRow < Index->NumRows;
+	NumRow++)
+      if (Index->Rows[NumRow].End < 0 ||
+	  (NumRow + 1 < Index->NumRows &&
+	   Index->Rows[NumRow].End > Index->Rows[NumRow + 1].Start))
+	 Index->Rows[NumRow].End = NumRow + 1 < Index->NumRows ? Index->Rows[NumRow + 1].Start :
+							         Index->TableEnd;
+  }
+
+/*****************************************************************************/
+/************* Add the valid user's IDs found in a cell to index *************/
+/*****************************************************************************/
+
+static void Mrk_AddUsrIDsInCell (struct Mrk_Index *Index,unsigned *MaxUsrIDs,
+                                 unsigned NumRow,const char *CellContent)
+  {
+   char UsrIDFromTable[ID_MAX_BYTES_USR_ID + 1];
+   const char *Ptr = CellContent;
+
+   while (*Ptr)
+     {
+      /* Find next string in text until separator (leading and trailing spaces are removed) */
+      Str_GetNextStringUntilSeparator (&Ptr,UsrIDFromTable,ID_MAX_BYTES_USR_ID);
+
+      // Users' IDs are always stored internally in capitals and without leading zeros
+      Str_RemoveLeadingZeros (UsrIDFromTable);
+      Str_ConvertToUpperText (UsrIDFromTable);
+      if (ID_CheckIfUsrIDIsValid (UsrIDFromTable))
+	{
+	 /* Allocate space for one more user's ID */
+	 if (Index->NumUsrIDs == *MaxUsrIDs)
+	   {
+	    *MaxUsrIDs = *MaxUsrIDs ? 2 * *MaxUsrIDs :
+				      64;
+	    if ((Index->UsrIDs = realloc (Index->UsrIDs,
+					  *MaxUsrIDs * sizeof (Index->UsrIDs[0]))) == NULL)
+	       Lay_NotEnoughMemoryExit ();
+	   }
+
+	 /* Add user's ID */
+	 Str_Copy (Index->UsrIDs[Index->NumUsrIDs].UsrID,UsrIDFromTable,
+	           ID_MAX_BYTES_USR_ID);
+	 Index->UsrIDs[Index->NumUsrIDs].NumRow = NumRow;
+	 Index->NumUsrIDs++;
+	}
+     }
+  }
+
+/*****************************************************************************/
+/*************** Set byte ranges of header and footer of table ***************/
+/*****************************************************************************/
+
+static void Mrk_SetHeadAndFoot (struct MarksProperties *Marks)
+  {
+   unsigned Header = Marks->Header;
+   unsigned Footer = Marks->Footer;
+
+   /***** Header and footer can not exceed the number of rows *****/
+   if (Header > Marks->Index.NumRows)
+      Header = Marks->Index.NumRows;
+   if (Footer > Marks->Index.NumRows - Header)
+      Footer = Marks->Index.NumRows - Header;
+
+   /***** Everything until the end of the header is written before user's row *****/
+   Marks->Index.HeadEnd = Header ? Marks->Index.Rows[Header - 1].End :
+				   Marks->Index.TableStart;
+
+   /***** Everything from the start of the footer is written after user's row *****/
+   Marks->Index.FootStart = Footer ? Marks->Index.Rows[Marks->Index.NumRows - Footer].Start :
+				     Marks->Index.TableEnd;
+  }
+
+/*****************************************************************************/
+/***************** Store index of a file of marks in database ****************/
+/*****************************************************************************/
+// Only user's IDs found after the header are stored
+
+static void Mrk_StoreIndexInDB (const struct MarksProperties *Marks)
+  {
+   char *Rows;
+   size_t RowsSize;
+   char Row[Mrk_MAX_BYTES_INDEX_ROW + 1];
+   unsigned NumUsrID;
+   unsigned NumRowsInQuery = 0;
+   const struct Mrk_UsrID *UsrID;
+
+   /***** Store byte ranges of header and footer *****/
+   DB_QueryUPDATE ("can not update index of marks",
+		   "UPDATE marks_properties"
+		   " SET FileSize=%ld,FileTime=%ld,HeadEnd=%ld,FootStart=%ld"
+		   " WHERE FilCod=%ld",
+		   Marks->Index.FileSize,
+		   Marks->Index.FileTime,
+		   Marks->Index.HeadEnd,
+		   Marks->Index.FootStart,
+		   Marks->FilCod);
+
+   /***** Remove old rows of index *****/
+   DB_QueryDELETE ("can not remove index of marks",
+		   "DELETE FROM marks_rows WHERE FilCod=%ld",
+		   Marks->FilCod);
+
+   /***** Allocate space for the rows of a multi-row query *****/
+   RowsSize = Mrk_MAX_IDS_PER_INDEX_QUERY * (Mrk_MAX_BYTES_INDEX_ROW + 1);
+   if ((Rows = malloc (RowsSize + 1)) == NULL)
+      Lay_NotEnoughMemoryExit ();
+   Rows[0] = '\0';
+
+   /***** Insert user's IDs in several multi-row queries.
+          If an ID is repeated, the first row where it appears is kept *****/
+   for (NumUsrID = 0;
+	NumUsrID < Marks->Index.NumUsrIDs;
+	NumUsrID++)
+     {
+      UsrID = &Marks->Index.UsrIDs[NumUsrID];
+      if (UsrID->NumRow < Marks->Header)
+	 continue;	// IDs in header are not indexed
+
+      snprintf (Row,sizeof (Row),"%s(%ld,'%s',%ld,%ld)",
+		NumRowsInQuery ? "," :
+				 "",
+		Marks->FilCod,UsrID->UsrID,
+		Marks->Index.Rows[UsrID->NumRow].Start,
+		Marks->Index.Rows[UsrID->NumRow].End);
+      Str_Concat (Rows,Row,RowsSize);
+      if (++NumRowsInQuery == Mrk_MAX_IDS_PER_INDEX_QUERY)
+	{
+	 DB_QueryINSERT ("can not create index of marks",
+			 "INSERT IGNORE INTO marks_rows"
+			 " (FilCod,UsrID,RowStart,RowEnd)"
+			 " VALUES"
+			 " %s",
+			 Rows);
+	 Rows[0] = '\0';
+	 NumRowsInQuery = 0;
+	}
+     }
+   if (NumRowsInQuery)
+      DB_QueryINSERT ("can not create index of marks",
+		      "INSERT IGNORE INTO marks_rows"
+		      " (FilCod,UsrID,RowStart,RowEnd)"
+		      " VALUES"
+		      " %s",
+		      Rows);
+
+   /***** Free memory used for the query *****/
+   free (Rows);
+  }
+
+/*****************************************************************************/
+/************** Rebuild index of a file of marks if it has changed ***********/
+/*****************************************************************************/
+// Returns false if the file can not be read
+// If the index is rebuilt, Marks->Index holds the rows of the table
+
+static bool Mrk_RebuildIndex (int FdAllMarks,struct MarksProperties *Marks)
+  {
+   struct stat FileStatus;
+   FILE *FileAllMarks;
+   int FdCopy;
+
+   /***** Check if the index is up to date *****/
+   if (fstat (FdAllMarks,&FileStatus))
+      return false;
+   if (Marks->Index.FileSize == (long) FileStatus.st_size &&
+       Marks->Index.FileTime == (long) FileStatus.st_mtime)
+      return true;	// Index is up to date
+
+   /***** Parse the file to get the rows of the table *****/
+   if ((FdCopy = dup (FdAllMarks)) < 0)
+      return false;
+   if ((FileAllMarks = fdopen (FdCopy,"rb")) == NULL)
+     {
+      close (FdCopy);
+      return false;
+     }
+   Mrk_FreeIndex (Marks);
+   Mrk_GetRowsOfTable (FileAllMarks,&Marks->Index);
+   fclose (FileAllMarks);
+   Mrk_SetHeadAndFoot (Marks);
+
+   /***** Store the new index *****/
+   if (Marks->FilCod > 0)
+      Mrk_StoreIndexInDB (Marks);
+
+   return true;
+  }
+
 /*****************************************************************************/
 /******* Check if only user's IDs or other stuff found in a table cell *******/
 /*****************************************************************************/
@@ -416,164 +746,177 @@ static bool Mrk_CheckIfCellContainsOnlyIDs (const char *CellContent)
 /*****************************************************************************/
 /*************************** Show the marks of a user ************************/
 /*****************************************************************************/
+// The row of the user is got from the index of the file of marks,
+// so only the header, the row of the user and the footer are read
 
 static bool Mrk_GetUsrMarks (FILE *FileUsrMarks,struct UsrData *UsrDat,
                              const char *PathFileAllMarks,
                              struct MarksProperties *Marks)
   {
    extern const char *Txt_THE_USER_X_is_not_found_in_the_file_of_marks;
-   unsigned Row;
-   char CellContent[Mrk_MAX_BYTES_IN_CELL_CONTENT + 1];
-   const char *Ptr;
-   char UsrIDFromTable[ID_MAX_BYTES_USR_ID + 1];
-   FILE *FileAllMarks;
-   unsigned NumID;
-   bool UsrIDFound;
-   bool EndOfTable;
+   int FdAllMarks;
+   long RowStart;
+   long RowEnd;
+   bool Success;
 
    /***** Open HTML file with the table of marks *****/
-   if (!(FileAllMarks = fopen (PathFileAllMarks,"rb")))
+   if ((FdAllMarks = open (PathFileAllMarks,O_RDONLY)) < 0)
      {  // Can't open the file with the table of marks
       Ale_CreateAlert (Ale_ERROR,NULL,
 		       "Can not open file of marks.");
       return false;
      }
 
-   /***** Check if it exists a user's ID in the first column of the table of marks *****/
-   /* Jump to table start */
-   Str_FindStrInFile (FileAllMarks,"<table",Str_NO_SKIP_HTML_COMMENTS);
-   Str_FindStrInFile (FileAllMarks,">",Str_NO_SKIP_HTML_COMMENTS);
+   /***** Rebuild the index if the file has changed
+          or if the index was never built *****/
+   if (!Mrk_RebuildIndex (FdAllMarks,Marks))
+     {
+      close (FdAllMarks);
+      Mrk_FreeIndex (Marks);
+      Ale_CreateAlert (Ale_ERROR,NULL,
+		       "Can not open file of marks.");
+      return false;
+     }
+
+   /***** Find the row of the user *****/
+   if (!Mrk_GetRowOfUsr (Marks,UsrDat,&RowStart,&RowEnd))
+     {
+      /***** User's ID not found in table *****/
+      close (FdAllMarks);
+      Mrk_FreeIndex (Marks);
+      Ale_CreateAlert (Ale_WARNING,NULL,
+		       Txt_THE_USER_X_is_not_found_in_the_file_of_marks,
+		       UsrDat->FullName);
+      return false;
+     }
 
-   /* Skip header */
-   for (Row = 1;
-	Row <= Marks->Header;
-	Row++)
-      Str_FindStrInFile (FileAllMarks,"<tr",Str_NO_SKIP_HTML_COMMENTS);   // Go to the next row
+   /***** Write all until the header (included),
+          the row corresponding to the student,
+          and the footer and all until the end *****/
+   Success = Mrk_CopyBytesOfFile (FdAllMarks,FileUsrMarks,0,Marks->Index.HeadEnd) &&
+	     Mrk_CopyBytesOfFile (FdAllMarks,FileUsrMarks,RowStart,RowEnd) &&
+	     Mrk_CopyBytesOfFile (FdAllMarks,FileUsrMarks,Marks->Index.FootStart,Marks->Index.FileSize);
 
-   /* Get user's IDs from table row by row until footer */
-   UsrIDFound = EndOfTable = false;
-   while (!UsrIDFound && !EndOfTable)
-      if (Str_FindStrInFile (FileAllMarks,"<tr",Str_NO_SKIP_HTML_COMMENTS))   // Go to the next row
-        {
-         // All user's IDs must be in the first column of the row
-	 Str_GetCellFromHTMLTableSkipComments (FileAllMarks,CellContent,Mrk_MAX_BYTES_IN_CELL_CONTENT);
+   /***** The file of marks is no longer needed. Close it. *****/
+   close (FdAllMarks);
+   Mrk_FreeIndex (Marks);
 
-	 /* Get user's IDs */
-         Ptr = CellContent;
-	 while (*Ptr && !UsrIDFound)
-	   {
-	    /* Find next string in text until separator (leading and trailing spaces are removed) */
-            Str_GetNextStringUntilSeparator (&Ptr,UsrIDFromTable,ID_MAX_BYTES_USR_ID);
-
-	    // Users' IDs are always stored internally in capitals and without leading zeros
-	    Str_RemoveLeadingZeros (UsrIDFromTable);
-	    Str_ConvertToUpperText (UsrIDFromTable);
-
-	    if (ID_CheckIfUsrIDIsValid (UsrIDFromTable))
-	       // A valid user's ID is found in the first column of table, and stored in UsrIDFromTable.
-	       // Compare UsrIDFromTable with all the confirmed user's IDs in list
-	       for (NumID = 0;
-		    NumID < UsrDat->IDs.Num && !UsrIDFound;
-		    NumID++)
-		  if (UsrDat->IDs.List[NumID].Confirmed)
-		     if (!strcasecmp (UsrDat->IDs.List[NumID].ID,UsrIDFromTable))
-			UsrIDFound = true;
-	   }
-        }
-      else
-         EndOfTable = true;	// No more rows
+   if (!Success)
+      Ale_CreateAlert (Ale_ERROR,NULL,
+		       "Can not read file of marks.");
+   return Success;
+  }
 
-   if (UsrIDFound)
-     {
-      /***** Write all until the header (included) *****/
-      /* Go to start of file */
-      rewind (FileAllMarks);
-
-      /* Write until table start */
-      Str_WriteUntilStrFoundInFileIncludingStr (FileUsrMarks,FileAllMarks,"<table",Str_NO_SKIP_HTML_COMMENTS);
-      Str_WriteUntilStrFoundInFileIncludingStr (FileUsrMarks,FileAllMarks,">",Str_NO_SKIP_HTML_COMMENTS);
-
-      /* Write header */
-      for (Row = 1;
-	   Row <= Marks->Header;
-	   Row++)
-	 Str_WriteUntilStrFoundInFileIncludingStr (FileUsrMarks,FileAllMarks,"</tr>",Str_NO_SKIP_HTML_COMMENTS);
-
-      /****** Write the row corresponding to the student *****/
-      /* Find user's ID */
-      UsrIDFound = EndOfTable = false;
-      while (!UsrIDFound && !EndOfTable)
-	 if (Str_FindStrInFile (FileAllMarks,"<tr",Str_NO_SKIP_HTML_COMMENTS))   // Go to the next row
-	   {
-	    // All user's IDs must be in the first column of the row
-	    Str_GetCellFromHTMLTableSkipComments (FileAllMarks,CellContent,Mrk_MAX_BYTES_IN_CELL_CONTENT);
+/*****************************************************************************/
+/********** Get the byte range of the first row of the table of marks ********/
+/********** that contains one of the confirmed IDs of a user          ********/
+/*****************************************************************************/
 
-	    /* Get user's IDs */
-	    Ptr = CellContent;
-	    while (*Ptr && !UsrIDFound)
-	      {
-	       /* Find next string in text until comma or semicolon (leading and trailing spaces are removed) */
-	       Str_GetNextStringUntilSeparator (&Ptr,UsrIDFromTable,ID_MAX_BYTES_USR_ID);
-
-	       // Users' IDs are always stored internally in capitals and without leading zeros
-	       Str_RemoveLeadingZeros (UsrIDFromTable);
-	       Str_ConvertToUpperText (UsrIDFromTable);
-	       if (ID_CheckIfUsrIDIsValid (UsrIDFromTable))
-		  // A valid user's ID is found in the first column of table, and stored in UsrIDFromTable.
-		  // Compare UsrIDFromTable with all the confirmed user's IDs in list
-		  for (NumID = 0;
-		       NumID < UsrDat->IDs.Num && !UsrIDFound;
-		       NumID++)
-		     if (UsrDat->IDs.List[NumID].Confirmed)
-			if (!strcasecmp (UsrDat->IDs.List[NumID].ID,UsrIDFromTable))
-			   UsrIDFound = true;
-	      }
-	   }
-	 else
-	    EndOfTable = true;	// No more rows
+static bool Mrk_GetRowOfUsr (const struct MarksProperties *Marks,
+                             const struct UsrData *UsrDat,
+                             long *RowStart,long *RowEnd)
+  {
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   char *SubQuery;
+   size_t SubQuerySize;
+   unsigned NumID;
+   unsigned NumUsrID;
+   const struct Mrk_UsrID *UsrID;
+   bool Found = false;
 
-      if (UsrIDFound)	// This should happen always, because the check was already made
+   /***** Index built in this request ==> search in memory *****/
+   if (Marks->Index.Rows)
+     {
+      for (NumUsrID = 0;
+	   NumUsrID < Marks->Index.NumUsrIDs && !Found;
+	   NumUsrID++)
+	{
+	 UsrID = &Marks->Index.UsrIDs[NumUsrID];
+	 if (UsrID->NumRow >= Marks->Header)
+	    for (NumID = 0;
+		 NumID < UsrDat->IDs.Num && !Found;
+		 NumID++)
+	       if (UsrDat->IDs.List[NumID].Confirmed)
+		  if (!strcasecmp (UsrDat->IDs.List[NumID].ID,UsrID->UsrID))
+		    {
+		     *RowStart = Marks->Index.Rows[UsrID->NumRow].Start;
+		     *RowEnd   = Marks->Index.Rows[UsrID->NumRow].End;
+		     Found = true;
+		    }
+	}
+      return Found;
+     }
+
+   /***** Build list of confirmed user's IDs *****/
+   SubQuerySize = UsrDat->IDs.Num * (1 + 1 + ID_MAX_BYTES_USR_ID + 1);
+   if ((SubQuery = malloc (SubQuerySize + 1)) == NULL)
+      Lay_NotEnoughMemoryExit ();
+   SubQuery[0] = '\0';
+   for (NumID = 0;
+	NumID < UsrDat->IDs.Num;
+	NumID++)
+      if (UsrDat->IDs.List[NumID].Confirmed)
 	{
-	 /* Find backward until "<tr" */
-	 Str_FindStrInFileBack (FileAllMarks,"<tr",Str_NO_SKIP_HTML_COMMENTS);
+	 if (SubQuery[0])
+	    Str_Concat (SubQuery,",",SubQuerySize);
+	 Str_Concat (SubQuery,"'",SubQuerySize);
+	 Str_Concat (SubQuery,UsrDat->IDs.List[NumID].ID,SubQuerySize);
+	 Str_Concat (SubQuery,"'",SubQuerySize);
+	}
 
-	 /* Write until "</tr>" */
-	 Str_WriteUntilStrFoundInFileIncludingStr (FileUsrMarks,FileAllMarks,"</tr>",Str_NO_SKIP_HTML_COMMENTS);
+   /***** Get byte range of the first row with any of the IDs *****/
+   if (SubQuery[0])
+     {
+      if (DB_QuerySELECT (&mysql_res,"can not get row of marks",
+			  "SELECT RowStart,"	// row[0]
+				 "RowEnd"	// row[1]
+			  " FROM marks_rows"
+			  " WHERE FilCod=%ld"
+			  " AND UsrID IN (%s)"
+			  " ORDER BY RowStart LIMIT 1",
+			  Marks->FilCod,
+			  SubQuery))
+	{
+	 row = mysql_fetch_row (mysql_res);
+	 Found = (sscanf (row[0],"%ld",RowStart) == 1 &&
+		  sscanf (row[1],"%ld",RowEnd  ) == 1);
+	}
 
-	 /***** Write the footer and all until the end *****/
-	 /* Find the footer of the table */
-	 Str_FindStrInFile (FileAllMarks,"</table>",Str_NO_SKIP_HTML_COMMENTS);
-	 Str_FindStrInFileBack (FileAllMarks,"</table>",Str_NO_SKIP_HTML_COMMENTS);
+      /***** Free structure that stores the query result *****/
+      DB_FreeMySQLResult (&mysql_res);
+     }
 
-	 for (Row = 1;
-	      Row <= Marks->Footer;
-	      Row++)
-	    Str_FindStrInFileBack (FileAllMarks,"<tr",Str_NO_SKIP_HTML_COMMENTS);
+   /***** Free list of IDs *****/
+   free (SubQuery);
 
-	 /* Write the footer of the table */
-	 for (Row = 1;
-	      Row <= Marks->Footer;
-	      Row++)
-	    Str_WriteUntilStrFoundInFileIncludingStr (FileUsrMarks,FileAllMarks,"</tr>",Str_NO_SKIP_HTML_COMMENTS);
+   return Found;
+  }
 
-	 /* Write the end */
-	 Str_FindStrInFile (FileAllMarks,"</table>",Str_NO_SKIP_HTML_COMMENTS);
-	 Str_FindStrInFileBack (FileAllMarks,"</table>",Str_NO_SKIP_HTML_COMMENTS);
-	 Fil_FastCopyOfOpenFiles (FileAllMarks,FileUsrMarks);
+/*****************************************************************************/
+/********* Copy a range of bytes of the file of marks to another file ********/
+/*****************************************************************************/
 
-	 /***** The file of marks is no longer needed. Close it. *****/
-	 fclose (FileAllMarks);
+static bool Mrk_CopyBytesOfFile (int FdAllMarks,FILE *FileUsrMarks,
+                                 long Start,long End)
+  {
+   char Buffer[Mrk_SIZE_OF_COPY_BUFFER];
+   size_t NumBytesToRead;
+   ssize_t NumBytesRead;
 
-	 return true;
-	}
+   while (Start < End)
+     {
+      NumBytesToRead = (size_t) (End - Start);
+      if (NumBytesToRead > sizeof (Buffer))
+	 NumBytesToRead = sizeof (Buffer);
+      if ((NumBytesRead = pread (FdAllMarks,Buffer,NumBytesToRead,(off_t) Start)) <= 0)
+	 return false;
+      if (fwrite (Buffer,1,(size_t) NumBytesRead,FileUsrMarks) != (size_t) NumBytesRead)
+	 return false;
+      Start += (long) NumBytesRead;
      }
 
-   /***** User's ID not found in table *****/
-   fclose (FileAllMarks);
-   Ale_CreateAlert (Ale_WARNING,NULL,
-		    Txt_THE_USER_X_is_not_found_in_the_file_of_marks,
-		    UsrDat->FullName);
-   return false;
+   return true;
   }
 
 /*****************************************************************************/
@@ -600,7 +943,7 @@ void Mrk_ShowMyMarks (void)
              Gbl.FileBrowser.FilFolLnk.Full);
 
    /***** Get number of rows of header or footer *****/
-   Mrk_GetNumRowsHeaderAndFooter (&Marks);
+   Mrk_GetPropertiesOfMarks (&Marks);
 
    /***** Set the student whose marks will be shown *****/
    if (Gbl.Usrs.Me.Role.Logged == Rol_STD)	// If I am logged as student...
@@ -723,8 +1066,16 @@ void Mrk_GetNotifMyMarks (char SummaryStr[Ntf_MAX_BYTES_SUMMARY + 1],
    /***** Get subject of message from database *****/
    if (DB_QuerySELECT (&mysql_res,"can not get the number of rows"
 				  " in header and footer",
-		       "SELECT files.FileBrowser,files.Cod,files.Path,"
-		       "marks_properties.Header,marks_properties.Footer"
+		       "SELECT files.FileBrowser,"		// row[0]
+			      "files.Cod,"			// row[1]
+			      "files.Path,"			// row[2]
+			      "marks_properties.FilCod,"	// row[3]
+			      "marks_properties.Header,"	// row[4]
+			      "marks_properties.Footer,"	// row[5]
+			      "marks_properties.FileSize,"	// row[6]
+			      "marks_properties.FileTime,"	// row[7]
+			      "marks_properties.HeadEnd,"	// row[8]
+			      "marks_properties.FootStart"	// row[9]
 		       " FROM files,marks_properties"
 		       " WHERE files.FilCod=%ld"
 		       " AND files.FilCod=marks_properties.FilCod",
@@ -754,13 +1105,8 @@ void Mrk_GetNotifMyMarks (char SummaryStr[Ntf_MAX_BYTES_SUMMARY + 1],
 
       if (GetContent)
 	{
-	 /* Header (row[3]) */
-	 if (sscanf (row[3],"%u",&(Marks.Header)) != 1)
-	    Lay_ShowErrorAndExit ("Wrong number of header rows.");
-
-	 /* Footer (row[4]) */
-	 if (sscanf (row[4],"%u",&(Marks.Footer)) != 1)
-	    Lay_ShowErrorAndExit ("Wrong number of footer rows.");
+	 /* Header, footer and index (row[3]...row[9]) */
+	 Mrk_GetPropertiesFromRow (&row[3],&Marks);
 
 	 if (UsrDat.IDs.Num)
 	   {
@@ -30,15 +30,45 @@
 #include <stdbool.h>		// For boolean type
 
 #include "swad_file_browser.h"
+#include "swad_ID.h"
 
 /*****************************************************************************/
 /******************************* Public types ********************************/
 /*****************************************************************************/
 
+struct Mrk_Row		// A row of the table of marks
+  {
+   long Start;		// Offset of "<tr"
+   long End;		// Offset just after "</tr>"
+   bool OnlyIDs;	// Does the first cell contain only user's IDs?
+  };
+
+struct Mrk_UsrID	// A user's ID found in the first cell of a row
+  {
+   char UsrID[ID_MAX_BYTES_USR_ID + 1];
+   unsigned NumRow;	// Row where the ID is found (0, 1, 2...)
+  };
+
+struct Mrk_Index	// Byte ranges in the file of marks
+  {
+   long FileSize;	// Size of the file when the index was built
+   long FileTime;	// Modification time of the file when the index was built
+   long HeadEnd;	// Everything before this offset is written before the user's row
+   long FootStart;	// Everything from this offset is written after the user's row
+   long TableStart;	// Offset just after "<table ...>"
+   long TableEnd;	// Offset of "</table>"
+   unsigned NumRows;
+   struct Mrk_Row *Rows;	// Only in memory while the index is built
+   unsigned NumUsrIDs;
+   struct Mrk_UsrID *UsrIDs;	// Only in memory while the index is built
+  };
+
 struct MarksProperties
   {
-   unsigned Header;
-   unsigned Footer;
+   long FilCod;		// Code of the file of marks
+   unsigned Header;	// Number of rows of header
+   unsigned Footer;	// Number of rows of footer
+   struct Mrk_Index Index;
   };
 
 /*****************************************************************************/
@@ -51,6 +81,7 @@ void Mrk_ChangeNumRowsHeader (void);
 void Mrk_ChangeNumRowsFooter (void);
 
 bool Mrk_CheckFileOfMarks (const char *Path,struct MarksProperties *Marks);
+void Mrk_FreeIndex (struct MarksProperties *Marks);
 void Mrk_ShowMyMarks (void);
 void Mrk_GetNotifMyMarks (char SummaryStr[Ntf_MAX_BYTES_SUMMARY + 1],
                           char **ContentStr,
@@ -0,0 +1,2608 @@
+// swad_markdown.c: conversion from Markdown to HTML
+
+/*
+    SWAD (Shared Workspace At a Distance),
+    is a web platform developed at the University of Granada (Spain),
+    and used to support university teaching.
+
+    This file is part of SWAD core.
+    Copyright (C) 1999-2021 Antonio Caas Vargas
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as
+    published by the Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.
+
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/*****************************************************************************/
+/********************************* Headers ***********************************/
+/*****************************************************************************/
+
+#include <ctype.h>		// For isalnum, isspace, etc.
+#include <stdbool.h>		// For boolean type
+#include <stdint.h>		// For SIZE_MAX
+#include <stdlib.h>		// For malloc, realloc, free
+#include <string.h>		// For string functions
+#include <strings.h>		// For strncasecmp
+
+#include "swad_markdown.h"
+
+/*****************************************************************************/
+/*
+   Markdown is converted to HTML5 with the extensions
+   that were used with pandoc (markdown_github+tex_math_dollars):
+   - pipe tables,
+   - fenced code blocks,
+   - strikeout (~~text~~),
+   - URIs autolinked,
+   - hard line breaks (every newline inside a paragraph is a line break),
+   - raw HTML,
+   - intraword underscores (not emphasis),
+   - identifiers in headings,
+   - TeX math between $...$ and $$...$$, left for MathJax.
+   Text is not converted to UTF-8, so it is written in the page encoding.
+   The conversion does not depend on other modules,
+   so it can be benchmarked out of the CGI (see swad_markdown_bench.c).
+*/
+/*****************************************************************************/
+
+/*****************************************************************************/
+/***************************** Private constants *****************************/
+/*****************************************************************************/
+
+#define Mkd_MAX_DEPTH			 32	// Maximum nesting of quotes and lists
+#define Mkd_MAX_TABLE_COLUMNS		 64
+#define Mkd_MAX_BYTES_LINK_TEXT		999	// Maximum length of [link text]
+#define Mkd_MAX_BYTES_LINK_DEST	       2047	// Maximum length of (URL "title")
+#define Mkd_MAX_BYTES_HTML_TAG	       1023	// Maximum length of inline <tag ...>
+#define Mkd_MAX_BYTES_ID		 63	// Maximum length of heading identifiers
+#define Mkd_MAX_BACKTICKS_MEMO		  8	// Code spans with more backticks are not memoized
+
+#define Mkd_NOT_FOUND SIZE_MAX
+
+/* Block-level HTML tags that start a raw HTML block */
+static const char *Mkd_HTMLBlockTags[] =
+  {
+   "address","article","aside","blockquote","body","center","dd","details",
+   "dialog","dir","div","dl","dt","fieldset","figcaption","figure","footer",
+   "form","h1","h2","h3","h4","h5","h6","header","hr","html","iframe",
+   "legend","li","main","menu","nav","ol","p","pre","script","section",
+   "style","summary","table","tbody","td","tfoot","th","thead","tr","ul",
+   NULL
+  };
+
+/* Letters without accent of Latin-1 characters 0xC0 to 0xFF,
+   used to build identifiers of headings ('\0' = not a letter) */
+static const char Mkd_LettersLatin1[64] =
+  {
+   'a','a','a','a','a','a','a','c','e','e','e','e','i','i','i','i',	// 0xC0
+   'd','n','o','o','o','o','o','\0','o','u','u','u','u','y','\0','s',	// 0xD0
+   'a','a','a','a','a','a','a','c','e','e','e','e','i','i','i','i',	// 0xE0
+   'd','n','o','o','o','o','o','\0','o','u','u','u','u','y','\0','y',	// 0xF0
+  };
+
+/*****************************************************************************/
+/******************************* Private types *******************************/
+/*****************************************************************************/
+
+struct Mkd_Line
+  {
+   const char *Txt;	// Not null-terminated
+   size_t Len;
+  };
+
+struct Mkd_Ref		// Reference of a link: [label]: URL "title"
+  {
+   char *Label;		// Normalized (lowercase and single spaces)
+   char *URL;
+   char *Title;
+  };
+
+struct Mkd_Id		// Identifier of a heading
+  {
+   char *Id;
+   unsigned NumUses;	// Number of headings with this identifier plus a suffix
+  };
+
+struct Mkd_Doc
+  {
+   FILE *FileHTML;
+   struct Mkd_Ref *Refs;
+   unsigned NumRefs;
+   struct Mkd_Id *Ids;	// Identifiers already used in headings
+   unsigned NumIds;
+   unsigned InlineDepth;	// Nesting of emphasis and links being written
+  };
+
+typedef enum
+  {
+   Mkd_LIST_BULLET,
+   Mkd_LIST_ORDERED,
+  } Mkd_ListType_t;
+
+struct Mkd_ListMarker
+  {
+   Mkd_ListType_t Type;
+   char Chr;		// '-', '+', '*' in bullet lists; '.', ')' in ordered lists
+   long Start;		// Number of item in ordered lists
+   size_t Offset;	// Column where content of item starts
+   bool Empty;		// Nothing after marker
+  };
+
+typedef enum
+  {
+   Mkd_ALIGN_NONE,
+   Mkd_ALIGN_LEFT,
+   Mkd_ALIGN_CENTER,
+   Mkd_ALIGN_RIGHT,
+  } Mkd_Align_t;
+
+struct Mkd_Cell
+  {
+   const char *Txt;
+   size_t Len;
+  };
+
+struct Mkd_Link
+  {
+   size_t End;		// Position just after the link in the text
+   size_t TxtStart;	// Link text
+   size_t TxtLen;
+   char *URL;
+   char *Title;		// NULL if no title
+  };
+
+struct Mkd_Inline	// Searches that failed in a text,
+  {			// not repeated from positions after them
+   size_t NoEmph[2][3];		// '*' or '_' with 1, 2 or 3 chars
+   size_t NoCode[Mkd_MAX_BACKTICKS_MEMO];
+   size_t NoStrike;
+   size_t NoMath;
+   size_t NoDisplayMath;
+  };
+
+/*****************************************************************************/
+/************************** Private global variables *************************/
+/*****************************************************************************/
+
+static void (*Mkd_NotEnoughMemoryExit) (void);	// Called if no memory, must not return
+
+/*****************************************************************************/
+/***************************** Private prototypes ****************************/
+/*****************************************************************************/
+
+static char *Mkd_ExpandTabs (const char *TxtMD);
+static size_t Mkd_SplitLines (const char *Txt,struct Mkd_Line **Lines);
+static void Mkd_FreeDoc (struct Mkd_Doc *Doc);
+
+static void Mkd_WriteBlocks (struct Mkd_Doc *Doc,
+                             const struct Mkd_Line *Lines,size_t NumLines,
+                             bool Tight,unsigned Depth);
+static size_t Mkd_WriteIndentedCode (struct Mkd_Doc *Doc,
+                                     const struct Mkd_Line *Lines,size_t NumLines,
+                                     size_t NumLine);
+static size_t Mkd_WriteFencedCode (struct Mkd_Doc *Doc,
+                                   const struct Mkd_Line *Lines,size_t NumLines,
+                                   size_t NumLine);
+static size_t Mkd_WriteBlockQuote (struct Mkd_Doc *Doc,
+                                   const struct Mkd_Line *Lines,size_t NumLines,
+                                   size_t NumLine,unsigned Depth);
+static size_t Mkd_WriteList (struct Mkd_Doc *Doc,
+                             const struct Mkd_Line *Lines,size_t NumLines,
+                             size_t NumLine,unsigned Depth);
+static size_t Mkd_WriteHTMLBlock (struct Mkd_Doc *Doc,
+                                  const struct Mkd_Line *Lines,size_t NumLines,
+                                  size_t NumLine);
+static size_t Mkd_WriteTable (struct Mkd_Doc *Doc,
+                              const struct Mkd_Line *Lines,size_t NumLines,
+                              size_t NumLine,
+                              const Mkd_Align_t Aligns[Mkd_MAX_TABLE_COLUMNS],
+                              unsigned NumCols);
+static void Mkd_WriteTableRow (struct Mkd_Doc *Doc,const struct Mkd_Line *Line,
+                               const Mkd_Align_t Aligns[Mkd_MAX_TABLE_COLUMNS],
+                               unsigned NumCols,
+                               const char *ClassRow,const char *CellTag);
+static size_t Mkd_WriteParagraph (struct Mkd_Doc *Doc,
+                                  const struct Mkd_Line *Lines,size_t NumLines,
+                                  size_t NumLine,bool Tight);
+static void Mkd_WriteHeading (struct Mkd_Doc *Doc,unsigned Level,
+                              const char *Txt,size_t Len);
+static void Mkd_WriteHeadingId (struct Mkd_Doc *Doc,const char *Txt,size_t Len);
+static struct Mkd_Id *Mkd_GetId (const struct Mkd_Doc *Doc,const char *Id);
+static void Mkd_WriteLinesInline (struct Mkd_Doc *Doc,
+                                  const struct Mkd_Line *Lines,size_t NumLines);
+
+static size_t Mkd_GetIndent (const struct Mkd_Line *Line);
+static bool Mkd_CheckIfBlank (const struct Mkd_Line *Line);
+static bool Mkd_CheckIfThematicBreak (const struct Mkd_Line *Line);
+static unsigned Mkd_GetATXHeading (const struct Mkd_Line *Line,
+                                   const char **Txt,size_t *Len);
+static unsigned Mkd_GetSetextUnderline (const struct Mkd_Line *Line);
+static size_t Mkd_GetFence (const struct Mkd_Line *Line,char *FenceChr);
+static bool Mkd_GetListMarker (const struct Mkd_Line *Line,
+                               struct Mkd_ListMarker *Marker);
+static bool Mkd_CheckIfHTMLBlockStart (const struct Mkd_Line *Line);
+static bool Mkd_CheckIfBlockQuoteStart (const struct Mkd_Line *Line);
+static bool Mkd_CheckIfInterruptsParagraph (const struct Mkd_Line *Line);
+static unsigned Mkd_SplitTableRow (const struct Mkd_Line *Line,
+                                   struct Mkd_Cell Cells[Mkd_MAX_TABLE_COLUMNS]);
+static unsigned Mkd_GetTableDelimiterRow (const struct Mkd_Line *Line,
+                                          Mkd_Align_t Aligns[Mkd_MAX_TABLE_COLUMNS]);
+
+static void Mkd_GetRefDefinitions (struct Mkd_Doc *Doc,
+                                   struct Mkd_Line *Lines,size_t NumLines);
+static bool Mkd_GetRefDefinition (struct Mkd_Doc *Doc,const struct Mkd_Line *Line);
+static char *Mkd_NormalizeLabel (const char *Txt,size_t Len);
+static const struct Mkd_Ref *Mkd_GetRef (const struct Mkd_Doc *Doc,
+                                         const char *Txt,size_t Len);
+
+static void Mkd_WriteInline (struct Mkd_Doc *Doc,const char *Txt,size_t Len,
+                             bool InLink);
+static size_t Mkd_WriteCodeSpan (struct Mkd_Doc *Doc,const char *Txt,size_t Len,
+                                 size_t Pos,struct Mkd_Inline *Memo);
+static size_t Mkd_WriteMath (struct Mkd_Doc *Doc,const char *Txt,size_t Len,
+                             size_t Pos,struct Mkd_Inline *Memo);
+static size_t Mkd_WriteEmphasis (struct Mkd_Doc *Doc,const char *Txt,size_t Len,
+                                 size_t Pos,bool InLink,struct Mkd_Inline *Memo);
+static size_t Mkd_WriteStrikeout (struct Mkd_Doc *Doc,const char *Txt,size_t Len,
+                                  size_t Pos,bool InLink,struct Mkd_Inline *Memo);
+static size_t Mkd_WriteLinkOrImage (struct Mkd_Doc *Doc,const char *Txt,size_t Len,
+                                    size_t Pos,bool Image);
+static size_t Mkd_WriteAngleBrackets (struct Mkd_Doc *Doc,const char *Txt,size_t Len,
+                                      size_t Pos,bool InLink);
+static size_t Mkd_WriteBareURL (struct Mkd_Doc *Doc,const char *Txt,size_t Len,
+                                size_t Pos);
+
+static size_t Mkd_FindCodeSpanEnd (const char *Txt,size_t Len,size_t Pos,
+                                   size_t NumBackticks);
+static size_t Mkd_FindEmphCloser (const char *Txt,size_t Len,size_t From,
+                                  char Chr,size_t RunLen);
+static size_t Mkd_FindClosingBracket (const char *Txt,size_t Len,size_t Pos);
+static bool Mkd_GetLinkDestination (const char *Txt,size_t Len,size_t Pos,
+                                    struct Mkd_Link *Link);
+static size_t Mkd_GetRunLength (const char *Txt,size_t Len,size_t Pos);
+static size_t Mkd_GetEntityLength (const char *Txt,size_t Len,size_t Pos);
+static char *Mkd_CopyUnescaped (const char *Txt,size_t Len);
+
+static void Mkd_WriteEscaped (FILE *FileHTML,const char *Txt,size_t Len);
+static void Mkd_WritePlainText (FILE *FileHTML,const char *Txt,size_t Len);
+
+/*****************************************************************************/
+/*********************** Convert from Markdown to HTML ***********************/
+/*****************************************************************************/
+
+void Mkd_WriteHTMLFromMarkdown (const char *TxtMD,FILE *FileHTML,
+                                void (*NotEnoughMemoryExit) (void))
+  {
+   struct Mkd_Doc Doc;
+   char *Txt;
+   struct Mkd_Line *Lines;
+   size_t NumLines;
+
+   /***** Set function to be called if no memory *****/
+   Mkd_NotEnoughMemoryExit = NotEnoughMemoryExit;
+
+   /***** Initialize document *****/
+   Doc.FileHTML    = FileHTML;
+   Doc.Refs        = NULL;
+   Doc.NumRefs     = 0;
+   Doc.Ids         = NULL;
+   Doc.NumIds      = 0;
+   Doc.InlineDepth = 0;
+
+   /***** Split text in lines *****/
+   Txt = Mkd_ExpandTabs (TxtMD);
+   NumLines = Mkd_SplitLines (Txt,&Lines);
+
+   /***** Get references of links, used in any place of the text *****/
+   Mkd_GetRefDefinitions (&Doc,Lines,NumLines);
+
+   /***** Write blocks *****/
+   Mkd_WriteBlocks (&Doc,Lines,NumLines,false,0);
+
+   /***** Free memory *****/
+   Mkd_FreeDoc (&Doc);
+   free (Lines);
+   free (Txt);
+  }
+
+/*****************************************************************************/
+/************** Copy text expanding tabs and removing returns ****************/
+/*****************************************************************************/
+// Tab stops every 4 columns, as in Markdown
+
+static char *Mkd_ExpandTabs (const char *TxtMD)
+  {
+   const char *Src;
+   char *Txt;
+   char *Dst;
+   size_t Col = 0;
+
+   if ((Txt = malloc (strlen (TxtMD) * 4 + 1)) == NULL)
+      Mkd_NotEnoughMemoryExit ();
+
+   for (Src = TxtMD, Dst = Txt;
+	*Src;
+	Src++)
+      switch (*Src)
+	{
+	 case '\t':
+	    do
+	      {
+	       *Dst++ = ' ';
+	       Col++;
+	      }
+	    while (Col % 4);
+	    break;
+	 case '\r':
+	    break;
+	 case '\n':
+	    *Dst++ = '\n';
+	    Col = 0;
+	    break;
+	 default:
+	    *Dst++ = *Src;
+	    Col++;
+	    break;
+	}
+   *Dst = '\0';
+
+   return Txt;
+  }
+
+/*****************************************************************************/
+/*************************** Split text in lines *****************************/
+/*****************************************************************************/
+
+static size_t Mkd_SplitLines (const char *Txt,struct Mkd_Line **Lines)
+  {
+   const char *Ptr;
+   const char *End;
+   size_t NumLines = 1;
+
+   /***** Allocate lines *****/
+   for (Ptr = Txt;
+	*Ptr;
+	Ptr++)
+      if (*Ptr == '\n')
+	 NumLines++;
+   if ((*Lines = malloc (NumLines * sizeof (struct Mkd_Line))) == NULL)
+      Mkd_NotEnoughMemoryExit ();
+
+   /***** Set lines *****/
+   for (Ptr = Txt, NumLines = 0;
+	;
+	Ptr = End + 1)
+     {
+      if ((End = strchr (Ptr,'\n')) == NULL)
+	 End = Ptr + strlen (Ptr);
+      (*Lines)[NumLines].Txt = Ptr;
+      (*Lines)[NumLines].Len = (size_t) (End - Ptr);
+      NumLines++;
+      if (*End == '\0')
+	 break;
+     }
+
+   return NumLines;
+  }
+
+/*****************************************************************************/
+/******************* Free memory used by references and ids ******************/
+/*****************************************************************************/
+
+static void Mkd_FreeDoc (struct Mkd_Doc *Doc)
+  {
+   unsigned NumRef;
+   unsigned NumId;
+
+   for (NumRef = 0;
+	NumRef < Doc->NumRefs;
+	NumRef++)
+     {
+      free (Doc->Refs[NumRef].Label);
+      free (Doc->Refs[NumRef].URL);
+      free (Doc->Refs[NumRef].Title);
+     }
+   free (Doc->Refs);
+
+   for (NumId = 0;
+	NumId < Doc->NumIds;
+	NumId++)
+      free (Doc->Ids[NumId].Id);
+   free (Doc->Ids);
+  }
+
+/*****************************************************************************/
+/************************* Write a sequence of blocks ************************/
+/*****************************************************************************/
+// Tight: paragraphs are written without <p> (in tight lists)
+
+static void Mkd_WriteBlocks (struct Mkd_Doc *Doc,
+                             const struct Mkd_Line *Lines,size_t NumLines,
+                             bool Tight,unsigned Depth)
+  {
+   size_t NumLine = 0;
+   const struct Mkd_Line *Line;
+   const char *Txt;
+   size_t Len;
+   unsigned Level;
+   char FenceChr;
+   struct Mkd_ListMarker Marker;
+   Mkd_Align_t Aligns[Mkd_MAX_TABLE_COLUMNS];
+   struct Mkd_Cell Cells[Mkd_MAX_TABLE_COLUMNS];
+   unsigned NumCols;
+
+   while (NumLine < NumLines)
+     {
+      Line = &Lines[NumLine];
+
+      if (Mkd_CheckIfBlank (Line))
+	 NumLine++;
+      else if (Mkd_GetIndent (Line) >= 4)
+	 NumLine = Mkd_WriteIndentedCode (Doc,Lines,NumLines,NumLine);
+      else if (Mkd_GetFence (Line,&FenceChr))
+	 NumLine = Mkd_WriteFencedCode (Doc,Lines,NumLines,NumLine);
+      else if ((Level = Mkd_GetATXHeading (Line,&Txt,&Len)))
+	{
+	 Mkd_WriteHeading (Doc,Level,Txt,Len);
+	 NumLine++;
+	}
+      else if (Mkd_CheckIfThematicBreak (Line))
+	{
+	 fputs ("<hr />\n",Doc->FileHTML);
+	 NumLine++;
+	}
+      else if (Depth < Mkd_MAX_DEPTH &&
+	       Mkd_CheckIfBlockQuoteStart (Line))
+	 NumLine = Mkd_WriteBlockQuote (Doc,Lines,NumLines,NumLine,Depth);
+      else if (Depth < Mkd_MAX_DEPTH &&
+	       Mkd_GetListMarker (Line,&Marker))
+	 NumLine = Mkd_WriteList (Doc,Lines,NumLines,NumLine,Depth);
+      else if (Mkd_CheckIfHTMLBlockStart (Line))
+	 NumLine = Mkd_WriteHTMLBlock (Doc,Lines,NumLines,NumLine);
+      else if (NumLine + 1 < NumLines &&
+	       (NumCols = Mkd_GetTableDelimiterRow (&Lines[NumLine + 1],Aligns)) &&
+	       Mkd_SplitTableRow (Line,Cells) == NumCols)
+	 NumLine = Mkd_WriteTable (Doc,Lines,NumLines,NumLine,Aligns,NumCols);
+      else
+	 NumLine = Mkd_WriteParagraph (Doc,Lines,NumLines,NumLine,Tight);
+     }
+  }
+
+
+/*****************************************************************************/
+/************************** Write an indented code ***************************/
+/*****************************************************************************/
+// Return the number of the line after the block
+
+static size_t Mkd_WriteIndentedCode (struct Mkd_Doc *Doc,
+                                     const struct Mkd_Line *Lines,size_t NumLines,
+                                     size_t NumLine)
+  {
+   size_t FirstLine = NumLine;
+   size_t LastLine = NumLine;
+   size_t Indent;
+
+   /***** Get lines indented or blank, except blank lines at the end *****/
+   for (;
+	NumLine < NumLines &&
+	(Mkd_CheckIfBlank (&Lines[NumLine]) || Mkd_GetIndent (&Lines[NumLine]) >= 4);
+	NumLine++)
+      if (!Mkd_CheckIfBlank (&Lines[NumLine]))
+	 LastLine = NumLine;
+
+   /***** Write code without the indentation *****/
+   fputs ("<pre><code>",Doc->FileHTML);
+   for (NumLine = FirstLine;
+	NumLine <= LastLine;
+	NumLine++)
+     {
+      Indent = Mkd_GetIndent (&Lines[NumLine]);
+      if (Indent > 4)
+	 Indent = 4;
+      Mkd_WriteEscaped (Doc->FileHTML,Lines[NumLine].Txt + Indent,
+			Lines[NumLine].Len - Indent);
+      fputc ('\n',Doc->FileHTML);
+     }
+   fputs ("</code></pre>\n",Doc->FileHTML);
+
+   return LastLine + 1;
+  }
+
+/*****************************************************************************/
+/*************************** Write a fenced code *****************************/
+/*****************************************************************************/
+// Return the number of the line after the block
+
+static size_t Mkd_WriteFencedCode (struct Mkd_Doc *Doc,
+                                   const struct Mkd_Line *Lines,size_t NumLines,
+                                   size_t NumLine)
+  {
+   const struct Mkd_Line *Line = &Lines[NumLine];
+   size_t FenceIndent = Mkd_GetIndent (Line);
+   char FenceChr;
+   size_t FenceLen = Mkd_GetFence (Line,&FenceChr);
+   size_t Pos;
+   size_t InfoStart;
+   size_t Indent;
+   char ClosingChr;
+
+   /***** Write start with the language in info string as class *****/
+   for (Pos = FenceIndent + FenceLen;
+	Pos < Line->Len && Line->Txt[Pos] == ' ';
+	Pos++);
+   for (InfoStart = Pos;
+	Pos < Line->Len && Line->Txt[Pos] != ' ';
+	Pos++);
+   if (Pos > InfoStart)
+     {
+      fputs ("<pre class=\"",Doc->FileHTML);
+      Mkd_WriteEscaped (Doc->FileHTML,&Line->Txt[InfoStart],Pos - InfoStart);
+      fputs ("\"><code>",Doc->FileHTML);
+     }
+   else
+      fputs ("<pre><code>",Doc->FileHTML);
+
+   /***** Write lines until closing fence or end *****/
+   for (NumLine++;
+	NumLine < NumLines;
+	NumLine++)
+     {
+      Line = &Lines[NumLine];
+
+      /* Closing fence? */
+      if (Mkd_GetFence (Line,&ClosingChr) >= FenceLen &&
+	  ClosingChr == FenceChr)
+	{
+	 for (Pos = Mkd_GetIndent (Line);
+	      Pos < Line->Len && Line->Txt[Pos] == FenceChr;
+	      Pos++);
+	 for (;
+	      Pos < Line->Len && Line->Txt[Pos] == ' ';
+	      Pos++);
+	 if (Pos == Line->Len)
+	   {
+	    NumLine++;
+	    break;
+	   }
+	}
+
+      /* Write line without the indentation of the fence */
+      Indent = Mkd_GetIndent (Line);
+      if (Indent > FenceIndent)
+	 Indent = FenceIndent;
+      Mkd_WriteEscaped (Doc->FileHTML,Line->Txt + Indent,Line->Len - Indent);
+      fputc ('\n',Doc->FileHTML);
+     }
+   fputs ("</code></pre>\n",Doc->FileHTML);
+
+   return NumLine;
+  }
+
+/*****************************************************************************/
+/**************************** Write a block quote ****************************/
+/*****************************************************************************/
+// Return the number of the line after the block
+
+static size_t Mkd_WriteBlockQuote (struct Mkd_Doc *Doc,
+                                   const struct Mkd_Line *Lines,size_t NumLines,
+                                   size_t NumLine,unsigned Depth)
+  {
+   struct Mkd_Line *QuoteLines;
+   size_t NumQuoteLines = 0;
+   const struct Mkd_Line *Line;
+   size_t Pos;
+   bool PrevBlank = false;
+
+   if ((QuoteLines = malloc ((NumLines - NumLine) * sizeof (struct Mkd_Line))) == NULL)
+      Mkd_NotEnoughMemoryExit ();
+
+   /***** Get lines of the quote without '>' *****/
+   for (;
+	NumLine < NumLines;
+	NumLine++)
+     {
+      Line = &Lines[NumLine];
+      if (Mkd_CheckIfBlockQuoteStart (Line))
+	{
+	 Pos = Mkd_GetIndent (Line) + 1;
+	 if (Pos < Line->Len && Line->Txt[Pos] == ' ')
+	    Pos++;
+	 QuoteLines[NumQuoteLines].Txt = Line->Txt + Pos;
+	 QuoteLines[NumQuoteLines].Len = Line->Len - Pos;
+	}
+      else if (!PrevBlank &&				// Lazy continuation
+	       !Mkd_CheckIfBlank (Line) &&		// of a paragraph
+	       !Mkd_CheckIfInterruptsParagraph (Line))
+	 QuoteLines[NumQuoteLines] = *Line;
+      else
+	 break;
+      PrevBlank = Mkd_CheckIfBlank (&QuoteLines[NumQuoteLines]);
+      NumQuoteLines++;
+     }
+
+   /***** Write quote *****/
+   fputs ("<blockquote>\n",Doc->FileHTML);
+   Mkd_WriteBlocks (Doc,QuoteLines,NumQuoteLines,false,Depth + 1);
+   fputs ("</blockquote>\n",Doc->FileHTML);
+
+   free (QuoteLines);
+
+   return NumLine;
+  }
+
+/*****************************************************************************/
+/******************************* Write a list ********************************/
+/*****************************************************************************/
+// Return the number of the line after the list
+
+static size_t Mkd_WriteList (struct Mkd_Doc *Doc,
+                             const struct Mkd_Line *Lines,size_t NumLines,
+                             size_t NumLine,unsigned Depth)
+  {
+   struct Mkd_ListMarker FirstMarker;
+   struct Mkd_ListMarker Marker;
+   struct Mkd_ListMarker NestedMarker;
+   struct Mkd_Line *ItemLines;	// Lines of all items, one item after another
+   size_t NumItemLines = 0;
+   size_t *FirstItemLine;	// Index in ItemLines of first line of each item
+   size_t NumItems = 0;
+   size_t NumItem;
+   const struct Mkd_Line *Line;
+   size_t Indent;
+   size_t NumBlankLines;
+   bool PrevBlank;
+   bool Loose = false;
+
+   if ((ItemLines = malloc ((NumLines - NumLine) * sizeof (struct Mkd_Line))) == NULL ||
+       (FirstItemLine = malloc ((NumLines - NumLine + 1) * sizeof (size_t))) == NULL)
+      Mkd_NotEnoughMemoryExit ();
+
+   /***** Get lines of items without markers and indentation *****/
+   Mkd_GetListMarker (&Lines[NumLine],&FirstMarker);
+   Marker = FirstMarker;
+   for (;;)
+     {
+      /* First line of item, after marker */
+      Line = &Lines[NumLine++];
+      FirstItemLine[NumItems++] = NumItemLines;
+      if (Marker.Empty)
+	{
+	 ItemLines[NumItemLines].Txt = Line->Txt + Line->Len;
+	 ItemLines[NumItemLines].Len = 0;
+	}
+      else
+	{
+	 ItemLines[NumItemLines].Txt = Line->Txt + Marker.Offset;
+	 ItemLines[NumItemLines].Len = Line->Len - Marker.Offset;
+	}
+      NumItemLines++;
+
+      /* Next lines of item */
+      for (PrevBlank = Marker.Empty, NumBlankLines = 0;
+	   NumLine < NumLines;
+	   NumLine++)
+	{
+	 Line = &Lines[NumLine];
+	 if (Mkd_CheckIfBlank (Line))
+	   {
+	    if (Marker.Empty &&
+		NumItemLines - FirstItemLine[NumItems - 1] == 1)
+	       break;	// An item can begin with at most one blank line
+	    ItemLines[NumItemLines].Txt = Line->Txt;
+	    ItemLines[NumItemLines].Len = 0;
+	    NumBlankLines++;
+	    PrevBlank = true;
+	   }
+	 else
+	   {
+	    if ((Indent = Mkd_GetIndent (Line)) >= Marker.Offset)
+	      {
+	       ItemLines[NumItemLines].Txt = Line->Txt + Marker.Offset;
+	       ItemLines[NumItemLines].Len = Line->Len - Marker.Offset;
+
+	       /* A blank line between paragraphs of this item
+		  makes the list loose */
+	       if (NumBlankLines && Indent == Marker.Offset &&
+		   !Mkd_GetListMarker (&ItemLines[NumItemLines],&NestedMarker))
+		  Loose = true;
+	      }
+	    else if (!PrevBlank &&				// Lazy continuation
+		     !Mkd_GetListMarker (Line,&NestedMarker) &&	// of a paragraph
+		     !Mkd_CheckIfInterruptsParagraph (Line))
+	       ItemLines[NumItemLines] = *Line;
+	    else
+	       break;
+	    NumBlankLines = 0;
+	    PrevBlank = false;
+	   }
+	 NumItemLines++;
+	}
+
+      /* Remove blank lines at the end of item */
+      NumItemLines -= NumBlankLines;
+
+      /* Next item? */
+      if (NumLine < NumLines &&
+	  !Mkd_CheckIfThematicBreak (&Lines[NumLine]) &&
+	  Mkd_GetListMarker (&Lines[NumLine],&Marker) &&
+	  Marker.Type == FirstMarker.Type &&
+	  Marker.Chr  == FirstMarker.Chr)
+	{
+	 if (NumBlankLines)	// Blank lines between items make the list loose
+	    Loose = true;
+	}
+      else
+	{
+	 NumLine -= NumBlankLines;	// Blank lines after list are not in it
+	 break;
+	}
+     }
+   FirstItemLine[NumItems] = NumItemLines;
+
+   /***** Write list *****/
+   if (FirstMarker.Type == Mkd_LIST_BULLET)
+      fputs ("<ul>\n",Doc->FileHTML);
+   else if (FirstMarker.Start == 1)
+      fputs ("<ol>\n",Doc->FileHTML);
+   else
+      fprintf (Doc->FileHTML,"<ol start=\"%ld\">\n",FirstMarker.Start);
+   for (NumItem = 0;
+	NumItem < NumItems;
+	NumItem++)
+     {
+      fputs ("<li>",Doc->FileHTML);
+      if (Loose)
+	 fputc ('\n',Doc->FileHTML);
+      Mkd_WriteBlocks (Doc,&ItemLines[FirstItemLine[NumItem]],
+		       FirstItemLine[NumItem + 1] - FirstItemLine[NumItem],
+		       !Loose,Depth + 1);
+      fputs ("</li>\n",Doc->FileHTML);
+     }
+   fputs (FirstMarker.Type == Mkd_LIST_BULLET ? "</ul>\n" :
+					        "</ol>\n",
+	  Doc->FileHTML);
+
+   free (FirstItemLine);
+   free (ItemLines);
+
+   return NumLine;
+  }
+
+/*****************************************************************************/
+/***************************** Write a raw HTML block ************************/
+/*****************************************************************************/
+// Return the number of the line after the block
+
+static size_t Mkd_WriteHTMLBlock (struct Mkd_Doc *Doc,
+                                  const struct Mkd_Line *Lines,size_t NumLines,
+                                  size_t NumLine)
+  {
+   /***** Write lines as they are until a blank line *****/
+   for (;
+	NumLine < NumLines && !Mkd_CheckIfBlank (&Lines[NumLine]);
+	NumLine++)
+     {
+      fwrite (Lines[NumLine].Txt,1,Lines[NumLine].Len,Doc->FileHTML);
+      fputc ('\n',Doc->FileHTML);
+     }
+
+   return NumLine;
+  }
+
+/*****************************************************************************/
+/******************************* Write a table *******************************/
+/*****************************************************************************/
+// Return the number of the line after the table
+
+static size_t Mkd_WriteTable (struct Mkd_Doc *Doc,
+                              const struct Mkd_Line *Lines,size_t NumLines,
+                              size_t NumLine,
+                              const Mkd_Align_t Aligns[Mkd_MAX_TABLE_COLUMNS],
+                              unsigned NumCols)
+  {
+   unsigned NumRow;
+
+   /***** Write header row, skipping delimiter row *****/
+   fputs ("<table>\n"
+	  "<thead>\n",Doc->FileHTML);
+   Mkd_WriteTableRow (Doc,&Lines[NumLine],Aligns,NumCols,"header","th");
+   fputs ("</thead>\n",Doc->FileHTML);
+   NumLine += 2;
+
+   /***** Write body rows until a blank line or a line without pipes *****/
+   for (NumRow = 0;
+	NumLine < NumLines &&
+	!Mkd_CheckIfBlank (&Lines[NumLine]) &&
+	memchr (Lines[NumLine].Txt,'|',Lines[NumLine].Len);
+	NumLine++, NumRow++)
+     {
+      if (NumRow == 0)
+	 fputs ("<tbody>\n",Doc->FileHTML);
+      Mkd_WriteTableRow (Doc,&Lines[NumLine],Aligns,NumCols,
+			 (NumRow % 2) ? "even" :
+				        "odd",
+			 "td");
+     }
+   if (NumRow)
+      fputs ("</tbody>\n",Doc->FileHTML);
+   fputs ("</table>\n",Doc->FileHTML);
+
+   return NumLine;
+  }
+
+/*****************************************************************************/
+/***************************** Write a table row *****************************/
+/*****************************************************************************/
+
+static void Mkd_WriteTableRow (struct Mkd_Doc *Doc,const struct Mkd_Line *Line,
+                               const Mkd_Align_t Aligns[Mkd_MAX_TABLE_COLUMNS],
+                               unsigned NumCols,
+                               const char *ClassRow,const char *CellTag)
+  {
+   static const char *AlignStyle[] =
+     {
+      [Mkd_ALIGN_NONE  ] = "",
+      [Mkd_ALIGN_LEFT  ] = " style=\"text-align: left;\"",
+      [Mkd_ALIGN_CENTER] = " style=\"text-align: center;\"",
+      [Mkd_ALIGN_RIGHT ] = " style=\"text-align: right;\"",
+     };
+   struct Mkd_Cell Cells[Mkd_MAX_TABLE_COLUMNS];
+   unsigned NumCellsInRow = Mkd_SplitTableRow (Line,Cells);
+   unsigned NumCol;
+
+   fprintf (Doc->FileHTML,"<tr class=\"%s\">\n",ClassRow);
+   for (NumCol = 0;
+	NumCol < NumCols;
+	NumCol++)
+     {
+      fprintf (Doc->FileHTML,"<%s%s>",CellTag,AlignStyle[Aligns[NumCol]]);
+      if (NumCol < NumCellsInRow)	// Missing cells are empty
+	 Mkd_WriteInline (Doc,Cells[NumCol].Txt,Cells[NumCol].Len,false);
+      fprintf (Doc->FileHTML,"</%s>\n",CellTag);
+     }
+   fputs ("</tr>\n",Doc->FileHTML);
+  }
+
+/*****************************************************************************/
+/************************ Write a paragraph or heading ***********************/
+/*****************************************************************************/
+// Return the number of the line after the paragraph
+
+static size_t Mkd_WriteParagraph (struct Mkd_Doc *Doc,
+                                  const struct Mkd_Line *Lines,size_t NumLines,
+                                  size_t NumLine,bool Tight)
+  {
+   size_t FirstLine = NumLine;
+   unsigned Level;
+   char *Heading;
+   size_t Len;
+   size_t Pos;
+
+   /***** Get lines of paragraph.
+          First line is always in the paragraph *****/
+   for (NumLine++;
+	NumLine < NumLines;
+	NumLine++)
+     {
+      if (Mkd_CheckIfBlank (&Lines[NumLine]))
+	 break;
+
+      /* Setext heading: lines of text underlined by === or --- */
+      if ((Level = Mkd_GetSetextUnderline (&Lines[NumLine])))
+	{
+	 /* Join lines of heading */
+	 for (Pos = FirstLine, Len = 0;
+	      Pos < NumLine;
+	      Pos++)
+	    Len += Lines[Pos].Len + 1;
+	 if ((Heading = malloc (Len)) == NULL)
+	    Mkd_NotEnoughMemoryExit ();
+	 for (Pos = FirstLine, Len = 0;
+	      Pos < NumLine;
+	      Pos++)
+	   {
+	    if (Len)
+	       Heading[Len++] = ' ';
+	    memcpy (&Heading[Len],Lines[Pos].Txt,Lines[Pos].Len);
+	    Len += Lines[Pos].Len;
+	   }
+
+	 /* Remove spaces at start and end */
+	 for (Pos = 0;
+	      Pos < Len && Heading[Pos] == ' ';
+	      Pos++);
+	 while (Len > Pos && Heading[Len - 1] == ' ')
+	    Len--;
+
+	 Mkd_WriteHeading (Doc,Level,&Heading[Pos],Len - Pos);
+	 free (Heading);
+	 return NumLine + 1;
+	}
+
+      if (Mkd_GetIndent (&Lines[NumLine]) < 4 &&
+	  Mkd_CheckIfInterruptsParagraph (&Lines[NumLine]))
+	 break;
+     }
+
+   /***** Write paragraph *****/
+   if (!Tight)
+      fputs ("<p>",Doc->FileHTML);
+   Mkd_WriteLinesInline (Doc,&Lines[FirstLine],NumLine - FirstLine);
+   if (!Tight)
+      fputs ("</p>\n",Doc->FileHTML);
+
+   return NumLine;
+  }
+
+/*****************************************************************************/
+/****************************** Write a heading ******************************/
+/*****************************************************************************/
+
+static void Mkd_WriteHeading (struct Mkd_Doc *Doc,unsigned Level,
+                              const char *Txt,size_t Len)
+  {
+   fprintf (Doc->FileHTML,"<h%u id=\"",Level);
+   Mkd_WriteHeadingId (Doc,Txt,Len);
+   fputs ("\">",Doc->FileHTML);
+   Mkd_WriteInline (Doc,Txt,Len,false);
+   fprintf (Doc->FileHTML,"</h%u>\n",Level);
+  }
+
+/*****************************************************************************/
+/************************* Write identifier of heading ***********************/
+/*****************************************************************************/
+// The same identifier as pandoc: letters in lowercase, digits, '_', '-', '.',
+// spaces as '-', and nothing before the first letter.
+// Repeated identifiers get a suffix -1, -2...
+
+static void Mkd_WriteHeadingId (struct Mkd_Doc *Doc,const char *Txt,size_t Len)
+  {
+   char Id[Mkd_MAX_BYTES_ID + 1 + 16];
+   size_t IdLen = 0;
+   size_t Pos;
+   const char *End;
+   unsigned char Chr;
+   char Letter;
+   struct Mkd_Id *Ids;
+   struct Mkd_Id *UsedId;
+   bool LetterFound = false;
+
+   /***** Build identifier from text *****/
+   for (Pos = 0;
+	Pos < Len && IdLen < Mkd_MAX_BYTES_ID;
+	Pos++)
+     {
+      Chr = (unsigned char) Txt[Pos];
+
+      /* Skip URL of links and HTML tags */
+      if (Chr == ']' && Pos + 1 < Len && Txt[Pos + 1] == '(' &&
+	  (End = memchr (&Txt[Pos],')',Len - Pos)))
+	{
+	 Pos = (size_t) (End - Txt);
+	 continue;
+	}
+      if (Chr == '<' &&
+	  (End = memchr (&Txt[Pos],'>',Len - Pos)))
+	{
+	 Pos = (size_t) (End - Txt);
+	 continue;
+	}
+
+      if (Chr >= 0xC0)
+	 Letter = Mkd_LettersLatin1[Chr - 0xC0];
+      else if (isascii (Chr) && isalpha (Chr))
+	 Letter = (char) tolower (Chr);
+      else
+	 Letter = '\0';
+
+      if (Letter)
+	{
+	 Id[IdLen++] = Letter;
+	 LetterFound = true;
+	}
+      else if (LetterFound)
+	{
+	 if (isascii (Chr) && isdigit (Chr))
+	    Id[IdLen++] = (char) Chr;
+	 else if (Chr == '_' || Chr == '-' || Chr == '.')
+	    Id[IdLen++] = (char) Chr;
+	 else if (Chr == ' ' || Chr == '\n')
+	    Id[IdLen++] = '-';
+	}
+     }
+   while (IdLen && Id[IdLen - 1] == '-')
+      IdLen--;
+   if (IdLen == 0)
+     {
+      strcpy (Id,"section");
+      IdLen = strlen (Id);
+     }
+   Id[IdLen] = '\0';
+
+   /***** Add a suffix if identifier is already used *****/
+   if ((UsedId = Mkd_GetId (Doc,Id)))
+      do
+	 snprintf (&Id[IdLen],sizeof (Id) - IdLen,"-%u",++UsedId->NumUses);
+      while (Mkd_GetId (Doc,Id));
+
+   /***** Store identifier and write it *****/
+   if ((Ids = realloc (Doc->Ids,(Doc->NumIds + 1) * sizeof (struct Mkd_Id))) == NULL ||
+       (Ids[Doc->NumIds].Id = strdup (Id)) == NULL)
+      Mkd_NotEnoughMemoryExit ();
+   Ids[Doc->NumIds].NumUses = 0;
+   Doc->Ids = Ids;
+   Doc->NumIds++;
+   fputs (Id,Doc->FileHTML);
+  }
+
+/*****************************************************************************/
+/***************** Get an identifier already used in a heading ***************/
+/*****************************************************************************/
+// Return NULL if not used
+
+static struct Mkd_Id *Mkd_GetId (const struct Mkd_Doc *Doc,const char *Id)
+  {
+   unsigned NumId;
+
+   for (NumId = 0;
+	NumId < Doc->NumIds;
+	NumId++)
+      if (!strcmp (Doc->Ids[NumId].Id,Id))
+	 return &Doc->Ids[NumId];
+
+   return NULL;
+  }
+
+/*****************************************************************************/
+/************** Write lines of a paragraph as a single inline text ***********/
+/*****************************************************************************/
+// Lines are joined with '\n', without spaces at start and end of lines
+
+static void Mkd_WriteLinesInline (struct Mkd_Doc *Doc,
+                                  const struct Mkd_Line *Lines,size_t NumLines)
+  {
+   char *Txt;
+   size_t Len = 0;
+   size_t NumLine;
+   size_t Start;
+   size_t End;
+
+   /***** Join lines *****/
+   for (NumLine = 0;
+	NumLine < NumLines;
+	NumLine++)
+      Len += Lines[NumLine].Len + 1;
+   if ((Txt = malloc (Len)) == NULL)
+      Mkd_NotEnoughMemoryExit ();
+   for (NumLine = 0, Len = 0;
+	NumLine < NumLines;
+	NumLine++)
+     {
+      for (Start = 0;
+	   Start < Lines[NumLine].Len && Lines[NumLine].Txt[Start] == ' ';
+	   Start++);
+      for (End = Lines[NumLine].Len;
+	   End > Start && Lines[NumLine].Txt[End - 1] == ' ';
+	   End--);
+      if (NumLine)
+	 Txt[Len++] = '\n';
+      memcpy (&Txt[Len],&Lines[NumLine].Txt[Start],End - Start);
+      Len += End - Start;
+     }
+
+   /***** Write inline elements *****/
+   Mkd_WriteInline (Doc,Txt,Len,false);
+
+   free (Txt);
+  }
+
+/*****************************************************************************/
+/************************* Get indentation of a line *************************/
+/*****************************************************************************/
+
+static size_t Mkd_GetIndent (const struct Mkd_Line *Line)
+  {
+   size_t Indent;
+
+   for (Indent = 0;
+	Indent < Line->Len && Line->Txt[Indent] == ' ';
+	Indent++);
+
+   return Indent;
+  }
+
+/*****************************************************************************/
+/********************** Check if a line has only spaces **********************/
+/*****************************************************************************/
+
+static bool Mkd_CheckIfBlank (const struct Mkd_Line *Line)
+  {
+   return Mkd_GetIndent (Line) == Line->Len;
+  }
+
+/*****************************************************************************/
+/************** Check if a line is a thematic break (*** --- ___) ************/
+/*****************************************************************************/
+
+static bool Mkd_CheckIfThematicBreak (const struct Mkd_Line *Line)
+  {
+   size_t Pos = Mkd_GetIndent (Line);
+   char Chr;
+   unsigned NumChrs = 0;
+
+   if (Pos > 3 || Pos == Line->Len)
+      return false;
+
+   Chr = Line->Txt[Pos];
+   if (Chr != '*' && Chr != '-' && Chr != '_')
+      return false;
+   for (;
+	Pos < Line->Len;
+	Pos++)
+      if (Line->Txt[Pos] == Chr)
+	 NumChrs++;
+      else if (Line->Txt[Pos] != ' ')
+	 return false;
+
+   return NumChrs >= 3;
+  }
+
+/*****************************************************************************/
+/************************* Get an ATX heading (# ...) ************************/
+/*****************************************************************************/
+// Return level of heading (1 to 6), or 0 if the line is not a heading
+
+static unsigned Mkd_GetATXHeading (const struct Mkd_Line *Line,
+                                   const char **Txt,size_t *Len)
+  {
+   size_t Pos = Mkd_GetIndent (Line);
+   size_t Start;
+   size_t End;
+   size_t EndHashes;
+   unsigned Level;
+
+   if (Pos > 3)
+      return 0;
+
+   /***** Get opening sequence of '#' *****/
+   for (Level = 0;
+	Pos < Line->Len && Line->Txt[Pos] == '#';
+	Pos++)
+      Level++;
+   if (Level < 1 || Level > 6 ||
+       (Pos < Line->Len && Line->Txt[Pos] != ' '))
+      return 0;
+
+   /***** Get content without spaces and closing sequence of '#' *****/
+   for (Start = Pos;
+	Start < Line->Len && Line->Txt[Start] == ' ';
+	Start++);
+   for (End = Line->Len;
+	End > Start && Line->Txt[End - 1] == ' ';
+	End--);
+   for (EndHashes = End;
+	EndHashes > Start && Line->Txt[EndHashes - 1] == '#';
+	EndHashes--);
+   if (EndHashes == Start || Line->Txt[EndHashes - 1] == ' ')
+      for (End = EndHashes;
+	   End > Start && Line->Txt[End - 1] == ' ';
+	   End--);
+
+   *Txt = &Line->Txt[Start];
+   *Len = End - Start;
+   return Level;
+  }
+
+/*****************************************************************************/
+/*************** Get underline of a setext heading (=== or ---) **************/
+/*****************************************************************************/
+// Return level of heading (1 or 2), or 0 if the line is not an underline
+
+static unsigned Mkd_GetSetextUnderline (const struct Mkd_Line *Line)
+  {
+   size_t Pos = Mkd_GetIndent (Line);
+   char Chr;
+
+   if (Pos > 3 || Pos == Line->Len)
+      return 0;
+
+   Chr = Line->Txt[Pos];
+   if (Chr != '=' && Chr != '-')
+      return 0;
+   for (;
+	Pos < Line->Len && Line->Txt[Pos] == Chr;
+	Pos++);
+   for (;
+	Pos < Line->Len && Line->Txt[Pos] == ' ';
+	Pos++);
+   if (Pos < Line->Len)
+      return 0;
+
+   return Chr == '=' ? 1 :
+		       2;
+  }
+
+/*****************************************************************************/
+/************************ Get opening fence of code **************************/
+/*****************************************************************************/
+// Return length of fence (at least 3 '`' or '~'), or 0 if there is no fence
+
+static size_t Mkd_GetFence (const struct Mkd_Line *Line,char *FenceChr)
+  {
+   size_t Pos = Mkd_GetIndent (Line);
+   size_t Start = Pos;
+
+   if (Pos > 3 || Pos == Line->Len)
+      return 0;
+
+   *FenceChr = Line->Txt[Pos];
+   if (*FenceChr != '`' && *FenceChr != '~')
+      return 0;
+   for (;
+	Pos < Line->Len && Line->Txt[Pos] == *FenceChr;
+	Pos++);
+   if (Pos - Start < 3)
+      return 0;
+
+   /***** Info string after backticks can not contain backticks *****/
+   if (*FenceChr == '`' &&
+       memchr (&Line->Txt[Pos],'`',Line->Len - Pos))
+      return 0;
+
+   return Pos - Start;
+  }
+
+/*****************************************************************************/
+/********************* Get marker of a list item if any **********************/
+/*****************************************************************************/
+
+static bool Mkd_GetListMarker (const struct Mkd_Line *Line,
+                               struct Mkd_ListMarker *Marker)
+  {
+   size_t Pos = Mkd_GetIndent (Line);
+   size_t Start;
+   size_t Spaces;
+
+   if (Pos > 3 || Pos == Line->Len)
+      return false;
+
+   /***** Get marker *****/
+   Start = Pos;
+   switch (Line->Txt[Pos])
+     {
+      case '-':
+      case '+':
+      case '*':
+	 Marker->Type = Mkd_LIST_BULLET;
+	 Marker->Chr = Line->Txt[Pos++];
+	 Marker->Start = 1;
+	 break;
+      default:
+	 for (Marker->Start = 0;
+	      Pos < Line->Len && Pos - Start < 9 &&
+	      isascii ((unsigned char) Line->Txt[Pos]) &&
+	      isdigit ((unsigned char) Line->Txt[Pos]);
+	      Pos++)
+	    Marker->Start = Marker->Start * 10 + (Line->Txt[Pos] - '0');
+	 if (Pos == Start || Pos == Line->Len ||
+	     (Line->Txt[Pos] != '.' && Line->Txt[Pos] != ')'))
+	    return false;
+	 Marker->Type = Mkd_LIST_ORDERED;
+	 Marker->Chr = Line->Txt[Pos++];
+	 break;
+     }
+
+   /***** Get start of content *****/
+   if (Pos == Line->Len || Mkd_CheckIfBlank (&(struct Mkd_Line) {&Line->Txt[Pos],
+							     Line->Len - Pos}))
+     {
+      Marker->Empty = true;
+      Marker->Offset = Pos + 1;
+      return true;
+     }
+   if (Line->Txt[Pos] != ' ')
+      return false;
+
+   Marker->Empty = false;
+   for (Spaces = 0;
+	Pos + Spaces < Line->Len && Line->Txt[Pos + Spaces] == ' ';
+	Spaces++);
+   Marker->Offset = Pos + (Spaces > 4 ? 1 :	// Indented code in item
+					Spaces);
+   return true;
+  }
+
+/*****************************************************************************/
+/******************* Check if a line starts a raw HTML block *****************/
+/*****************************************************************************/
+
+static bool Mkd_CheckIfHTMLBlockStart (const struct Mkd_Line *Line)
+  {
+   size_t Pos = Mkd_GetIndent (Line);
+   size_t Start;
+   size_t TagLen;
+   const char **Tag;
+
+   if (Pos > 3 || Pos == Line->Len || Line->Txt[Pos] != '<')
+      return false;
+   Pos++;
+
+   /***** Comment *****/
+   if (Line->Len - Pos >= 3 && !strncmp (&Line->Txt[Pos],"!--",3))
+      return true;
+
+   /***** Opening or closing tag of a block element *****/
+   if (Pos < Line->Len && Line->Txt[Pos] == '/')
+      Pos++;
+   for (Start = Pos;
+	Pos < Line->Len &&
+	isascii ((unsigned char) Line->Txt[Pos]) &&
+	isalnum ((unsigned char) Line->Txt[Pos]);
+	Pos++);
+   if ((TagLen = Pos - Start) == 0 ||
+       (Pos < Line->Len &&
+	Line->Txt[Pos] != ' ' && Line->Txt[Pos] != '>' && Line->Txt[Pos] != '/'))
+      return false;
+   for (Tag = Mkd_HTMLBlockTags;
+	*Tag;
+	Tag++)
+      if (strlen (*Tag) == TagLen &&
+	  !strncasecmp (*Tag,&Line->Txt[Start],TagLen))
+	 return true;
+
+   return false;
+  }
+
+/*****************************************************************************/
+/******************** Check if a line starts a block quote *******************/
+/*****************************************************************************/
+
+static bool Mkd_CheckIfBlockQuoteStart (const struct Mkd_Line *Line)
+  {
+   size_t Pos = Mkd_GetIndent (Line);
+
+   return Pos <= 3 && Pos < Line->Len && Line->Txt[Pos] == '>';
+  }
+
+/*****************************************************************************/
+/***************** Check if a line starts a block that ends **************** */
+/***************** a paragraph without a blank line between ******************/
+/*****************************************************************************/
+
+static bool Mkd_CheckIfInterruptsParagraph (const struct Mkd_Line *Line)
+  {
+   const char *Txt;
+   size_t Len;
+   char FenceChr;
+   struct Mkd_ListMarker Marker;
+
+   if (Mkd_GetIndent (Line) > 3)
+      return false;
+
+   return Mkd_GetATXHeading (Line,&Txt,&Len) ||
+	  Mkd_GetFence (Line,&FenceChr) ||
+	  Mkd_CheckIfThematicBreak (Line) ||
+	  Mkd_CheckIfBlockQuoteStart (Line) ||
+	  Mkd_CheckIfHTMLBlockStart (Line) ||
+	  (Mkd_GetListMarker (Line,&Marker) &&	// Only non-empty items,
+	   !Marker.Empty &&			// and ordered lists starting at 1
+	   (Marker.Type == Mkd_LIST_BULLET || Marker.Start == 1));
+  }
+
+/*****************************************************************************/
+/********************** Split a row of a table in cells **********************/
+/*****************************************************************************/
+// Return the number of cells
+
+static unsigned Mkd_SplitTableRow (const struct Mkd_Line *Line,
+                                   struct Mkd_Cell Cells[Mkd_MAX_TABLE_COLUMNS])
+  {
+   size_t Pos = Mkd_GetIndent (Line);
+   size_t End = Line->Len;
+   size_t Start;
+   size_t CellEnd;
+   unsigned NumCells = 0;
+
+   if (Pos > 3 || !memchr (Line->Txt,'|',Line->Len))
+      return 0;
+
+   /***** Remove leading and trailing pipes *****/
+   while (End > Pos && Line->Txt[End - 1] == ' ')
+      End--;
+   if (Pos < End && Line->Txt[Pos] == '|')
+      Pos++;
+   if (End > Pos && Line->Txt[End - 1] == '|' &&
+       !(End - Pos >= 2 && Line->Txt[End - 2] == '\\'))
+      End--;
+
+   /***** Get cells between pipes not escaped *****/
+   while (Pos <= End && NumCells < Mkd_MAX_TABLE_COLUMNS)
+     {
+      for (Start = Pos;
+	   Pos < End && Line->Txt[Pos] != '|';
+	   Pos++)
+	 if (Line->Txt[Pos] == '\\' && Pos + 1 < End)
+	    Pos++;
+      for (CellEnd = Pos;
+	   CellEnd > Start && Line->Txt[CellEnd - 1] == ' ';
+	   CellEnd--);
+      for (;
+	   Start < CellEnd && Line->Txt[Start] == ' ';
+	   Start++);
+      Cells[NumCells].Txt = &Line->Txt[Start];
+      Cells[NumCells].Len = CellEnd - Start;
+      NumCells++;
+      Pos++;	// Skip pipe
+     }
+
+   return NumCells;
+  }
+
+/*****************************************************************************/
+/***************** Get alignments from delimiter row of a table **************/
+/*****************************************************************************/
+// Return the number of columns, or 0 if the line is not a delimiter row
+
+static unsigned Mkd_GetTableDelimiterRow (const struct Mkd_Line *Line,
+                                          Mkd_Align_t Aligns[Mkd_MAX_TABLE_COLUMNS])
+  {
+   struct Mkd_Cell Cells[Mkd_MAX_TABLE_COLUMNS];
+   unsigned NumCols = Mkd_SplitTableRow (Line,Cells);
+   unsigned NumCol;
+   size_t Pos;
+   size_t Len;
+   bool Left;
+   bool Right;
+
+   for (NumCol = 0;
+	NumCol < NumCols;
+	NumCol++)
+     {
+      Len = Cells[NumCol].Len;
+      if (Len == 0)
+	 return 0;
+      Left  = Cells[NumCol].Txt[0]       == ':';
+      Right = Cells[NumCol].Txt[Len - 1] == ':' && Len > 1;
+      for (Pos = Left ? 1 :
+			0;
+	   Pos < Len - (Right ? 1 :
+				0);
+	   Pos++)
+	 if (Cells[NumCol].Txt[Pos] != '-')
+	    return 0;
+      if (Pos == (Left ? 1 :
+			 0))	// No '-'
+	 return 0;
+      Aligns[NumCol] = Left ? (Right ? Mkd_ALIGN_CENTER :
+				       Mkd_ALIGN_LEFT) :
+			      (Right ? Mkd_ALIGN_RIGHT :
+				       Mkd_ALIGN_NONE);
+     }
+
+   return NumCols;
+  }
+
+/*****************************************************************************/
+/**************** Get definitions of references of links *********************/
+/*****************************************************************************/
+// Lines with definitions are emptied, so they are not written
+
+static void Mkd_GetRefDefinitions (struct Mkd_Doc *Doc,
+                                   struct Mkd_Line *Lines,size_t NumLines)
+  {
+   size_t NumLine;
+   char FenceChr = '\0';
+   size_t FenceLen = 0;
+   char ClosingChr;
+   bool CanStart = true;	// A definition can not interrupt a paragraph
+
+   for (NumLine = 0;
+	NumLine < NumLines;
+	NumLine++)
+     {
+      /***** Skip fenced code *****/
+      if (FenceLen)
+	{
+	 if (Mkd_GetFence (&Lines[NumLine],&ClosingChr) >= FenceLen &&
+	     ClosingChr == FenceChr)
+	   {
+	    FenceLen = 0;
+	    CanStart = true;
+	   }
+	 continue;
+	}
+      if ((FenceLen = Mkd_GetFence (&Lines[NumLine],&FenceChr)))
+	 continue;
+
+      /***** Get definition *****/
+      if (CanStart && Mkd_GetRefDefinition (Doc,&Lines[NumLine]))
+	 Lines[NumLine].Len = 0;
+      else
+	 CanStart = Mkd_CheckIfBlank (&Lines[NumLine]);
+     }
+  }
+
+/*****************************************************************************/
+/************* Get a definition of a reference in a line if any **************/
+/*****************************************************************************/
+// [label]: URL "title"
+
+static bool Mkd_GetRefDefinition (struct Mkd_Doc *Doc,const struct Mkd_Line *Line)
+  {
+   const char *Txt = Line->Txt;
+   size_t Len = Line->Len;
+   size_t Pos = Mkd_GetIndent (Line);
+   size_t LabelStart;
+   size_t LabelEnd;
+   size_t URLStart;
+   size_t URLEnd;
+   size_t TitleStart = 0;
+   size_t TitleEnd = 0;
+   bool HasTitle = false;
+   char Close;
+   char *Label;
+   struct Mkd_Ref *Refs;
+
+   if (Pos > 3 || Pos == Len || Txt[Pos] != '[')
+      return false;
+
+   /***** Get label *****/
+   for (LabelStart = ++Pos;
+	Pos < Len && Txt[Pos] != ']';
+	Pos++)
+      if (Txt[Pos] == '[')
+	 return false;
+      else if (Txt[Pos] == '\\' && Pos + 1 < Len)
+	 Pos++;
+   if (Pos == Len || Pos - LabelStart > Mkd_MAX_BYTES_LINK_TEXT)
+      return false;
+   LabelEnd = Pos++;
+   if (Pos == Len || Txt[Pos++] != ':')
+      return false;
+
+   /***** Get URL *****/
+   for (;
+	Pos < Len && Txt[Pos] == ' ';
+	Pos++);
+   if (Pos == Len)
+      return false;
+   if (Txt[Pos] == '<')
+     {
+      for (URLStart = ++Pos;
+	   Pos < Len && Txt[Pos] != '>';
+	   Pos++);
+      if (Pos == Len)
+	 return false;
+      URLEnd = Pos++;
+     }
+   else
+     {
+      for (URLStart = Pos;
+	   Pos < Len && Txt[Pos] != ' ';
+	   Pos++);
+      URLEnd = Pos;
+     }
+
+   /***** Get optional title *****/
+   for (;
+	Pos < Len && Txt[Pos] == ' ';
+	Pos++);
+   if (Pos < Len)
+     {
+      switch (Txt[Pos])
+	{
+	 case '"':
+	 case '\'':
+	    Close = Txt[Pos];
+	    break;
+	 case '(':
+	    Close = ')';
+	    break;
+	 default:
+	    return false;
+	}
+      for (TitleStart = ++Pos;
+	   Pos < Len && Txt[Pos] != Close;
+	   Pos++)
+	 if (Txt[Pos] == '\\' && Pos + 1 < Len)
+	    Pos++;
+      if (Pos == Len)
+	 return false;
+      TitleEnd = Pos++;
+      HasTitle = true;
+      for (;
+	   Pos < Len && Txt[Pos] == ' ';
+	   Pos++);
+      if (Pos < Len)
+	 return false;
+     }
+
+   /***** Store reference. If label is repeated, first definition is used *****/
+   Label = Mkd_NormalizeLabel (&Txt[LabelStart],LabelEnd - LabelStart);
+   if (!Label[0])
+     {
+      free (Label);
+      return false;
+     }
+   if (Mkd_GetRef (Doc,&Txt[LabelStart],LabelEnd - LabelStart))
+     {
+      free (Label);
+      return true;
+     }
+   if ((Refs = realloc (Doc->Refs,(Doc->NumRefs + 1) * sizeof (struct Mkd_Ref))) == NULL)
+      Mkd_NotEnoughMemoryExit ();
+   Doc->Refs = Refs;
+   Refs[Doc->NumRefs].Label = Label;
+   Refs[Doc->NumRefs].URL   = Mkd_CopyUnescaped (&Txt[URLStart],URLEnd - URLStart);
+   Refs[Doc->NumRefs].Title = HasTitle ? Mkd_CopyUnescaped (&Txt[TitleStart],
+							    TitleEnd - TitleStart) :
+					 NULL;
+   Doc->NumRefs++;
+
+   return true;
+  }
+
+/*****************************************************************************/
+/******* Normalize a label: lowercase and spaces collapsed into one **********/
+/*****************************************************************************/
+// Returned string must be freed by caller
+
+static char *Mkd_NormalizeLabel (const char *Txt,size_t Len)
+  {
+   char *Label;
+   size_t Pos;
+   size_t LabelLen = 0;
+   bool Space = false;
+
+   if ((Label = malloc (Len + 1)) == NULL)
+      Mkd_NotEnoughMemoryExit ();
+   for (Pos = 0;
+	Pos < Len;
+	Pos++)
+      if (Txt[Pos] == ' ' || Txt[Pos] == '\n')
+	 Space = true;
+      else
+	{
+	 if (Space && LabelLen)
+	    Label[LabelLen++] = ' ';
+	 Space = false;
+	 Label[LabelLen++] = (char) tolower ((unsigned char) Txt[Pos]);
+	}
+   Label[LabelLen] = '\0';
+
+   return Label;
+  }
+
+/*****************************************************************************/
+/*********************** Get the reference of a label ************************/
+/*****************************************************************************/
+// Return NULL if not found
+
+static const struct Mkd_Ref *Mkd_GetRef (const struct Mkd_Doc *Doc,
+                                         const char *Txt,size_t Len)
+  {
+   char *Label;
+   unsigned NumRef;
+   const struct Mkd_Ref *Ref = NULL;
+
+   if (Doc->NumRefs == 0)
+      return NULL;
+
+   Label = Mkd_NormalizeLabel (Txt,Len);
+   for (NumRef = 0;
+	NumRef < Doc->NumRefs;
+	NumRef++)
+      if (!strcmp (Doc->Refs[NumRef].Label,Label))
+	{
+	 Ref = &Doc->Refs[NumRef];
+	 break;
+	}
+   free (Label);
+
+   return Ref;
+  }
+
+/*****************************************************************************/
+/************************** Write inline elements ****************************/
+/*****************************************************************************/
+// InLink: inside the text of a link, where links are not written
+
+static void Mkd_WriteInline (struct Mkd_Doc *Doc,const char *Txt,size_t Len,
+                             bool InLink)
+  {
+   struct Mkd_Inline Memo;
+   size_t Pos = 0;
+   size_t Start;
+   size_t Next;
+   unsigned i;
+   unsigned j;
+
+   /***** Nothing has been searched yet *****/
+   for (i = 0;
+	i < 2;
+	i++)
+      for (j = 0;
+	   j < 3;
+	   j++)
+	 Memo.NoEmph[i][j] = Mkd_NOT_FOUND;
+   for (i = 0;
+	i < Mkd_MAX_BACKTICKS_MEMO;
+	i++)
+      Memo.NoCode[i] = Mkd_NOT_FOUND;
+   Memo.NoStrike      = Mkd_NOT_FOUND;
+   Memo.NoMath        = Mkd_NOT_FOUND;
+   Memo.NoDisplayMath = Mkd_NOT_FOUND;
+
+   Doc->InlineDepth++;
+   while (Pos < Len)
+     {
+      /***** Write plain text until a character that may start an element *****/
+      for (Start = Pos;
+	   Pos < Len &&
+	   !strchr ("\\`$*_~![<&>\n",Txt[Pos]) &&
+	   !(!InLink &&
+	     (Txt[Pos] == 'h' || Txt[Pos] == 'f' || Txt[Pos] == 'w') &&
+	     (Pos == 0 || !isalnum ((unsigned char) Txt[Pos - 1])));
+	   Pos++);
+      fwrite (&Txt[Start],1,Pos - Start,Doc->FileHTML);
+      if (Pos == Len)
+	 break;
+
+      /***** Write element *****/
+      Next = Pos;
+      switch (Txt[Pos])
+	{
+	 case '\\':
+	    if (Pos + 1 < Len)
+	      {
+	       if (Txt[Pos + 1] == '\n')
+		 {
+		  fputs ("<br />\n",Doc->FileHTML);
+		  Next = Pos + 2;
+		 }
+	       else if (isascii ((unsigned char) Txt[Pos + 1]) &&
+			ispunct ((unsigned char) Txt[Pos + 1]))
+		 {
+		  Mkd_WriteEscaped (Doc->FileHTML,&Txt[Pos + 1],1);
+		  Next = Pos + 2;
+		 }
+	      }
+	    break;
+	 case '`':
+	    Next = Mkd_WriteCodeSpan (Doc,Txt,Len,Pos,&Memo);
+	    break;
+	 case '$':
+	    Next = Mkd_WriteMath (Doc,Txt,Len,Pos,&Memo);
+	    break;
+	 case '*':
+	 case '_':
+	    Next = Mkd_WriteEmphasis (Doc,Txt,Len,Pos,InLink,&Memo);
+	    break;
+	 case '~':
+	    Next = Mkd_WriteStrikeout (Doc,Txt,Len,Pos,InLink,&Memo);
+	    break;
+	 case '!':
+	    if (!InLink && Pos + 1 < Len && Txt[Pos + 1] == '[')
+	       Next = Mkd_WriteLinkOrImage (Doc,Txt,Len,Pos,true);
+	    break;
+	 case '[':
+	    if (!InLink)
+	       Next = Mkd_WriteLinkOrImage (Doc,Txt,Len,Pos,false);
+	    break;
+	 case '<':
+	    Next = Mkd_WriteAngleBrackets (Doc,Txt,Len,Pos,InLink);
+	    break;
+	 case '&':
+	    if ((Next = Mkd_GetEntityLength (Txt,Len,Pos)))
+	      {
+	       fwrite (&Txt[Pos],1,Next,Doc->FileHTML);	// Entity as it is
+	       Next += Pos;
+	      }
+	    else
+	      {
+	       fputs ("&amp;",Doc->FileHTML);
+	       Next = Pos + 1;
+	      }
+	    break;
+	 case '>':
+	    fputs ("&gt;",Doc->FileHTML);
+	    Next = Pos + 1;
+	    break;
+	 case '\n':
+	    fputs ("<br />\n",Doc->FileHTML);
+	    Next = Pos + 1;
+	    break;
+	 default:	// Start of a word
+	    Next = Mkd_WriteBareURL (Doc,Txt,Len,Pos);
+	    break;
+	}
+
+      /***** Nothing special: write the character *****/
+      if (Next == Pos)
+	{
+	 fputc (Txt[Pos],Doc->FileHTML);
+	 Next = Pos + 1;
+	}
+      Pos = Next;
+     }
+   Doc->InlineDepth--;
+  }
+
+/*****************************************************************************/
+/**************************** Write a code span ******************************/
+/*****************************************************************************/
+// Return the position after the written text
+
+static size_t Mkd_WriteCodeSpan (struct Mkd_Doc *Doc,const char *Txt,size_t Len,
+                                 size_t Pos,struct Mkd_Inline *Memo)
+  {
+   size_t NumBackticks = Mkd_GetRunLength (Txt,Len,Pos);
+   size_t From = Pos + NumBackticks;
+   size_t End = Mkd_NOT_FOUND;
+   size_t Start;
+   size_t ContentEnd;
+   const char *NewLine;
+
+   /***** Find closing backticks *****/
+   if (NumBackticks > Mkd_MAX_BACKTICKS_MEMO)
+      End = Mkd_FindCodeSpanEnd (Txt,Len,From,NumBackticks);
+   else if (From < Memo->NoCode[NumBackticks - 1])
+      if ((End = Mkd_FindCodeSpanEnd (Txt,Len,From,NumBackticks)) == Mkd_NOT_FOUND)
+	 Memo->NoCode[NumBackticks - 1] = From;
+   if (End == Mkd_NOT_FOUND)
+     {
+      fwrite (&Txt[Pos],1,NumBackticks,Doc->FileHTML);
+      return From;
+     }
+
+   /***** Write code without spaces at start and end,
+          and with newlines as spaces *****/
+   for (Start = From;
+	Start < End && (Txt[Start] == ' ' || Txt[Start] == '\n');
+	Start++);
+   for (ContentEnd = End;
+	ContentEnd > Start && (Txt[ContentEnd - 1] == ' ' || Txt[ContentEnd - 1] == '\n');
+	ContentEnd--);
+   fputs ("<code>",Doc->FileHTML);
+   while ((NewLine = memchr (&Txt[Start],'\n',ContentEnd - Start)))
+     {
+      Mkd_WriteEscaped (Doc->FileHTML,&Txt[Start],(size_t) (NewLine - &Txt[Start]));
+      fputc (' ',Doc->FileHTML);
+      Start = (size_t) (NewLine - Txt) + 1;
+     }
+   Mkd_WriteEscaped (Doc->FileHTML,&Txt[Start],ContentEnd - Start);
+   fputs ("</code>",Doc->FileHTML);
+
+   return End + NumBackticks;
+  }
+
+/*****************************************************************************/
+/************************* Write TeX math for MathJax ************************/
+/*****************************************************************************/
+// Return the position after the written text, or Pos if there is no math
+
+static size_t Mkd_WriteMath (struct Mkd_Doc *Doc,const char *Txt,size_t Len,
+                             size_t Pos,struct Mkd_Inline *Memo)
+  {
+   size_t From;
+   size_t End;
+
+   if (Pos + 1 < Len && Txt[Pos + 1] == '$')
+     {
+      /***** Display math: $$...$$ *****/
+      From = Pos + 2;
+      if (From < Memo->NoDisplayMath)
+	 for (End = From;
+	      End + 1 < Len;
+	      End++)
+	    if (Txt[End] == '$' && Txt[End + 1] == '$')
+	      {
+	       fputs ("<span class=\"math display\">\\[",Doc->FileHTML);
+	       Mkd_WriteEscaped (Doc->FileHTML,&Txt[From],End - From);
+	       fputs ("\\]</span>",Doc->FileHTML);
+	       return End + 2;
+	      }
+      Memo->NoDisplayMath = From;
+      fputs ("$$",Doc->FileHTML);
+      return From;
+     }
+
+   /***** Inline math: $...$, without spaces after opening $,
+          nor before closing $, nor digits after closing $ *****/
+   From = Pos + 1;
+   if (From == Len || Txt[From] == ' ' || Txt[From] == '\n')
+      return Pos;
+   if (From < Memo->NoMath)
+     {
+      for (End = From + 1;
+	   End < Len;
+	   End++)
+	 if (Txt[End] == '$' &&
+	     Txt[End - 1] != ' ' && Txt[End - 1] != '\n' && Txt[End - 1] != '\\' &&
+	     !(End + 1 < Len && isascii ((unsigned char) Txt[End + 1]) &&
+				isdigit ((unsigned char) Txt[End + 1])))
+	   {
+	    fputs ("<span class=\"math inline\">\\(",Doc->FileHTML);
+	    Mkd_WriteEscaped (Doc->FileHTML,&Txt[From],End - From);
+	    fputs ("\\)</span>",Doc->FileHTML);
+	    return End + 1;
+	   }
+      Memo->NoMath = From;
+     }
+
+   return Pos;
+  }
+
+/*****************************************************************************/
+/******************** Write emphasis (*em*, **strong**) **********************/
+/*****************************************************************************/
+// Return the position after the written text
+
+static size_t Mkd_WriteEmphasis (struct Mkd_Doc *Doc,const char *Txt,size_t Len,
+                                 size_t Pos,bool InLink,struct Mkd_Inline *Memo)
+  {
+   static const char *OpeningTags[3] =
+     {
+      "<em>",
+      "<strong>",
+      "<strong><em>",
+     };
+   static const char *ClosingTags[3] =
+     {
+      "</em>",
+      "</strong>",
+      "</em></strong>",
+     };
+   char Chr = Txt[Pos];
+   unsigned NumChr = (Chr == '*') ? 0 :
+				    1;
+   size_t RunLen = Mkd_GetRunLength (Txt,Len,Pos);
+   size_t From = Pos + RunLen;
+   size_t NumChrs;
+   size_t End = Mkd_NOT_FOUND;
+
+   /***** Find closing run with the same number of characters,
+          or with less characters if not found *****/
+   if (Doc->InlineDepth < Mkd_MAX_DEPTH &&
+       From < Len && Txt[From] != ' ' && Txt[From] != '\n' &&
+       !(Chr == '_' && Pos && isalnum ((unsigned char) Txt[Pos - 1])))	// Not intraword
+      for (NumChrs = (RunLen < 3) ? RunLen :
+				    3;
+	   NumChrs;
+	   NumChrs--)
+	 if (From < Memo->NoEmph[NumChr][NumChrs - 1])
+	   {
+	    if ((End = Mkd_FindEmphCloser (Txt,Len,From,Chr,NumChrs)) != Mkd_NOT_FOUND)
+	       break;
+	    Memo->NoEmph[NumChr][NumChrs - 1] = From;
+	   }
+   if (End == Mkd_NOT_FOUND)
+     {
+      fwrite (&Txt[Pos],1,RunLen,Doc->FileHTML);
+      return From;
+     }
+
+   /***** Write emphasized text.
+          Opening characters not closed are written as they are *****/
+   fwrite (&Txt[Pos],1,RunLen - NumChrs,Doc->FileHTML);
+   fputs (OpeningTags[NumChrs - 1],Doc->FileHTML);
+   Mkd_WriteInline (Doc,&Txt[From],End - From,InLink);
+   fputs (ClosingTags[NumChrs - 1],Doc->FileHTML);
+
+   return End + NumChrs;
+  }
+
+/*****************************************************************************/
+/************************ Write strikeout (~~text~~) *************************/
+/*****************************************************************************/
+// Return the position after the written text
+
+static size_t Mkd_WriteStrikeout (struct Mkd_Doc *Doc,const char *Txt,size_t Len,
+                                  size_t Pos,bool InLink,struct Mkd_Inline *Memo)
+  {
+   size_t RunLen = Mkd_GetRunLength (Txt,Len,Pos);
+   size_t From = Pos + RunLen;
+   size_t End = Mkd_NOT_FOUND;
+
+   if (RunLen == 2 &&
+       Doc->InlineDepth < Mkd_MAX_DEPTH &&
+       From < Len && Txt[From] != ' ' && Txt[From] != '\n' &&
+       From < Memo->NoStrike)
+      if ((End = Mkd_FindEmphCloser (Txt,Len,From,'~',2)) == Mkd_NOT_FOUND)
+	 Memo->NoStrike = From;
+   if (End == Mkd_NOT_FOUND)
+     {
+      fwrite (&Txt[Pos],1,RunLen,Doc->FileHTML);
+      return From;
+     }
+
+   fputs ("<del>",Doc->FileHTML);
+   Mkd_WriteInline (Doc,&Txt[From],End - From,InLink);
+   fputs ("</del>",Doc->FileHTML);
+
+   return End + 2;
+  }
+
+/*****************************************************************************/
+/**************************** Write a link or image **************************/
+/*****************************************************************************/
+// Return the position after the written text, or Pos if there is no link
+
+static size_t Mkd_WriteLinkOrImage (struct Mkd_Doc *Doc,const char *Txt,size_t Len,
+                                    size_t Pos,bool Image)
+  {
+   struct Mkd_Link Link;
+   const struct Mkd_Ref *Ref = NULL;
+   size_t Open = Image ? Pos + 1 :
+			 Pos;
+   size_t Close;
+   size_t CloseLabel;
+   const char *URL;
+   const char *Title;
+
+   if (Doc->InlineDepth >= Mkd_MAX_DEPTH ||
+       (Close = Mkd_FindClosingBracket (Txt,Len,Open)) == Mkd_NOT_FOUND)
+      return Pos;
+   Link.TxtStart = Open + 1;
+   Link.TxtLen   = Close - Link.TxtStart;
+   Link.URL      = NULL;
+   Link.Title    = NULL;
+
+   /***** Get destination *****/
+   if (Close + 1 < Len && Txt[Close + 1] == '(' &&
+       Mkd_GetLinkDestination (Txt,Len,Close + 1,&Link))
+     {
+      // Inline link: [text](URL "title")
+     }
+   else if (Close + 1 < Len && Txt[Close + 1] == '[' &&
+	    (CloseLabel = Mkd_FindClosingBracket (Txt,Len,Close + 1)) != Mkd_NOT_FOUND)
+     {
+      // Full reference [text][label] or collapsed reference [label][]
+      Ref = (CloseLabel == Close + 2) ? Mkd_GetRef (Doc,&Txt[Link.TxtStart],Link.TxtLen) :
+				        Mkd_GetRef (Doc,&Txt[Close + 2],CloseLabel - Close - 2);
+      Link.End = CloseLabel + 1;
+     }
+   else
+     {
+      // Shortcut reference [label]
+      Ref = Mkd_GetRef (Doc,&Txt[Link.TxtStart],Link.TxtLen);
+      Link.End = Close + 1;
+     }
+   if (Link.URL)
+     {
+      URL   = Link.URL;
+      Title = Link.Title;
+     }
+   else if (Ref)
+     {
+      URL   = Ref->URL;
+      Title = Ref->Title;
+     }
+   else
+      return Pos;
+
+   /***** Write link or image *****/
+   if (Image)
+     {
+      fputs ("<img src=\"",Doc->FileHTML);
+      Mkd_WriteEscaped (Doc->FileHTML,URL,strlen (URL));
+      fputs ("\" alt=\"",Doc->FileHTML);
+      Mkd_WritePlainText (Doc->FileHTML,&Txt[Link.TxtStart],Link.TxtLen);
+      fputc ('"',Doc->FileHTML);
+     }
+   else
+     {
+      fputs ("<a href=\"",Doc->FileHTML);
+      Mkd_WriteEscaped (Doc->FileHTML,URL,strlen (URL));
+      fputc ('"',Doc->FileHTML);
+     }
+   if (Title)
+     {
+      fputs (" title=\"",Doc->FileHTML);
+      Mkd_WriteEscaped (Doc->FileHTML,Title,strlen (Title));
+      fputc ('"',Doc->FileHTML);
+     }
+   if (Image)
+      fputs (" />",Doc->FileHTML);
+   else
+     {
+      fputc ('>',Doc->FileHTML);
+      Mkd_WriteInline (Doc,&Txt[Link.TxtStart],Link.TxtLen,true);
+      fputs ("</a>",Doc->FileHTML);
+     }
+
+   free (Link.URL);
+   free (Link.Title);
+
+   return Link.End;
+  }
+
+/*****************************************************************************/
+/*********** Write text starting by '<': autolink, HTML tag or '<' ***********/
+/*****************************************************************************/
+// Return the position after the written text
+
+static size_t Mkd_WriteAngleBrackets (struct Mkd_Doc *Doc,const char *Txt,size_t Len,
+                                      size_t Pos,bool InLink)
+  {
+   size_t Start = Pos + 1;
+   size_t End;
+   size_t Limit = (Len - Start > Mkd_MAX_BYTES_HTML_TAG) ? Start + Mkd_MAX_BYTES_HTML_TAG :
+							    Len;
+   const char *Ptr;
+   bool Email = false;
+
+   /***** Autolink: <scheme:...> *****/
+   for (End = Start;
+	End < Limit && End - Start <= 32 &&
+	isascii ((unsigned char) Txt[End]) &&
+	(isalnum ((unsigned char) Txt[End]) ||
+	 Txt[End] == '+' || Txt[End] == '.' || Txt[End] == '-');
+	End++);
+   if (End - Start >= 2 && isalpha ((unsigned char) Txt[Start]) &&
+       End < Limit && Txt[End] == ':')
+     {
+      for (;
+	   End < Limit && Txt[End] != '>';
+	   End++)
+	 if (Txt[End] == '<' || Txt[End] == ' ' || Txt[End] == '\n')
+	   {
+	    End = Limit;
+	    break;
+	   }
+     }
+   else
+     {
+      /***** Autolink: <email@address> *****/
+      for (End = Start;
+	   End < Limit &&
+	   ((isascii ((unsigned char) Txt[End]) && isalnum ((unsigned char) Txt[End])) ||
+	    strchr (".!#$%&'*+/=?^_`{|}~-",Txt[End]));
+	   End++);
+      if (End > Start && End < Limit && Txt[End] == '@')
+	{
+	 for (End++;
+	      End < Limit &&
+	      ((isascii ((unsigned char) Txt[End]) && isalnum ((unsigned char) Txt[End])) ||
+	       Txt[End] == '.' || Txt[End] == '-');
+	      End++);
+	 Email = (Txt[End - 1] != '@');
+	}
+      if (!Email)
+	 End = Limit;
+     }
+   if (End < Limit && Txt[End] == '>')
+     {
+      if (InLink)
+	 Mkd_WriteEscaped (Doc->FileHTML,&Txt[Start],End - Start);
+      else
+	{
+	 fputs ("<a href=\"",Doc->FileHTML);
+	 if (Email)
+	    fputs ("mailto:",Doc->FileHTML);
+	 Mkd_WriteEscaped (Doc->FileHTML,&Txt[Start],End - Start);
+	 fputs (Email ? "\" class=\"email\">" :
+		        "\" class=\"uri\">",Doc->FileHTML);
+	 Mkd_WriteEscaped (Doc->FileHTML,&Txt[Start],End - Start);
+	 fputs ("</a>",Doc->FileHTML);
+	}
+      return End + 1;
+     }
+
+   /***** Raw HTML: comment or tag *****/
+   if (Limit - Start >= 3 && !strncmp (&Txt[Start],"!--",3))
+      for (End = Start + 3;
+	   End + 3 <= Limit;
+	   End++)
+	 if (!strncmp (&Txt[End],"-->",3))
+	   {
+	    fwrite (&Txt[Pos],1,End + 3 - Pos,Doc->FileHTML);
+	    return End + 3;
+	   }
+   End = Start;
+   if (End < Limit && Txt[End] == '/')
+      End++;
+   if (End < Limit &&
+       isascii ((unsigned char) Txt[End]) && isalpha ((unsigned char) Txt[End]) &&
+       (Ptr = memchr (&Txt[End],'>',Limit - End)) &&
+       !memchr (&Txt[End],'<',(size_t) (Ptr - &Txt[End])))
+     {
+      End = (size_t) (Ptr - Txt) + 1;
+      fwrite (&Txt[Pos],1,End - Pos,Doc->FileHTML);
+      return End;
+     }
+
+   /***** Just a '<' *****/
+   fputs ("&lt;",Doc->FileHTML);
+   return Pos + 1;
+  }
+
+/*****************************************************************************/
+/******************* Write a bare URL (http://..., www....) ******************/
+/*****************************************************************************/
+// Return the position after the written text, or Pos if there is no URL
+
+static size_t Mkd_WriteBareURL (struct Mkd_Doc *Doc,const char *Txt,size_t Len,
+                                size_t Pos)
+  {
+   static const char *Prefixes[] =
+     {
+      "http://",
+      "https://",
+      "ftp://",
+      "www.",
+      NULL
+     };
+   const char **Prefix;
+   size_t PrefixLen = 0;
+   size_t End;
+   size_t i;
+   unsigned OpenParens;
+   unsigned CloseParens;
+
+   /***** Check prefix *****/
+   for (Prefix = Prefixes;
+	*Prefix;
+	Prefix++)
+     {
+      PrefixLen = strlen (*Prefix);
+      if (Len - Pos > PrefixLen &&
+	  !strncasecmp (&Txt[Pos],*Prefix,PrefixLen))
+	 break;
+     }
+   if (!*Prefix)
+      return Pos;
+
+   /***** Get end of URL,
+          without punctuation at end and unbalanced parenthesis *****/
+   for (End = Pos + PrefixLen;
+	End < Len && Txt[End] != ' ' && Txt[End] != '\n' && Txt[End] != '<';
+	End++);
+   while (End > Pos + PrefixLen)
+      if (strchr (".,:;!?\"'*_~",Txt[End - 1]))
+	 End--;
+      else if (Txt[End - 1] == ')')
+	{
+	 for (i = Pos, OpenParens = CloseParens = 0;
+	      i < End;
+	      i++)
+	    if (Txt[i] == '(')
+	       OpenParens++;
+	    else if (Txt[i] == ')')
+	       CloseParens++;
+	 if (CloseParens <= OpenParens)
+	    break;
+	 End--;
+	}
+      else
+	 break;
+   if (End == Pos + PrefixLen)
+      return Pos;
+
+   /***** Write link *****/
+   fputs ("<a href=\"",Doc->FileHTML);
+   if (Txt[Pos] == 'w' || Txt[Pos] == 'W')
+      fputs ("http://",Doc->FileHTML);
+   Mkd_WriteEscaped (Doc->FileHTML,&Txt[Pos],End - Pos);
+   fputs ("\" class=\"uri\">",Doc->FileHTML);
+   Mkd_WriteEscaped (Doc->FileHTML,&Txt[Pos],End - Pos);
+   fputs ("</a>",Doc->FileHTML);
+
+   return End;
+  }
+
+/*****************************************************************************/
+/******************* Find the closing backticks of a code span ***************/
+/*****************************************************************************/
+// Return the position of a run of exactly NumBackticks backticks from Pos
+
+static size_t Mkd_FindCodeSpanEnd (const char *Txt,size_t Len,size_t Pos,
+                                   size_t NumBackticks)
+  {
+   const char *Ptr;
+   size_t RunLen;
+
+   while (Pos < Len && (Ptr = memchr (&Txt[Pos],'`',Len - Pos)))
+     {
+      Pos = (size_t) (Ptr - Txt);
+      if ((RunLen = Mkd_GetRunLength (Txt,Len,Pos)) == NumBackticks)
+	 return Pos;
+      Pos += RunLen;
+     }
+
+   return Mkd_NOT_FOUND;
+  }
+
+/*****************************************************************************/
+/********************* Find the closing run of emphasis **********************/
+/*****************************************************************************/
+// Return the position of a run of exactly RunLen characters Chr from From,
+// after a non-space character
+
+static size_t Mkd_FindEmphCloser (const char *Txt,size_t Len,size_t From,
+                                  char Chr,size_t RunLen)
+  {
+   size_t Pos = From;
+   size_t Run;
+
+   while (Pos < Len)
+      if (Txt[Pos] == Chr)
+	{
+	 Run = Mkd_GetRunLength (Txt,Len,Pos);
+	 if (Run == RunLen && Pos > From &&
+	     Txt[Pos - 1] != ' ' && Txt[Pos - 1] != '\n' &&
+	     !(Chr == '_' && Pos + Run < Len &&		// Not intraword
+	       isalnum ((unsigned char) Txt[Pos + Run])))
+	    return Pos;
+	 Pos += Run;
+	}
+      else if (Txt[Pos] == '\\')
+	 Pos += 2;
+      else
+	 Pos++;
+
+   return Mkd_NOT_FOUND;
+  }
+
+/*****************************************************************************/
+/************************ Find the closing bracket ***************************/
+/*****************************************************************************/
+// Pos is the position of '['
+// Return the position of the matching ']'
+
+static size_t Mkd_FindClosingBracket (const char *Txt,size_t Len,size_t Pos)
+  {
+   unsigned Level = 0;
+   size_t End;
+
+   for (End = Pos + 1;
+	End < Len && End - Pos <= Mkd_MAX_BYTES_LINK_TEXT;
+	End++)
+      switch (Txt[End])
+	{
+	 case '\\':
+	    End++;
+	    break;
+	 case '[':
+	    Level++;
+	    break;
+	 case ']':
+	    if (Level == 0)
+	       return End;
+	    Level--;
+	    break;
+	}
+
+   return Mkd_NOT_FOUND;
+  }
+
+/*****************************************************************************/
+/************** Get destination of an inline link: (URL "title") *************/
+/*****************************************************************************/
+// Pos is the position of '('
+
+static bool Mkd_GetLinkDestination (const char *Txt,size_t Len,size_t Pos,
+                                    struct Mkd_Link *Link)
+  {
+   size_t Limit = (Len - Pos > Mkd_MAX_BYTES_LINK_DEST) ? Pos + Mkd_MAX_BYTES_LINK_DEST :
+							  Len;
+   size_t URLStart;
+   size_t URLEnd;
+   size_t TitleStart = 0;
+   size_t TitleEnd = 0;
+   bool HasTitle = false;
+   unsigned Parens = 0;
+   char Close;
+
+   /***** Get URL *****/
+   for (Pos++;
+	Pos < Limit && (Txt[Pos] == ' ' || Txt[Pos] == '\n');
+	Pos++);
+   if (Pos < Limit && Txt[Pos] == '<')
+     {
+      for (URLStart = ++Pos;
+	   Pos < Limit && Txt[Pos] != '>' && Txt[Pos] != '\n';
+	   Pos++)
+	 if (Txt[Pos] == '\\')
+	    Pos++;
+      if (Pos >= Limit || Txt[Pos] != '>')
+	 return false;
+      URLEnd = Pos++;
+     }
+   else
+     {
+      for (URLStart = Pos;
+	   Pos < Limit && Txt[Pos] != ' ' && Txt[Pos] != '\n';
+	   Pos++)
+	 if (Txt[Pos] == '\\')
+	    Pos++;
+	 else if (Txt[Pos] == '(')
+	    Parens++;
+	 else if (Txt[Pos] == ')')
+	   {
+	    if (Parens == 0)
+	       break;
+	    Parens--;
+	   }
+      if (Pos > Limit)
+	 return false;
+      URLEnd = Pos;
+     }
+
+   /***** Get optional title *****/
+   for (;
+	Pos < Limit && (Txt[Pos] == ' ' || Txt[Pos] == '\n');
+	Pos++);
+   if (Pos < Limit && (Txt[Pos] == '"' || Txt[Pos] == '\'' || Txt[Pos] == '('))
+     {
+      Close = (Txt[Pos] == '(') ? ')' :
+				  Txt[Pos];
+      for (TitleStart = ++Pos;
+	   Pos < Limit && Txt[Pos] != Close;
+	   Pos++)
+	 if (Txt[Pos] == '\\')
+	    Pos++;
+      if (Pos >= Limit)
+	 return false;
+      TitleEnd = Pos++;
+      HasTitle = true;
+      for (;
+	   Pos < Limit && (Txt[Pos] == ' ' || Txt[Pos] == '\n');
+	   Pos++);
+     }
+   if (Pos >= Limit || Txt[Pos] != ')')
+      return false;
+
+   Link->End   = Pos + 1;
+   Link->URL   = Mkd_CopyUnescaped (&Txt[URLStart],URLEnd - URLStart);
+   Link->Title = HasTitle ? Mkd_CopyUnescaped (&Txt[TitleStart],TitleEnd - TitleStart) :
+			    NULL;
+   return true;
+  }
+
+/*****************************************************************************/
+/*************** Get number of consecutive equal characters ******************/
+/*****************************************************************************/
+
+static size_t Mkd_GetRunLength (const char *Txt,size_t Len,size_t Pos)
+  {
+   size_t End;
+
+   for (End = Pos + 1;
+	End < Len && Txt[End] == Txt[Pos];
+	End++);
+
+   return End - Pos;
+  }
+
+/*****************************************************************************/
+/************ Get length of an HTML entity (&amp; &#233; &#xE9;) *************/
+/*****************************************************************************/
+// Return 0 if there is no entity at Pos
+
+static size_t Mkd_GetEntityLength (const char *Txt,size_t Len,size_t Pos)
+  {
+   size_t End = Pos + 1;
+   size_t Start;
+   size_t MaxChrs;
+   int (*CheckChr) (int);
+
+   if (End < Len && Txt[End] == '#')
+     {
+      End++;
+      if (End < Len && (Txt[End] == 'x' || Txt[End] == 'X'))
+	{
+	 End++;
+	 CheckChr = isxdigit;
+	 MaxChrs = 6;
+	}
+      else
+	{
+	 CheckChr = isdigit;
+	 MaxChrs = 7;
+	}
+     }
+   else
+     {
+      CheckChr = isalnum;
+      MaxChrs = 31;
+     }
+   for (Start = End;
+	End < Len && End - Start < MaxChrs &&
+	isascii ((unsigned char) Txt[End]) && CheckChr ((unsigned char) Txt[End]);
+	End++);
+   if (End == Start || End == Len || Txt[End] != ';')
+      return 0;
+
+   return End + 1 - Pos;
+  }
+
+/*****************************************************************************/
+/****************** Copy a text removing backslash escapes *******************/
+/*****************************************************************************/
+// Returned string must be freed by caller
+
+static char *Mkd_CopyUnescaped (const char *Txt,size_t Len)
+  {
+   char *Copy;
+   size_t Pos;
+   size_t CopyLen = 0;
+
+   if ((Copy = malloc (Len + 1)) == NULL)
+      Mkd_NotEnoughMemoryExit ();
+   for (Pos = 0;
+	Pos < Len;
+	Pos++)
+     {
+      if (Txt[Pos] == '\\' && Pos + 1 < Len &&
+	  isascii ((unsigned char) Txt[Pos + 1]) &&
+	  ispunct ((unsigned char) Txt[Pos + 1]))
+	 Pos++;
+      Copy[CopyLen++] = Txt[Pos];
+     }
+   Copy[CopyLen] = '\0';
+
+   return Copy;
+  }
+
+/*****************************************************************************/
+/********************** Write text escaping & < > " **************************/
+/*****************************************************************************/
+
+static void Mkd_WriteEscaped (FILE *FileHTML,const char *Txt,size_t Len)
+  {
+   size_t Pos;
+   size_t Start;
+
+   for (Pos = 0;
+	Pos < Len;
+	Pos++)
+     {
+      for (Start = Pos;
+	   Pos < Len &&
+	   Txt[Pos] != '&' && Txt[Pos] != '<' && Txt[Pos] != '>' && Txt[Pos] != '"';
+	   Pos++);
+      fwrite (&Txt[Start],1,Pos - Start,FileHTML);
+      if (Pos == Len)
+	 break;
+      switch (Txt[Pos])
+	{
+	 case '&':
+	    fputs ("&amp;",FileHTML);
+	    break;
+	 case '<':
+	    fputs ("&lt;",FileHTML);
+	    break;
+	 case '>':
+	    fputs ("&gt;",FileHTML);
+	    break;
+	 default:
+	    fputs ("&quot;",FileHTML);
+	    break;
+	}
+     }
+  }
+
+/*****************************************************************************/
+/******************** Write text without Markdown marks **********************/
+/*****************************************************************************/
+// Used in alternative text of images
+
+static void Mkd_WritePlainText (FILE *FileHTML,const char *Txt,size_t Len)
+  {
+   size_t Pos;
+
+   for (Pos = 0;
+	Pos < Len;
+	Pos++)
+      if (!strchr ("*_`[]",Txt[Pos]))
+	 Mkd_WriteEscaped (FileHTML,&Txt[Pos],1);
+  }
@@ -0,0 +1,133 @@
+// swad_markdown_bench.c: time the conversion of Markdown files to HTML
+
+/*
+    SWAD (Shared Workspace At a Distance),
+    is a web platform developed at the University of Granada (Spain),
+    and used to support university teaching.
+
+    This file is part of SWAD core.
+    Copyright (C) 1999-2021 Antonio Caas Vargas
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as
+    published by the Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.
+
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/*****************************************************************************/
+/********************************* Headers ***********************************/
+/*****************************************************************************/
+
+#include <stdio.h>		// For fprintf, fopen...
+#include <stdlib.h>		// For exit codes, malloc, strtoul
+#include <string.h>		// For strcmp
+#include <time.h>		// For clock_gettime
+
+#include "swad_markdown.h"
+
+/*****************************************************************************/
+/***************************** Private prototypes ****************************/
+/*****************************************************************************/
+
+static void NotEnoughMemoryExit (void);
+
+/*****************************************************************************/
+/****************************** Main function ********************************/
+/*****************************************************************************/
+// Usage: swad_markdown_bench [-n RUNS] FILE...
+// For each file, print its size in bytes
+// and the microseconds spent in each conversion (output to /dev/null).
+// With -n 0 the HTML of the files is written to standard output.
+
+int main (int argc,char *argv[])
+  {
+   unsigned long NumRuns = 100;
+   unsigned long NumRun;
+   int NumArg = 1;
+   FILE *FileMD;
+   FILE *FileNull;
+   char *TxtMD;
+   long Size;
+   struct timespec Start;
+   struct timespec End;
+   double Microseconds;
+
+   if (argc > 2 && !strcmp (argv[1],"-n"))
+     {
+      NumRuns = strtoul (argv[2],NULL,10);
+      NumArg = 3;
+     }
+   if (NumArg >= argc)
+     {
+      fprintf (stderr,"Usage: %s [-n RUNS] FILE...\n",argv[0]);
+      return EXIT_FAILURE;
+     }
+   if ((FileNull = fopen ("/dev/null","wb")) == NULL)
+     {
+      perror ("/dev/null");
+      return EXIT_FAILURE;
+     }
+
+   for (;
+	NumArg < argc;
+	NumArg++)
+     {
+      /***** Read file *****/
+      if ((FileMD = fopen (argv[NumArg],"rb")) == NULL)
+	{
+	 perror (argv[NumArg]);
+	 return EXIT_FAILURE;
+	}
+      fseek (FileMD,0L,SEEK_END);
+      Size = ftell (FileMD);
+      rewind (FileMD);
+      if ((TxtMD = malloc ((size_t) Size + 1)) == NULL)
+	{
+	 perror ("Not enough memory");
+	 return EXIT_FAILURE;
+	}
+      TxtMD[fread (TxtMD,1,(size_t) Size,FileMD)] = '\0';
+      fclose (FileMD);
+
+      /***** Convert file *****/
+      if (NumRuns == 0)
+	 Mkd_WriteHTMLFromMarkdown (TxtMD,stdout,NotEnoughMemoryExit);
+      else
+	{
+	 clock_gettime (CLOCK_MONOTONIC,&Start);
+	 for (NumRun = 0;
+	      NumRun < NumRuns;
+	      NumRun++)
+	    Mkd_WriteHTMLFromMarkdown (TxtMD,FileNull,NotEnoughMemoryExit);
+	 fflush (FileNull);
+	 clock_gettime (CLOCK_MONOTONIC,&End);
+	 Microseconds = ((double) (End.tv_sec - Start.tv_sec) * 1E6 +
+			 (double) (End.tv_nsec - Start.tv_nsec) / 1E3) /
+			(double) NumRuns;
+	 printf ("%s\t%ld\t%.1f\n",argv[NumArg],Size,Microseconds);
+	}
+
+      free (TxtMD);
+     }
+
+   fclose (FileNull);
+   return ferror (stdout) ? EXIT_FAILURE :
+			    EXIT_SUCCESS;
+  }
+
+/*****************************************************************************/
+/************************** Exit if no memory ********************************/
+/*****************************************************************************/
+
+static void NotEnoughMemoryExit (void)
+  {
+   perror ("Not enough memory to convert Markdown");
+   exit (EXIT_FAILURE);
+  }
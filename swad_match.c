@@ -96,6 +96,21 @@ const char *Mch_ShowingStringsDB[Mch_NUM_SHOWING] =
 
 long Mch_MchCodBeingPlayed;	// Used to refresh game via AJAX
 
+static struct
+  {
+   bool IsRead;			// Is the histogram already read from database...
+				// ...or it needs to be read?
+   long MchCod;			// Match...
+   unsigned QstInd;		// ...and question the histogram refers to
+   unsigned NumUsrs;		// Number of users who have answered the question
+   unsigned NumUsrsAns[Tst_MAX_OPTIONS_PER_QUESTION];	// Number of users who have chosen each answer
+  } Mch_Histogram =
+  {
+   .IsRead = false,
+   .MchCod = -1L,
+   .QstInd = 0,
+  };
+
 /*****************************************************************************/
 /***************************** Private prototypes ****************************/
 /*****************************************************************************/
@@ -237,9 +252,12 @@ static void Mch_SetMatchAsNotBeingPlayed (long MchCod);
 static bool Mch_GetIfMatchIsBeingPlayed (long MchCod);
 static void Mch_GetNumPlayers (struct Mch_Match *Match);
 
-static void Mch_UpdateMyAnswerToMatchQuestion (const struct Mch_Match *Match,
+static bool Mch_UpdateMyAnswerToMatchQuestion (const struct Mch_Match *Match,
                                                const struct Mch_UsrAnswer *UsrAnswer);
-static void Mch_RemoveMyAnswerToMatchQuestion (const struct Mch_Match *Match);
+static bool Mch_RemoveMyAnswerToMatchQuestion (const struct Mch_Match *Match);
+
+static void Mch_GetHistogram (long MchCod,unsigned QstInd);
+static void Mch_InvalidateHistogram (long MchCod,unsigned QstInd);
 
 static unsigned Mch_GetNumUsrsWhoHavePlayedMch (long MchCod);
 
@@ -1842,50 +1860,12 @@ static void Mch_CreateIndexes (long GamCod,long MchCod)
 static void Mch_ReorderAnswer (long MchCod,unsigned QstInd,
 			       const struct Tst_Question *Question)
   {
-   MYSQL_RES *mysql_res;
-   MYSQL_ROW row;
-   unsigned NumAnss;
-   unsigned NumAns;
-   long LongNum;
-   unsigned AnsInd;
-   char StrOneAnswer[Cns_MAX_DECIMAL_DIGITS_UINT + 1];
-   char StrAnswersOneQst[Tst_MAX_BYTES_ANSWERS_ONE_QST + 1];
-
-   /***** Initialize list of answers to empty string *****/
-   StrAnswersOneQst[0] = '\0';
-
-   /***** Get questions of the game *****/
-   NumAnss = (unsigned)
-	     DB_QuerySELECT (&mysql_res,"can not get questions of a game",
-			     "SELECT AnsInd"	// row[0]
-			     " FROM tst_answers"
-			     " WHERE QstCod=%ld"
-			     " ORDER BY %s",
-			     Question->QstCod,
-			     Question->Answer.Shuffle ? "RAND()" :	// Use RAND() because is really random; RAND(NOW()) repeats order
-				                        "AnsInd");
-
-   /***** For each answer in question... *****/
-   for (NumAns = 0;
-	NumAns < NumAnss;
-	NumAns++)
-     {
-      row = mysql_fetch_row (mysql_res);
-
-      /* Get answer index (row[0]) */
-      if ((LongNum = Str_ConvertStrCodToLongCod (row[0])) < 0)
-	 Lay_ShowErrorAndExit ("Wrong answer index.");
-      AnsInd = (unsigned) LongNum;
-      snprintf (StrOneAnswer,sizeof (StrOneAnswer),"%u",AnsInd);
-
-      /* Concatenate answer index to list of answers */
-      if (NumAns)
-         Str_Concat (StrAnswersOneQst,",",sizeof (StrAnswersOneQst) - 1);
-      Str_Concat (StrAnswersOneQst,StrOneAnswer,sizeof (StrAnswersOneQst) - 1);
-     }
+   char StrAnswersOneQst[Tst_MAX_BYTES_INDEXES_ONE_QST + 1];
 
-   /***** Free structure that stores the query result *****/
-   DB_FreeMySQLResult (&mysql_res);
+   /***** Get indexes of answers, shuffled in memory if necessary *****/
+   Tst_GetChoiceIndexesFromDB ("tst_answers",Question->QstCod,
+			       Question->Answer.Shuffle,
+			       StrAnswersOneQst);
 
    /***** Create entry for this question in table of match indexes *****/
    DB_QueryINSERT ("can not create match indexes",
@@ -3951,10 +3931,9 @@ void Mch_RemoveMyQuestionAnswer (const struct Mch_Match *Match,unsigned QstInd)
        QstInd == Match->Status.QstInd)		// Removing answer to the current question being played
      {
       /***** Remove my answer to this question *****/
-      Mch_RemoveMyAnswerToMatchQuestion (Match);
-
-      /***** Compute score and update my match result *****/
-      MchPrn_ComputeScoreAndUpdateMyMatchPrintInDB (Match->MchCod);
+      if (Mch_RemoveMyAnswerToMatchQuestion (Match))	// My answer has been removed
+	 /***** Compute score and update my match result *****/
+	 MchPrn_ComputeScoreAndUpdateMyMatchPrintInDB (Match->MchCod);
      }
   }
 
@@ -4156,13 +4135,14 @@ void Mch_StoreQuestionAnswer (const struct Mch_Match *Match,unsigned QstInd,
                               struct Mch_UsrAnswer *UsrAnswer)
   {
    unsigned Indexes[Tst_MAX_OPTIONS_PER_QUESTION];
-   struct Mch_UsrAnswer PreviousUsrAnswer;
 
    /***** Check that teacher's screen is showing answers
           and question index is the current one being played *****/
    if (Match->Status.Playing &&			// Match is being played
        Match->Status.Showing == Mch_ANSWERS &&	// Teacher's screen is showing answers
-       QstInd == Match->Status.QstInd)		// Receiving an answer to the current question being played
+       QstInd == Match->Status.QstInd &&	// Receiving an answer to the current question being played
+       UsrAnswer->NumOpt >= 0 &&
+       UsrAnswer->NumOpt < (int) Tst_MAX_OPTIONS_PER_QUESTION)
      {
       /***** Get indexes for this question from database *****/
       Mch_GetIndexes (Match->MchCod,Match->Status.QstInd,Indexes);
@@ -4185,52 +4165,67 @@ void Mch_StoreQuestionAnswer (const struct Mch_Match *Match,unsigned QstInd,
       */
       UsrAnswer->AnsInd = Indexes[UsrAnswer->NumOpt];
 
-      /***** Get previous student's answer to this question
-	     (<0 ==> no answer) *****/
-      Mch_GetQstAnsFromDB (Match->MchCod,Gbl.Usrs.Me.UsrDat.UsrCod,Match->Status.QstInd,
-			   &PreviousUsrAnswer);
-
-      /***** Store student's answer *****/
-      if (UsrAnswer->NumOpt >= 0 &&
-	  UsrAnswer->AnsInd >= 0 &&
-	  UsrAnswer->AnsInd != PreviousUsrAnswer.AnsInd)
-	{
-	 /***** Update my answer to this question *****/
-	 Mch_UpdateMyAnswerToMatchQuestion (Match,UsrAnswer);
-
+      /***** Store student's answer.
+             The previous answer is not read from database:
+             the answer is inserted or updated in only one query
+             and nothing is changed if the answer is the same *****/
+      if (Mch_UpdateMyAnswerToMatchQuestion (Match,UsrAnswer))	// My answer has changed
 	 /***** Compute score and update my match result *****/
 	 MchPrn_ComputeScoreAndUpdateMyMatchPrintInDB (Match->MchCod);
-	}
      }
   }
 
 /*****************************************************************************/
 /******************** Update my answer to match question *********************/
 /*****************************************************************************/
+// Last answer wins: the previous answer (if any) is overwritten
+// Return true if my answer has been inserted or changed
 
-static void Mch_UpdateMyAnswerToMatchQuestion (const struct Mch_Match *Match,
+static bool Mch_UpdateMyAnswerToMatchQuestion (const struct Mch_Match *Match,
                                                const struct Mch_UsrAnswer *UsrAnswer)
   {
-   DB_QueryREPLACE ("can not register your answer to the match question",
-		    "REPLACE mch_answers"
-		    " (MchCod,UsrCod,QstInd,NumOpt,AnsInd)"
-		    " VALUES"
-		    " (%ld,%ld,%u,%d,%d)",
-		    Match->MchCod,Gbl.Usrs.Me.UsrDat.UsrCod,Match->Status.QstInd,
-		    UsrAnswer->NumOpt,
-		    UsrAnswer->AnsInd);
+   /***** Insert or update my answer *****/
+   // Number of affected rows will be:
+   // 0 if the answer was already stored with the same values
+   // 1 if the answer is inserted as a new row
+   // 2 if an existing answer is updated
+   DB_QueryINSERT ("can not register your answer to the match question",
+		   "INSERT INTO mch_answers"
+		   " (MchCod,UsrCod,QstInd,NumOpt,AnsInd)"
+		   " VALUES"
+		   " (%ld,%ld,%u,%d,%d)"
+		   " ON DUPLICATE KEY"
+		   " UPDATE NumOpt=VALUES(NumOpt),AnsInd=VALUES(AnsInd)",
+		   Match->MchCod,Gbl.Usrs.Me.UsrDat.UsrCod,Match->Status.QstInd,
+		   UsrAnswer->NumOpt,
+		   UsrAnswer->AnsInd);
+   if (!mysql_affected_rows (&Gbl.mysql))
+      return false;	// Nothing changed
+
+   /***** Histogram of this question is no longer valid *****/
+   Mch_InvalidateHistogram (Match->MchCod,Match->Status.QstInd);
+
+   return true;
   }
 
 /*****************************************************************************/
 /******************* Remove my answer to match question **********************/
 /*****************************************************************************/
+// Return true if my answer has been removed
 
-static void Mch_RemoveMyAnswerToMatchQuestion (const struct Mch_Match *Match)
+static bool Mch_RemoveMyAnswerToMatchQuestion (const struct Mch_Match *Match)
   {
    DB_QueryDELETE ("can not remove your answer to the match question",
 		    "DELETE FROM mch_answers"
 		    " WHERE MchCod=%ld AND UsrCod=%ld AND QstInd=%u",
 		    Match->MchCod,Gbl.Usrs.Me.UsrDat.UsrCod,Match->Status.QstInd);
+   if (!mysql_affected_rows (&Gbl.mysql))
+      return false;	// There was no answer to remove
+
+   /***** Histogram of this question is no longer valid *****/
+   Mch_InvalidateHistogram (Match->MchCod,Match->Status.QstInd);
+
+   return true;
   }
 
 /*****************************************************************************/
@@ -4242,23 +4237,30 @@ void Mch_GetMatchQuestionsFromDB (struct MchPrn_Print *Print)
    MYSQL_RES *mysql_res;
    MYSQL_ROW row;
    unsigned NumQst;
-   long LongNum;
-   unsigned QstInd;
-   struct Mch_UsrAnswer UsrAnswer;
+   int AnsInd;
 
    /***** Get questions and answers of a match result *****/
+   // User's answers are got in the same query (LEFT JOIN)
+   // instead of one query per question
    Print->NumQsts.All = (unsigned)
 		        DB_QuerySELECT (&mysql_res,"can not get questions and answers"
 						   " of a match result",
 					"SELECT gam_questions.QstCod,"	// row[0]
-					       "gam_questions.QstInd,"	// row[1]
-					       "mch_indexes.Indexes"	// row[2]
-					" FROM mch_matches,gam_questions,mch_indexes"
-					" WHERE mch_matches.MchCod=%ld"
-					" AND mch_matches.GamCod=gam_questions.GamCod"
-					" AND mch_matches.MchCod=mch_indexes.MchCod"
+					       "mch_indexes.Indexes,"	// row[1]
+					       "mch_answers.AnsInd"	// row[2]
+					" FROM mch_matches"
+					" JOIN gam_questions"
+					" ON mch_matches.GamCod=gam_questions.GamCod"
+					" JOIN mch_indexes"
+					" ON mch_matches.MchCod=mch_indexes.MchCod"
 					" AND gam_questions.QstInd=mch_indexes.QstInd"
+					" LEFT JOIN mch_answers"
+					" ON mch_matches.MchCod=mch_answers.MchCod"
+					" AND mch_answers.UsrCod=%ld"
+					" AND gam_questions.QstInd=mch_answers.QstInd"
+					" WHERE mch_matches.MchCod=%ld"
 					" ORDER BY gam_questions.QstInd",
+					Print->UsrCod,
 					Print->MchCod);
    for (NumQst = 0, Print->NumQsts.NotBlank = 0;
 	NumQst < Print->NumQsts.All;
@@ -4270,25 +4272,23 @@ void Mch_GetMatchQuestionsFromDB (struct MchPrn_Print *Print)
       if ((Print->PrintedQuestions[NumQst].QstCod = Str_ConvertStrCodToLongCod (row[0])) < 0)
 	 Lay_ShowErrorAndExit ("Wrong code of question.");
 
-      /* Get question index (row[1]) */
-      if ((LongNum = Str_ConvertStrCodToLongCod (row[1])) < 0)
-	 Lay_ShowErrorAndExit ("Wrong code of question.");
-      QstInd = (unsigned) LongNum;
-
-      /* Get indexes for this question (row[2]) */
-      Str_Copy (Print->PrintedQuestions[NumQst].StrIndexes,row[2],
+      /* Get indexes for this question (row[1]) */
+      Str_Copy (Print->PrintedQuestions[NumQst].StrIndexes,row[1],
                 sizeof (Print->PrintedQuestions[NumQst].StrIndexes) - 1);
 
-      /* Get answers selected by user for this question */
-      Mch_GetQstAnsFromDB (Print->MchCod,Print->UsrCod,QstInd,&UsrAnswer);
-      if (UsrAnswer.AnsInd >= 0)	// UsrAnswer.AnsInd >= 0 ==> answer selected
+      /* Get answer selected by user for this question (row[2]) */
+      AnsInd = -1;	// < 0 ==> no answer selected
+      if (row[2])	// NULL when the user has not answered this question
+	 if (sscanf (row[2],"%d",&AnsInd) != 1)
+	    Lay_ShowErrorAndExit ("Error when getting student's answer to a match question.");
+      if (AnsInd >= 0)	// AnsInd >= 0 ==> answer selected
 	{
          snprintf (Print->PrintedQuestions[NumQst].StrAnswers,
                    sizeof (Print->PrintedQuestions[NumQst].StrAnswers),
-                   "%d",UsrAnswer.AnsInd);
+                   "%d",AnsInd);
          Print->NumQsts.NotBlank++;
         }
-      else				// UsrAnswer.AnsInd < 0 ==> no answer selected
+      else		// AnsInd < 0 ==> no answer selected
 	 Print->PrintedQuestions[NumQst].StrAnswers[0] = '\0';	// Empty answer
      }
 
@@ -4331,13 +4331,10 @@ void Mch_ComputeScore (struct MchPrn_Print *Print)
 
 unsigned Mch_GetNumUsrsWhoAnsweredQst (long MchCod,unsigned QstInd)
   {
-   /***** Get number of users who answered
-          a question in a match from database *****/
-   return
-   (unsigned) DB_QueryCOUNT ("can not get number of users who answered a question",
-			     "SELECT COUNT(*) FROM mch_answers"
-			     " WHERE MchCod=%ld AND QstInd=%u",
-			     MchCod,QstInd);
+   /***** Get histogram of answers to this question *****/
+   Mch_GetHistogram (MchCod,QstInd);
+
+   return Mch_Histogram.NumUsrs;
   }
 
 /*****************************************************************************/
@@ -4346,13 +4343,85 @@ unsigned Mch_GetNumUsrsWhoAnsweredQst (long MchCod,unsigned QstInd)
 
 unsigned Mch_GetNumUsrsWhoHaveChosenAns (long MchCod,unsigned QstInd,unsigned AnsInd)
   {
-   /***** Get number of users who have chosen
-          an answer of a question from database *****/
-   return
-   (unsigned) DB_QueryCOUNT ("can not get number of users who have chosen an answer",
-			     "SELECT COUNT(*) FROM mch_answers"
-			     " WHERE MchCod=%ld AND QstInd=%u AND AnsInd=%u",
-			     MchCod,QstInd,AnsInd);
+   /***** Get histogram of answers to this question *****/
+   Mch_GetHistogram (MchCod,QstInd);
+
+   return AnsInd < Tst_MAX_OPTIONS_PER_QUESTION ? Mch_Histogram.NumUsrsAns[AnsInd] :
+						  0;
+  }
+
+/*****************************************************************************/
+/******** Get histogram of answers to a match question from database *********/
+/*****************************************************************************/
+// The number of users who have chosen each answer is got in only one query
+// and kept in memory, so the teacher's screen, refreshed periodically,
+// does not need one COUNT for the question and another one for each answer
+
+static void Mch_GetHistogram (long MchCod,unsigned QstInd)
+  {
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   unsigned NumRows;
+   unsigned NumRow;
+   unsigned AnsInd;
+   unsigned NumUsrs;
+
+   /***** Trivial check: is the histogram already read? *****/
+   if (Mch_Histogram.IsRead &&
+       Mch_Histogram.MchCod == MchCod &&
+       Mch_Histogram.QstInd == QstInd)
+      return;
+
+   /***** Reset histogram *****/
+   Mch_Histogram.MchCod  = MchCod;
+   Mch_Histogram.QstInd  = QstInd;
+   Mch_Histogram.NumUsrs = 0;
+   for (AnsInd = 0;
+	AnsInd < Tst_MAX_OPTIONS_PER_QUESTION;
+	AnsInd++)
+      Mch_Histogram.NumUsrsAns[AnsInd] = 0;
+
+   /***** Get number of users who have chosen each answer from database *****/
+   NumRows = (unsigned) DB_QuerySELECT (&mysql_res,"can not get number of users"
+						   " who have chosen each answer",
+					"SELECT AnsInd,"	// row[0]
+					       "COUNT(*)"	// row[1]
+					" FROM mch_answers"
+					" WHERE MchCod=%ld AND QstInd=%u"
+					" GROUP BY AnsInd",
+					MchCod,QstInd);
+   for (NumRow = 0;
+	NumRow < NumRows;
+	NumRow++)
+     {
+      row = mysql_fetch_row (mysql_res);
+
+      /* Get answer index (row[0]) and number of users (row[1]) */
+      if (sscanf (row[0],"%u",&AnsInd) != 1 ||
+	  sscanf (row[1],"%u",&NumUsrs) != 1)
+	 Lay_ShowErrorAndExit ("Error when getting number of users who have chosen an answer.");
+
+      /* Update histogram */
+      if (AnsInd < Tst_MAX_OPTIONS_PER_QUESTION)
+	 Mch_Histogram.NumUsrsAns[AnsInd] = NumUsrs;
+      Mch_Histogram.NumUsrs += NumUsrs;
+     }
+
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+
+   Mch_Histogram.IsRead = true;
+  }
+
+/*****************************************************************************/
+/****** Invalidate histogram of answers to a match question in memory ********/
+/*****************************************************************************/
+
+static void Mch_InvalidateHistogram (long MchCod,unsigned QstInd)
+  {
+   if (Mch_Histogram.MchCod == MchCod &&
+       Mch_Histogram.QstInd == QstInd)
+      Mch_Histogram.IsRead = false;
   }
 
 /*****************************************************************************/
@@ -99,40 +99,29 @@ void MchPrn_ComputeScoreAndUpdateMyMatchPrintInDB (long MchCod)
 
 static void MchPrn_UpdateMyMatchPrintInDB (struct MchPrn_Print *Print)
   {
+   /***** Create result or update it if it already exists.
+          Start time is kept when the result is updated *****/
    Str_SetDecimalPointToUS ();	// To print the floating point as a dot
-   if (DB_QueryCOUNT ("can not get if match result exists",
-		      "SELECT COUNT(*) FROM mch_results"
-		      " WHERE MchCod=%ld AND UsrCod=%ld",
-		      Print->MchCod,Print->UsrCod))	// Match print exists
-      /* Update result */
-      DB_QueryUPDATE ("can not update match result",
-		       "UPDATE mch_results"
-		       " SET EndTime=NOW(),"
-			    "NumQsts=%u,"
-			    "NumQstsNotBlank=%u,"
-			    "Score='%.15lg'"
-		       " WHERE MchCod=%ld AND UsrCod=%ld",
-		       Print->NumQsts.All,
-		       Print->NumQsts.NotBlank,
-		       Print->Score,
-		       Print->MchCod,Print->UsrCod);
-   else							// Match print doesn't exist
-      /* Create result */
-      DB_QueryINSERT ("can not create match result",
-		       "INSERT mch_results "
-		       "(MchCod,UsrCod,StartTime,EndTime,NumQsts,NumQstsNotBlank,Score)"
-		       " VALUES "
-		       "(%ld,"		// MchCod
-		       "%ld,"		// UsrCod
-		       "NOW(),"		// StartTime
-		       "NOW(),"		// EndTime
-		       "%u,"		// NumQsts
-		       "%u,"		// NumQstsNotBlank
-		       "'%.15lg')",	// Score
-		       Print->MchCod,Print->UsrCod,
-		       Print->NumQsts.All,
-		       Print->NumQsts.NotBlank,
-		       Print->Score);
+   DB_QueryINSERT ("can not create or update match result",
+		   "INSERT INTO mch_results "
+		   "(MchCod,UsrCod,StartTime,EndTime,NumQsts,NumQstsNotBlank,Score)"
+		   " VALUES "
+		   "(%ld,"		// MchCod
+		   "%ld,"		// UsrCod
+		   "NOW(),"		// StartTime
+		   "NOW(),"		// EndTime
+		   "%u,"		// NumQsts
+		   "%u,"		// NumQstsNotBlank
+		   "'%.15lg')"	// Score
+		   " ON DUPLICATE KEY"
+		   " UPDATE EndTime=NOW(),"
+			   "NumQsts=VALUES(NumQsts),"
+			   "NumQstsNotBlank=VALUES(NumQstsNotBlank),"
+			   "Score=VALUES(Score)",
+		   Print->MchCod,Print->UsrCod,
+		   Print->NumQsts.All,
+		   Print->NumQsts.NotBlank,
+		   Print->Score);
    Str_SetDecimalPointToLocal ();	// Return to local system
   }
 
@@ -46,6 +46,7 @@
 #include "swad_hierarchy.h"
 #include "swad_HTML.h"
 #include "swad_ID.h"
+#include "swad_indicator.h"
 #include "swad_message.h"
 #include "swad_notification.h"
 #include "swad_pagination.h"
@@ -101,6 +102,16 @@ static unsigned long Msg_GetSentOrReceivedMsgs (const struct Msg_Messages *Messa
 						long UsrCod,
 						const char *FilterFromToSubquery,
 						MYSQL_RES **mysql_res);
+static void Msg_BuildQuerySentOrReceivedMsgs (const struct Msg_Messages *Messages,
+					      long UsrCod,
+					      const char *FilterFromToSubquery,
+					      char **Query);
+static unsigned Msg_GetNumMsgsInQuery (const char *Query);
+static bool Msg_GetPosOfMsgInQuery (const char *Query,long MsgCod,
+                                    unsigned long *NumMsgsBefore);
+static unsigned long Msg_GetPageOfMsgsInQuery (const char *Query,
+                                               const struct Pagination *Pagination,
+                                               MYSQL_RES **mysql_res);
 
 static void Msg_SetNumMsgsStr (const struct Msg_Messages *Messages,
                                char **NumMsgsStr,unsigned NumUnreadMsgs);
@@ -1430,6 +1441,11 @@ static long Msg_InsertNewMsg (const char *Subject,const char *Content,
    /***** Increment number of messages sent by me *****/
    Prf_IncrementNumMsgSntUsr (Gbl.Usrs.Me.UsrDat.UsrCod);
 
+   /***** Update stored indicators of the course
+          if the message has been sent by a teacher of the course *****/
+   if (Gbl.Usrs.Me.UsrDat.Roles.InCurrentCrs.Role == Rol_TCH)
+      Ind_UpdateIndicatorsCrs (Gbl.Hierarchy.Crs.CrsCod,Ind_COUNTER_MESSAGES);
+
    return MsgCod;
   }
 
@@ -1809,10 +1825,12 @@ static void Msg_ShowSentOrReceivedMessages (struct Msg_Messages *Messages)
    extern const char *Txt_Filter;
    extern const char *Txt_Update_messages;
    char FilterFromToSubquery[Msg_MAX_BYTES_MESSAGES_QUERY + 1];
+   char *Query;
    MYSQL_RES *mysql_res;
    MYSQL_ROW row;
    unsigned long NumRow;
    unsigned long NumRows;
+   unsigned long NumMsgsBefore;
    char *NumMsgsStr;
    unsigned long NumMsg;
    unsigned NumUnreadMsgs;
@@ -1869,12 +1887,12 @@ static void Msg_ShowSentOrReceivedMessages (struct Msg_Messages *Messages)
 	 break;
      }
 
-   /***** Get messages from database *****/
-   NumRows = Msg_GetSentOrReceivedMsgs (Messages,
-                                        Gbl.Usrs.Me.UsrDat.UsrCod,
-					FilterFromToSubquery,
-				        &mysql_res);
-   Messages->NumMsgs = (unsigned) NumRows;
+   /***** Get number of messages from database *****/
+   Msg_BuildQuerySentOrReceivedMsgs (Messages,
+                                     Gbl.Usrs.Me.UsrDat.UsrCod,
+				     FilterFromToSubquery,
+				     &Query);
+   Messages->NumMsgs = Msg_GetNumMsgsInQuery (Query);
 
    /***** Begin box with messages *****/
    Msg_SetNumMsgsStr (Messages,&NumMsgsStr,NumUnreadMsgs);
@@ -1920,20 +1938,9 @@ static void Msg_ShowSentOrReceivedMessages (struct Msg_Messages *Messages)
 						// from a notification of received message, so show the page where the message is inside
         {
          /***** Get the page where the expanded message is inside *****/
-         for (NumRow = 0;
-              NumRow < NumRows;
-              NumRow++)
-           {
-            row = mysql_fetch_row (mysql_res);
-            if (sscanf (row[0],"%ld",&MsgCod) != 1)
-               Lay_ShowErrorAndExit ("Wrong code of message when searching for a page.");
-
-            if (MsgCod == Messages->ExpandedMsgCod)	// Expanded message found
-              {
-               Messages->CurrentPage = (unsigned) (NumRow / Pag_ITEMS_PER_PAGE) + 1;
-               break;
-              }
-           }
+         if (Msg_GetPosOfMsgInQuery (Query,Messages->ExpandedMsgCod,
+                                     &NumMsgsBefore))	// Expanded message found
+            Messages->CurrentPage = (unsigned) (NumMsgsBefore / Pag_ITEMS_PER_PAGE) + 1;
         }
 
       /***** Compute variables related to pagination *****/
@@ -1950,24 +1957,30 @@ static void Msg_ShowSentOrReceivedMessages (struct Msg_Messages *Messages)
       Pag_WriteLinksToPagesCentered (WhatPaginate[Messages->TypeOfMessages],&Pagination,
 				     Messages,-1L);
 
+      /***** Get messages in this page from database *****/
+      NumRows = Msg_GetPageOfMsgsInQuery (Query,&Pagination,&mysql_res);
+
       /***** Show received / sent messages in this page *****/
       HTM_TABLE_BeginWidePadding (2);
 
-      mysql_data_seek (mysql_res,(my_ulonglong) (Pagination.FirstItemVisible - 1));
-      for (NumRow  = Pagination.FirstItemVisible;
-           NumRow <= Pagination.LastItemVisible;
+      for (NumRow = 0;
+           NumRow < NumRows;
            NumRow++)
         {
          row = mysql_fetch_row (mysql_res);
 
          if (sscanf (row[0],"%ld",&MsgCod) != 1)
             Lay_ShowErrorAndExit ("Wrong code of message when listing the messages in a page.");
-         NumMsg = NumRows - NumRow + 1;
+         NumMsg = (unsigned long) Messages->NumMsgs -
+                  (unsigned long) Pagination.FirstItemVisible - NumRow + 1;
          Msg_ShowASentOrReceivedMessage (Messages,NumMsg,MsgCod);
         }
 
       HTM_TABLE_End ();
 
+      /***** Free structure that stores the query result *****/
+      DB_FreeMySQLResult (&mysql_res);
+
       /***** Write again links to pages *****/
       Pag_WriteLinksToPagesCentered (WhatPaginate[Messages->TypeOfMessages],&Pagination,
 				     Messages,-1L);
@@ -1976,8 +1989,8 @@ static void Msg_ShowSentOrReceivedMessages (struct Msg_Messages *Messages)
    /***** End box *****/
    Box_BoxEnd ();
 
-   /***** Free structure that stores the query result *****/
-   DB_FreeMySQLResult (&mysql_res);
+   /***** Free memory used for query *****/
+   free (Query);
   }
 
 /*****************************************************************************/
@@ -2008,17 +2021,115 @@ static void Msg_PutLinkToViewBannedUsers(void)
   }
 
 /*****************************************************************************/
-/********* Generate a query to select messages received or sent **************/
+/***** Get all the messages received or sent, from most recent to oldest *****/
 /*****************************************************************************/
 
 static unsigned long Msg_GetSentOrReceivedMsgs (const struct Msg_Messages *Messages,
 						long UsrCod,
 						const char *FilterFromToSubquery,
 						MYSQL_RES **mysql_res)
+  {
+   char *Query;
+   unsigned long NumMsgs;
+
+   /***** Get messages from database *****/
+   Msg_BuildQuerySentOrReceivedMsgs (Messages,UsrCod,FilterFromToSubquery,&Query);
+   NumMsgs = DB_QuerySELECT (mysql_res,"can not get messages",
+			     "%s"
+			     " ORDER BY MsgCod DESC",	// End the query ordering the result from most recent message to oldest
+			     Query);
+
+   /***** Free memory used for query *****/
+   free (Query);
+
+   return NumMsgs;
+  }
+
+/*****************************************************************************/
+/****************** Get number of messages received or sent ******************/
+/*****************************************************************************/
+
+static unsigned Msg_GetNumMsgsInQuery (const char *Query)
+  {
+   return (unsigned)
+   DB_QueryCOUNT ("can not get number of messages",
+		  "SELECT COUNT(*) FROM (%s) AS M",
+		  Query);
+  }
+
+/*****************************************************************************/
+/********* Get position of a message among messages received or sent *********/
+/*****************************************************************************/
+// Return true if the message is found
+// NumMsgsBefore: number of messages more recent than the given one
+
+static bool Msg_GetPosOfMsgInQuery (const char *Query,long MsgCod,
+                                    unsigned long *NumMsgsBefore)
+  {
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   unsigned Found = 0;
+
+   /***** Count messages more recent than the given one,
+          ordered by code like in the list of messages *****/
+   *NumMsgsBefore = 0;
+   if (DB_QuerySELECT (&mysql_res,"can not get position of a message",
+		       "SELECT COUNT(*),"		// row[0]
+			      "SUM(MsgCod=%ld)"		// row[1]
+		       " FROM (%s) AS M"
+		       " WHERE MsgCod>=%ld",
+		       MsgCod,Query,MsgCod))
+     {
+      row = mysql_fetch_row (mysql_res);
+
+      /* Is the message in the list? (row[1]) */
+      if (row[1])
+	 if (sscanf (row[1],"%u",&Found) != 1)
+	    Found = 0;
+
+      /* Get number of messages more recent (row[0]) */
+      if (Found)
+	 if (sscanf (row[0],"%lu",NumMsgsBefore) == 1)
+	    if (*NumMsgsBefore)
+	       (*NumMsgsBefore)--;	// Do not count the message itself
+     }
+
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+
+   return (Found != 0);
+  }
+
+/*****************************************************************************/
+/********* Get the messages received or sent visible in current page *********/
+/*****************************************************************************/
+
+static unsigned long Msg_GetPageOfMsgsInQuery (const char *Query,
+                                               const struct Pagination *Pagination,
+                                               MYSQL_RES **mysql_res)
+  {
+   return DB_QuerySELECT (mysql_res,"can not get messages",
+			  "%s"
+			  " ORDER BY MsgCod DESC"	// From most recent message to oldest
+			  " LIMIT %u,%u",
+			  Query,
+			  Pagination->FirstItemVisible - 1,
+			  Pagination->LastItemVisible -
+			  Pagination->FirstItemVisible + 1);
+  }
+
+/*****************************************************************************/
+/********* Generate a query to select messages received or sent **************/
+/*****************************************************************************/
+// Query must be freed by the caller
+
+static void Msg_BuildQuerySentOrReceivedMsgs (const struct Msg_Messages *Messages,
+					      long UsrCod,
+					      const char *FilterFromToSubquery,
+					      char **Query)
   {
    char *SubQuery;
    const char *StrUnreadMsg;
-   unsigned long NumMsgs;
 
    if (Messages->FilterCrsCod > 0)	// If origin course selected
       switch (Messages->TypeOfMessages)
@@ -2161,24 +2272,20 @@ static unsigned long Msg_GetSentOrReceivedMsgs (const struct Msg_Messages *Messa
         }
 
    if (Messages->FilterContent[0])
+     {
       /* Match against the content written in filter form */
-      NumMsgs = DB_QuerySELECT (mysql_res,"can not get messages",
-				"SELECT MsgCod"
-				" FROM msg_content"
-				" WHERE MsgCod IN (SELECT MsgCod FROM (%s) AS M)"
-				" AND MATCH (Subject,Content) AGAINST ('%s')"
-				" ORDER BY MsgCod DESC",	// End the query ordering the result from most recent message to oldest
-				SubQuery,Messages->FilterContent);
+      if (asprintf (Query,"SELECT MsgCod"
+			  " FROM msg_content"
+			  " WHERE MsgCod IN (SELECT MsgCod FROM (%s) AS M)"
+			  " AND MATCH (Subject,Content) AGAINST ('%s')",
+		    SubQuery,Messages->FilterContent) < 0)
+	 Lay_NotEnoughMemoryExit ();
+
+      /***** Free memory used for subquery *****/
+      free (SubQuery);
+     }
    else
-      NumMsgs = DB_QuerySELECT (mysql_res,"can not get messages",
-				"%s"
-				" ORDER BY MsgCod DESC",	// End the query ordering the result from most recent message to oldest
-				SubQuery);
-
-   /***** Free memory used for subquery *****/
-   free (SubQuery);
-
-   return NumMsgs;
+      *Query = SubQuery;
   }
 
 /*****************************************************************************/
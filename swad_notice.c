@@ -146,7 +146,7 @@ void Not_ReceiveNotice (void)
    NotCod = Not_InsertNoticeInDB (Content);
 
    /***** Update RSS of current course *****/
-   RSS_UpdateRSSFileForACrs (&Gbl.Hierarchy.Crs);
+   RSS_MarkRSSFileForACrsAsChanged (Gbl.Hierarchy.Crs.CrsCod);
 
    /***** Write message of success *****/
    Ale_ShowAlert (Ale_SUCCESS,Txt_Notice_created);
@@ -248,7 +248,7 @@ void Not_HideActiveNotice (void)
 	           NotCod,Gbl.Hierarchy.Crs.CrsCod);
 
    /***** Update RSS of current course *****/
-   RSS_UpdateRSSFileForACrs (&Gbl.Hierarchy.Crs);
+   RSS_MarkRSSFileForACrsAsChanged (Gbl.Hierarchy.Crs.CrsCod);
 
    /***** Set notice to be highlighted *****/
    Gbl.Crs.Notices.HighlightNotCod = NotCod;
@@ -273,7 +273,7 @@ void Not_RevealHiddenNotice (void)
 	           NotCod,Gbl.Hierarchy.Crs.CrsCod);
 
    /***** Update RSS of current course *****/
-   RSS_UpdateRSSFileForACrs (&Gbl.Hierarchy.Crs);
+   RSS_MarkRSSFileForACrsAsChanged (Gbl.Hierarchy.Crs.CrsCod);
 
    /***** Set notice to be highlighted *****/
    Gbl.Crs.Notices.HighlightNotCod = NotCod;
@@ -343,7 +343,7 @@ void Not_RemoveNotice (void)
    TL_Not_MarkNoteAsUnavailable (TL_NOTE_NOTICE,NotCod);
 
    /***** Update RSS of current course *****/
-   RSS_UpdateRSSFileForACrs (&Gbl.Hierarchy.Crs);
+   RSS_MarkRSSFileForACrsAsChanged (Gbl.Hierarchy.Crs.CrsCod);
   }
 
 /*****************************************************************************/
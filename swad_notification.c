@@ -1148,20 +1148,17 @@ void Ntf_MarkNotifFilesInGroupAsRemoved (long GrpCod)
 
 unsigned Ntf_StoreNotifyEventsToAllUsrs (Ntf_NotifyEvent_t NotifyEvent,long Cod)
   {
-   MYSQL_RES *mysql_res;
-   MYSQL_ROW row;
-   unsigned long NumRow;
-   unsigned long NumRows = 0;	// Initialized to avoid warning
-   struct UsrData UsrDat;
+   char *SubQuery = NULL;
    struct For_Forum ForumSelected;
    long InsCod;
    long CtrCod;
    long DegCod;
    long CrsCod;
+   long FirstNtfCod;
    unsigned NumUsrsToBeNotifiedByEMail = 0;
    unsigned NotifyEventMask = (1 << NotifyEvent);
 
-   /***** Get users who want to be notified from database ******/
+   /***** Build query to get users to be notified ******/
    switch (NotifyEvent)
      {
       case Ntf_EVENT_UNKNOWN:	// This function should not be called in this case
@@ -1175,50 +1172,46 @@ unsigned Ntf_StoreNotifyEventsToAllUsrs (Ntf_NotifyEvent_t NotifyEvent,long Cod)
             case Brw_ADMI_DOC_CRS:
             case Brw_ADMI_SHR_CRS:
             case Brw_ADMI_MRK_CRS:	// Notify all users in course except me
-               NumRows = DB_QuerySELECT (&mysql_res,"can not get users"
-					      " to be notified",
-					 "SELECT UsrCod FROM crs_usr"
-					 " WHERE CrsCod=%ld"
-					 " AND UsrCod<>%ld",
-					 Gbl.Hierarchy.Crs.CrsCod,
-					 Gbl.Usrs.Me.UsrDat.UsrCod);
+               DB_BuildQuery (&SubQuery,
+			      "SELECT UsrCod FROM crs_usr"
+			      " WHERE CrsCod=%ld"
+			      " AND UsrCod<>%ld",
+			      Gbl.Hierarchy.Crs.CrsCod,
+			      Gbl.Usrs.Me.UsrDat.UsrCod);
                break;
             case Brw_ADMI_TCH_CRS:	// Notify all teachers in course except me
-               NumRows = DB_QuerySELECT (&mysql_res,"can not get users"
-					      " to be notified",
-					 "SELECT UsrCod FROM crs_usr"
-					 " WHERE CrsCod=%ld"
-					 " AND UsrCod<>%ld"
-					 " AND Role=%u",	// Notify teachers only
-					 Gbl.Hierarchy.Crs.CrsCod,
-					 Gbl.Usrs.Me.UsrDat.UsrCod,
-					 (unsigned) Rol_TCH);
+               DB_BuildQuery (&SubQuery,
+			      "SELECT UsrCod FROM crs_usr"
+			      " WHERE CrsCod=%ld"
+			      " AND UsrCod<>%ld"
+			      " AND Role=%u",	// Notify teachers only
+			      Gbl.Hierarchy.Crs.CrsCod,
+			      Gbl.Usrs.Me.UsrDat.UsrCod,
+			      (unsigned) Rol_TCH);
                break;
             case Brw_ADMI_DOC_GRP:
             case Brw_ADMI_SHR_GRP:
             case Brw_ADMI_MRK_GRP:	// Notify all users in group except me
-               NumRows = DB_QuerySELECT (&mysql_res,"can not get users"
-					      " to be notified",
-					 "SELECT UsrCod FROM crs_grp_usr"
-					 " WHERE crs_grp_usr.GrpCod=%ld"
-					 " AND crs_grp_usr.UsrCod<>%ld",
-					 Gbl.Crs.Grps.GrpCod,
-					 Gbl.Usrs.Me.UsrDat.UsrCod);
+               DB_BuildQuery (&SubQuery,
+			      "SELECT UsrCod FROM crs_grp_usr"
+			      " WHERE crs_grp_usr.GrpCod=%ld"
+			      " AND crs_grp_usr.UsrCod<>%ld",
+			      Gbl.Crs.Grps.GrpCod,
+			      Gbl.Usrs.Me.UsrDat.UsrCod);
                break;
             case Brw_ADMI_TCH_GRP:	// Notify all teachers in group except me
-               NumRows = DB_QuerySELECT (&mysql_res,"can not get users"
-					      " to be notified",
-				         "SELECT crs_grp_usr.UsrCod"
-					 " FROM crs_grp_usr,crs_grp,crs_grp_types,crs_usr"
-					 " WHERE crs_grp_usr.GrpCod=%ld"
-					 " AND crs_grp_usr.UsrCod<>%ld"
-					 " AND crs_grp_usr.GrpCod=crs_grp.GrpCod"
-					 " AND crs_grp.GrpTypCod=crs_grp_types.GrpTypCod"
-					 " AND crs_grp_types.CrsCod=crs_usr.CrsCod"
-					 " AND crs_usr.Role=%u",	// Notify teachers only
-					 Gbl.Crs.Grps.GrpCod,
-					 Gbl.Usrs.Me.UsrDat.UsrCod,
-					 (unsigned) Rol_TCH);
+               DB_BuildQuery (&SubQuery,
+			      "SELECT crs_grp_usr.UsrCod"
+			      " FROM crs_grp_usr,crs_grp,crs_grp_types,crs_usr"
+			      " WHERE crs_grp_usr.GrpCod=%ld"
+			      " AND crs_grp_usr.UsrCod<>%ld"
+			      " AND crs_grp_usr.GrpCod=crs_grp.GrpCod"
+			      " AND crs_grp.GrpTypCod=crs_grp_types.GrpTypCod"
+			      " AND crs_grp_types.CrsCod=crs_usr.CrsCod"
+			      " AND crs_usr.Role=%u",	// Notify teachers only
+			      Gbl.Crs.Grps.GrpCod,
+			      Gbl.Usrs.Me.UsrDat.UsrCod,
+			      (unsigned) Rol_TCH);
                break;
             default:	// This function should not be called in other cases
                return 0;
@@ -1228,32 +1221,30 @@ unsigned Ntf_StoreNotifyEventsToAllUsrs (Ntf_NotifyEvent_t NotifyEvent,long Cod)
          // 1. If the assignment is available for the whole course ==> get all users enroled in the course except me
          // 2. If the assignment is available only for some groups ==> get all users who belong to any of the groups except me
          // Cases 1 and 2 are mutually exclusive, so the union returns the case 1 or 2
-         NumRows = DB_QuerySELECT (&mysql_res,"can not get users"
-					      " to be notified",
-				   "(SELECT crs_usr.UsrCod"
-				   " FROM assignments,crs_usr"
-				   " WHERE assignments.AsgCod=%ld"
-				   " AND assignments.AsgCod NOT IN"
-				   " (SELECT AsgCod FROM asg_grp WHERE AsgCod=%ld)"
-				   " AND assignments.CrsCod=crs_usr.CrsCod"
-				   " AND crs_usr.UsrCod<>%ld)"
-				   " UNION "
-				   "(SELECT DISTINCT crs_grp_usr.UsrCod"
-				   " FROM asg_grp,crs_grp_usr"
-				   " WHERE asg_grp.AsgCod=%ld"
-				   " AND asg_grp.GrpCod=crs_grp_usr.GrpCod"
-				   " AND crs_grp_usr.UsrCod<>%ld)",
-				   Cod,Cod,Gbl.Usrs.Me.UsrDat.UsrCod,
-				   Cod,Gbl.Usrs.Me.UsrDat.UsrCod);
+         DB_BuildQuery (&SubQuery,
+			"(SELECT crs_usr.UsrCod"
+			" FROM assignments,crs_usr"
+			" WHERE assignments.AsgCod=%ld"
+			" AND assignments.AsgCod NOT IN"
+			" (SELECT AsgCod FROM asg_grp WHERE AsgCod=%ld)"
+			" AND assignments.CrsCod=crs_usr.CrsCod"
+			" AND crs_usr.UsrCod<>%ld)"
+			" UNION "
+			"(SELECT DISTINCT crs_grp_usr.UsrCod"
+			" FROM asg_grp,crs_grp_usr"
+			" WHERE asg_grp.AsgCod=%ld"
+			" AND asg_grp.GrpCod=crs_grp_usr.GrpCod"
+			" AND crs_grp_usr.UsrCod<>%ld)",
+			Cod,Cod,Gbl.Usrs.Me.UsrDat.UsrCod,
+			Cod,Gbl.Usrs.Me.UsrDat.UsrCod);
          break;
       case Ntf_EVENT_EXAM_ANNOUNCEMENT:
       case Ntf_EVENT_NOTICE:
-         NumRows = DB_QuerySELECT (&mysql_res,"can not get users"
-					      " to be notified",
-				   "SELECT UsrCod FROM crs_usr"
-				   " WHERE CrsCod=%ld AND UsrCod<>%ld",
-				   Gbl.Hierarchy.Crs.CrsCod,
-				   Gbl.Usrs.Me.UsrDat.UsrCod);
+         DB_BuildQuery (&SubQuery,
+			"SELECT UsrCod FROM crs_usr"
+			" WHERE CrsCod=%ld AND UsrCod<>%ld",
+			Gbl.Hierarchy.Crs.CrsCod,
+			Gbl.Usrs.Me.UsrDat.UsrCod);
          break;
       case Ntf_EVENT_ENROLMENT_STD:	// This function should not be called in this case
       case Ntf_EVENT_ENROLMENT_NET:	// This function should not be called in this case
@@ -1263,44 +1254,41 @@ unsigned Ntf_StoreNotifyEventsToAllUsrs (Ntf_NotifyEvent_t NotifyEvent,long Cod)
 	 if (Usr_GetNumUsrsInCrss (Hie_Lvl_CRS,Gbl.Hierarchy.Crs.CrsCod,
 				   1 << Rol_TCH))
 	    // If this course has teachers ==> send notification to teachers
-	    NumRows = DB_QuerySELECT (&mysql_res,"can not get users"
-					         " to be notified",
-				      "SELECT UsrCod FROM crs_usr"
-				      " WHERE CrsCod=%ld"
-				      " AND UsrCod<>%ld"
-				      " AND Role=%u",	// Notify teachers only
-				      Gbl.Hierarchy.Crs.CrsCod,
-				      Gbl.Usrs.Me.UsrDat.UsrCod,
-				      (unsigned) Rol_TCH);
+	    DB_BuildQuery (&SubQuery,
+			   "SELECT UsrCod FROM crs_usr"
+			   " WHERE CrsCod=%ld"
+			   " AND UsrCod<>%ld"
+			   " AND Role=%u",	// Notify teachers only
+			   Gbl.Hierarchy.Crs.CrsCod,
+			   Gbl.Usrs.Me.UsrDat.UsrCod,
+			   (unsigned) Rol_TCH);
 	 else	// Course without teachers
 	    // If this course has no teachers
 	    // and I want to be a teacher (checked before calling this function
 	    // to not send requests to be a student to admins)
 	    // ==> send notification to administrators or superusers
-	    NumRows = DB_QuerySELECT (&mysql_res,"can not get users"
-					         " to be notified",
-				      "SELECT UsrCod FROM admin"
-				      " WHERE (Scope='%s'"
-				      " OR (Scope='%s' AND Cod=%ld)"
-				      " OR (Scope='%s' AND Cod=%ld)"
-				      " OR (Scope='%s' AND Cod=%ld))"
-				      " AND UsrCod<>%ld",
-				      Sco_GetDBStrFromScope (Hie_Lvl_SYS),
-				      Sco_GetDBStrFromScope (Hie_Lvl_INS),Gbl.Hierarchy.Ins.InsCod,
-				      Sco_GetDBStrFromScope (Hie_Lvl_CTR),Gbl.Hierarchy.Ctr.CtrCod,
-				      Sco_GetDBStrFromScope (Hie_Lvl_DEG),Gbl.Hierarchy.Deg.DegCod,
-				      Gbl.Usrs.Me.UsrDat.UsrCod);
+	    DB_BuildQuery (&SubQuery,
+			   "SELECT UsrCod FROM admin"
+			   " WHERE (Scope='%s'"
+			   " OR (Scope='%s' AND Cod=%ld)"
+			   " OR (Scope='%s' AND Cod=%ld)"
+			   " OR (Scope='%s' AND Cod=%ld))"
+			   " AND UsrCod<>%ld",
+			   Sco_GetDBStrFromScope (Hie_Lvl_SYS),
+			   Sco_GetDBStrFromScope (Hie_Lvl_INS),Gbl.Hierarchy.Ins.InsCod,
+			   Sco_GetDBStrFromScope (Hie_Lvl_CTR),Gbl.Hierarchy.Ctr.CtrCod,
+			   Sco_GetDBStrFromScope (Hie_Lvl_DEG),Gbl.Hierarchy.Deg.DegCod,
+			   Gbl.Usrs.Me.UsrDat.UsrCod);
          break;
       case Ntf_EVENT_TIMELINE_COMMENT:	// New comment to one of my social notes or comments
          // Cod is the code of the social publishing
-	 NumRows = DB_QuerySELECT (&mysql_res,"can not get users"
-					      " to be notified",
-				   "SELECT DISTINCT(PublisherCod) FROM tl_pubs"
-				   " WHERE NotCod="
-				   "(SELECT NotCod FROM tl_pubs"
-				   " WHERE PubCod=%ld)"
-				   " AND PublisherCod<>%ld",
-				   Cod,Gbl.Usrs.Me.UsrDat.UsrCod);
+	 DB_BuildQuery (&SubQuery,
+			"SELECT DISTINCT PublisherCod AS UsrCod FROM tl_pubs"
+			" WHERE NotCod="
+			"(SELECT NotCod FROM tl_pubs"
+			" WHERE PubCod=%ld)"
+			" AND PublisherCod<>%ld",
+			Cod,Gbl.Usrs.Me.UsrDat.UsrCod);
          break;
       case Ntf_EVENT_TIMELINE_FAV:		// New favourite to one of my social notes or comments
       case Ntf_EVENT_TIMELINE_SHARE:		// New sharing of one of my social notes
@@ -1315,34 +1303,31 @@ unsigned Ntf_StoreNotifyEventsToAllUsrs (Ntf_NotifyEvent_t NotifyEvent,long Cod)
 	 switch (ForumSelected.Type)
 	   {
 	    case For_FORUM_COURSE_USRS:
-	       NumRows = DB_QuerySELECT (&mysql_res,"can not get users"
-					            " to be notified",
-					 "SELECT UsrCod FROM crs_usr"
-					 " WHERE CrsCod=%ld AND UsrCod<>%ld",
-					 Gbl.Hierarchy.Crs.CrsCod,
-					 Gbl.Usrs.Me.UsrDat.UsrCod);
+	       DB_BuildQuery (&SubQuery,
+			      "SELECT UsrCod FROM crs_usr"
+			      " WHERE CrsCod=%ld AND UsrCod<>%ld",
+			      Gbl.Hierarchy.Crs.CrsCod,
+			      Gbl.Usrs.Me.UsrDat.UsrCod);
 	       break;
 	    case For_FORUM_COURSE_TCHS:
-	       NumRows = DB_QuerySELECT (&mysql_res,"can not get users"
-					            " to be notified",
-					 "SELECT UsrCod FROM crs_usr"
-					 " WHERE CrsCod=%ld AND Role=%u AND UsrCod<>%ld",
-					 Gbl.Hierarchy.Crs.CrsCod,
-					 (unsigned) Rol_TCH,
-					 Gbl.Usrs.Me.UsrDat.UsrCod);
+	       DB_BuildQuery (&SubQuery,
+			      "SELECT UsrCod FROM crs_usr"
+			      " WHERE CrsCod=%ld AND Role=%u AND UsrCod<>%ld",
+			      Gbl.Hierarchy.Crs.CrsCod,
+			      (unsigned) Rol_TCH,
+			      Gbl.Usrs.Me.UsrDat.UsrCod);
 	       break;
 	    default:
 	       return 0;
 	   }
          break;
       case Ntf_EVENT_FORUM_REPLY:
-         NumRows = DB_QuerySELECT (&mysql_res,"can not get users"
-					      " to be notified",
-				   "SELECT DISTINCT(UsrCod) FROM forum_post"
-				   " WHERE ThrCod = (SELECT ThrCod FROM forum_post"
-				   " WHERE PstCod=%ld)"
-				   " AND UsrCod<>%ld",
-				   Cod,Gbl.Usrs.Me.UsrDat.UsrCod);
+         DB_BuildQuery (&SubQuery,
+			"SELECT DISTINCT UsrCod FROM forum_post"
+			" WHERE ThrCod = (SELECT ThrCod FROM forum_post"
+			" WHERE PstCod=%ld)"
+			" AND UsrCod<>%ld",
+			Cod,Gbl.Usrs.Me.UsrDat.UsrCod);
          break;
       case Ntf_EVENT_MESSAGE:		// This function should not be called in this case
 	 return 0;
@@ -1350,33 +1335,32 @@ unsigned Ntf_StoreNotifyEventsToAllUsrs (Ntf_NotifyEvent_t NotifyEvent,long Cod)
          // 1. If the survey is available for the whole course ==> get users enroled in the course whose role is available in survey, except me
          // 2. If the survey is available only for some groups ==> get users who belong to any of the groups and whose role is available in survey, except me
          // Cases 1 and 2 are mutually exclusive, so the union returns the case 1 or 2
-         NumRows = DB_QuerySELECT (&mysql_res,"can not get users"
-					      " to be notified",
-				   "(SELECT crs_usr.UsrCod"
-				   " FROM surveys,crs_usr"
-				   " WHERE surveys.SvyCod=%ld"
-				   " AND surveys.SvyCod NOT IN"
-				   " (SELECT SvyCod FROM svy_grp WHERE SvyCod=%ld)"
-				   " AND surveys.Scope='%s' AND surveys.Cod=crs_usr.CrsCod"
-				   " AND crs_usr.UsrCod<>%ld"
-				   " AND (surveys.Roles&(1<<crs_usr.Role))<>0)"
-				   " UNION "
-				   "(SELECT DISTINCT crs_grp_usr.UsrCod"
-				   " FROM svy_grp,crs_grp_usr,surveys,crs_usr"
-				   " WHERE svy_grp.SvyCod=%ld"
-				   " AND svy_grp.GrpCod=crs_grp_usr.GrpCod"
-				   " AND crs_grp_usr.UsrCod=crs_usr.UsrCod"
-				   " AND crs_grp_usr.UsrCod<>%ld"
-				   " AND svy_grp.SvyCod=surveys.SvyCod"
-				   " AND surveys.Scope='%s' AND surveys.Cod=crs_usr.CrsCod"
-				   " AND (surveys.Roles&(1<<crs_usr.Role))<>0)",
-				   Cod,
-				   Cod,
-				   Sco_GetDBStrFromScope (Hie_Lvl_CRS),
-				   Gbl.Usrs.Me.UsrDat.UsrCod,
-				   Cod,
-				   Gbl.Usrs.Me.UsrDat.UsrCod,
-				   Sco_GetDBStrFromScope (Hie_Lvl_CRS));
+         DB_BuildQuery (&SubQuery,
+			"(SELECT crs_usr.UsrCod"
+			" FROM surveys,crs_usr"
+			" WHERE surveys.SvyCod=%ld"
+			" AND surveys.SvyCod NOT IN"
+			" (SELECT SvyCod FROM svy_grp WHERE SvyCod=%ld)"
+			" AND surveys.Scope='%s' AND surveys.Cod=crs_usr.CrsCod"
+			" AND crs_usr.UsrCod<>%ld"
+			" AND (surveys.Roles&(1<<crs_usr.Role))<>0)"
+			" UNION "
+			"(SELECT DISTINCT crs_grp_usr.UsrCod"
+			" FROM svy_grp,crs_grp_usr,surveys,crs_usr"
+			" WHERE svy_grp.SvyCod=%ld"
+			" AND svy_grp.GrpCod=crs_grp_usr.GrpCod"
+			" AND crs_grp_usr.UsrCod=crs_usr.UsrCod"
+			" AND crs_grp_usr.UsrCod<>%ld"
+			" AND svy_grp.SvyCod=surveys.SvyCod"
+			" AND surveys.Scope='%s' AND surveys.Cod=crs_usr.CrsCod"
+			" AND (surveys.Roles&(1<<crs_usr.Role))<>0)",
+			Cod,
+			Cod,
+			Sco_GetDBStrFromScope (Hie_Lvl_CRS),
+			Gbl.Usrs.Me.UsrDat.UsrCod,
+			Cod,
+			Gbl.Usrs.Me.UsrDat.UsrCod,
+			Sco_GetDBStrFromScope (Hie_Lvl_CRS));
          break;
      }
 
@@ -1414,44 +1398,46 @@ unsigned Ntf_StoreNotifyEventsToAllUsrs (Ntf_NotifyEvent_t NotifyEvent,long Cod)
       CrsCod = Gbl.Hierarchy.Crs.CrsCod;
      }
 
-   if (NumRows) // Users found
-     {
-      /***** Initialize structure with user's data *****/
-      Usr_UsrDataConstructor (&UsrDat);
-
-      /***** Notify the users one by one *****/
-      for (NumRow = 0;
-	   NumRow < NumRows;
-	   NumRow++)
-	{
-         /* Get next user */
-         row = mysql_fetch_row (mysql_res);
-
-         /* Get user code */
-         UsrDat.UsrCod = Str_ConvertStrCodToLongCod (row[0]);
-
-	 if (Usr_ChkUsrCodAndGetAllUsrDataFromUsrCod (&UsrDat,Usr_DONT_GET_PREFS))		// Get user's data from the database
-            if ((UsrDat.NtfEvents.CreateNotif & NotifyEventMask))	// Create notification
-              {
-	       if ((UsrDat.NtfEvents.SendEmail & NotifyEventMask))	// Send notification by email
-		 {
-		  Ntf_StoreNotifyEventToOneUser (NotifyEvent,&UsrDat,Cod,
-						 (Ntf_Status_t) Ntf_STATUS_BIT_EMAIL,
-						 InsCod,CtrCod,DegCod,CrsCod);
-		  NumUsrsToBeNotifiedByEMail++;
-		 }
-	       else							// Don't send notification by email
-		  Ntf_StoreNotifyEventToOneUser (NotifyEvent,&UsrDat,Cod,(Ntf_Status_t) 0,
-						 InsCod,CtrCod,DegCod,CrsCod);
-              }
-        }
-
-      /***** Free memory used for user's data *****/
-      Usr_UsrDataDestructor (&UsrDat);
-     }
-
-   /***** Free structure that stores the query result *****/
-   DB_FreeMySQLResult (&mysql_res);
+   /***** Store notify event to all users who want to be notified *****/
+   // Users' settings are checked in the database
+   // instead of getting the data of every user
+   FirstNtfCod =
+   DB_QueryINSERTandReturnCode ("can not create new notification events",
+				"INSERT INTO notif"
+				" (NotifyEvent,ToUsrCod,FromUsrCod,"
+				"InsCod,CtrCod,DegCod,CrsCod,Cod,TimeNotif,Status)"
+				" SELECT DISTINCT"
+				" %u,usr_data.UsrCod,%ld,"
+				"%ld,%ld,%ld,%ld,%ld,NOW(),"
+				"IF(usr_data.EmailNtfEvents<%u"
+				" AND (usr_data.EmailNtfEvents&%u)<>0,%u,0)"	// Send notification by email?
+				" FROM (%s) AS ntf_rcpts,usr_data"
+				" WHERE ntf_rcpts.UsrCod=usr_data.UsrCod"
+				" AND (usr_data.NotifNtfEvents&%u)<>0",		// Create notification?
+				(unsigned) NotifyEvent,Gbl.Usrs.Me.UsrDat.UsrCod,
+				InsCod,CtrCod,DegCod,CrsCod,Cod,
+				(unsigned) (1 << Ntf_NUM_NOTIFY_EVENTS),	// Maximum binary value for NotifyEvents is 000...0011...11
+				NotifyEventMask,(unsigned) Ntf_STATUS_BIT_EMAIL,
+				SubQuery,
+				NotifyEventMask);
+   free (SubQuery);
+
+   /***** Get number of users to be notified by email *****/
+   // The notify events just stored have codes >= FirstNtfCod
+   if (mysql_affected_rows (&Gbl.mysql))
+      NumUsrsToBeNotifiedByEMail =
+      (unsigned) DB_QueryCOUNT ("can not get number of users to be notified by email",
+				"SELECT COUNT(*) FROM notif"
+				" WHERE NtfCod>=%ld"
+				" AND NotifyEvent=%u"
+				" AND FromUsrCod=%ld"
+				" AND Cod=%ld"
+				" AND (Status&%u)<>0",
+				FirstNtfCod,
+				(unsigned) NotifyEvent,
+				Gbl.Usrs.Me.UsrDat.UsrCod,
+				Cod,
+				(unsigned) Ntf_STATUS_BIT_EMAIL);
 
    return NumUsrsToBeNotifiedByEMail;
   }
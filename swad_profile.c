@@ -28,12 +28,14 @@
 #define _GNU_SOURCE 		// For asprintf
 #include <stddef.h>		// For NULL
 #include <stdio.h>		// For asprintf
+#include <stdlib.h>		// For malloc, free, qsort
 #include <string.h>		// For string functions
 
 #include "swad_box.h"
 #include "swad_config.h"
 #include "swad_database.h"
 #include "swad_figure.h"
+#include "swad_figure_cache.h"
 #include "swad_follow.h"
 #include "swad_form.h"
 #include "swad_forum.h"
@@ -50,6 +52,7 @@
 #include "swad_profile.h"
 #include "swad_role.h"
 #include "swad_role_type.h"
+#include "swad_scope.h"
 #include "swad_setting.h"
 #include "swad_theme.h"
 #include "swad_timeline.h"
@@ -64,10 +67,43 @@
 /***************************** Private constants *****************************/
 /*****************************************************************************/
 
+#define Prf_MAX_ROWS_PER_RANKS_QUERY	256	// Number of users written back in each multi-row query
+#define Prf_MAX_BYTES_RANKS_ROW		128	// ,(UsrCod,RankClicks,RankClicksPerDay,...)
+
 /*****************************************************************************/
 /******************************* Private types *******************************/
 /*****************************************************************************/
 
+#define Prf_NUM_RANKINGS 6
+typedef enum
+  {
+   Prf_RANKING_CLICKS		= 0,
+   Prf_RANKING_CLICKS_PER_DAY	= 1,
+   Prf_RANKING_FILE_VIEWS	= 2,
+   Prf_RANKING_SOC_PUB		= 3,
+   Prf_RANKING_FOR_PST		= 4,
+   Prf_RANKING_MSG_SNT		= 5,
+  } Prf_Ranking_t;
+
+struct Prf_UsrRanks
+  {
+   unsigned Rank[Prf_NUM_RANKINGS];	// 0 ==> user not yet ranked
+   unsigned NumUsrs[Prf_NUM_RANKINGS];	// Number of users in each ranking
+  };
+
+struct Prf_RankedUsr
+  {
+   long UsrCod;
+   double Value[Prf_NUM_RANKINGS];	// < 0 ==> user out of ranking
+   unsigned Rank[Prf_NUM_RANKINGS];	//   0 ==> user out of ranking
+  };
+
+struct Prf_RankEntry
+  {
+   double Value;
+   unsigned NumUsr;			// Index in array of ranked users
+  };
+
 /*****************************************************************************/
 /************** External global variables from others modules ****************/
 /*****************************************************************************/
@@ -78,6 +114,16 @@ extern struct Globals Gbl;
 /************************* Private global variables **************************/
 /*****************************************************************************/
 
+static const FigCch_FigureCached_t Prf_FigureNumUsrsInRanking[Prf_NUM_RANKINGS] =
+  {
+   [Prf_RANKING_CLICKS        ] = FigCch_NUM_USRS_RANK_CLICKS,
+   [Prf_RANKING_CLICKS_PER_DAY] = FigCch_NUM_USRS_RANK_CLICKS_DAY,
+   [Prf_RANKING_FILE_VIEWS    ] = FigCch_NUM_USRS_RANK_FILE_VIEWS,
+   [Prf_RANKING_SOC_PUB       ] = FigCch_NUM_USRS_RANK_SOC_PUB,
+   [Prf_RANKING_FOR_PST       ] = FigCch_NUM_USRS_RANK_FOR_PST,
+   [Prf_RANKING_MSG_SNT       ] = FigCch_NUM_USRS_RANK_MSG_SNT,
+  };
+
 /*****************************************************************************/
 /***************************** Private prototypes ****************************/
 /*****************************************************************************/
@@ -88,23 +134,37 @@ static void Prf_ShowNumCrssWithRole (const struct UsrData *UsrDat,
 				     Rol_Role_t Role);
 static void Prf_ShowNumFilesCurrentlyPublished (const struct UsrData *UsrDat);
 static void Prf_ShowNumClicks (const struct UsrData *UsrDat,
-                               const struct UsrFigures *UsrFigures);
+                               const struct UsrFigures *UsrFigures,
+                               const struct Prf_UsrRanks *UsrRanks);
 static void Prf_ShowNumFileViews (const struct UsrData *UsrDat,
-                                  const struct UsrFigures *UsrFigures);
+                                  const struct UsrFigures *UsrFigures,
+                                  const struct Prf_UsrRanks *UsrRanks);
 static void Prf_ShowNumSocialPublications (const struct UsrData *UsrDat,
-                                           const struct UsrFigures *UsrFigures);
+                                           const struct UsrFigures *UsrFigures,
+                                           const struct Prf_UsrRanks *UsrRanks);
 static void Prf_ShowNumForumPosts (const struct UsrData *UsrDat,
-                                   const struct UsrFigures *UsrFigures);
+                                   const struct UsrFigures *UsrFigures,
+                                   const struct Prf_UsrRanks *UsrRanks);
 static void Prf_ShowNumMessagesSent (const struct UsrData *UsrDat,
-                                     const struct UsrFigures *UsrFigures);
+                                     const struct UsrFigures *UsrFigures,
+                                     const struct Prf_UsrRanks *UsrRanks);
 static void Prf_StartListItem (const char *Title,const char *Icon);
 static void Prf_EndListItem (void);
 static void Prf_PutLinkCalculateFigures (const char *EncryptedUsrCod);
 
+static void Prf_GetUsrRanks (long UsrCod,struct Prf_UsrRanks *UsrRanks);
+static bool Prf_GetNumUsrsInRankingsFromCache (unsigned NumUsrs[Prf_NUM_RANKINGS],
+                                               time_t TimeCached);
+static bool Prf_ClaimComputationOfRankings (void);
+static void Prf_ComputeAndStoreRankings (unsigned NumUsrs[Prf_NUM_RANKINGS]);
+static int Prf_CompareRankEntries (const void *a,const void *b);
+static void Prf_StoreRanks (const char *Rows);
+
 static unsigned long Prf_GetRankingFigure (long UsrCod,const char *FieldName);
-static unsigned long Prf_GetNumUsrsWithFigure (const char *FieldName);
 static unsigned long Prf_GetRankingNumClicksPerDay (long UsrCod);
-static unsigned long Prf_GetNumUsrsWithNumClicksPerDay (void);
+static void Prf_ShowRankingOfUsr (long UsrCod,
+                                  const struct Prf_UsrRanks *UsrRanks,
+                                  Prf_Ranking_t Ranking);
 static void Prf_ShowRanking (unsigned long Rank,unsigned long NumUsrs);
 
 static void Prf_GetFirstClickFromLogAndStoreAsUsrFigure (long UsrCod);
@@ -403,6 +463,7 @@ void Prf_ShowDetailsUserProfile (const struct UsrData *UsrDat)
   {
    bool UsrIsBannedFromRanking;
    struct UsrFigures UsrFigures;
+   struct Prf_UsrRanks UsrRanks;
    Rol_Role_t Role;
 
    /***** Get figures *****/
@@ -435,23 +496,26 @@ void Prf_ShowDetailsUserProfile (const struct UsrData *UsrDat)
    UsrIsBannedFromRanking = Usr_CheckIfUsrBanned (UsrDat->UsrCod);
    if (!UsrIsBannedFromRanking)
      {
+      /* Get positions of the user in rankings */
+      Prf_GetUsrRanks (UsrDat->UsrCod,&UsrRanks);
+
       /* Start right list */
       HTM_UL_Begin ("class=\"PRF_FIG_UL DAT_NOBR_N\"");
 
       /* Number of clicks */
-      Prf_ShowNumClicks (UsrDat,&UsrFigures);
+      Prf_ShowNumClicks (UsrDat,&UsrFigures,&UsrRanks);
 
       /* Number of file views */
-      Prf_ShowNumFileViews (UsrDat,&UsrFigures);
+      Prf_ShowNumFileViews (UsrDat,&UsrFigures,&UsrRanks);
 
       /* Number of social publications */
-      Prf_ShowNumSocialPublications (UsrDat,&UsrFigures);
+      Prf_ShowNumSocialPublications (UsrDat,&UsrFigures,&UsrRanks);
 
       /* Number of posts in forums */
-      Prf_ShowNumForumPosts (UsrDat,&UsrFigures);
+      Prf_ShowNumForumPosts (UsrDat,&UsrFigures,&UsrRanks);
 
       /* Number of messages sent */
-      Prf_ShowNumMessagesSent (UsrDat,&UsrFigures);
+      Prf_ShowNumMessagesSent (UsrDat,&UsrFigures,&UsrRanks);
 
       /* End right list */
       HTM_UL_End ();
@@ -594,7 +658,8 @@ static void Prf_ShowNumFilesCurrentlyPublished (const struct UsrData *UsrDat)
 /*****************************************************************************/
 
 static void Prf_ShowNumClicks (const struct UsrData *UsrDat,
-                               const struct UsrFigures *UsrFigures)
+                               const struct UsrFigures *UsrFigures,
+                               const struct Prf_UsrRanks *UsrRanks)
   {
    extern const char *Txt_Clicks;
    extern const char *Txt_clicks;
@@ -607,16 +672,14 @@ static void Prf_ShowNumClicks (const struct UsrData *UsrDat,
      {
       HTM_Long (UsrFigures->NumClicks);
       HTM_TxtF ("&nbsp;%s&nbsp;",Txt_clicks);
-      Prf_ShowRanking (Prf_GetRankingFigure (UsrDat->UsrCod,"NumClicks"),
-		       Prf_GetNumUsrsWithFigure ("NumClicks"));
+      Prf_ShowRankingOfUsr (UsrDat->UsrCod,UsrRanks,Prf_RANKING_CLICKS);
       if (UsrFigures->NumDays > 0)
 	{
 	 HTM_TxtF ("&nbsp;%s","(");
 	 HTM_DoubleFewDigits ((double) UsrFigures->NumClicks /
 		     (double) UsrFigures->NumDays);
 	 HTM_TxtF ("/%s&nbsp;",Txt_day);
-	 Prf_ShowRanking (Prf_GetRankingNumClicksPerDay (UsrDat->UsrCod),
-			  Prf_GetNumUsrsWithNumClicksPerDay ());
+	 Prf_ShowRankingOfUsr (UsrDat->UsrCod,UsrRanks,Prf_RANKING_CLICKS_PER_DAY);
 	 HTM_Txt (")");
 	}
      }
@@ -632,7 +695,8 @@ static void Prf_ShowNumClicks (const struct UsrData *UsrDat,
 /*****************************************************************************/
 
 static void Prf_ShowNumFileViews (const struct UsrData *UsrDat,
-                                  const struct UsrFigures *UsrFigures)
+                                  const struct UsrFigures *UsrFigures,
+                                  const struct Prf_UsrRanks *UsrRanks)
   {
    extern const char *Txt_Downloads;
    extern const char *Txt_download;
@@ -647,8 +711,7 @@ static void Prf_ShowNumFileViews (const struct UsrData *UsrDat,
       HTM_Long (UsrFigures->NumFileViews);
       HTM_TxtF ("&nbsp;%s&nbsp;",(UsrFigures->NumFileViews == 1) ? Txt_download :
 						         Txt_downloads);
-      Prf_ShowRanking (Prf_GetRankingFigure (UsrDat->UsrCod,"NumFileViews"),
-		       Prf_GetNumUsrsWithFigure ("NumFileViews"));
+      Prf_ShowRankingOfUsr (UsrDat->UsrCod,UsrRanks,Prf_RANKING_FILE_VIEWS);
       if (UsrFigures->NumDays > 0)
 	{
 	 HTM_TxtF ("&nbsp;%s","(");
@@ -669,7 +732,8 @@ static void Prf_ShowNumFileViews (const struct UsrData *UsrDat,
 /*****************************************************************************/
 
 static void Prf_ShowNumSocialPublications (const struct UsrData *UsrDat,
-                                           const struct UsrFigures *UsrFigures)
+                                           const struct UsrFigures *UsrFigures,
+                                           const struct Prf_UsrRanks *UsrRanks)
   {
    extern const char *Txt_Timeline;
    extern const char *Txt_TIMELINE_post;
@@ -684,8 +748,7 @@ static void Prf_ShowNumSocialPublications (const struct UsrData *UsrDat,
       HTM_Long (UsrFigures->NumSocPub);
       HTM_TxtF ("&nbsp;%s&nbsp;",UsrFigures->NumSocPub == 1 ? Txt_TIMELINE_post :
 					                      Txt_TIMELINE_posts);
-      Prf_ShowRanking (Prf_GetRankingFigure (UsrDat->UsrCod,"NumSocPub"),
-		       Prf_GetNumUsrsWithFigure ("NumSocPub"));
+      Prf_ShowRankingOfUsr (UsrDat->UsrCod,UsrRanks,Prf_RANKING_SOC_PUB);
       if (UsrFigures->NumDays > 0)
 	{
 	 HTM_TxtF ("&nbsp;%s","(");
@@ -706,7 +769,8 @@ static void Prf_ShowNumSocialPublications (const struct UsrData *UsrDat,
 /*****************************************************************************/
 
 static void Prf_ShowNumForumPosts (const struct UsrData *UsrDat,
-                                   const struct UsrFigures *UsrFigures)
+                                   const struct UsrFigures *UsrFigures,
+                                   const struct Prf_UsrRanks *UsrRanks)
   {
    extern const char *Txt_Forums;
    extern const char *Txt_FORUM_post;
@@ -721,8 +785,7 @@ static void Prf_ShowNumForumPosts (const struct UsrData *UsrDat,
       HTM_Long (UsrFigures->NumForPst);
       HTM_TxtF ("&nbsp;%s&nbsp;",UsrFigures->NumForPst == 1 ? Txt_FORUM_post :
 					                      Txt_FORUM_posts);
-      Prf_ShowRanking (Prf_GetRankingFigure (UsrDat->UsrCod,"NumForPst"),
-		       Prf_GetNumUsrsWithFigure ("NumForPst"));
+      Prf_ShowRankingOfUsr (UsrDat->UsrCod,UsrRanks,Prf_RANKING_FOR_PST);
       if (UsrFigures->NumDays > 0)
 	{
 	 HTM_TxtF ("&nbsp;%s","(");
@@ -743,7 +806,8 @@ static void Prf_ShowNumForumPosts (const struct UsrData *UsrDat,
 /*****************************************************************************/
 
 static void Prf_ShowNumMessagesSent (const struct UsrData *UsrDat,
-                                     const struct UsrFigures *UsrFigures)
+                                     const struct UsrFigures *UsrFigures,
+                                     const struct Prf_UsrRanks *UsrRanks)
   {
    extern const char *Txt_Messages;
    extern const char *Txt_message;
@@ -758,8 +822,7 @@ static void Prf_ShowNumMessagesSent (const struct UsrData *UsrDat,
       HTM_Long (UsrFigures->NumMsgSnt);
       HTM_TxtF ("&nbsp;%s&nbsp;",UsrFigures->NumMsgSnt == 1 ? Txt_message :
 					                      Txt_messages);
-      Prf_ShowRanking (Prf_GetRankingFigure (UsrDat->UsrCod,"NumMsgSnt"),
-		       Prf_GetNumUsrsWithFigure ("NumMsgSnt"));
+      Prf_ShowRankingOfUsr (UsrDat->UsrCod,UsrRanks,Prf_RANKING_MSG_SNT);
       if (UsrFigures->NumDays > 0)
 	{
 	 HTM_TxtF ("&nbsp;%s","(");
@@ -877,9 +940,305 @@ void Prf_GetUsrFigures (long UsrCod,struct UsrFigures *UsrFigures)
    DB_FreeMySQLResult (&mysql_res);
   }
 
+/*****************************************************************************/
+/********** Get positions of a user in the rankings of user's figures ********/
+/*****************************************************************************/
+
+static void Prf_GetUsrRanks (long UsrCod,struct Prf_UsrRanks *UsrRanks)
+  {
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   Prf_Ranking_t Ranking;
+
+   /***** Compute rankings again if they are outdated.
+          Only one process computes them,
+          the others use the previous rankings meanwhile *****/
+   if (!Prf_GetNumUsrsInRankingsFromCache (UsrRanks->NumUsrs,
+                                           Cfg_TIME_TO_UPDATE_USR_RANKS))
+     {
+      if (Prf_ClaimComputationOfRankings ())
+	 Prf_ComputeAndStoreRankings (UsrRanks->NumUsrs);
+      else
+	 Prf_GetNumUsrsInRankingsFromCache (UsrRanks->NumUsrs,
+	                                    Cfg_TIME_TO_KEEP_OLD_USR_RANKS);
+     }
+
+   /***** Reset ranks *****/
+   for (Ranking  = (Prf_Ranking_t) 0;
+	Ranking <= (Prf_Ranking_t) (Prf_NUM_RANKINGS - 1);
+	Ranking++)
+      UsrRanks->Rank[Ranking] = 0;
+
+   /***** Get user's ranks from database *****/
+   if (DB_QuerySELECT (&mysql_res,"can not get user's ranks",
+		       "SELECT RankClicks,"		// row[0]
+			      "RankClicksPerDay,"	// row[1]
+			      "RankFileViews,"		// row[2]
+			      "RankSocPub,"		// row[3]
+			      "RankForPst,"		// row[4]
+			      "RankMsgSnt"		// row[5]
+		       " FROM usr_ranks WHERE UsrCod=%ld",
+		       UsrCod))
+     {
+      row = mysql_fetch_row (mysql_res);
+
+      /* Get ranks (row[0]...row[5]) */
+      for (Ranking  = (Prf_Ranking_t) 0;
+	   Ranking <= (Prf_Ranking_t) (Prf_NUM_RANKINGS - 1);
+	   Ranking++)
+	 if (sscanf (row[Ranking],"%u",&UsrRanks->Rank[Ranking]) != 1)
+	    UsrRanks->Rank[Ranking] = 0;
+     }
+
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+  }
+
+/*****************************************************************************/
+/************* Get number of users in rankings from figures cache ************/
+/*****************************************************************************/
+// Return true if all the numbers are cached and updated
+// less than TimeCached seconds ago
+
+static bool Prf_GetNumUsrsInRankingsFromCache (unsigned NumUsrs[Prf_NUM_RANKINGS],
+                                               time_t TimeCached)
+  {
+   Prf_Ranking_t Ranking;
+   bool AllFound = true;
+
+   for (Ranking  = (Prf_Ranking_t) 0;
+	Ranking <= (Prf_Ranking_t) (Prf_NUM_RANKINGS - 1);
+	Ranking++)
+      if (!FigCch_GetFigureFromCacheNotOlderThan (Prf_FigureNumUsrsInRanking[Ranking],Hie_Lvl_SYS,-1L,
+                                                  FigCch_UNSIGNED,&NumUsrs[Ranking],
+                                                  TimeCached))
+	 AllFound = false;
+
+   return AllFound;
+  }
+
+/*****************************************************************************/
+/************ Claim the computation of rankings for this process *************/
+/*****************************************************************************/
+// The time of the cached number of users in the first ranking
+// is updated only if it is outdated, so only one process succeeds.
+// Return true if this process must compute the rankings
+
+static bool Prf_ClaimComputationOfRankings (void)
+  {
+   /***** First time: insert the cached figure *****/
+   DB_QueryINSERT ("can not claim computation of rankings",
+		   "INSERT IGNORE INTO figures"
+		   " (Figure,Scope,Cod,ValueInt,ValueDouble,LastUpdate)"
+		   " VALUES"
+		   " (%u,'%s',-1,0,'0.0',NOW())",
+		   (unsigned) Prf_FigureNumUsrsInRanking[0],
+		   Sco_GetDBStrFromScope (Hie_Lvl_SYS));
+   if (mysql_affected_rows (&Gbl.mysql))
+      return true;
+
+   /***** Next times: update time of the cached figure if outdated *****/
+   DB_QueryUPDATE ("can not claim computation of rankings",
+		   "UPDATE figures SET LastUpdate=NOW()"
+		   " WHERE Figure=%u AND Scope='%s' AND Cod=-1"
+		   " AND LastUpdate<=FROM_UNIXTIME(UNIX_TIMESTAMP()-%lu)",
+		   (unsigned) Prf_FigureNumUsrsInRanking[0],
+		   Sco_GetDBStrFromScope (Hie_Lvl_SYS),
+		   (unsigned long) Cfg_TIME_TO_UPDATE_USR_RANKS);
+   return mysql_affected_rows (&Gbl.mysql) != 0;
+  }
+
+/*****************************************************************************/
+/********* Compute all the rankings of user's figures in one pass and ********/
+/********* store the position of each user and the number of users   ********/
+/*****************************************************************************/
+// Ranks are not dense: users with the same value share the same position,
+// and the next position is the number of users with a greater value plus one
+
+static void Prf_ComputeAndStoreRankings (unsigned NumUsrs[Prf_NUM_RANKINGS])
+  {
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;
+   unsigned NumUsrsWithFigures;
+   unsigned NumUsr;
+   unsigned NumEntry;
+   struct Prf_RankedUsr *Usrs;
+   struct Prf_RankEntry *Entries;
+   Prf_Ranking_t Ranking;
+   unsigned Rank;
+   char *Rows;
+   size_t RowsSize;
+   unsigned NumRowsInQuery = 0;
+   char Row[Prf_MAX_BYTES_RANKS_ROW + 1];
+
+   /***** Reset number of users in rankings *****/
+   for (Ranking  = (Prf_Ranking_t) 0;
+	Ranking <= (Prf_Ranking_t) (Prf_NUM_RANKINGS - 1);
+	Ranking++)
+      NumUsrs[Ranking] = 0;
+
+   /***** Get figures of all users in one query *****/
+   NumUsrsWithFigures =
+   (unsigned) DB_QuerySELECT (&mysql_res,"can not get users' figures",
+			      "SELECT UsrCod,"					// row[0]
+				     "NumClicks,"				// row[1]
+				     "IF(NumClicks>0"
+				        " AND FirstClickTime>FROM_UNIXTIME(0),"
+				        "NumClicks/(DATEDIFF(NOW(),FirstClickTime)+1),"
+				        "-1),"					// row[2]
+				     "NumFileViews,"				// row[3]
+				     "NumSocPub,"				// row[4]
+				     "NumForPst,"				// row[5]
+				     "NumMsgSnt"				// row[6]
+			      " FROM usr_figures");
+
+   if (NumUsrsWithFigures)
+     {
+      /***** Allocate memory for users and for one ranking *****/
+      if ((Usrs = malloc ((size_t) NumUsrsWithFigures *
+                          sizeof (*Usrs))) == NULL)
+	 Lay_NotEnoughMemoryExit ();
+      if ((Entries = malloc ((size_t) NumUsrsWithFigures *
+                             sizeof (*Entries))) == NULL)
+	 Lay_NotEnoughMemoryExit ();
+
+      /***** Get figures of each user *****/
+      Str_SetDecimalPointToUS ();	// To get the decimal point as a dot
+      for (NumUsr = 0;
+	   NumUsr < NumUsrsWithFigures;
+	   NumUsr++)
+	{
+	 row = mysql_fetch_row (mysql_res);
+
+	 /* Get user's code (row[0]) */
+	 Usrs[NumUsr].UsrCod = Str_ConvertStrCodToLongCod (row[0]);
+
+	 /* Get figures (row[1]...row[6]) */
+	 for (Ranking  = (Prf_Ranking_t) 0;
+	      Ranking <= (Prf_Ranking_t) (Prf_NUM_RANKINGS - 1);
+	      Ranking++)
+	   {
+	    if (sscanf (row[1 + Ranking],"%lf",&Usrs[NumUsr].Value[Ranking]) != 1)
+	       Usrs[NumUsr].Value[Ranking] = -1.0;
+	    Usrs[NumUsr].Rank[Ranking] = 0;
+	   }
+	}
+      Str_SetDecimalPointToLocal ();	// Return to local system
+
+      /***** Sort users by each figure and set their positions *****/
+      for (Ranking  = (Prf_Ranking_t) 0;
+	   Ranking <= (Prf_Ranking_t) (Prf_NUM_RANKINGS - 1);
+	   Ranking++)
+	{
+	 for (NumUsr = 0;
+	      NumUsr < NumUsrsWithFigures;
+	      NumUsr++)
+	   {
+	    Entries[NumUsr].Value  = Usrs[NumUsr].Value[Ranking];
+	    Entries[NumUsr].NumUsr = NumUsr;
+	   }
+	 qsort (Entries,NumUsrsWithFigures,sizeof (*Entries),
+		Prf_CompareRankEntries);
+
+	 /* Users with unknown figure (value < 0) are at the end */
+	 for (NumEntry = 0, Rank = 0;
+	      NumEntry < NumUsrsWithFigures &&
+	      Entries[NumEntry].Value >= 0.0;
+	      NumEntry++)
+	   {
+	    if (NumEntry == 0 ||
+		Entries[NumEntry].Value < Entries[NumEntry - 1].Value)
+	       Rank = NumEntry + 1;
+	    Usrs[Entries[NumEntry].NumUsr].Rank[Ranking] = Rank;
+	   }
+	 NumUsrs[Ranking] = NumEntry;
+	}
+
+      /***** Allocate space for the rows of a multi-row query *****/
+      RowsSize = Prf_MAX_ROWS_PER_RANKS_QUERY * (Prf_MAX_BYTES_RANKS_ROW + 1);
+      if ((Rows = malloc (RowsSize + 1)) == NULL)
+	 Lay_NotEnoughMemoryExit ();
+      Rows[0] = '\0';
+
+      /***** Store positions of all users *****/
+      for (NumUsr = 0;
+	   NumUsr < NumUsrsWithFigures;
+	   NumUsr++)
+	{
+	 snprintf (Row,sizeof (Row),"%s(%ld,%u,%u,%u,%u,%u,%u)",
+		   NumRowsInQuery ? "," :
+				    "",
+		   Usrs[NumUsr].UsrCod,
+		   Usrs[NumUsr].Rank[Prf_RANKING_CLICKS        ],
+		   Usrs[NumUsr].Rank[Prf_RANKING_CLICKS_PER_DAY],
+		   Usrs[NumUsr].Rank[Prf_RANKING_FILE_VIEWS    ],
+		   Usrs[NumUsr].Rank[Prf_RANKING_SOC_PUB       ],
+		   Usrs[NumUsr].Rank[Prf_RANKING_FOR_PST       ],
+		   Usrs[NumUsr].Rank[Prf_RANKING_MSG_SNT       ]);
+	 Str_Concat (Rows,Row,RowsSize);
+	 if (++NumRowsInQuery == Prf_MAX_ROWS_PER_RANKS_QUERY)
+	   {
+	    Prf_StoreRanks (Rows);
+	    Rows[0] = '\0';
+	    NumRowsInQuery = 0;
+	   }
+	}
+      if (NumRowsInQuery)
+	 Prf_StoreRanks (Rows);
+
+      /***** Free memory *****/
+      free (Rows);
+      free (Entries);
+      free (Usrs);
+     }
+
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+
+   /***** Update number of users in each ranking into cache *****/
+   for (Ranking  = (Prf_Ranking_t) 0;
+	Ranking <= (Prf_Ranking_t) (Prf_NUM_RANKINGS - 1);
+	Ranking++)
+      FigCch_UpdateFigureIntoCache (Prf_FigureNumUsrsInRanking[Ranking],Hie_Lvl_SYS,-1L,
+				    FigCch_UNSIGNED,&NumUsrs[Ranking]);
+  }
+
+/*****************************************************************************/
+/******************* Compare two entries of a ranking ************************/
+/*****************************************************************************/
+// Sort in descending order of value
+
+static int Prf_CompareRankEntries (const void *a,const void *b)
+  {
+   const struct Prf_RankEntry *EntryA = (const struct Prf_RankEntry *) a;
+   const struct Prf_RankEntry *EntryB = (const struct Prf_RankEntry *) b;
+
+   if (EntryA->Value > EntryB->Value)
+      return -1;
+   if (EntryA->Value < EntryB->Value)
+      return 1;
+   return 0;
+  }
+
+/*****************************************************************************/
+/************** Store positions of several users in rankings *****************/
+/*****************************************************************************/
+
+static void Prf_StoreRanks (const char *Rows)
+  {
+   DB_QueryREPLACE ("can not store users' ranks",
+		    "REPLACE INTO usr_ranks"
+		    " (UsrCod,"
+		      "RankClicks,RankClicksPerDay,RankFileViews,"
+		      "RankSocPub,RankForPst,RankMsgSnt)"
+		    " VALUES %s",
+		    Rows);
+  }
+
 /*****************************************************************************/
 /********** Get ranking of a user according to the number of clicks **********/
 /*****************************************************************************/
+// Used only when the user has not yet been ranked (for example, a new user)
 
 static unsigned long Prf_GetRankingFigure (long UsrCod,const char *FieldName)
   {
@@ -893,22 +1252,10 @@ static unsigned long Prf_GetRankingFigure (long UsrCod,const char *FieldName)
 			 UsrCod,FieldName,FieldName,UsrCod);
   }
 
-/*****************************************************************************/
-/********************* Get number of users with a figure *********************/
-/*****************************************************************************/
-
-static unsigned long Prf_GetNumUsrsWithFigure (const char *FieldName)
-  {
-   /***** Select number of rows with values already calculated *****/
-   return DB_QueryCOUNT ("can not get number of users with a figure",
-			 "SELECT COUNT(*) FROM usr_figures"
-			 " WHERE %s>=0",
-			 FieldName);
-  }
-
 /*****************************************************************************/
 /****** Get ranking of a user according to the number of clicks per day ******/
 /*****************************************************************************/
+// Used only when the user has not yet been ranked (for example, a new user)
 
 static unsigned long Prf_GetRankingNumClicksPerDay (long UsrCod)
   {
@@ -933,17 +1280,31 @@ static unsigned long Prf_GetRankingNumClicksPerDay (long UsrCod)
   }
 
 /*****************************************************************************/
-/************** Get number of users with number of clicks per day ************/
+/******************* Show position of a user in a ranking ********************/
 /*****************************************************************************/
 
-static unsigned long Prf_GetNumUsrsWithNumClicksPerDay (void)
+static void Prf_ShowRankingOfUsr (long UsrCod,
+                                  const struct Prf_UsrRanks *UsrRanks,
+                                  Prf_Ranking_t Ranking)
   {
-   /***** Select number of rows with values already calculated *****/
-   return DB_QueryCOUNT ("can not get number of users"
-			 " with number of clicks per day",
-			 "SELECT COUNT(*) FROM usr_figures"
-			 " WHERE NumClicks>0"
-			 " AND FirstClickTime>FROM_UNIXTIME(0)");
+   static const char *FieldName[Prf_NUM_RANKINGS] =
+     {
+      [Prf_RANKING_CLICKS        ] = "NumClicks",
+      [Prf_RANKING_CLICKS_PER_DAY] = NULL,
+      [Prf_RANKING_FILE_VIEWS    ] = "NumFileViews",
+      [Prf_RANKING_SOC_PUB       ] = "NumSocPub",
+      [Prf_RANKING_FOR_PST       ] = "NumForPst",
+      [Prf_RANKING_MSG_SNT       ] = "NumMsgSnt",
+     };
+   unsigned long Rank = (unsigned long) UsrRanks->Rank[Ranking];
+
+   /***** If user is not yet ranked, get position from user's figures *****/
+   if (Rank == 0)
+      Rank = (Ranking == Prf_RANKING_CLICKS_PER_DAY) ? Prf_GetRankingNumClicksPerDay (UsrCod) :
+						       Prf_GetRankingFigure (UsrCod,FieldName[Ranking]);
+
+   /***** Show position *****/
+   Prf_ShowRanking (Rank,(unsigned long) UsrRanks->NumUsrs[Ranking]);
   }
 
 /*****************************************************************************/
@@ -1299,6 +1660,11 @@ void Prf_RemoveUsrFigures (long UsrCod)
    DB_QueryDELETE ("can not delete user's figures",
 		   "DELETE FROM usr_figures WHERE UsrCod=%ld",
 		   UsrCod);
+
+   /***** Remove user's positions in rankings *****/
+   DB_QueryDELETE ("can not delete user's ranks",
+		   "DELETE FROM usr_ranks WHERE UsrCod=%ld",
+		   UsrCod);
   }
 
 /*****************************************************************************/
@@ -1321,10 +1687,9 @@ void Prf_IncrementNumClicksUsr (long UsrCod)
   {
    /***** Increment number of clicks *****/
    // If NumClicks < 0 ==> not yet calculated, so do nothing
-   DB_QueryINSERT ("can not increment user's clicks",
-		   "UPDATE IGNORE usr_figures SET NumClicks=NumClicks+1"
-		   " WHERE UsrCod=%ld AND NumClicks>=0",
-	           UsrCod);
+   DB_DeferQuery ("UPDATE IGNORE usr_figures SET NumClicks=NumClicks+1"
+		  " WHERE UsrCod=%ld AND NumClicks>=0",
+	          UsrCod);
   }
 
 /*****************************************************************************/
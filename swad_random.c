@@ -0,0 +1,261 @@
+// swad_random.c: random numbers, shuffling and sampling
+
+/*
+    SWAD (Shared Workspace At a Distance),
+    is a web platform developed at the University of Granada (Spain),
+    and used to support university teaching.
+
+    This file is part of SWAD core.
+    Copyright (C) 1999-2021 Antonio Caas Vargas
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as
+    published by the Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.
+
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/*****************************************************************************/
+/********************************* Headers ***********************************/
+/*****************************************************************************/
+
+#include <stdbool.h>		// For boolean type
+#include <stdio.h>		// For FILE, fopen, fread
+#include <stdlib.h>		// For malloc, free
+#include <sys/time.h>		// For gettimeofday
+#include <unistd.h>		// For getpid
+
+#include "swad_layout.h"
+#include "swad_random.h"
+
+/*****************************************************************************/
+/***************************** Private variables *****************************/
+/*****************************************************************************/
+
+static struct
+  {
+   bool Seeded;		// Has the generator been seeded?
+   uint64_t State;	// State of the generator (must not be 0)
+  } Rnd_Generator =
+  {
+   .Seeded = false,
+   .State  = 0,
+  };
+
+/*****************************************************************************/
+/***************************** Private prototypes ****************************/
+/*****************************************************************************/
+
+static void Rnd_SeedIfNotSeeded (void);
+
+/*****************************************************************************/
+/*************************** Set seed of generator ***************************/
+/*****************************************************************************/
+// Using the same seed, the same sequence of numbers is generated.
+// This is useful to reproduce a selection of questions or a shuffling
+
+void Rnd_SetSeed (uint64_t Seed)
+  {
+   /***** Scramble seed (splitmix64) to avoid states with few bits set *****/
+   Seed += 0x9E3779B97F4A7C15ULL;
+   Seed = (Seed ^ (Seed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+   Seed = (Seed ^ (Seed >> 27)) * 0x94D049BB133111EBULL;
+   Seed ^= Seed >> 31;
+
+   Rnd_Generator.State  = Seed ? Seed :
+				 0x9E3779B97F4A7C15ULL;	// State must not be 0
+   Rnd_Generator.Seeded = true;
+  }
+
+/*****************************************************************************/
+/*************** Seed generator the first time it is used ********************/
+/*****************************************************************************/
+// Several requests may start in the same second,
+// so seconds are not enough to seed the generator
+
+static void Rnd_SeedIfNotSeeded (void)
+  {
+   FILE *FileRandom;
+   uint64_t Seed = 0;
+   struct timeval tv;
+
+   if (Rnd_Generator.Seeded)
+      return;
+
+   /***** Try to get seed from kernel random source *****/
+   if ((FileRandom = fopen ("/dev/urandom","rb")) != NULL)
+     {
+      if (fread (&Seed,sizeof (Seed),1,FileRandom) != 1)
+	 Seed = 0;
+      fclose (FileRandom);
+     }
+
+   /***** Mix with time and process id *****/
+   gettimeofday (&tv,NULL);
+   Seed ^= ((uint64_t) tv.tv_sec << 20) ^
+	    (uint64_t) tv.tv_usec ^
+	   ((uint64_t) getpid () << 40);
+
+   Rnd_SetSeed (Seed);
+  }
+
+/*****************************************************************************/
+/********************* Get next 64-bit pseudorandom number *******************/
+/*****************************************************************************/
+// xorshift64* generator
+
+uint64_t Rnd_GetUInt64 (void)
+  {
+   Rnd_SeedIfNotSeeded ();
+
+   Rnd_Generator.State ^= Rnd_Generator.State >> 12;
+   Rnd_Generator.State ^= Rnd_Generator.State << 25;
+   Rnd_Generator.State ^= Rnd_Generator.State >> 27;
+   return Rnd_Generator.State * 0x2545F4914F6CDD1DULL;
+  }
+
+/*****************************************************************************/
+/**************** Get a pseudorandom number in range [0,N) *******************/
+/*****************************************************************************/
+// Numbers are uniformly distributed (there is no modulo bias)
+// Return 0 if N == 0
+
+unsigned Rnd_GetUnsignedLessThan (unsigned N)
+  {
+   uint64_t Limit;
+   uint64_t Random;
+
+   if (N <= 1)
+      return 0;
+
+   /***** Discard numbers in the last incomplete interval *****/
+   Limit = UINT64_MAX - UINT64_MAX % (uint64_t) N;
+   do
+      Random = Rnd_GetUInt64 ();
+   while (Random >= Limit);
+
+   return (unsigned) (Random % (uint64_t) N);
+  }
+
+/*****************************************************************************/
+/************************ Shuffle an array in place **************************/
+/*****************************************************************************/
+// Fisher-Yates shuffle
+
+void Rnd_ShuffleUnsigned (unsigned *Array,unsigned NumItems)
+  {
+   unsigned i;
+   unsigned j;
+   unsigned Tmp;
+
+   for (i = NumItems;
+	i > 1;
+	i--)
+     {
+      j = Rnd_GetUnsignedLessThan (i);
+      Tmp          = Array[i - 1];
+      Array[i - 1] = Array[j];
+      Array[j]     = Tmp;
+     }
+  }
+
+/*****************************************************************************/
+/********** Get a random sample of different numbers in range [0,N) **********/
+/*****************************************************************************/
+// Floyd's algorithm: only the sample is stored, not the whole range,
+// so it is suitable for a few items selected from a big range.
+// Sample must have room for NumItemsInSample numbers.
+// Items in sample are returned in random order.
+// Return the number of items in sample (never greater than NumItems)
+
+unsigned Rnd_GetSample (unsigned NumItems,unsigned NumItemsInSample,
+                        unsigned *Sample)
+  {
+   unsigned NumItemsSelected = 0;
+   unsigned j;
+   unsigned t;
+   unsigned k;
+   bool AlreadySelected;
+
+   if (NumItemsInSample > NumItems)
+      NumItemsInSample = NumItems;
+
+   for (j = NumItems - NumItemsInSample;
+	j < NumItems;
+	j++)
+     {
+      /***** Select a random number in [0,j] *****/
+      t = Rnd_GetUnsignedLessThan (j + 1);
+
+      /***** If already selected, select j, that can not be selected yet *****/
+      for (k = 0, AlreadySelected = false;
+	   k < NumItemsSelected && !AlreadySelected;
+	   k++)
+	 AlreadySelected = (Sample[k] == t);
+      Sample[NumItemsSelected++] = AlreadySelected ? j :
+						     t;
+     }
+
+   /***** Floyd's algorithm does not give a random order ==> shuffle *****/
+   Rnd_ShuffleUnsigned (Sample,NumItemsSelected);
+
+   return NumItemsSelected;
+  }
+
+/*****************************************************************************/
+/************ Get a random sample of rows from a query result ****************/
+/*****************************************************************************/
+// The query must not use ORDER BY RAND(), which sorts all the rows.
+// SampleRows must have room for NumRowsInSample rows.
+// Return the number of rows in sample (never greater than NumRows)
+
+unsigned Rnd_GetSampleOfRows (MYSQL_RES *mysql_res,unsigned NumRows,
+                              unsigned NumRowsInSample,
+                              MYSQL_ROW *SampleRows)
+  {
+   unsigned *Sample;
+   unsigned NumRow;
+
+   if (NumRowsInSample > NumRows)
+      NumRowsInSample = NumRows;
+   if (NumRowsInSample == 0)
+      return 0;
+
+   /***** Get a random sample of row indexes *****/
+   if ((Sample = malloc (NumRowsInSample * sizeof (*Sample))) == NULL)
+      Lay_NotEnoughMemoryExit ();
+   NumRowsInSample = Rnd_GetSample (NumRows,NumRowsInSample,Sample);
+
+   /***** Get rows in sample *****/
+   for (NumRow = 0;
+	NumRow < NumRowsInSample;
+	NumRow++)
+     {
+      mysql_data_seek (mysql_res,(my_ulonglong) Sample[NumRow]);
+      SampleRows[NumRow] = mysql_fetch_row (mysql_res);
+     }
+
+   free (Sample);
+
+   return NumRowsInSample;
+  }
+
+/*****************************************************************************/
+/***************** Get a random row from a query result **********************/
+/*****************************************************************************/
+// Return NULL if there are no rows
+
+MYSQL_ROW Rnd_GetRandomRow (MYSQL_RES *mysql_res,unsigned NumRows)
+  {
+   if (NumRows == 0)
+      return NULL;
+
+   mysql_data_seek (mysql_res,(my_ulonglong) Rnd_GetUnsignedLessThan (NumRows));
+   return mysql_fetch_row (mysql_res);
+  }
@@ -0,0 +1,49 @@
+// swad_random.h: random numbers, shuffling and sampling
+
+#ifndef _SWAD_RND
+#define _SWAD_RND
+/*
+    SWAD (Shared Workspace At a Distance in Spanish),
+    is a web platform developed at the University of Granada (Spain),
+    and used to support university teaching.
+
+    This file is part of SWAD core.
+    Copyright (C) 1999-2021 Antonio Caas Vargas
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as
+    published by the Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.
+
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/*****************************************************************************/
+/********************************* Headers ***********************************/
+/*****************************************************************************/
+
+#include <mysql/mysql.h>	// To access MySQL databases
+#include <stdint.h>		// For uint64_t
+
+/*****************************************************************************/
+/***************************** Public prototypes *****************************/
+/*****************************************************************************/
+
+void Rnd_SetSeed (uint64_t Seed);
+uint64_t Rnd_GetUInt64 (void);
+unsigned Rnd_GetUnsignedLessThan (unsigned N);
+
+void Rnd_ShuffleUnsigned (unsigned *Array,unsigned NumItems);
+unsigned Rnd_GetSample (unsigned NumItems,unsigned NumItemsInSample,
+                        unsigned *Sample);
+unsigned Rnd_GetSampleOfRows (MYSQL_RES *mysql_res,unsigned NumRows,
+                              unsigned NumRowsInSample,
+                              MYSQL_ROW *SampleRows);
+MYSQL_ROW Rnd_GetRandomRow (MYSQL_RES *mysql_res,unsigned NumRows);
+
+#endif
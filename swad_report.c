@@ -779,12 +779,10 @@ static void Rep_WriteSectionHitsPerAction (struct Rep_Report *Report)
 
    /***** Make the query *****/
    NumRows = DB_QuerySELECT (&mysql_res,"can not get clicks",
-			     "SELECT SQL_NO_CACHE ActCod,COUNT(*) AS N"
-			     " FROM log"
-			     " WHERE ClickTime>=FROM_UNIXTIME(%ld)"
-			     " AND UsrCod=%ld"
+			     "SELECT ActCod,SUM(NumHits) AS N"
+			     " FROM usr_hits"
+			     " WHERE UsrCod=%ld"
 			     " GROUP BY ActCod ORDER BY N DESC LIMIT %u",
-			     (long) Report->UsrFigures.FirstClickTimeUTC,
 			     Gbl.Usrs.Me.UsrDat.UsrCod,
 			     Rep_MAX_ACTIONS);
 
@@ -923,12 +921,11 @@ static void Rep_GetMaxHitsPerYear (struct Rep_Report *Report)
 		   // Clicks without course selected --------------------------
 	           "SELECT "
 	           "-1 AS CrsCod,"
-	           "YEAR(CONVERT_TZ(ClickTime,@@session.time_zone,'UTC')) AS Year,"
+	           "Year,"
 	           "%u AS Role,"
-	           "COUNT(*) AS N"
-	           " FROM log"
-	           " WHERE ClickTime>=FROM_UNIXTIME(%ld)"
-	           " AND UsrCod=%ld"
+	           "SUM(NumHits) AS N"
+	           " FROM usr_hits"
+	           " WHERE UsrCod=%ld"
 	           " AND CrsCod<=0"
 	           " GROUP BY Year"
 		   // ---------------------------------------------------------
@@ -936,12 +933,11 @@ static void Rep_GetMaxHitsPerYear (struct Rep_Report *Report)
 		   // Clicks as student, non-editing teacher or teacher in courses
 	           "SELECT "
 	           "CrsCod,"
-	           "YEAR(CONVERT_TZ(ClickTime,@@session.time_zone,'UTC')) AS Year,"
+	           "Year,"
 	           "Role,"
-	           "COUNT(*) AS N"
-	           " FROM log"
-	           " WHERE ClickTime>=FROM_UNIXTIME(%ld)"
-	           " AND UsrCod=%ld"
+	           "SUM(NumHits) AS N"
+	           " FROM usr_hits"
+	           " WHERE UsrCod=%ld"
 	           " AND Role>=%u"	// Student
 	           " AND Role<=%u"	// Teacher
 	           " AND CrsCod>0"
@@ -949,9 +945,7 @@ static void Rep_GetMaxHitsPerYear (struct Rep_Report *Report)
 		   // ---------------------------------------------------------
 	           ") AS hits_per_crs_year",
 		   (unsigned) Rol_UNK,
-		   (long) Report->UsrFigures.FirstClickTimeUTC,
 		   Gbl.Usrs.Me.UsrDat.UsrCod,
-		   (long) Report->UsrFigures.FirstClickTimeUTC,
 		   Gbl.Usrs.Me.UsrDat.UsrCod,
 		   (unsigned) Rol_STD,
 		   (unsigned) Rol_TCH);
@@ -1010,13 +1004,13 @@ static void Rep_GetAndWriteMyCurrentCrss (Rol_Role_t Role,
       NumCrss =
       (unsigned) DB_QuerySELECT (&mysql_res,"can not get courses of a user",
 				 "SELECT my_courses.CrsCod,"		// row[0]
-                                        "COUNT(*) AS N"			// row[1]
+                                        "SUM(usr_hits.NumHits) AS N"	// row[1]
                                  " FROM"
                                  " (SELECT CrsCod FROM crs_usr"
                                  " WHERE UsrCod=%ld AND Role=%u) AS my_courses"	// It's imperative to use a derived table to not block crs_usr!
-                                 " LEFT JOIN log"
-                                 " ON (my_courses.CrsCod=log.CrsCod)"
-                                 " WHERE log.UsrCod=%ld AND log.Role=%u"
+                                 " LEFT JOIN usr_hits"
+                                 " ON (my_courses.CrsCod=usr_hits.CrsCod)"
+                                 " WHERE usr_hits.UsrCod=%ld AND usr_hits.Role=%u"
                                  " GROUP BY my_courses.CrsCod"
                                  " ORDER BY N DESC,my_courses.CrsCod DESC",
 				 Gbl.Usrs.Me.UsrDat.UsrCod,(unsigned) Role,
@@ -1097,8 +1091,8 @@ static void Rep_GetAndWriteMyHistoricCrss (Rol_Role_t Role,
    /***** Get historic courses of a user from log *****/
    NumCrss =
    (unsigned) DB_QuerySELECT (&mysql_res,"can not get courses of a user",
-			      "SELECT CrsCod,COUNT(*) AS N"
-			      " FROM log"
+			      "SELECT CrsCod,SUM(NumHits) AS N"
+			      " FROM usr_hits"
 			      " WHERE UsrCod=%ld AND Role=%u AND CrsCod>0"
 			      " GROUP BY CrsCod"
 			      " HAVING N>%u"
@@ -1235,13 +1229,12 @@ static void Rep_ShowMyHitsPerYear (bool AnyCourse,long CrsCod,Rol_Role_t Role,
       sprintf (SubQueryRol," AND Role=%u",(unsigned) Role);
 
    NumRows = DB_QuerySELECT (&mysql_res,"can not get clicks",
-			     "SELECT SQL_NO_CACHE "
-			     "YEAR(CONVERT_TZ(ClickTime,@@session.time_zone,'UTC')) AS Year,"
-			     "COUNT(*) FROM log"
-			     " WHERE ClickTime>=FROM_UNIXTIME(%ld)"
-			     " AND UsrCod=%ld%s%s"
-			     " GROUP BY Year DESC",
-			     (long) Report->UsrFigures.FirstClickTimeUTC,
+			     "SELECT Year,"
+			     "SUM(NumHits)"
+			     " FROM usr_hits"
+			     " WHERE UsrCod=%ld%s%s"
+			     " GROUP BY Year"
+			     " ORDER BY Year DESC",
 			     Gbl.Usrs.Me.UsrDat.UsrCod,
 			     SubQueryCrs,
 			     SubQueryRol);
@@ -1390,6 +1383,24 @@ static void Rep_WriteDouble (double Num)
    free (Str);
   }
 
+/*****************************************************************************/
+/*********** Increment number of hits of a user in current year, *************/
+/*********** course, role and action                             *************/
+/*****************************************************************************/
+// Rows of usr_hits are pre-aggregated clicks of the log,
+// so usage reports do not need to scan the log
+
+void Rep_IncrementNumHitsUsr (long UsrCod,long CrsCod,Rol_Role_t Role,long ActCod)
+  {
+   /***** Increment number of hits *****/
+   DB_DeferQuery ("INSERT INTO usr_hits"
+		  " (UsrCod,Year,CrsCod,Role,ActCod,NumHits)"
+		  " VALUES"
+		  " (%ld,YEAR(UTC_TIMESTAMP()),%ld,%u,%ld,1)"
+		  " ON DUPLICATE KEY UPDATE NumHits=NumHits+1",
+		  UsrCod,CrsCod,(unsigned) Role,ActCod);
+  }
+
 /*****************************************************************************/
 /********** Remove all user's usage report of a user from database ***********/
 /*****************************************************************************/
@@ -1401,6 +1412,11 @@ void Rep_RemoveUsrUsageReports (long UsrCod)
 
    /***** Remove all user's usage reports of a user from database *****/
    Rep_RemoveUsrReportsFromDB (UsrCod);
+
+   /***** Remove hits of a user used in usage reports *****/
+   DB_QueryDELETE ("can not remove user's hits",
+		   "DELETE FROM usr_hits WHERE UsrCod=%ld",
+		   UsrCod);
   }
 
 /*****************************************************************************/
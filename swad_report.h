@@ -43,6 +43,8 @@ void Rep_ReqMyUsageReport (void);
 void Rep_ShowMyUsageReport (void);
 void Rep_PrintMyUsageReport (void);
 
+void Rep_IncrementNumHitsUsr (long UsrCod,long CrsCod,Rol_Role_t Role,long ActCod);
+
 void Rep_RemoveUsrUsageReports (long UsrCod);
 
 #endif
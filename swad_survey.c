@@ -169,11 +169,9 @@ static void Svy_DrawBarNumUsrs (unsigned NumUsrs,unsigned MaxUsrs);
 static void Svy_PutIconToRemoveOneQst (void *Surveys);
 static void Svy_PutParamsRemoveOneQst (void *Surveys);
 
-static void Svy_ReceiveAndStoreUserAnswersToASurvey (long SvyCod);
-static void Svy_IncreaseAnswerInDB (long QstCod,unsigned AnsInd);
-static void Svy_RegisterIHaveAnsweredSvy (long SvyCod);
+static bool Svy_ReceiveAndStoreUserAnswersToASurvey (long SvyCod);
+static bool Svy_RegisterIHaveAnsweredSvy (long SvyCod);
 static bool Svy_CheckIfIHaveAnsweredSvy (long SvyCod);
-static unsigned Svy_GetNumUsrsWhoHaveAnsweredSvy (long SvyCod);
 
 /*****************************************************************************/
 /*************************** Reset surveys context ***************************/
@@ -1262,7 +1260,8 @@ void Svy_GetDataOfSurveyByCod (struct Svy_Survey *Svy)
 			     "UNIX_TIMESTAMP(StartTime),"
 			     "UNIX_TIMESTAMP(EndTime),"
 			     "NOW() BETWEEN StartTime AND EndTime,"
-			     "Title"
+			     "Title,"
+			     "NumUsrs"
 			     " FROM surveys"
 			     " WHERE SvyCod=%ld",
 			     Svy->SvyCod);
@@ -1304,9 +1303,12 @@ void Svy_GetDataOfSurveyByCod (struct Svy_Survey *Svy)
       /* Get the title of the survey (row[9]) */
       Str_Copy (Svy->Title,row[9],strlen (Svy->Title) - 1);
 
-      /* Get number of questions and number of users who have already answer this survey */
+      /* Get number of users who have already answer this survey (row[10]) */
+      if (sscanf (row[10],"%u",&Svy->NumUsrs) != 1)
+	 Svy->NumUsrs = 0;
+
+      /* Get number of questions */
       Svy->NumQsts = Svy_GetNumQstsSvy (Svy->SvyCod);
-      Svy->NumUsrs = Svy_GetNumUsrsWhoHaveAnsweredSvy (Svy->SvyCod);
 
       /* Am I logged with a valid role to answer this survey? */
       Svy->Status.IAmLoggedWithAValidRoleToAnswer = (Svy->Roles & (1 << Gbl.Usrs.Me.Role.Logged));
@@ -1750,10 +1752,17 @@ void Svy_ResetSurvey (void)
    if (!Svy.Status.ICanEdit)
       Lay_NoPermissionExit ();
 
+   /***** Users, counters and answers are reset in one transaction *****/
+   DB_Query ("can not start transaction to reset a survey",
+	     "START TRANSACTION");
+
    /***** Remove all the users in this survey *****/
    DB_QueryDELETE ("can not remove users who are answered a survey",
 		   "DELETE FROM svy_users WHERE SvyCod=%ld",
 		   Svy.SvyCod);
+   DB_QueryUPDATE ("can not reset number of users who have answered a survey",
+		   "UPDATE surveys SET NumUsrs=0 WHERE SvyCod=%ld",
+		   Svy.SvyCod);
 
    /***** Reset all the answers in this survey *****/
    DB_QueryUPDATE ("can not reset answers of a survey",
@@ -1762,6 +1771,9 @@ void Svy_ResetSurvey (void)
                    " AND svy_questions.QstCod=svy_answers.QstCod",
 		   Svy.SvyCod);
 
+   DB_Query ("can not commit transaction to reset a survey",
+	     "COMMIT");
+
    /***** Write message to show the change made *****/
    Ale_ShowAlert (Ale_SUCCESS,Txt_Survey_X_reset,
                   Svy.Title);
@@ -3736,15 +3748,13 @@ void Svy_ReceiveSurveyAnswers (void)
    /***** Get data of the survey from database *****/
    Svy_GetDataOfSurveyByCod (&Svy);
 
-   /***** Check if I have no answered this survey formerly *****/
-   if (Svy.Status.IHaveAnswered)
-      Ale_ShowAlert (Ale_WARNING,Txt_You_already_answered_this_survey_before);
-   else
-     {
-      /***** Receive and store user's answers *****/
-      Svy_ReceiveAndStoreUserAnswersToASurvey (Svy.SvyCod);
+   /***** Check if I have no answered this survey formerly
+          and receive and store user's answers *****/
+   if (!Svy.Status.IHaveAnswered &&
+       Svy_ReceiveAndStoreUserAnswersToASurvey (Svy.SvyCod))
       Ale_ShowAlert (Ale_SUCCESS,Txt_Thanks_for_answering_the_survey);
-     }
+   else
+      Ale_ShowAlert (Ale_WARNING,Txt_You_already_answered_this_survey_before);
 
    /***** Show current survey *****/
    Svy_ShowOneSurvey (&Surveys,Svy.SvyCod,true);
@@ -3753,8 +3763,11 @@ void Svy_ReceiveSurveyAnswers (void)
 /*****************************************************************************/
 /**************** Get and store user's answers to a survey *******************/
 /*****************************************************************************/
+// All the answers checked by the user are counted with one query,
+// in the same transaction that registers that the user has answered.
+// Return false if the user had already answered the survey
 
-static void Svy_ReceiveAndStoreUserAnswersToASurvey (long SvyCod)
+static bool Svy_ReceiveAndStoreUserAnswersToASurvey (long SvyCod)
   {
    MYSQL_RES *mysql_res;
    MYSQL_ROW row;
@@ -3766,6 +3779,9 @@ static void Svy_ReceiveAndStoreUserAnswersToASurvey (long SvyCod)
    const char *Ptr;
    char UnsignedStr[Cns_MAX_DECIMAL_DIGITS_UINT + 1];
    unsigned AnsInd;
+   unsigned NumAnswers = 0;
+   char *Query = NULL;
+   bool AnswersStored;
 
    /***** Get questions of this survey from database *****/
    NumQsts = (unsigned) DB_QuerySELECT (&mysql_res,"can not get questions"
@@ -3776,6 +3792,10 @@ static void Svy_ReceiveAndStoreUserAnswersToASurvey (long SvyCod)
    if (NumQsts)
      {
       // This survey has questions
+      DB_BuildQuery (&Query,
+		     "UPDATE svy_answers SET NumUsrs=NumUsrs+1"
+		     " WHERE (QstCod,AnsInd) IN (");
+
       /***** Get questions *****/
       for (NumQst = 0;
 	   NumQst < NumQsts;
@@ -3798,11 +3818,15 @@ static void Svy_ReceiveAndStoreUserAnswersToASurvey (long SvyCod)
            {
             Par_GetNextStrUntilSeparParamMult (&Ptr,UnsignedStr,Cns_MAX_DECIMAL_DIGITS_UINT);
             if (sscanf (UnsignedStr,"%u",&AnsInd) == 1)
-               // Parameter exists ==> user has checked this answer
-               // 		   ==> store it in database
-               Svy_IncreaseAnswerInDB (QstCod,AnsInd);
+	       // Parameter exists ==> user has checked this answer
+	       // 		   ==> add it to the query
+	       DB_AddToQuery (&Query,"%s(%ld,%u)",
+			      NumAnswers++ ? "," :
+					     "",
+			      QstCod,AnsInd);
            }
         }
+      DB_AddToQuery (&Query,")");
      }
    else		// This survey has no questions
       Lay_ShowErrorAndExit ("Error: this survey has no questions.");
@@ -3810,35 +3834,42 @@ static void Svy_ReceiveAndStoreUserAnswersToASurvey (long SvyCod)
    /***** Free structure that stores the query result *****/
    DB_FreeMySQLResult (&mysql_res);
 
-   /***** Register that you have answered this survey *****/
-   Svy_RegisterIHaveAnsweredSvy (SvyCod);
-  }
-
-/*****************************************************************************/
-/************ Increase number of users who have marked one answer ************/
-/*****************************************************************************/
-
-static void Svy_IncreaseAnswerInDB (long QstCod,unsigned AnsInd)
-  {
-   /***** Increase number of users who have selected the answer AnsInd in the question QstCod *****/
-   DB_QueryUPDATE ("can not register your answer to the survey",
-		   "UPDATE svy_answers SET NumUsrs=NumUsrs+1"
-                   " WHERE QstCod=%ld AND AnsInd=%u",
-		   QstCod,AnsInd);
+   /***** Register that I have answered this survey
+          and increase number of users who have checked each answer *****/
+   DB_Query ("can not start transaction to store answers to a survey",
+	     "START TRANSACTION");
+   if ((AnswersStored = Svy_RegisterIHaveAnsweredSvy (SvyCod)))
+      if (NumAnswers)
+	 DB_QueryUPDATE ("can not register your answers to the survey",
+			 "%s",Query);
+   DB_Query ("can not commit transaction to store answers to a survey",
+	     "COMMIT");
+   free (Query);
+
+   return AnswersStored;
   }
 
 /*****************************************************************************/
 /***************** Register that I have answered this survey *****************/
 /*****************************************************************************/
+// Return false if I had already answered this survey
 
-static void Svy_RegisterIHaveAnsweredSvy (long SvyCod)
+static bool Svy_RegisterIHaveAnsweredSvy (long SvyCod)
   {
    DB_QueryINSERT ("can not register that you have answered the survey",
-		   "INSERT INTO svy_users"
+		   "INSERT IGNORE INTO svy_users"
 	           " (SvyCod,UsrCod)"
                    " VALUES"
                    " (%ld,%ld)",
 		   SvyCod,Gbl.Usrs.Me.UsrDat.UsrCod);
+   if (!mysql_affected_rows (&Gbl.mysql))
+      return false;
+
+   /***** Increase number of users who have answered this survey *****/
+   DB_QueryUPDATE ("can not update number of users who have answered a survey",
+		   "UPDATE surveys SET NumUsrs=NumUsrs+1 WHERE SvyCod=%ld",
+		   SvyCod);
+   return true;
   }
 
 /*****************************************************************************/
@@ -3854,21 +3885,6 @@ static bool Svy_CheckIfIHaveAnsweredSvy (long SvyCod)
 			  SvyCod,Gbl.Usrs.Me.UsrDat.UsrCod) != 0);
   }
 
-/*****************************************************************************/
-/*************** Register that you have answered this survey *****************/
-/*****************************************************************************/
-
-static unsigned Svy_GetNumUsrsWhoHaveAnsweredSvy (long SvyCod)
-  {
-   /***** Get number of surveys with a field value from database *****/
-   return
-   (unsigned) DB_QueryCOUNT ("can not get number of users"
-			     " who have answered a survey",
-			     "SELECT COUNT(*) FROM svy_users"
-			     " WHERE SvyCod=%ld",
-			     SvyCod);
-  }
-
 /*****************************************************************************/
 /******************** Get number of courses with surveys *********************/
 /*****************************************************************************/
@@ -26,11 +26,15 @@
 /*****************************************************************************/
 
 #include <unistd.h>		// For SEEK_SET
+#include <fcntl.h>		// For open
 #include <linux/limits.h>	// For PATH_MAX
 #include <stddef.h>		// For NULL
+#include <stdint.h>		// For int32_t, int64_t, uint32_t
 #include <stdlib.h>		// For free ()
 #include <stdsoap2.h>		// For SOAP_OK and soap functions
 #include <string.h>		// For string functions
+#include <sys/mman.h>		// For mmap, munmap
+#include <sys/stat.h>		// For stat, fstat
 #include <time.h>		// For time ()
 
 #include "swad_box.h"
@@ -64,6 +68,8 @@ extern struct Globals Gbl;
 
 #define Syl_WIDTH_NUM_SYLLABUS 20
 
+#define Syl_BIN_MAGIC "Syl1"	// Change when format of binary file changes
+
 static const char *StyleSyllabus[1 + Syl_MAX_LEVELS_SYLLABUS] =
   {
    [ 0] = "",
@@ -88,7 +94,29 @@ struct ItemSyllabus
    int Level;
    int CodItem[1 + Syl_MAX_LEVELS_SYLLABUS];
    bool HasChildren;
-   char Text[Syl_MAX_BYTES_TEXT_ITEM + 1];
+   const char *Text;	// Points to binary file mapped in memory,
+			// to texts read from XML file or to a new text
+  };
+
+/* Binary file with items of a syllabus already parsed from XML file:
+   header, items and texts (null-terminated) */
+struct Syl_BinHeader
+  {
+   char Magic[4];		// Syl_BIN_MAGIC
+   uint32_t NumItems;
+   uint32_t NumItemsWithChildren;
+   int32_t NumLevels;
+   int64_t XMLSize;		// Size of XML file from which it was built
+   int64_t XMLModifTimeSec;	// Modification time of XML file
+   int64_t XMLModifTimeNsec;
+  };
+
+struct Syl_BinItem
+  {
+   int32_t Level;
+   int32_t CodItem[1 + Syl_MAX_LEVELS_SYLLABUS];
+   uint32_t HasChildren;
+   uint32_t TextOffset;		// From start of texts
   };
 
 /*****************************************************************************/
@@ -103,7 +131,15 @@ struct LstItemsSyllabus Syl_LstItemsSyllabus;
 
 static unsigned Syl_GetParamItemNumber (void);
 
+static bool Syl_ShowListItemsSyllabus (struct Syl_Syllabus *Syllabus);
 static void Syl_SetSyllabusTypeFromAction (struct Syl_Syllabus *Syllabus);
+static bool Syl_LoadListItemsFromBinFile (const struct Syl_Syllabus *Syllabus,
+                                          const struct stat *XMLStatus);
+static void Syl_LoadListItemsFromXMLFile (const struct Syl_Syllabus *Syllabus,
+                                          struct stat *XMLStatus);
+static void Syl_ComputeNumbersOfItems (void);
+static void Syl_WriteBinFile (const struct Syl_Syllabus *Syllabus,
+                              const struct stat *XMLStatus);
 static void Syl_ShowSyllabus (struct Syl_Syllabus *Syllabus,
                               bool PutIconToEdit);
 static void Syl_ShowRowSyllabus (struct Syl_Syllabus *Syllabus,unsigned NumItem,
@@ -115,8 +151,12 @@ static void Syl_PutParamNumItem (void *ParamNumItem);
 static void Syl_WriteNumItem (char *StrDst,FILE *FileTgt,int Level,int *CodItem);
 
 static void Syl_ChangePlaceItemSyllabus (Syl_ChangePosItem_t UpOrDownPos);
+static void Syl_ExchangeSubtrees (const struct MoveSubtrees *Subtree);
 static void Syl_ChangeLevelItemSyllabus (Syl_ChangeLevelItem_t IncreaseOrDecreaseLevel);
 
+static void Syl_UpdateAndShowSyllabus (struct Syl_Syllabus *Syllabus);
+static void Syl_WriteSyllabusFiles (const struct Syl_Syllabus *Syllabus);
+
 static void Syl_OpenSyllabusFile (const struct Syl_Syllabus *Syllabus,
                                   char PathFile[PATH_MAX + 1]);
 
@@ -220,17 +260,28 @@ bool Syl_CheckSyllabus (struct Syl_Syllabus *Syllabus,long CrsCod)
 
 bool Syl_CheckAndEditSyllabus (struct Syl_Syllabus *Syllabus)
   {
-   extern const Act_Action_t Inf_ActionsSeeInfo[Inf_NUM_INFO_TYPES];
-   extern const char *Txt_Done;
-   bool ICanEdit;
-   bool PutIconToEdit;
-
    /***** Set syllabus type depending on current action *****/
    Syl_SetSyllabusTypeFromAction (Syllabus);
 
    /***** Load syllabus from XML file to memory *****/
    Syl_LoadListItemsSyllabusIntoMemory (Syllabus,Gbl.Hierarchy.Crs.CrsCod);
 
+   /***** Show syllabus *****/
+   return Syl_ShowListItemsSyllabus (Syllabus);
+  }
+
+/*****************************************************************************/
+/************** Show syllabus loaded in memory, to see or edit ***************/
+/*****************************************************************************/
+// Return true if info available
+
+static bool Syl_ShowListItemsSyllabus (struct Syl_Syllabus *Syllabus)
+  {
+   extern const Act_Action_t Inf_ActionsSeeInfo[Inf_NUM_INFO_TYPES];
+   extern const char *Txt_Done;
+   bool ICanEdit;
+   bool PutIconToEdit;
+
    switch (Gbl.Action.Act)
      {
       case ActEditorSylLec:	case ActEditorSylPra:
@@ -358,17 +409,14 @@ static void Syl_SetSyllabusTypeFromAction (struct Syl_Syllabus *Syllabus)
 /*****************************************************************************/
 /*** Read from XML and load in memory a syllabus of lectures or practicals ***/
 /*****************************************************************************/
+// Items already parsed are read from a binary file mapped in memory.
+// The binary file is built again only when the XML file changes
 
 void Syl_LoadListItemsSyllabusIntoMemory (struct Syl_Syllabus *Syllabus,
                                           long CrsCod)
   {
    char PathFile[PATH_MAX + 1];
-   long PostBeginList;
-   unsigned NumItem = 0;
-   int N;
-   int CodItem[1 + Syl_MAX_LEVELS_SYLLABUS];	// To make numeration
-   int Result;
-   unsigned NumItemsWithChildren = 0;
+   struct stat XMLStatus;
 
    /* Path of the private directory for the XML file with the syllabus */
    snprintf (Syllabus->PathDir,sizeof (Syllabus->PathDir),"%s/%ld/%s",
@@ -376,8 +424,150 @@ void Syl_LoadListItemsSyllabusIntoMemory (struct Syl_Syllabus *Syllabus,
 	     Syllabus->WhichSyllabus == Syl_LECTURES ? Cfg_SYLLABUS_FOLDER_LECTURES :
 		                                       Cfg_SYLLABUS_FOLDER_PRACTICALS);
 
+   /***** Try to load items from binary file built from current XML file *****/
+   Syl_BuildPathFileSyllabus (Syllabus,PathFile);
+   if (stat (PathFile,&XMLStatus) == 0)
+      if (Syl_LoadListItemsFromBinFile (Syllabus,&XMLStatus))
+	 return;
+
+   /***** Binary file does not exist or is not up to date
+          ==> load items from XML file and build binary file *****/
+   Syl_LoadListItemsFromXMLFile (Syllabus,&XMLStatus);
+   Syl_WriteBinFile (Syllabus,&XMLStatus);
+  }
+
+/*****************************************************************************/
+/************ Load items of a syllabus from binary file, if valid ************/
+/*****************************************************************************/
+// Return true if binary file exists and corresponds to XML file
+
+static bool Syl_LoadListItemsFromBinFile (const struct Syl_Syllabus *Syllabus,
+                                          const struct stat *XMLStatus)
+  {
+   char PathFileBin[PATH_MAX + 1 + NAME_MAX + 1];
+   int FileDescriptor;
+   struct stat BinStatus;
+   size_t MappedFileSize;
+   void *MappedFile;
+   const struct Syl_BinHeader *Header;
+   const struct Syl_BinItem *BinItems;
+   const char *Texts;
+   size_t TextsSize;
+   unsigned NumItem;
+   unsigned NumItemsWithChildren = 0;
+   int N;
+
+   /***** Map binary file in memory *****/
+   snprintf (PathFileBin,sizeof (PathFileBin),"%s/%s",
+	     Syllabus->PathDir,Cfg_SYLLABUS_BIN_FILENAME);
+   if ((FileDescriptor = open (PathFileBin,O_RDONLY)) < 0)
+      return false;
+   if (fstat (FileDescriptor,&BinStatus) ||
+       (size_t) BinStatus.st_size <= sizeof (struct Syl_BinHeader))
+     {
+      close (FileDescriptor);
+      return false;
+     }
+   MappedFileSize = (size_t) BinStatus.st_size;
+   MappedFile = mmap (NULL,MappedFileSize,PROT_READ,MAP_PRIVATE,FileDescriptor,0);
+   close (FileDescriptor);
+   if (MappedFile == MAP_FAILED)
+      return false;
+
+   /***** Check that binary file was built from current XML file *****/
+   Header = (const struct Syl_BinHeader *) MappedFile;
+   BinItems = (const struct Syl_BinItem *) (Header + 1);
+   if (memcmp (Header->Magic,Syl_BIN_MAGIC,sizeof (Header->Magic)) ||
+       Header->XMLSize          != (int64_t) XMLStatus->st_size ||
+       Header->XMLModifTimeSec  != (int64_t) XMLStatus->st_mtim.tv_sec ||
+       Header->XMLModifTimeNsec != (int64_t) XMLStatus->st_mtim.tv_nsec ||
+       Header->NumItems > (MappedFileSize - sizeof (struct Syl_BinHeader) - 1) /
+			  sizeof (struct Syl_BinItem) ||	// At least one byte for texts
+       Header->NumLevels < 1 ||
+       Header->NumLevels > Syl_MAX_LEVELS_SYLLABUS ||
+       Header->NumItemsWithChildren > Header->NumItems)
+     {
+      munmap (MappedFile,MappedFileSize);
+      return false;
+     }
+   Texts = (const char *) (BinItems + Header->NumItems);
+   TextsSize = MappedFileSize - (size_t) (Texts - (const char *) MappedFile);
+   if (Texts[TextsSize - 1] != '\0')	// Last text must be null-terminated
+     {
+      munmap (MappedFile,MappedFileSize);
+      return false;
+     }
+   for (NumItem = 0;
+	NumItem < Header->NumItems;
+	NumItem++)
+     {
+      if (BinItems[NumItem].Level < 1 ||
+	  BinItems[NumItem].Level > Header->NumLevels ||
+	  BinItems[NumItem].TextOffset >= TextsSize)
+	{
+	 munmap (MappedFile,MappedFileSize);
+	 return false;
+	}
+      if (BinItems[NumItem].HasChildren)
+	 NumItemsWithChildren++;
+     }
+   if (NumItemsWithChildren != Header->NumItemsWithChildren)
+     {
+      munmap (MappedFile,MappedFileSize);
+      return false;
+     }
+
+   /***** Allocate memory for the list of items *****/
+   Syl_LstItemsSyllabus.NumItems = Header->NumItems;
+   if ((Syl_LstItemsSyllabus.Lst = calloc (Syl_LstItemsSyllabus.NumItems + 1,
+                                           sizeof (*Syl_LstItemsSyllabus.Lst))) == NULL)
+      Lay_NotEnoughMemoryExit ();
+   Syl_LstItemsSyllabus.MappedFile = MappedFile;
+   Syl_LstItemsSyllabus.MappedFileSize = MappedFileSize;
+
+   /***** Get items, with texts pointing to mapped file *****/
+   for (NumItem = 0;
+	NumItem < Syl_LstItemsSyllabus.NumItems;
+	NumItem++)
+     {
+      Syl_LstItemsSyllabus.Lst[NumItem].Level = BinItems[NumItem].Level;
+      for (N = 1;
+	   N <= Syl_MAX_LEVELS_SYLLABUS;
+	   N++)
+	 Syl_LstItemsSyllabus.Lst[NumItem].CodItem[N] = BinItems[NumItem].CodItem[N];
+      Syl_LstItemsSyllabus.Lst[NumItem].HasChildren = BinItems[NumItem].HasChildren != 0;
+      Syl_LstItemsSyllabus.Lst[NumItem].Text = Texts + BinItems[NumItem].TextOffset;
+     }
+   Syl_LstItemsSyllabus.NumItemsWithChildren = Header->NumItemsWithChildren;
+   Syl_LstItemsSyllabus.NumLevels = Header->NumLevels;
+
+   /***** If the syllabus is empty ==> initialize an item to be edited *****/
+   if (Syl_LstItemsSyllabus.NumItems == 0)
+      Syl_ComputeNumbersOfItems ();
+
+   return true;
+  }
+
+/*****************************************************************************/
+/********************* Load items of a syllabus from XML *********************/
+/*****************************************************************************/
+
+static void Syl_LoadListItemsFromXMLFile (const struct Syl_Syllabus *Syllabus,
+                                          struct stat *XMLStatus)
+  {
+   char PathFile[PATH_MAX + 1];
+   long PostBeginList;
+   unsigned NumItem;
+   char Text[Syl_MAX_BYTES_TEXT_ITEM + 1];
+   int Result;
+   FILE *FileTexts;
+   size_t TextsSize;
+   size_t *TextOffsets;
+
    /***** Open the file with the syllabus *****/
    Syl_OpenSyllabusFile (Syllabus,PathFile);
+   if (fstat (fileno (Gbl.F.XML),XMLStatus))
+      Lay_ShowErrorAndExit ("Can not get status of syllabus file.");
 
    /***** Go to the start of the list of items *****/
    if (!Str_FindStrInFile (Gbl.F.XML,"<lista>",Str_NO_SKIP_HTML_COMMENTS))
@@ -393,12 +583,70 @@ void Syl_LoadListItemsSyllabusIntoMemory (struct Syl_Syllabus *Syllabus,
 
    /***** Allocate memory for the list of items *****/
    if ((Syl_LstItemsSyllabus.Lst = calloc (Syl_LstItemsSyllabus.NumItems + 1,
-                                           sizeof (*Syl_LstItemsSyllabus.Lst))) == NULL)
+                                           sizeof (*Syl_LstItemsSyllabus.Lst))) == NULL ||
+       (TextOffsets = malloc ((Syl_LstItemsSyllabus.NumItems + 1) * sizeof (*TextOffsets))) == NULL)
       Lay_NotEnoughMemoryExit ();
 
    /***** Return to the start of the list *****/
    fseek (Gbl.F.XML,PostBeginList,SEEK_SET);
 
+   /***** Loop to read all the items of the syllabus,
+          storing all texts one after another *****/
+   if ((FileTexts = open_memstream (&Syl_LstItemsSyllabus.Texts,&TextsSize)) == NULL)
+      Lay_NotEnoughMemoryExit ();
+   for (NumItem = 0;
+	NumItem < Syl_LstItemsSyllabus.NumItems;
+	NumItem++)
+     {
+      /* Go to the start of the item */
+      if (!Str_FindStrInFile (Gbl.F.XML,"<item",Str_NO_SKIP_HTML_COMMENTS))
+	 Lay_ShowErrorAndExit ("Wrong syllabus format.");
+
+      /* Get the level */
+      Syl_LstItemsSyllabus.Lst[NumItem].Level = Syl_ReadLevelItemSyllabus ();
+
+      /* Get the text of the item */
+      Result = Str_ReadFileUntilBoundaryStr (Gbl.F.XML,Text,
+					     "</item>",strlen ("</item>"),
+					     (unsigned long long) Syl_MAX_BYTES_TEXT_ITEM);
+      if (Result == 0) // Str too long
+	{
+	 if (!Str_FindStrInFile (Gbl.F.XML,"</item>",Str_NO_SKIP_HTML_COMMENTS)) // End the search
+	    Lay_ShowErrorAndExit ("Wrong syllabus format.");
+	}
+      else if (Result == -1)
+	 Lay_ShowErrorAndExit ("Wrong syllabus format.");
+      TextOffsets[NumItem] = (size_t) ftell (FileTexts);
+      fwrite (Text,1,strlen (Text) + 1,FileTexts);
+     }
+   fclose (FileTexts);
+
+   /***** Close the file with the syllabus *****/
+   Fil_CloseXMLFile ();
+
+   /***** Point texts of items to texts read *****/
+   for (NumItem = 0;
+	NumItem < Syl_LstItemsSyllabus.NumItems;
+	NumItem++)
+      Syl_LstItemsSyllabus.Lst[NumItem].Text = Syl_LstItemsSyllabus.Texts +
+					       TextOffsets[NumItem];
+   free (TextOffsets);
+
+   /***** Compute numbers of items from their levels *****/
+   Syl_ComputeNumbersOfItems ();
+  }
+
+/*****************************************************************************/
+/******* Compute codes (numbers) of items and other fields in the list *******/
+/*****************************************************************************/
+
+static void Syl_ComputeNumbersOfItems (void)
+  {
+   unsigned NumItem;
+   int N;
+   int CodItem[1 + Syl_MAX_LEVELS_SYLLABUS];	// To make numeration
+   unsigned NumItemsWithChildren = 0;
+
    for (N  = 1;
 	N <= Syl_MAX_LEVELS_SYLLABUS;
 	N++)
@@ -419,20 +667,15 @@ void Syl_LoadListItemsSyllabusIntoMemory (struct Syl_Syllabus *Syllabus,
 	 Syl_LstItemsSyllabus.Lst[0].CodItem[N] = CodItem[N];
 
       /* Text of the item  */
-      Syl_LstItemsSyllabus.Lst[0].Text[0] = '\0';
+      Syl_LstItemsSyllabus.Lst[0].Text = "";
      }
    else
-      /***** Loop to read and store all the items of the syllabus *****/
+      /***** Loop to compute the code of all the items of the syllabus *****/
       for (NumItem = 0;
 	   NumItem < Syl_LstItemsSyllabus.NumItems;
 	   NumItem++)
 	{
-	 /* Go to the start of the item */
-	 if (!Str_FindStrInFile (Gbl.F.XML,"<item",Str_NO_SKIP_HTML_COMMENTS))
-	    Lay_ShowErrorAndExit ("Wrong syllabus format.");
-
-	 /* Get the level */
-	 Syl_LstItemsSyllabus.Lst[NumItem].Level = Syl_ReadLevelItemSyllabus ();
+	 /* Get the maximum level */
 	 if (Syl_LstItemsSyllabus.Lst[NumItem].Level > Syl_LstItemsSyllabus.NumLevels)
 	    Syl_LstItemsSyllabus.NumLevels = Syl_LstItemsSyllabus.Lst[NumItem].Level;
 
@@ -446,23 +689,8 @@ void Syl_LoadListItemsSyllabusIntoMemory (struct Syl_Syllabus *Syllabus,
 	      N <= Syl_MAX_LEVELS_SYLLABUS;
 	      N++)
 	    Syl_LstItemsSyllabus.Lst[NumItem].CodItem[N] = CodItem[N];
-
-	 /* Get the text of the item */
-	 Result = Str_ReadFileUntilBoundaryStr (Gbl.F.XML,Syl_LstItemsSyllabus.Lst[NumItem].Text,
-	                                        "</item>",strlen ("</item>"),
-	                                        (unsigned long long) Syl_MAX_BYTES_TEXT_ITEM);
-	 if (Result == 0) // Str too long
-	   {
-	    if (!Str_FindStrInFile (Gbl.F.XML,"</item>",Str_NO_SKIP_HTML_COMMENTS)) // End the search
-	       Lay_ShowErrorAndExit ("Wrong syllabus format.");
-	   }
-	 else if (Result == -1)
-	    Lay_ShowErrorAndExit ("Wrong syllabus format.");
 	}
 
-   /***** Close the file with the syllabus *****/
-   Fil_CloseXMLFile ();
-
    /***** Initialize other fields in the list *****/
    if (Syl_LstItemsSyllabus.NumItems)
      {
@@ -481,6 +709,80 @@ void Syl_LoadListItemsSyllabusIntoMemory (struct Syl_Syllabus *Syllabus,
    Syl_LstItemsSyllabus.NumItemsWithChildren = NumItemsWithChildren;
   }
 
+/*****************************************************************************/
+/********* Write binary file with the items of a syllabus in memory **********/
+/*****************************************************************************/
+// The binary file is written in a temporary file and then renamed,
+// so other processes never map a partially written file
+
+static void Syl_WriteBinFile (const struct Syl_Syllabus *Syllabus,
+                              const struct stat *XMLStatus)
+  {
+   char PathFileBin[PATH_MAX + 1 + NAME_MAX + 1];
+   char PathFileTmp[PATH_MAX + 1 + NAME_MAX + 1];
+   FILE *FileBin;
+   struct Syl_BinHeader Header;
+   struct Syl_BinItem BinItem;
+   uint32_t TextOffset;
+   unsigned NumItem;
+   int N;
+
+   /***** Create temporary file *****/
+   snprintf (PathFileBin,sizeof (PathFileBin),"%s/%s",
+	     Syllabus->PathDir,Cfg_SYLLABUS_BIN_FILENAME);
+   snprintf (PathFileTmp,sizeof (PathFileTmp),"%s/%s.tmp",
+	     Syllabus->PathDir,Gbl.UniqueNameEncrypted);
+   if ((FileBin = fopen (PathFileTmp,"wb")) == NULL)
+      return;	// Binary file is not necessary, XML file will be read again
+
+   /***** Write header *****/
+   memset (&Header,0,sizeof (Header));
+   memcpy (Header.Magic,Syl_BIN_MAGIC,sizeof (Header.Magic));
+   Header.NumItems             = (uint32_t) Syl_LstItemsSyllabus.NumItems;
+   Header.NumItemsWithChildren = (uint32_t) Syl_LstItemsSyllabus.NumItemsWithChildren;
+   Header.NumLevels            = (int32_t) Syl_LstItemsSyllabus.NumLevels;
+   Header.XMLSize              = (int64_t) XMLStatus->st_size;
+   Header.XMLModifTimeSec      = (int64_t) XMLStatus->st_mtim.tv_sec;
+   Header.XMLModifTimeNsec     = (int64_t) XMLStatus->st_mtim.tv_nsec;
+   fwrite (&Header,sizeof (Header),1,FileBin);
+
+   /***** Write items *****/
+   for (NumItem = 0, TextOffset = 0;
+	NumItem < Syl_LstItemsSyllabus.NumItems;
+	NumItem++)
+     {
+      memset (&BinItem,0,sizeof (BinItem));
+      BinItem.Level = (int32_t) Syl_LstItemsSyllabus.Lst[NumItem].Level;
+      for (N = 1;
+	   N <= Syl_MAX_LEVELS_SYLLABUS;
+	   N++)
+	 BinItem.CodItem[N] = (int32_t) Syl_LstItemsSyllabus.Lst[NumItem].CodItem[N];
+      BinItem.HasChildren = Syl_LstItemsSyllabus.Lst[NumItem].HasChildren ? 1 :
+									    0;
+      BinItem.TextOffset = TextOffset;
+      fwrite (&BinItem,sizeof (BinItem),1,FileBin);
+      TextOffset += (uint32_t) strlen (Syl_LstItemsSyllabus.Lst[NumItem].Text) + 1;
+     }
+
+   /***** Write texts, null-terminated, and an empty text at the end *****/
+   for (NumItem = 0;
+	NumItem < Syl_LstItemsSyllabus.NumItems;
+	NumItem++)
+      fwrite (Syl_LstItemsSyllabus.Lst[NumItem].Text,
+	      1,strlen (Syl_LstItemsSyllabus.Lst[NumItem].Text) + 1,FileBin);
+   fputc ('\0',FileBin);
+
+   /***** Close temporary file and replace binary file *****/
+   if (ferror (FileBin))
+     {
+      fclose (FileBin);
+      unlink (PathFileTmp);
+     }
+   else if (fclose (FileBin) ||
+	    rename (PathFileTmp,PathFileBin))
+      unlink (PathFileTmp);
+  }
+
 /*****************************************************************************/
 /*********************** Free list of items of a syllabus ********************/
 /*****************************************************************************/
@@ -493,6 +795,17 @@ void Syl_FreeListItemsSyllabus (void)
       Syl_LstItemsSyllabus.Lst = NULL;
       Syl_LstItemsSyllabus.NumItems = 0;
      }
+   if (Syl_LstItemsSyllabus.Texts)
+     {
+      free (Syl_LstItemsSyllabus.Texts);
+      Syl_LstItemsSyllabus.Texts = NULL;
+     }
+   if (Syl_LstItemsSyllabus.MappedFile)
+     {
+      munmap (Syl_LstItemsSyllabus.MappedFile,Syl_LstItemsSyllabus.MappedFileSize);
+      Syl_LstItemsSyllabus.MappedFile = NULL;
+      Syl_LstItemsSyllabus.MappedFileSize = 0;
+     }
   }
 
 /*****************************************************************************/
@@ -925,10 +1238,6 @@ static void Syl_WriteNumItem (char *StrDst,FILE *FileTgt,int Level,int *CodItem)
 void Syl_RemoveItemSyllabus (void)
   {
    struct Syl_Syllabus Syllabus;
-   char PathFile[PATH_MAX + 1];
-   char PathOldFile[PATH_MAX + 1];
-   char PathNewFile[PATH_MAX + 1];
-   FILE *NewFile;
    unsigned NumItem;
 
    /***** Reset syllabus context *****/
@@ -945,30 +1254,18 @@ void Syl_RemoveItemSyllabus (void)
    /***** Get item number *****/
    Syllabus.NumItem = Syl_GetParamItemNumber ();
 
-   /***** Create a new file to make the update *****/
-   Syl_BuildPathFileSyllabus (&Syllabus,PathFile);
-   Fil_CreateUpdateFile (PathFile,".old",PathOldFile,PathNewFile,&NewFile);
-
-   /***** Create the new XML file *****/
-   Syl_WriteStartFileSyllabus (NewFile);
-   for (NumItem = 0;
-	NumItem < Syl_LstItemsSyllabus.NumItems;
-	NumItem++)
-      if (NumItem != Syllabus.NumItem)
-	 Syl_WriteItemFileSyllabus (NewFile,Syl_LstItemsSyllabus.Lst[NumItem].Level,Syl_LstItemsSyllabus.Lst[NumItem].Text);
-   Syl_WriteEndFileSyllabus (NewFile);
-
-   /***** Close the files *****/
-   Fil_CloseUpdateFile (PathFile,PathOldFile,PathNewFile,NewFile);
-
-   /***** We are editing a syllabus with the internal editor,
-          so change info source to internal editor in database *****/
-   Inf_SetInfoSrcIntoDB (Syl_LstItemsSyllabus.NumItems ? Inf_INFO_SRC_EDITOR :
-   	                                                 Inf_INFO_SRC_NONE);
+   /***** Remove item from list in memory *****/
+   if (Syllabus.NumItem < Syl_LstItemsSyllabus.NumItems)
+     {
+      for (NumItem = Syllabus.NumItem;
+	   NumItem < Syl_LstItemsSyllabus.NumItems - 1;
+	   NumItem++)
+	 Syl_LstItemsSyllabus.Lst[NumItem] = Syl_LstItemsSyllabus.Lst[NumItem + 1];
+      Syl_LstItemsSyllabus.NumItems--;
+     }
 
-   /***** Show the updated syllabus to continue editing it *****/
-   Syl_FreeListItemsSyllabus ();
-   (void) Syl_CheckAndEditSyllabus (&Syllabus);
+   /***** Write files and show the updated syllabus to continue editing it *****/
+   Syl_UpdateAndShowSyllabus (&Syllabus);
   }
 
 /*****************************************************************************/
@@ -996,11 +1293,6 @@ void Syl_DownItemSyllabus (void)
 static void Syl_ChangePlaceItemSyllabus (Syl_ChangePosItem_t UpOrDownPos)
   {
    struct Syl_Syllabus Syllabus;
-   char PathFile[PATH_MAX + 1];
-   char PathOldFile[PATH_MAX + 1];
-   char PathNewFile[PATH_MAX + 1];
-   FILE *NewFile;
-   unsigned NumItem;
    struct MoveSubtrees Subtree;
 
    /***** Reset syllabus context *****/
@@ -1023,10 +1315,6 @@ static void Syl_ChangePlaceItemSyllabus (Syl_ChangePosItem_t UpOrDownPos)
 
    if (Syllabus.NumItem < Syl_LstItemsSyllabus.NumItems)
      {
-      /***** Create a new file where make the update *****/
-      Syl_BuildPathFileSyllabus (&Syllabus,PathFile);
-      Fil_CreateUpdateFile (PathFile,".old",PathOldFile,PathNewFile,&NewFile);
-
       /***** Get up or get down position *****/
       switch (UpOrDownPos)
 	{
@@ -1038,43 +1326,43 @@ static void Syl_ChangePlaceItemSyllabus (Syl_ChangePosItem_t UpOrDownPos)
 	    break;
 	}
 
-      /***** Create the new XML file *****/
-      Syl_WriteStartFileSyllabus (NewFile);
+      /***** Exchange subtrees in list in memory *****/
       if (Subtree.MovAllowed)
-	{
-	 for (NumItem = 0;
-	      NumItem < Subtree.ToGetDown.Ini;
-	      NumItem++)
-	    Syl_WriteItemFileSyllabus (NewFile,Syl_LstItemsSyllabus.Lst[NumItem].Level,Syl_LstItemsSyllabus.Lst[NumItem].Text);
-	 for (NumItem = Subtree.ToGetUp.Ini;
-	      NumItem <= Subtree.ToGetUp.End;
-	      NumItem++)
-	    Syl_WriteItemFileSyllabus (NewFile,Syl_LstItemsSyllabus.Lst[NumItem].Level,Syl_LstItemsSyllabus.Lst[NumItem].Text);
-	 for (NumItem = Subtree.ToGetDown.Ini;
-	      NumItem <= Subtree.ToGetDown.End;
-	      NumItem++)
-	    Syl_WriteItemFileSyllabus (NewFile,Syl_LstItemsSyllabus.Lst[NumItem].Level,Syl_LstItemsSyllabus.Lst[NumItem].Text);
-	 for (NumItem = Subtree.ToGetUp.End + 1;
-	      NumItem < Syl_LstItemsSyllabus.NumItems;
-	      NumItem++)
-	    Syl_WriteItemFileSyllabus (NewFile,Syl_LstItemsSyllabus.Lst[NumItem].Level,Syl_LstItemsSyllabus.Lst[NumItem].Text);
-	}
-      else
-	 Syl_WriteAllItemsFileSyllabus (NewFile);
-      Syl_WriteEndFileSyllabus (NewFile);
-
-      /***** Close the files *****/
-      Fil_CloseUpdateFile (PathFile,PathOldFile,PathNewFile,NewFile);
+	 Syl_ExchangeSubtrees (&Subtree);
      }
 
-   /***** We are editing a syllabus with the internal editor,
-          so change info source to internal editor in database *****/
-   Inf_SetInfoSrcIntoDB (Syl_LstItemsSyllabus.NumItems ? Inf_INFO_SRC_EDITOR :
-						         Inf_INFO_SRC_NONE);
+   /***** Write files and show the updated syllabus to continue editing it *****/
+   Syl_UpdateAndShowSyllabus (&Syllabus);
+  }
 
-   /***** Show the updated syllabus to continue editing it *****/
-   Syl_FreeListItemsSyllabus ();
-   (void) Syl_CheckAndEditSyllabus (&Syllabus);
+/*****************************************************************************/
+/****** Exchange two consecutive subtrees in the list of items in memory *****/
+/*****************************************************************************/
+// The subtree to get down is just before the subtree to get up
+
+static void Syl_ExchangeSubtrees (const struct MoveSubtrees *Subtree)
+  {
+   unsigned NumItemsToGetUp   = Subtree->ToGetUp.End   - Subtree->ToGetUp.Ini   + 1;
+   unsigned NumItemsToGetDown = Subtree->ToGetDown.End - Subtree->ToGetDown.Ini + 1;
+   struct ItemSyllabus *ItemsToGetDown;
+
+   /***** Save subtree to get down *****/
+   if ((ItemsToGetDown = malloc (NumItemsToGetDown * sizeof (*ItemsToGetDown))) == NULL)
+      Lay_NotEnoughMemoryExit ();
+   memcpy (ItemsToGetDown,&Syl_LstItemsSyllabus.Lst[Subtree->ToGetDown.Ini],
+	   NumItemsToGetDown * sizeof (*ItemsToGetDown));
+
+   /***** Move subtree to get up to the start *****/
+   memmove (&Syl_LstItemsSyllabus.Lst[Subtree->ToGetDown.Ini],
+	    &Syl_LstItemsSyllabus.Lst[Subtree->ToGetUp.Ini],
+	    NumItemsToGetUp * sizeof (*ItemsToGetDown));
+
+   /***** Put subtree to get down after it *****/
+   memcpy (&Syl_LstItemsSyllabus.Lst[Subtree->ToGetDown.Ini + NumItemsToGetUp],
+	   ItemsToGetDown,
+	   NumItemsToGetDown * sizeof (*ItemsToGetDown));
+
+   free (ItemsToGetDown);
   }
 
 /*****************************************************************************/
@@ -1192,10 +1480,6 @@ void Syl_LeftItemSyllabus (void)
 static void Syl_ChangeLevelItemSyllabus (Syl_ChangeLevelItem_t IncreaseOrDecreaseLevel)
   {
    struct Syl_Syllabus Syllabus;
-   char PathFile[PATH_MAX + 1];
-   char PathOldFile[PATH_MAX + 1];
-   char PathNewFile[PATH_MAX + 1];
-   FILE *NewFile;
 
    /***** Reset syllabus context *****/
    Syl_ResetSyllabus (&Syllabus);
@@ -1211,39 +1495,22 @@ static void Syl_ChangeLevelItemSyllabus (Syl_ChangeLevelItem_t IncreaseOrDecreas
    /***** Get item number *****/
    Syllabus.NumItem = Syl_GetParamItemNumber ();
 
-   /***** Create a new file to do the update *****/
-   Syl_BuildPathFileSyllabus (&Syllabus,PathFile);
-   Fil_CreateUpdateFile (PathFile,".old",PathOldFile,PathNewFile,&NewFile);
-
    /***** Increase or decrease level *****/
-   switch (IncreaseOrDecreaseLevel)
-     {
-      case Syl_INCREASE_LEVEL:
-	 if (Syl_LstItemsSyllabus.Lst[Syllabus.NumItem].Level > 1)
-	    Syl_LstItemsSyllabus.Lst[Syllabus.NumItem].Level--;
-	 break;
-      case Syl_DECREASE_LEVEL:
-	 if (Syl_LstItemsSyllabus.Lst[Syllabus.NumItem].Level < Syl_MAX_LEVELS_SYLLABUS)
-	    Syl_LstItemsSyllabus.Lst[Syllabus.NumItem].Level++;
-	 break;
-     }
-
-   /***** Create the new XML file *****/
-   Syl_WriteStartFileSyllabus (NewFile);
-   Syl_WriteAllItemsFileSyllabus (NewFile);
-   Syl_WriteEndFileSyllabus (NewFile);
-
-   /***** Close the files *****/
-   Fil_CloseUpdateFile (PathFile,PathOldFile,PathNewFile,NewFile);
-
-   /***** We are editing a syllabus with the internal editor,
-          so change info source to internal editor in database *****/
-   Inf_SetInfoSrcIntoDB (Syl_LstItemsSyllabus.NumItems ? Inf_INFO_SRC_EDITOR :
-   	                                                 Inf_INFO_SRC_NONE);
+   if (Syllabus.NumItem < Syl_LstItemsSyllabus.NumItems)
+      switch (IncreaseOrDecreaseLevel)
+	{
+	 case Syl_INCREASE_LEVEL:
+	    if (Syl_LstItemsSyllabus.Lst[Syllabus.NumItem].Level > 1)
+	       Syl_LstItemsSyllabus.Lst[Syllabus.NumItem].Level--;
+	    break;
+	 case Syl_DECREASE_LEVEL:
+	    if (Syl_LstItemsSyllabus.Lst[Syllabus.NumItem].Level < Syl_MAX_LEVELS_SYLLABUS)
+	       Syl_LstItemsSyllabus.Lst[Syllabus.NumItem].Level++;
+	    break;
+	}
 
-   /***** Show the updated syllabus to continue editing it *****/
-   Syl_FreeListItemsSyllabus ();
-   (void) Syl_CheckAndEditSyllabus (&Syllabus);
+   /***** Write files and show the updated syllabus to continue editing it *****/
+   Syl_UpdateAndShowSyllabus (&Syllabus);
   }
 
 /*****************************************************************************/
@@ -1253,10 +1520,6 @@ static void Syl_ChangeLevelItemSyllabus (Syl_ChangeLevelItem_t IncreaseOrDecreas
 void Syl_InsertItemSyllabus (void)
   {
    struct Syl_Syllabus Syllabus;
-   char PathFile[PATH_MAX + 1];
-   char PathOldFile[PATH_MAX + 1];
-   char PathNewFile[PATH_MAX + 1];
-   FILE *NewFile;
    unsigned NumItem;
    char Txt[Syl_MAX_BYTES_TEXT_ITEM + 1];
 
@@ -1277,44 +1540,31 @@ void Syl_InsertItemSyllabus (void)
    /***** Get item body *****/
    Par_GetParToHTML ("Txt",Txt,Syl_MAX_BYTES_TEXT_ITEM);
 
-   /***** Create a new file to do the update *****/
-   Syl_BuildPathFileSyllabus (&Syllabus,PathFile);
-   Fil_CreateUpdateFile (PathFile,".old",PathOldFile,PathNewFile,&NewFile);
-
-   /***** Create the new XML file *****/
-   Syl_WriteStartFileSyllabus (NewFile);
-
-   /* Write items before the one to be inserted */
-   for (NumItem = 0;
-	NumItem < Syllabus.NumItem;
-	NumItem++)
-      Syl_WriteItemFileSyllabus (NewFile,Syl_LstItemsSyllabus.Lst[NumItem].Level,Syl_LstItemsSyllabus.Lst[NumItem].Text);
-
-   /* Write the item that will be inserted */
-   Syl_WriteItemFileSyllabus (NewFile,
-                              NumItem ? Syl_LstItemsSyllabus.Lst[NumItem - 1].Level :
-                        	        1,
-                              Txt);
-
-   /* Write items after the one just inserted */
-   for (;
-	NumItem < Syl_LstItemsSyllabus.NumItems;
-	NumItem++)
-      Syl_WriteItemFileSyllabus (NewFile,Syl_LstItemsSyllabus.Lst[NumItem].Level,Syl_LstItemsSyllabus.Lst[NumItem].Text);
-
-   Syl_WriteEndFileSyllabus (NewFile);
-
-   /***** Close the files *****/
-   Fil_CloseUpdateFile (PathFile,PathOldFile,PathNewFile,NewFile);
-
-   /***** We are editing a syllabus with the internal editor,
-          so change info source to internal editor in database *****/
-   Inf_SetInfoSrcIntoDB (Syl_LstItemsSyllabus.NumItems ? Inf_INFO_SRC_EDITOR :
-   	                                                 Inf_INFO_SRC_NONE);
+   /***** Insert item in list in memory *****/
+   if (Syllabus.NumItem <= Syl_LstItemsSyllabus.NumItems)
+     {
+      /* Allocate one item more (one more than the number of items
+         is always allocated) */
+      if ((Syl_LstItemsSyllabus.Lst = realloc (Syl_LstItemsSyllabus.Lst,
+					       (Syl_LstItemsSyllabus.NumItems + 2) *
+					       sizeof (*Syl_LstItemsSyllabus.Lst))) == NULL)
+	 Lay_NotEnoughMemoryExit ();
+
+      /* Move items after the one to be inserted */
+      for (NumItem = Syl_LstItemsSyllabus.NumItems;
+	   NumItem > Syllabus.NumItem;
+	   NumItem--)
+	 Syl_LstItemsSyllabus.Lst[NumItem] = Syl_LstItemsSyllabus.Lst[NumItem - 1];
+      Syl_LstItemsSyllabus.NumItems++;
+
+      /* Set the item that will be inserted */
+      Syl_LstItemsSyllabus.Lst[NumItem].Level = NumItem ? Syl_LstItemsSyllabus.Lst[NumItem - 1].Level :
+							  1;
+      Syl_LstItemsSyllabus.Lst[NumItem].Text = Txt;
+     }
 
-   /***** Show the updated syllabus to continue editing it *****/
-   Syl_FreeListItemsSyllabus ();
-   (void) Syl_CheckAndEditSyllabus (&Syllabus);
+   /***** Write files and show the updated syllabus to continue editing it *****/
+   Syl_UpdateAndShowSyllabus (&Syllabus);
   }
 
 /*****************************************************************************/
@@ -1324,10 +1574,7 @@ void Syl_InsertItemSyllabus (void)
 void Syl_ModifyItemSyllabus (void)
   {
    struct Syl_Syllabus Syllabus;
-   char PathFile[PATH_MAX + 1];
-   char PathOldFile[PATH_MAX + 1];
-   char PathNewFile[PATH_MAX + 1];
-   FILE *NewFile;
+   char Txt[Syl_MAX_BYTES_TEXT_ITEM + 1];
 
    /***** Reset syllabus context *****/
    Syl_ResetSyllabus (&Syllabus);
@@ -1344,20 +1591,29 @@ void Syl_ModifyItemSyllabus (void)
    Syllabus.NumItem = Syl_GetParamItemNumber ();
 
    /***** Get item body *****/
-   Par_GetParToHTML ("Txt",Syl_LstItemsSyllabus.Lst[Syllabus.NumItem].Text,
-                     Syl_MAX_BYTES_TEXT_ITEM);
+   if (Syllabus.NumItem < Syl_LstItemsSyllabus.NumItems)
+     {
+      Par_GetParToHTML ("Txt",Txt,Syl_MAX_BYTES_TEXT_ITEM);
+      Syl_LstItemsSyllabus.Lst[Syllabus.NumItem].Text = Txt;
+     }
 
-   /***** Create a new file where make the update *****/
-   Syl_BuildPathFileSyllabus (&Syllabus,PathFile);
-   Fil_CreateUpdateFile (PathFile,".old",PathOldFile,PathNewFile,&NewFile);
+   /***** Write files and show the updated syllabus to continue editing it *****/
+   Syl_UpdateAndShowSyllabus (&Syllabus);
+  }
 
-   /***** Create the new XML file *****/
-   Syl_WriteStartFileSyllabus (NewFile);
-   Syl_WriteAllItemsFileSyllabus (NewFile);
-   Syl_WriteEndFileSyllabus (NewFile);
+/*****************************************************************************/
+/******* Write a syllabus changed in memory and show it to edit it ***********/
+/*****************************************************************************/
+// Texts of new items point to local variables of the caller,
+// so the list is freed before returning
 
-   /***** Close the files *****/
-   Fil_CloseUpdateFile (PathFile,PathOldFile,PathNewFile,NewFile);
+static void Syl_UpdateAndShowSyllabus (struct Syl_Syllabus *Syllabus)
+  {
+   /***** Compute again numbers of items *****/
+   Syl_ComputeNumbersOfItems ();
+
+   /***** Write XML and binary files *****/
+   Syl_WriteSyllabusFiles (Syllabus);
 
    /***** We are editing a syllabus with the internal editor,
           so change info source to internal editor in database *****/
@@ -1365,8 +1621,41 @@ void Syl_ModifyItemSyllabus (void)
    	                                                 Inf_INFO_SRC_NONE);
 
    /***** Show the updated syllabus to continue editing it *****/
+   (void) Syl_ShowListItemsSyllabus (Syllabus);
    Syl_FreeListItemsSyllabus ();
-   (void) Syl_CheckAndEditSyllabus (&Syllabus);
+  }
+
+/*****************************************************************************/
+/******** Write the list of items in memory into XML and binary files ********/
+/*****************************************************************************/
+
+static void Syl_WriteSyllabusFiles (const struct Syl_Syllabus *Syllabus)
+  {
+   char PathFile[PATH_MAX + 1];
+   char PathOldFile[PATH_MAX + 1];
+   char PathNewFile[PATH_MAX + 1];
+   FILE *NewFile;
+   struct stat XMLStatus;
+
+   /***** Create a new XML file to do the update *****/
+   Syl_BuildPathFileSyllabus (Syllabus,PathFile);
+   Fil_CreateUpdateFile (PathFile,".old",PathOldFile,PathNewFile,&NewFile);
+
+   /***** Write the new XML file *****/
+   Syl_WriteStartFileSyllabus (NewFile);
+   Syl_WriteAllItemsFileSyllabus (NewFile);
+   Syl_WriteEndFileSyllabus (NewFile);
+
+   /***** Get status of the new XML file once written *****/
+   fflush (NewFile);
+   if (fstat (fileno (NewFile),&XMLStatus))
+      Lay_ShowErrorAndExit ("Can not get status of syllabus file.");
+
+   /***** Close the files *****/
+   Fil_CloseUpdateFile (PathFile,PathOldFile,PathNewFile,NewFile);
+
+   /***** Write binary file corresponding to the new XML file *****/
+   Syl_WriteBinFile (Syllabus,&XMLStatus);
   }
 
 /*****************************************************************************/
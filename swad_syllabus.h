@@ -57,6 +57,9 @@ struct LstItemsSyllabus
    unsigned NumItems;			// Number of items in the list
    unsigned NumItemsWithChildren;	// Number of items with children
    int NumLevels;			// Number of levels in the list
+   char *Texts;				// Texts of items read from XML file
+   void *MappedFile;			// Binary file with items mapped in memory
+   size_t MappedFileSize;
   };
 
 // Structure used to get the limits (number of items) of the subtrees to exchange in a syllabus
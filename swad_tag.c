@@ -393,6 +393,7 @@ void Tag_InsertTagsIntoDB (long QstCod,const struct Tag_Tags *Tags)
    unsigned NumTag;
    unsigned TagIdx;
    long TagCod;
+   char *Query = NULL;
 
    /***** For each tag... *****/
    for (NumTag = 0, TagIdx = 0;
@@ -405,16 +406,28 @@ void Tag_InsertTagsIntoDB (long QstCod,const struct Tag_Tags *Tags)
             /* This tag is new for current course. Add it to tags table */
             TagCod = Tag_CreateNewTag (Gbl.Hierarchy.Crs.CrsCod,Tags->Txt[NumTag]);
 
-         /***** Insert tag in tst_question_tags *****/
-         DB_QueryINSERT ("can not create tag",
-			 "INSERT INTO tst_question_tags"
-                         " (QstCod,TagCod,TagInd)"
-                         " VALUES"
-                         " (%ld,%ld,%u)",
-			 QstCod,TagCod,TagIdx);
+         /***** Add tag to query *****/
+         if (Query)
+            DB_AddToQuery (&Query,
+        		   ",(%ld,%ld,%u)",
+			   QstCod,TagCod,TagIdx);
+         else
+            DB_BuildQuery (&Query,
+        		   "INSERT INTO tst_question_tags"
+                           " (QstCod,TagCod,TagInd)"
+                           " VALUES"
+                           " (%ld,%ld,%u)",
+			   QstCod,TagCod,TagIdx);
 
          TagIdx++;
         }
+
+   /***** Insert all tags in tst_question_tags *****/
+   if (Query)
+     {
+      DB_QueryINSERT ("can not create tags","%s",Query);
+      free (Query);
+     }
   }
 
 /*****************************************************************************/
@@ -50,6 +50,7 @@
 #include "swad_match.h"
 #include "swad_media.h"
 #include "swad_parameter.h"
+#include "swad_random.h"
 #include "swad_theme.h"
 #include "swad_test.h"
 #include "swad_test_config.h"
@@ -196,7 +197,6 @@ static void Tst_PutFloatInputField (const char *Label,const char *Field,
 static void Tst_PutTFInputField (const struct Tst_Question *Question,
                                  const char *Label,char Value);
 
-static void Tst_FreeTextChoiceAnswers (struct Tst_Question *Question);
 static void Tst_FreeTextChoiceAnswer (struct Tst_Question *Question,unsigned NumOpt);
 
 static void Tst_ResetMediaOfQuestion (struct Tst_Question *Question);
@@ -1879,7 +1879,8 @@ static void Tst_GetQuestionsForNewTestFromDB (struct Tst_Test *Test,
    char UnsignedStr[Cns_MAX_DECIMAL_DIGITS_UINT + 1];
    Tst_AnswerType_t AnswerType;
    bool Shuffle;
-   char StrNumQsts[Cns_MAX_DECIMAL_DIGITS_UINT + 1];
+   unsigned NumCandidates;
+   MYSQL_ROW SampleRows[TstCfg_MAX_QUESTIONS_PER_TEST];
    unsigned NumQst;
 
    /***** Trivial check: number of questions *****/
@@ -1961,19 +1962,17 @@ static void Tst_GetQuestionsForNewTestFromDB (struct Tst_Test *Test,
       Str_Concat (Query,")",Tst_MAX_BYTES_QUERY_TEST);
      }
 
-   /* End query */
-   Str_Concat (Query," ORDER BY RAND() LIMIT ",Tst_MAX_BYTES_QUERY_TEST);
-   snprintf (StrNumQsts,sizeof (StrNumQsts),"%u",Test->NumQsts);
-   Str_Concat (Query,StrNumQsts,Tst_MAX_BYTES_QUERY_TEST);
-/*
-   if (Gbl.Usrs.Me.Roles.LoggedRole == Rol_SYS_ADM)
-      Lay_ShowAlert (Lay_INFO,Query);
-*/
-   /* Make the query */
+   /* Make the query.
+      All the candidate questions are got without ORDER BY RAND(),
+      which would sort the whole set of candidates in database */
+   NumCandidates = (unsigned) DB_QuerySELECT (&mysql_res,"can not get questions",
+			                      "%s",
+			                      Query);
+
+   /***** Select a random sample of questions from candidates *****/
    Print->NumQsts.All =
-   Test->NumQsts      = (unsigned) DB_QuerySELECT (&mysql_res,"can not get questions",
-			                           "%s",
-			                           Query);
+   Test->NumQsts      = Rnd_GetSampleOfRows (mysql_res,NumCandidates,
+					     Test->NumQsts,SampleRows);
 
    /***** Get questions and answers from database *****/
    for (NumQst = 0;
@@ -1981,7 +1980,7 @@ static void Tst_GetQuestionsForNewTestFromDB (struct Tst_Test *Test,
 	NumQst++)
      {
       /* Get question row */
-      row = mysql_fetch_row (mysql_res);
+      row = SampleRows[NumQst];
       /*
       QstCod	row[0]
       AnsType	row[1]
@@ -2024,6 +2023,12 @@ static void Tst_GetQuestionsForNewTestFromDB (struct Tst_Test *Test,
       Print->PrintedQuestions[NumQst].StrAnswers[0] = '\0';
      }
 
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
+
+   /***** Free space used by query *****/
+   free (Query);
+
    /***** Get if test exam will be visible by teachers *****/
    Print->AllowTeachers = Par_GetParToBool ("AllowTchs");
   }
@@ -2035,60 +2040,71 @@ static void Tst_GetQuestionsForNewTestFromDB (struct Tst_Test *Test,
 void Tst_GenerateChoiceIndexes (struct TstPrn_PrintedQuestion *PrintedQuestion,
 				bool Shuffle)
   {
-   struct Tst_Question Question;
-   unsigned NumOpt;
+   Tst_GetChoiceIndexesFromDB ("tst_answers",PrintedQuestion->QstCod,Shuffle,
+			       PrintedQuestion->StrIndexes);
+  }
+
+/*****************************************************************************/
+/********** Get indexes of answers of a question, shuffled or not ************/
+/*****************************************************************************/
+// Only answer indexes are got from database (not text of answers).
+// Answers are shuffled in memory instead of using ORDER BY RAND().
+// Table may be "tst_answers" or "exa_set_answers"
+
+void Tst_GetChoiceIndexesFromDB (const char *Table,long QstCod,bool Shuffle,
+				 char StrIndexes[Tst_MAX_BYTES_INDEXES_ONE_QST + 1])
+  {
    MYSQL_RES *mysql_res;
    MYSQL_ROW row;
-   unsigned Index;
-   bool ErrorInIndex;
+   unsigned NumOpts;
+   unsigned NumOpt;
+   unsigned Indexes[Tst_MAX_OPTIONS_PER_QUESTION];
    char StrInd[1 + Cns_MAX_DECIMAL_DIGITS_UINT + 1];
 
-   /***** Create test question *****/
-   Tst_QstConstructor (&Question);
-   Question.QstCod = PrintedQuestion->QstCod;
-
-   /***** Get answers of question from database *****/
-   Tst_GetAnswersQst (&Question,&mysql_res,Shuffle);
-   /*
-   row[0] AnsInd
-   row[1] Answer
-   row[2] Feedback
-   row[3] MedCod
-   row[4] Correct
-   */
+   /***** Get answer indexes of question from database *****/
+   NumOpts = (unsigned) DB_QuerySELECT (&mysql_res,"can not get answers of a question",
+				        "SELECT AnsInd"	// row[0]
+				        " FROM %s"
+				        " WHERE QstCod=%ld"
+				        " ORDER BY AnsInd",
+				        Table,
+				        QstCod);
+   if (NumOpts > Tst_MAX_OPTIONS_PER_QUESTION)
+      Lay_ShowErrorAndExit ("Wrong number of answers.");
 
    for (NumOpt = 0;
-	NumOpt < Question.Answer.NumOptions;
+	NumOpt < NumOpts;
 	NumOpt++)
      {
       /***** Get next answer *****/
       row = mysql_fetch_row (mysql_res);
 
-      /***** Assign index (row[0]).
-             Index is 0,1,2,3... if no shuffle
-             or 1,3,0,2... (example) if shuffle *****/
-      ErrorInIndex = false;
-      if (sscanf (row[0],"%u",&Index) == 1)
-        {
-         if (Index >= Tst_MAX_OPTIONS_PER_QUESTION)
-            ErrorInIndex = true;
-        }
-      else
-         ErrorInIndex = true;
-      if (ErrorInIndex)
+      /***** Get index (row[0]) *****/
+      if (sscanf (row[0],"%u",&Indexes[NumOpt]) != 1)
+         Lay_ShowErrorAndExit ("Wrong index of answer.");
+      if (Indexes[NumOpt] >= Tst_MAX_OPTIONS_PER_QUESTION)
          Lay_ShowErrorAndExit ("Wrong index of answer.");
-
-      snprintf (StrInd,sizeof (StrInd),NumOpt ? ",%u" :
-						"%u",Index);
-      Str_Concat (PrintedQuestion->StrIndexes,StrInd,
-                  sizeof (PrintedQuestion->StrIndexes) - 1);
      }
 
    /***** Free structure that stores the query result *****/
    DB_FreeMySQLResult (&mysql_res);
 
-   /***** Destroy test question *****/
-   Tst_QstDestructor (&Question);
+   /***** Shuffle indexes.
+          Index is 0,1,2,3... if no shuffle
+          or 1,3,0,2... (example) if shuffle *****/
+   if (Shuffle)
+      Rnd_ShuffleUnsigned (Indexes,NumOpts);
+
+   /***** Build string with indexes *****/
+   StrIndexes[0] = '\0';
+   for (NumOpt = 0;
+	NumOpt < NumOpts;
+	NumOpt++)
+     {
+      snprintf (StrInd,sizeof (StrInd),NumOpt ? ",%u" :
+						"%u",Indexes[NumOpt]);
+      Str_Concat (StrIndexes,StrInd,Tst_MAX_BYTES_INDEXES_ONE_QST);
+     }
   }
 
 /*****************************************************************************/
@@ -2668,8 +2684,7 @@ unsigned Tst_GetNumAnswersQst (long QstCod)
 			            QstCod);
   }
 
-void Tst_GetAnswersQst (struct Tst_Question *Question,MYSQL_RES **mysql_res,
-                        bool Shuffle)
+void Tst_GetAnswersQst (struct Tst_Question *Question,MYSQL_RES **mysql_res)
   {
    /***** Get answers of a question from database *****/
    Question->Answer.NumOptions = (unsigned)
@@ -2681,10 +2696,8 @@ void Tst_GetAnswersQst (struct Tst_Question *Question,MYSQL_RES **mysql_res,
 			  "Correct"		// row[4]
 		   " FROM tst_answers"
 		   " WHERE QstCod=%ld"
-		   " ORDER BY %s",
-		   Question->QstCod,
-		   Shuffle ? "RAND()" :
-		             "AnsInd");
+		   " ORDER BY AnsInd",
+		   Question->QstCod);
    if (!Question->Answer.NumOptions)
       Ale_ShowAlert (Ale_ERROR,"Error when getting answers of a question.");
   }
@@ -3736,7 +3749,7 @@ bool Tst_AllocateTextChoiceAnswer (struct Tst_Question *Question,unsigned NumOpt
 /******************** Free memory of all choice answers **********************/
 /*****************************************************************************/
 
-static void Tst_FreeTextChoiceAnswers (struct Tst_Question *Question)
+void Tst_FreeTextChoiceAnswers (struct Tst_Question *Question)
   {
    unsigned NumOpt;
 
@@ -3918,8 +3931,7 @@ bool Tst_GetQstDataFromDB (struct Tst_Question *Question)
       DB_FreeMySQLResult (&mysql_res);
 
       /***** Get the answers from the database *****/
-      Tst_GetAnswersQst (Question,&mysql_res,
-			 false);	// Don't shuffle
+      Tst_GetAnswersQst (Question,&mysql_res);
       /*
       row[0] AnsInd
       row[1] Answer
@@ -4950,6 +4962,8 @@ void Tst_PutParamQstCod (void *QstCod)	// Should be a pointer to long
 
 void Tst_InsertOrUpdateQstTagsAnsIntoDB (struct Tst_Question *Question)
   {
+   bool NewQuestion = (Question->QstCod < 0);
+
    /***** Insert or update question in the table of questions *****/
    Tst_InsertOrUpdateQstIntoDB (Question);
    if (Question->QstCod > 0)
@@ -4958,7 +4972,9 @@ void Tst_InsertOrUpdateQstTagsAnsIntoDB (struct Tst_Question *Question)
       Tag_InsertTagsIntoDB (Question->QstCod,&Question->Tags);
 
       /***** Remove unused tags in current course *****/
-      Tag_RemoveUnusedTagsFromCrs (Gbl.Hierarchy.Crs.CrsCod);
+      // Only an existing question may leave unused the tags it had before
+      if (!NewQuestion)
+	 Tag_RemoveUnusedTagsFromCrs (Gbl.Hierarchy.Crs.CrsCod);
 
       /***** Insert answers in the answers table *****/
       Tst_InsertAnswersIntoDB (Question);
@@ -5041,72 +5057,79 @@ static void Tst_InsertAnswersIntoDB (struct Tst_Question *Question)
   {
    unsigned NumOpt;
    unsigned i;
+   char *Query = NULL;
 
-   /***** Insert answers in the answers table *****/
+   /***** Build query to insert all answers in the answers table *****/
+   DB_BuildQuery (&Query,
+		  "INSERT INTO tst_answers"
+		  " (QstCod,AnsInd,Answer,Feedback,MedCod,Correct)"
+		  " VALUES");
    switch (Question->Answer.Type)
      {
       case Tst_ANS_INT:
-         DB_QueryINSERT ("can not create answer",
-			 "INSERT INTO tst_answers"
-                         " (QstCod,AnsInd,Answer,Feedback,MedCod,Correct)"
-                         " VALUES"
-                         " (%ld,0,%ld,'',-1,'Y')",
-			 Question->QstCod,
-			 Question->Answer.Integer);
+         DB_AddToQuery (&Query,
+                        " (%ld,0,%ld,'',-1,'Y')",
+			Question->QstCod,
+			Question->Answer.Integer);
          break;
       case Tst_ANS_FLOAT:
 	 Str_SetDecimalPointToUS ();	// To print the floating point as a dot
    	 for (i = 0;
    	      i < 2;
    	      i++)
-            DB_QueryINSERT ("can not create answer",
-        		    "INSERT INTO tst_answers"
-                            " (QstCod,AnsInd,Answer,Feedback,MedCod,Correct)"
-                            " VALUES"
-                            " (%ld,%u,'%.15lg','',-1,'Y')",
-			    Question->QstCod,i,
-			    Question->Answer.FloatingPoint[i]);
+            DB_AddToQuery (&Query,
+                           "%s(%ld,%u,'%.15lg','',-1,'Y')",
+                           i ? "," :
+                               " ",
+			   Question->QstCod,i,
+			   Question->Answer.FloatingPoint[i]);
          Str_SetDecimalPointToLocal ();	// Return to local system
          break;
       case Tst_ANS_TRUE_FALSE:
-         DB_QueryINSERT ("can not create answer",
-			 "INSERT INTO tst_answers"
-                         " (QstCod,AnsInd,Answer,Feedback,MedCod,Correct)"
-                         " VALUES"
-                         " (%ld,0,'%c','',-1,'Y')",
-			 Question->QstCod,
-			 Question->Answer.TF);
+         DB_AddToQuery (&Query,
+                        " (%ld,0,'%c','',-1,'Y')",
+			Question->QstCod,
+			Question->Answer.TF);
          break;
       case Tst_ANS_UNIQUE_CHOICE:
       case Tst_ANS_MULTIPLE_CHOICE:
       case Tst_ANS_TEXT:
-         for (NumOpt = 0;
+         for (NumOpt = 0, i = 0;
               NumOpt < Question->Answer.NumOptions;
               NumOpt++)
             if (Question->Answer.Options[NumOpt].Text[0] ||			// Text
         	Question->Answer.Options[NumOpt].Media.Type != Med_TYPE_NONE)	// or media
               {
-               DB_QueryINSERT ("can not create answer",
-        		       "INSERT INTO tst_answers"
-                               " (QstCod,AnsInd,Answer,Feedback,MedCod,Correct)"
-                               " VALUES"
-                               " (%ld,%u,'%s','%s',%ld,'%c')",
-			       Question->QstCod,NumOpt,
-			       Question->Answer.Options[NumOpt].Text,
-			       Question->Answer.Options[NumOpt].Feedback ? Question->Answer.Options[NumOpt].Feedback :
-					                                   "",
-			       Question->Answer.Options[NumOpt].Media.MedCod,
-			       Question->Answer.Options[NumOpt].Correct ? 'Y' :
-								          'N');
+               DB_AddToQuery (&Query,
+                              "%s(%ld,%u,'%s','%s',%ld,'%c')",
+                              i++ ? "," :
+                        	    " ",
+			      Question->QstCod,NumOpt,
+			      Question->Answer.Options[NumOpt].Text,
+			      Question->Answer.Options[NumOpt].Feedback ? Question->Answer.Options[NumOpt].Feedback :
+					                                  "",
+			      Question->Answer.Options[NumOpt].Media.MedCod,
+			      Question->Answer.Options[NumOpt].Correct ? 'Y' :
+								         'N');
 
                /* Update image status */
 	       if (Question->Answer.Options[NumOpt].Media.Type != Med_TYPE_NONE)
 		  Question->Answer.Options[NumOpt].Media.Status = Med_STORED_IN_DB;
               }
+         if (i == 0)	// No answers
+           {
+            free (Query);
+            return;
+           }
 	 break;
       default:
-         break;
+         free (Query);
+         return;
      }
+
+   /***** Insert all answers in one query *****/
+   DB_QueryINSERT ("can not create answers","%s",Query);
+   free (Query);
   }
 
 /*****************************************************************************/
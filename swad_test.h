@@ -124,12 +124,13 @@ void Tst_ListQuestionsToSelectForGame (struct Gam_Games *Games);
 
 void Tst_GenerateChoiceIndexes (struct TstPrn_PrintedQuestion *PrintedQuestion,
 				bool Shuffle);
+void Tst_GetChoiceIndexesFromDB (const char *Table,long QstCod,bool Shuffle,
+				 char StrIndexes[Tst_MAX_BYTES_INDEXES_ONE_QST + 1]);
 
 void Tst_PutParamsEditQst (void *Test);
 
 unsigned Tst_GetNumAnswersQst (long QstCod);
-void Tst_GetAnswersQst (struct Tst_Question *Question,MYSQL_RES **mysql_res,
-                        bool Shuffle);
+void Tst_GetAnswersQst (struct Tst_Question *Question,MYSQL_RES **mysql_res);
 
 void Tst_ChangeFormatAnswersText (struct Tst_Question *Question);
 void Tst_ChangeFormatAnswersFeedback (struct Tst_Question *Question);
@@ -158,6 +159,7 @@ void Tst_QstConstructor (struct Tst_Question *Question);
 void Tst_QstDestructor (struct Tst_Question *Question);
 
 bool Tst_AllocateTextChoiceAnswer (struct Tst_Question *Question,unsigned NumOpt);
+void Tst_FreeTextChoiceAnswers (struct Tst_Question *Question);
 
 Tst_AnswerType_t Tst_GetQstAnswerTypeFromDB (long QstCod);
 bool Tst_GetQstDataFromDB (struct Tst_Question *Question);
@@ -47,10 +47,21 @@
 /**************************** Private constants ******************************/
 /*****************************************************************************/
 
+#define TsI_MAX_BYTES_XML_PREVIEW (16 * 1024)	// Only the start of the XML file is shown
+
+#define TsI_MAX_QSTS_IN_EXPORT_BLOCK 1000	// Questions exported from each block of queries
+
 /*****************************************************************************/
 /******************************* Private types *******************************/
 /*****************************************************************************/
 
+struct TsI_ExportRows
+  {
+   MYSQL_RES *mysql_res;
+   MYSQL_ROW row;	// Current row, NULL when there are no more rows
+   unsigned QstInd;	// Index of the question the current row belongs to
+  };
+
 /*****************************************************************************/
 /************** External global variables from others modules ****************/
 /*****************************************************************************/
@@ -68,13 +79,25 @@ extern struct Globals Gbl;
 static void TsI_PutParamsExportQsts (void *Test);
 static void TsI_PutCreateXMLParam (void);
 
-static void TsI_ExportQuestion (struct Tst_Question *Question,FILE *FileXML);
-
-static void TsI_GetAndWriteTagsXML (long QstCod,FILE *FileXML);
+static void TsI_CreateTmpTableQstsToExport (unsigned NumQsts,MYSQL_RES *mysql_res);
+static void TsI_ExportBlockOfQuestions (unsigned FirstQstInd,unsigned LastQstInd,
+                                        FILE *FileXML);
+static void TsI_GetNextExportRow (struct TsI_ExportRows *Rows);
+static void TsI_SkipExportRowsUntilQst (struct TsI_ExportRows *Rows,unsigned QstInd);
+static void TsI_GetAnswersToExport (struct Tst_Question *Question,unsigned QstInd,
+                                    struct TsI_ExportRows *Answers);
+static void TsI_ExportQuestion (const struct Tst_Question *Question,unsigned QstInd,
+                                struct TsI_ExportRows *Tags,FILE *FileXML);
+
+static void TsI_WriteTagsXML (unsigned QstInd,struct TsI_ExportRows *Tags,
+                              FILE *FileXML);
 static void TsI_WriteAnswersOfAQstXML (const struct Tst_Question *Question,
                                        FILE *FileXML);
 static void TsI_ReadQuestionsFromXMLFileAndStoreInDB (const char *FileNameXML);
-static void TsI_ImportQuestionsFromXMLBuffer (const char *XMLBuffer);
+static void TsI_ImportQuestionsFromXMLFile (FILE *FileXML);
+static void TsI_WriteStartOfXMLFile (FILE *FileXML);
+static void TsI_ImportQuestionFromXML (struct XMLElement *QuestionElem,
+                                       void *NumQsts);
 static Tst_AnswerType_t TsI_ConvertFromStrAnsTypXMLToAnsTyp (const char *StrAnsTypeXML);
 static void TsI_GetAnswerFromXML (struct XMLElement *AnswerElem,
                                   struct Tst_Question *Question);
@@ -188,9 +211,8 @@ void TsI_CreateXML (unsigned NumQsts,MYSQL_RES *mysql_res)
    extern const char *Txt_XML_file;
    char PathPubFile[PATH_MAX + 1];
    FILE *FileXML;
-   unsigned NumQst;
-   struct Tst_Question Question;
-   MYSQL_ROW row;
+   unsigned FirstQstInd;
+   unsigned LastQstInd;
 
    /***** Create a temporary public directory
 	  used to download the XML file *****/
@@ -208,25 +230,26 @@ void TsI_CreateXML (unsigned NumQsts,MYSQL_RES *mysql_res)
    XML_WriteStartFile (FileXML,"test",false);
    fprintf (FileXML,"%s",Txt_NEW_LINE);
 
-   /***** Write rows *****/
-   for (NumQst = 0;
-	NumQst < NumQsts;
-	NumQst++)
-     {
-      /* Create test question */
-      Tst_QstConstructor (&Question);
-
-      /* Get question code (row[0]) */
-      row = mysql_fetch_row (mysql_res);
-      if ((Question.QstCod = Str_ConvertStrCodToLongCod (row[0])) < 0)
-         Lay_ShowErrorAndExit ("Wrong code of question.");
+   /***** Store the codes of the selected questions in a temporary table *****/
+   TsI_CreateTmpTableQstsToExport (NumQsts,mysql_res);
 
-      TsI_ExportQuestion (&Question,FileXML);
-
-      /* Destroy test question */
-      Tst_QstDestructor (&Question);
+   /***** Write questions, block by block *****/
+   // Questions, tags and answers of each block are got with one query each,
+   // so the number of queries does not depend on the number of questions
+   for (FirstQstInd = 0;
+	FirstQstInd < NumQsts;
+	FirstQstInd = LastQstInd + 1)
+     {
+      LastQstInd = FirstQstInd + TsI_MAX_QSTS_IN_EXPORT_BLOCK - 1;
+      if (LastQstInd >= NumQsts)
+	 LastQstInd = NumQsts - 1;
+      TsI_ExportBlockOfQuestions (FirstQstInd,LastQstInd,FileXML);
      }
 
+   /***** Drop temporary table, no longer necessary *****/
+   DB_Query ("can not remove temporary table",
+	     "DROP TEMPORARY TABLE IF EXISTS tst_export_tmp");
+
    /***** End XML file *****/
    XML_WriteEndFile (FileXML,"test");
 
@@ -247,79 +270,311 @@ void TsI_CreateXML (unsigned NumQsts,MYSQL_RES *mysql_res)
    HTM_A_End ();
   }
 
+/*****************************************************************************/
+/*** Create temporary table with the codes of the questions to be exported ***/
+/*****************************************************************************/
+// QstInd keeps the order in which questions were selected
+
+static void TsI_CreateTmpTableQstsToExport (unsigned NumQsts,MYSQL_RES *mysql_res)
+  {
+   unsigned QstInd;
+   long QstCod;
+   MYSQL_ROW row;
+   char *Query = NULL;
+
+   /***** Create temporary table *****/
+   DB_Query ("can not remove temporary table",
+	     "DROP TEMPORARY TABLE IF EXISTS tst_export_tmp");
+   DB_Query ("can not create temporary table",
+	     "CREATE TEMPORARY TABLE tst_export_tmp"
+	     " (QstInd INT NOT NULL,"
+	       "QstCod INT NOT NULL,"
+	       "PRIMARY KEY USING BTREE (QstInd),"
+	       "INDEX(QstCod))"
+	     " ENGINE=MEMORY");
+
+   /***** Insert all the question codes with one query *****/
+   DB_BuildQuery (&Query,
+		  "INSERT INTO tst_export_tmp"
+		  " (QstInd,QstCod)"
+		  " VALUES");
+   for (QstInd = 0;
+	QstInd < NumQsts;
+	QstInd++)
+     {
+      /* Get question code (row[0]) */
+      row = mysql_fetch_row (mysql_res);
+      if ((QstCod = Str_ConvertStrCodToLongCod (row[0])) < 0)
+         Lay_ShowErrorAndExit ("Wrong code of question.");
+
+      DB_AddToQuery (&Query,"%s(%u,%ld)",
+		     QstInd ? "," :
+			      " ",
+		     QstInd,QstCod);
+     }
+   DB_QueryINSERT ("can not store questions to export","%s",Query);
+   free (Query);
+  }
+
+/*****************************************************************************/
+/************** Write a block of questions into the XML file *****************/
+/*****************************************************************************/
+// Questions, tags and answers are got ordered by question index
+// and merged while the questions are written
+
+static void TsI_ExportBlockOfQuestions (unsigned FirstQstInd,unsigned LastQstInd,
+                                        FILE *FileXML)
+  {
+   struct TsI_ExportRows Qsts;
+   struct TsI_ExportRows Tags;
+   struct TsI_ExportRows Answers;
+   struct Tst_Question Question;
+
+   /***** Get questions from database *****/
+   DB_QuerySELECT (&Qsts.mysql_res,"can not get questions",
+		   "SELECT tst_export_tmp.QstInd,"	// row[0]
+			  "tst_questions.AnsType,"	// row[1]
+			  "tst_questions.Shuffle,"	// row[2]
+			  "tst_questions.Stem,"		// row[3]
+			  "tst_questions.Feedback"	// row[4]
+		   " FROM tst_export_tmp,tst_questions"
+		   " WHERE tst_export_tmp.QstInd BETWEEN %u AND %u"
+		   " AND tst_export_tmp.QstCod=tst_questions.QstCod"
+		   " AND tst_questions.CrsCod=%ld"	// Extra check
+		   " ORDER BY tst_export_tmp.QstInd",
+		   FirstQstInd,LastQstInd,
+		   Gbl.Hierarchy.Crs.CrsCod);
+
+   /***** Get tags of the questions from database *****/
+   DB_QuerySELECT (&Tags.mysql_res,"can not get the tags of questions",
+		   "SELECT tst_export_tmp.QstInd,"	// row[0]
+			  "tst_tags.TagTxt"		// row[1]
+		   " FROM tst_export_tmp,tst_question_tags,tst_tags"
+		   " WHERE tst_export_tmp.QstInd BETWEEN %u AND %u"
+		   " AND tst_export_tmp.QstCod=tst_question_tags.QstCod"
+		   " AND tst_question_tags.TagCod=tst_tags.TagCod"
+		   " AND tst_tags.CrsCod=%ld"
+		   " ORDER BY tst_export_tmp.QstInd,"
+			     "tst_question_tags.TagInd",
+		   FirstQstInd,LastQstInd,
+		   Gbl.Hierarchy.Crs.CrsCod);
+
+   /***** Get answers of the questions from database *****/
+   DB_QuerySELECT (&Answers.mysql_res,"can not get answers of questions",
+		   "SELECT tst_export_tmp.QstInd,"	// row[0]
+			  "tst_answers.Answer,"		// row[1]
+			  "tst_answers.Feedback,"	// row[2]
+			  "tst_answers.Correct"		// row[3]
+		   " FROM tst_export_tmp,tst_answers"
+		   " WHERE tst_export_tmp.QstInd BETWEEN %u AND %u"
+		   " AND tst_export_tmp.QstCod=tst_answers.QstCod"
+		   " ORDER BY tst_export_tmp.QstInd,"
+			     "tst_answers.AnsInd",
+		   FirstQstInd,LastQstInd);
+
+   /***** Merge the three results writing the questions *****/
+   TsI_GetNextExportRow (&Tags);
+   TsI_GetNextExportRow (&Answers);
+   for (TsI_GetNextExportRow (&Qsts);
+	Qsts.row;
+	TsI_GetNextExportRow (&Qsts))
+     {
+      /* Create test question */
+      Tst_QstConstructor (&Question);
+
+      /* Get the type of answer (row[1]) */
+      Question.Answer.Type = Tst_ConvertFromStrAnsTypDBToAnsTyp (Qsts.row[1]);
+
+      /* Get shuffle (row[2]) */
+      Question.Answer.Shuffle = (Qsts.row[2][0] == 'Y');
+
+      /* Get the stem (row[3]) and the feedback (row[4]) */
+      if (Qsts.row[3])
+	 if (Qsts.row[3][0])
+	    Str_Copy (Question.Stem    ,Qsts.row[3],Cns_MAX_BYTES_TEXT);
+      if (Qsts.row[4])
+	 if (Qsts.row[4][0])
+	    Str_Copy (Question.Feedback,Qsts.row[4],Cns_MAX_BYTES_TEXT);
+
+      /* Get the answers and write the question */
+      TsI_GetAnswersToExport (&Question,Qsts.QstInd,&Answers);
+      TsI_ExportQuestion (&Question,Qsts.QstInd,&Tags,FileXML);
+
+      /* Destroy test question */
+      Tst_QstDestructor (&Question);
+     }
+
+   /***** Free structures that store the query results *****/
+   DB_FreeMySQLResult (&Answers.mysql_res);
+   DB_FreeMySQLResult (&Tags.mysql_res);
+   DB_FreeMySQLResult (&Qsts.mysql_res);
+  }
+
+/*****************************************************************************/
+/********************* Get next row of an export result **********************/
+/*****************************************************************************/
+
+static void TsI_GetNextExportRow (struct TsI_ExportRows *Rows)
+  {
+   /***** Get next row and the question index in it (row[0]) *****/
+   if ((Rows->row = mysql_fetch_row (Rows->mysql_res)))
+      if (sscanf (Rows->row[0],"%u",&Rows->QstInd) != 1)
+	 Lay_ShowErrorAndExit ("Wrong index of question.");
+  }
+
+/*****************************************************************************/
+/************ Skip rows of questions previous to a given question ************/
+/*****************************************************************************/
+
+static void TsI_SkipExportRowsUntilQst (struct TsI_ExportRows *Rows,unsigned QstInd)
+  {
+   while (Rows->row && Rows->QstInd < QstInd)
+      TsI_GetNextExportRow (Rows);
+  }
+
+/*****************************************************************************/
+/************* Get answers of a question from the export rows ****************/
+/*****************************************************************************/
+
+static void TsI_GetAnswersToExport (struct Tst_Question *Question,unsigned QstInd,
+                                    struct TsI_ExportRows *Answers)
+  {
+   unsigned NumOpt;
+
+   /***** Get the answers of this question *****/
+   /*
+   row[0] QstInd
+   row[1] Answer
+   row[2] Feedback
+   row[3] Correct
+   */
+   TsI_SkipExportRowsUntilQst (Answers,QstInd);
+   for (NumOpt = 0;
+	Answers->row && Answers->QstInd == QstInd;
+	NumOpt++, TsI_GetNextExportRow (Answers))
+      switch (Question->Answer.Type)
+	{
+	 case Tst_ANS_INT:
+	    Question->Answer.Integer = Tst_GetIntAnsFromStr (Answers->row[1]);
+	    break;
+	 case Tst_ANS_FLOAT:
+	    if (NumOpt >= 2)
+	       Lay_ShowErrorAndExit ("Wrong answer.");
+	    Question->Answer.FloatingPoint[NumOpt] = Str_GetDoubleFromStr (Answers->row[1]);
+	    break;
+	 case Tst_ANS_TRUE_FALSE:
+	    Question->Answer.TF = Answers->row[1][0];
+	    break;
+	 case Tst_ANS_UNIQUE_CHOICE:
+	 case Tst_ANS_MULTIPLE_CHOICE:
+	 case Tst_ANS_TEXT:
+	    /* Check number of options */
+	    if (NumOpt >= Tst_MAX_OPTIONS_PER_QUESTION)
+	       Lay_ShowErrorAndExit ("Wrong answer.");
+
+	    /*  Allocate space for text and feedback */
+	    if (!Tst_AllocateTextChoiceAnswer (Question,NumOpt))
+	       /* Abort on error */
+	       Ale_ShowAlertsAndExit ();
+
+	    /* Get text (row[1]) and feedback (row[2])*/
+	    if (Answers->row[1])
+	       if (Answers->row[1][0])
+		  Str_Copy (Question->Answer.Options[NumOpt].Text    ,Answers->row[1],
+			    Tst_MAX_BYTES_ANSWER_OR_FEEDBACK);
+	    if (Answers->row[2])
+	       if (Answers->row[2][0])
+		  Str_Copy (Question->Answer.Options[NumOpt].Feedback,Answers->row[2],
+			    Tst_MAX_BYTES_ANSWER_OR_FEEDBACK);
+
+	    /* Get if this option is correct (row[3]) */
+	    Question->Answer.Options[NumOpt].Correct = (Answers->row[3][0] == 'Y');
+	    break;
+	 default:
+	    break;
+	}
+   Question->Answer.NumOptions = NumOpt;
+
+   /***** Check number of answers *****/
+   if (Question->Answer.NumOptions)
+      switch (Question->Answer.Type)
+	{
+	 case Tst_ANS_INT:
+	 case Tst_ANS_TRUE_FALSE:
+	    Tst_CheckIfNumberOfAnswersIsOne (Question);
+	    break;
+	 case Tst_ANS_FLOAT:
+	    if (Question->Answer.NumOptions != 2)
+	       Lay_ShowErrorAndExit ("Wrong answer.");
+	    break;
+	 default:
+	    break;
+	}
+   else
+      Ale_ShowAlert (Ale_ERROR,"Error when getting answers of a question.");
+  }
+
 /*****************************************************************************/
 /****************** Write one question into the XML file *********************/
 /*****************************************************************************/
 
-static void TsI_ExportQuestion (struct Tst_Question *Question,FILE *FileXML)
+static void TsI_ExportQuestion (const struct Tst_Question *Question,unsigned QstInd,
+                                struct TsI_ExportRows *Tags,FILE *FileXML)
   {
    extern const char *Tst_StrAnswerTypesXML[Tst_NUM_ANS_TYPES];
    extern const char *Txt_NEW_LINE;
 
-   if (Tst_GetQstDataFromDB (Question))
-     {
-      /***** Write the answer type *****/
-      fprintf (FileXML,"<question type=\"%s\">%s",
-               Tst_StrAnswerTypesXML[Question->Answer.Type],Txt_NEW_LINE);
-
-      /***** Write the question tags *****/
-      fprintf (FileXML,"<tags>%s",Txt_NEW_LINE);
-      TsI_GetAndWriteTagsXML (Question->QstCod,FileXML);
-      fprintf (FileXML,"</tags>%s",Txt_NEW_LINE);
-
-      /***** Write the stem, that is in HTML format *****/
-      fprintf (FileXML,"<stem>%s</stem>%s",
-               Question->Stem,Txt_NEW_LINE);
-
-      /***** Write the feedback, that is in HTML format *****/
-      if (Question->Feedback[0])
-	 fprintf (FileXML,"<feedback>%s</feedback>%s",
-		  Question->Feedback,Txt_NEW_LINE);
-
-      /***** Write the answers of this question.
-             Shuffle can be enabled or disabled *****/
-      fprintf (FileXML,"<answer");
-      if (Question->Answer.Type == Tst_ANS_UNIQUE_CHOICE ||
-          Question->Answer.Type == Tst_ANS_MULTIPLE_CHOICE)
-         fprintf (FileXML," shuffle=\"%s\"",
-                  Question->Answer.Shuffle ? "yes" :
-                	                     "no");
-      fprintf (FileXML,">");
-      TsI_WriteAnswersOfAQstXML (Question,FileXML);
-      fprintf (FileXML,"</answer>%s",Txt_NEW_LINE);
-
-      /***** End question *****/
-      fprintf (FileXML,"</question>%s%s",
-               Txt_NEW_LINE,Txt_NEW_LINE);
-     }
+   /***** Write the answer type *****/
+   fprintf (FileXML,"<question type=\"%s\">%s",
+	    Tst_StrAnswerTypesXML[Question->Answer.Type],Txt_NEW_LINE);
+
+   /***** Write the question tags *****/
+   fprintf (FileXML,"<tags>%s",Txt_NEW_LINE);
+   TsI_WriteTagsXML (QstInd,Tags,FileXML);
+   fprintf (FileXML,"</tags>%s",Txt_NEW_LINE);
+
+   /***** Write the stem, that is in HTML format *****/
+   fprintf (FileXML,"<stem>%s</stem>%s",
+	    Question->Stem,Txt_NEW_LINE);
+
+   /***** Write the feedback, that is in HTML format *****/
+   if (Question->Feedback[0])
+      fprintf (FileXML,"<feedback>%s</feedback>%s",
+	       Question->Feedback,Txt_NEW_LINE);
+
+   /***** Write the answers of this question.
+	  Shuffle can be enabled or disabled *****/
+   fprintf (FileXML,"<answer");
+   if (Question->Answer.Type == Tst_ANS_UNIQUE_CHOICE ||
+       Question->Answer.Type == Tst_ANS_MULTIPLE_CHOICE)
+      fprintf (FileXML," shuffle=\"%s\"",
+	       Question->Answer.Shuffle ? "yes" :
+					  "no");
+   fprintf (FileXML,">");
+   TsI_WriteAnswersOfAQstXML (Question,FileXML);
+   fprintf (FileXML,"</answer>%s",Txt_NEW_LINE);
+
+   /***** End question *****/
+   fprintf (FileXML,"</question>%s%s",
+	    Txt_NEW_LINE,Txt_NEW_LINE);
   }
 
 /*****************************************************************************/
-/************* Get and write tags of a question into the XML file ************/
+/*************** Write tags of a question into the XML file ******************/
 /*****************************************************************************/
 
-static void TsI_GetAndWriteTagsXML (long QstCod,FILE *FileXML)
+static void TsI_WriteTagsXML (unsigned QstInd,struct TsI_ExportRows *Tags,
+                              FILE *FileXML)
   {
    extern const char *Txt_NEW_LINE;
-   unsigned long NumRow;
-   unsigned long NumRows;
-   MYSQL_RES *mysql_res;
-   MYSQL_ROW row;
 
-   if ((NumRows = Tst_GetTagsQst (QstCod,&mysql_res)))	// Result: TagTxt
-      /***** Write the tags *****/
-      for (NumRow = 1;
-	   NumRow <= NumRows;
-	   NumRow++)
-        {
-         row = mysql_fetch_row (mysql_res);
-         fprintf (FileXML,"<tag>%s</tag>%s",
-                  row[0],Txt_NEW_LINE);
-        }
-
-   /***** Free structure that stores the query result *****/
-   DB_FreeMySQLResult (&mysql_res);
- }
+   /***** Write the tags of this question (row[1]) *****/
+   for (TsI_SkipExportRowsUntilQst (Tags,QstInd);
+	Tags->row && Tags->QstInd == QstInd;
+	TsI_GetNextExportRow (Tags))
+      fprintf (FileXML,"<tag>%s</tag>%s",
+	       Tags->row[1],Txt_NEW_LINE);
+  }
 
 /*****************************************************************************/
 /**************** Get and write the answers of a test question ***************/
@@ -440,234 +695,250 @@ void TsI_ImportQstsFromXML (void)
 static void TsI_ReadQuestionsFromXMLFileAndStoreInDB (const char *FileNameXML)
   {
    FILE *FileXML;
-   char *XMLBuffer;
-   unsigned long FileSize;
 
    /***** Open file *****/
    if ((FileXML = fopen (FileNameXML,"rb")) == NULL)
       Lay_ShowErrorAndExit ("Can not open XML file.");
 
-   /***** Compute file size *****/
-   fseek (FileXML,0L,SEEK_END);
-   FileSize = (unsigned long) ftell (FileXML);
-   fseek (FileXML,0L,SEEK_SET);
-
-   /***** Allocate memory for XML buffer *****/
-   if ((XMLBuffer = malloc (FileSize + 1)) == NULL)
-      Lay_NotEnoughMemoryExit ();
-   else
-     {
-      /***** Read file contents into XML buffer *****/
-      if (fread (XMLBuffer,sizeof (char),(size_t) FileSize,FileXML))
-         XMLBuffer[FileSize] = '\0';
-      else
-         XMLBuffer[0] = '\0';
-
-      /***** Import questions from XML buffer *****/
-      TsI_ImportQuestionsFromXMLBuffer (XMLBuffer);
-
-      free (XMLBuffer);
-     }
+   /***** Import questions from XML file *****/
+   TsI_ImportQuestionsFromXMLFile (FileXML);
 
    /***** Close file *****/
    fclose (FileXML);
   }
 
 /*****************************************************************************/
-/******************** Import questions from XML buffer ***********************/
+/********************* Import questions from XML file ************************/
 /*****************************************************************************/
+// The file is read question by question, so memory used
+// does not depend on the number of questions
 
-static void TsI_ImportQuestionsFromXMLBuffer (const char *XMLBuffer)
+static void TsI_ImportQuestionsFromXMLFile (FILE *FileXML)
   {
    extern const char *Hlp_ASSESSMENT_Tests;
    extern const char *Txt_XML_file_content;
    extern const char *Txt_Imported_questions;
-   struct XMLElement *RootElem;
-   struct XMLElement *TestElem = NULL;
-   struct XMLElement *QuestionElem;
-   struct XMLElement *TagsElem;
-   struct XMLElement *TagElem;
-   struct XMLElement *StemElem;
-   struct XMLElement *FeedbackElem;
-   struct XMLElement *AnswerElem;
-   struct XMLAttribute *Attribute;
-   struct Tst_Question Question;
-   bool QuestionExists;
-   bool AnswerTypeFound;
-
-   /***** Allocate and get XML tree *****/
-   XML_GetTree (XMLBuffer,&RootElem);
+   unsigned NumQsts = 0;
+   bool TestElemFound;
 
    /***** Begin box *****/
    Box_BoxBegin (NULL,Txt_Imported_questions,
                  NULL,NULL,
                  Hlp_ASSESSMENT_Tests,Box_NOT_CLOSABLE);
 
-   /***** Print XML tree *****/
+   /***** Print start of XML file *****/
    HTM_DIV_Begin ("class=\"TEST_FILE_CONTENT\"");
    HTM_TEXTAREA_Begin ("title=\"%s\" cols=\"60\" rows=\"5\""
 	               " spellcheck=\"false\" readonly",
 	               Txt_XML_file_content);
-   XML_PrintTree (RootElem);
+   TsI_WriteStartOfXMLFile (FileXML);
    HTM_TEXTAREA_End ();
    HTM_DIV_End ();
 
-   /***** Get questions from XML tree and print them *****/
-   /* Go to <test> element */
-   if (RootElem->FirstChild)
-     {
-      TestElem = RootElem->FirstChild;
-      if (strcmp (TestElem->TagName,"test"))	// <test> must be at level 1
-         TestElem = NULL;
-     }
-   if (TestElem)
-     {
-      /* Current element is <test> */
+   /***** Get questions from XML file, store them in database and print them *****/
+   /* All the questions are inserted in one transaction */
+   rewind (FileXML);
+   DB_Query ("can not start transaction to import questions",
+	     "START TRANSACTION");
+   TestElemFound = XML_GetElementsFromStream (FileXML,
+					      "test",		// <test> must be at level 1
+					      "question",	// Questions at level 2
+					      TsI_ImportQuestionFromXML,&NumQsts);
+   DB_Query ("can not commit transaction to import questions",
+	     "COMMIT");
+
+   if (NumQsts)
+      HTM_TABLE_End ();
+   if (!TestElemFound)
+      Ale_ShowAlert (Ale_ERROR,"Root element &lt;test&gt; not found.");
+
+   /***** End box *****/
+   Box_BoxEnd ();
+  }
+
+/*****************************************************************************/
+/******************** Write the start of the XML file ************************/
+/*****************************************************************************/
+
+static void TsI_WriteStartOfXMLFile (FILE *FileXML)
+  {
+   char *Preview;
+   size_t NumBytes;
+   size_t i;
+
+   if ((Preview = malloc (TsI_MAX_BYTES_XML_PREVIEW)) == NULL)
+      Lay_NotEnoughMemoryExit ();
+
+   NumBytes = fread (Preview,sizeof (char),TsI_MAX_BYTES_XML_PREVIEW,FileXML);
+   for (i = 0;
+	i < NumBytes;
+	i++)
+      switch (Preview[i])
+	{
+	 case '<':
+	    HTM_Txt ("&lt;");
+	    break;
+	 case '>':
+	    HTM_Txt ("&gt;");
+	    break;
+	 case '&':
+	    HTM_Txt ("&amp;");
+	    break;
+	 default:
+	    HTM_TxtF ("%c",Preview[i]);
+	    break;
+	}
+   if (NumBytes == TsI_MAX_BYTES_XML_PREVIEW)
+      HTM_Txt ("\n...");
+
+   free (Preview);
+  }
+
+/*****************************************************************************/
+/************** Import one question got from the XML file ********************/
+/*****************************************************************************/
+
+static void TsI_ImportQuestionFromXML (struct XMLElement *QuestionElem,
+                                       void *NumQsts)
+  {
+   struct XMLElement *TagsElem;
+   struct XMLElement *TagElem;
+   struct XMLElement *StemElem;
+   struct XMLElement *FeedbackElem;
+   struct XMLElement *AnswerElem;
+   struct XMLAttribute *Attribute;
+   struct Tst_Question Question;
+   bool QuestionExists;
+   bool AnswerTypeFound;
 
-      /***** Write heading of list of imported questions *****/
+   /***** Write heading of list of imported questions before first question *****/
+   if (*((unsigned *) NumQsts) == 0)
+     {
       HTM_TABLE_BeginWideMarginPadding (5);
       TsI_WriteHeadingListImportedQst ();
+     }
+   (*((unsigned *) NumQsts))++;
 
-      /***** For each question... *****/
-      for (QuestionElem = TestElem->FirstChild;
-	   QuestionElem != NULL;
-	   QuestionElem = QuestionElem->NextBrother)
+   /***** Create test question *****/
+   Tst_QstConstructor (&Question);
+
+   /* Get answer type (in mandatory attribute "type") */
+   AnswerTypeFound = false;
+   for (Attribute = QuestionElem->FirstAttribute;
+	Attribute != NULL;
+	Attribute = Attribute->Next)
+      if (!strcmp (Attribute->AttributeName,"type"))
 	{
-	 if (!strcmp (QuestionElem->TagName,"question"))
+	 Question.Answer.Type = TsI_ConvertFromStrAnsTypXMLToAnsTyp (Attribute->Content);
+	 AnswerTypeFound = true;
+	 break;	// Only first attribute "type"
+	}
+
+   if (AnswerTypeFound)
+     {
+      /* Get tags */
+      for (TagsElem = QuestionElem->FirstChild, Question.Tags.Num = 0;
+	   TagsElem != NULL;
+	   TagsElem = TagsElem->NextBrother)
+	 if (!strcmp (TagsElem->TagName,"tags"))
 	   {
-	    /***** Create test question *****/
-	    Tst_QstConstructor (&Question);
-
-	    /* Get answer type (in mandatory attribute "type") */
-	    AnswerTypeFound = false;
-	    for (Attribute = QuestionElem->FirstAttribute;
-		 Attribute != NULL;
-		 Attribute = Attribute->Next)
-	       if (!strcmp (Attribute->AttributeName,"type"))
+	    for (TagElem = TagsElem->FirstChild;
+		 TagElem != NULL && Question.Tags.Num < Tag_MAX_TAGS_PER_QUESTION;
+		 TagElem = TagElem->NextBrother)
+	       if (!strcmp (TagElem->TagName,"tag"))
 		 {
-		  Question.Answer.Type = TsI_ConvertFromStrAnsTypXMLToAnsTyp (Attribute->Content);
-		  AnswerTypeFound = true;
-		  break;	// Only first attribute "type"
-		 }
-
-	    if (AnswerTypeFound)
-	      {
-	       /* Get tags */
-	       for (TagsElem = QuestionElem->FirstChild, Question.Tags.Num = 0;
-		    TagsElem != NULL;
-		    TagsElem = TagsElem->NextBrother)
-		  if (!strcmp (TagsElem->TagName,"tags"))
+		  if (TagElem->Content)
 		    {
-		     for (TagElem = TagsElem->FirstChild;
-			  TagElem != NULL && Question.Tags.Num < Tag_MAX_TAGS_PER_QUESTION;
-			  TagElem = TagElem->NextBrother)
-			if (!strcmp (TagElem->TagName,"tag"))
-			  {
-			   if (TagElem->Content)
-			     {
-			      Str_Copy (Question.Tags.Txt[Question.Tags.Num],
-					TagElem->Content,
-					sizeof (Question.Tags.Txt[Question.Tags.Num]) - 1);
-			      Question.Tags.Num++;
-			     }
-			  }
-		     break;	// Only first element "tags"
+		     Str_Copy (Question.Tags.Txt[Question.Tags.Num],
+			       TagElem->Content,
+			       sizeof (Question.Tags.Txt[Question.Tags.Num]) - 1);
+		     Question.Tags.Num++;
 		    }
+		 }
+	    break;	// Only first element "tags"
+	   }
 
-	       /* Get stem (mandatory) */
-	       for (StemElem = QuestionElem->FirstChild;
-		    StemElem != NULL;
-		    StemElem = StemElem->NextBrother)
-		  if (!strcmp (StemElem->TagName,"stem"))
-		    {
-		     if (StemElem->Content)
-		       {
-			/* Convert stem from text to HTML (in database stem is stored in HTML) */
-			Str_Copy (Question.Stem,StemElem->Content,Cns_MAX_BYTES_TEXT);
-			Str_ChangeFormat (Str_FROM_TEXT,Str_TO_HTML,
-					  Question.Stem,Cns_MAX_BYTES_TEXT,true);
-		       }
-		     break;	// Only first element "stem"
-		    }
+      /* Get stem (mandatory) */
+      for (StemElem = QuestionElem->FirstChild;
+	   StemElem != NULL;
+	   StemElem = StemElem->NextBrother)
+	 if (!strcmp (StemElem->TagName,"stem"))
+	   {
+	    if (StemElem->Content)
+	      {
+	       /* Convert stem from text to HTML (in database stem is stored in HTML) */
+	       Str_Copy (Question.Stem,StemElem->Content,Cns_MAX_BYTES_TEXT);
+	       Str_ChangeFormat (Str_FROM_TEXT,Str_TO_HTML,
+				 Question.Stem,Cns_MAX_BYTES_TEXT,true);
+	      }
+	    break;	// Only first element "stem"
+	   }
 
-	       /* Get feedback (optional) */
-	       for (FeedbackElem = QuestionElem->FirstChild;
-		    FeedbackElem != NULL;
-		    FeedbackElem = FeedbackElem->NextBrother)
-		  if (!strcmp (FeedbackElem->TagName,"feedback"))
-		    {
-		     if (FeedbackElem->Content)
-		       {
-			/* Convert feedback from text to HTML (in database feedback is stored in HTML) */
-			Str_Copy (Question.Feedback,FeedbackElem->Content,Cns_MAX_BYTES_TEXT);
-			Str_ChangeFormat (Str_FROM_TEXT,Str_TO_HTML,
-					  Question.Feedback,Cns_MAX_BYTES_TEXT,true);
-		       }
-		     break;	// Only first element "feedback"
-		    }
+      /* Get feedback (optional) */
+      for (FeedbackElem = QuestionElem->FirstChild;
+	   FeedbackElem != NULL;
+	   FeedbackElem = FeedbackElem->NextBrother)
+	 if (!strcmp (FeedbackElem->TagName,"feedback"))
+	   {
+	    if (FeedbackElem->Content)
+	      {
+	       /* Convert feedback from text to HTML (in database feedback is stored in HTML) */
+	       Str_Copy (Question.Feedback,FeedbackElem->Content,Cns_MAX_BYTES_TEXT);
+	       Str_ChangeFormat (Str_FROM_TEXT,Str_TO_HTML,
+				 Question.Feedback,Cns_MAX_BYTES_TEXT,true);
+	      }
+	    break;	// Only first element "feedback"
+	   }
 
-	       /* Get shuffle. By default, shuffle is false. */
-	       Question.Answer.Shuffle = false;
-	       for (AnswerElem = QuestionElem->FirstChild;
-		    AnswerElem != NULL;
-		    AnswerElem = AnswerElem->NextBrother)
-		  if (!strcmp (AnswerElem->TagName,"answer"))
+      /* Get shuffle. By default, shuffle is false. */
+      Question.Answer.Shuffle = false;
+      for (AnswerElem = QuestionElem->FirstChild;
+	   AnswerElem != NULL;
+	   AnswerElem = AnswerElem->NextBrother)
+	 if (!strcmp (AnswerElem->TagName,"answer"))
+	   {
+	    if (Question.Answer.Type == Tst_ANS_UNIQUE_CHOICE ||
+		Question.Answer.Type == Tst_ANS_MULTIPLE_CHOICE)
+	       /* Get whether shuffle answers (in attribute "shuffle") */
+	       for (Attribute = AnswerElem->FirstAttribute;
+		    Attribute != NULL;
+		    Attribute = Attribute->Next)
+		  if (!strcmp (Attribute->AttributeName,"shuffle"))
 		    {
-		     if (Question.Answer.Type == Tst_ANS_UNIQUE_CHOICE ||
-			 Question.Answer.Type == Tst_ANS_MULTIPLE_CHOICE)
-			/* Get whether shuffle answers (in attribute "shuffle") */
-			for (Attribute = AnswerElem->FirstAttribute;
-			     Attribute != NULL;
-			     Attribute = Attribute->Next)
-			   if (!strcmp (Attribute->AttributeName,"shuffle"))
-			     {
-			      Question.Answer.Shuffle = XML_GetAttributteYesNoFromXMLTree (Attribute);
-			      break;	// Only first attribute "shuffle"
-			     }
-		     break;	// Only first element "answer"
+		     Question.Answer.Shuffle = XML_GetAttributteYesNoFromXMLTree (Attribute);
+		     break;	// Only first attribute "shuffle"
 		    }
+	    break;	// Only first element "answer"
+	   }
 
-	       /* Get answer (mandatory) */
-	       TsI_GetAnswerFromXML (AnswerElem,&Question);
-
-	       /* Make sure that tags, text and answer are not empty */
-	       if (Tst_CheckIfQstFormatIsCorrectAndCountNumOptions (&Question))
-		 {
-		  /* Check if question already exists in database */
-		  QuestionExists = Tst_CheckIfQuestionExistsInDB (&Question);
+      /* Get answer (mandatory) */
+      TsI_GetAnswerFromXML (AnswerElem,&Question);
 
-		  /* Write row with this imported question */
-		  TsI_WriteRowImportedQst (StemElem,FeedbackElem,
-		                           &Question,QuestionExists);
+      /* Make sure that tags, text and answer are not empty */
+      if (Tst_CheckIfQstFormatIsCorrectAndCountNumOptions (&Question))
+	{
+	 /* Check if question already exists in database */
+	 QuestionExists = Tst_CheckIfQuestionExistsInDB (&Question);
 
-		  /***** If a new question ==> insert question, tags and answer in the database *****/
-		  if (!QuestionExists)
-		    {
-		     Question.QstCod = -1L;
-		     Tst_InsertOrUpdateQstTagsAnsIntoDB (&Question);
-		     if (Question.QstCod <= 0)
-			Lay_ShowErrorAndExit ("Can not create question.");
-		    }
-		 }
-	      }
-	    else	// Answer type not found
-	       Lay_ShowErrorAndExit ("Wrong type of answer.");
+	 /* Write row with this imported question */
+	 TsI_WriteRowImportedQst (StemElem,FeedbackElem,
+				  &Question,QuestionExists);
 
-	    /***** Destroy test question *****/
-	    Tst_QstDestructor (&Question);
+	 /***** If a new question ==> insert question, tags and answer in the database *****/
+	 if (!QuestionExists)
+	   {
+	    Question.QstCod = -1L;
+	    Tst_InsertOrUpdateQstTagsAnsIntoDB (&Question);
+	    if (Question.QstCod <= 0)
+	       Lay_ShowErrorAndExit ("Can not create question.");
 	   }
 	}
-
-      HTM_TABLE_End ();
      }
-   else	// TestElem not found
-      Ale_ShowAlert (Ale_ERROR,"Root element &lt;test&gt; not found.");
-
-   /***** End table *****/
-   Box_BoxEnd ();
+   else	// Answer type not found
+      Lay_ShowErrorAndExit ("Wrong type of answer.");
 
-   /***** Free XML tree *****/
-   XML_FreeTree (RootElem);
+   /***** Destroy test question *****/
+   Tst_QstDestructor (&Question);
   }
 
 /*****************************************************************************/
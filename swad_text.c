@@ -104,7 +104,9 @@
 #define L 3	// English
 #endif
 
-const unsigned Txt_Current_CGI_SWAD_Language = ((unsigned) L);
+// Language of the texts built in the program.
+// Changed at startup if the texts of other language are loaded from a catalog
+unsigned Txt_Current_CGI_SWAD_Language = ((unsigned) L);
 
 const char *Txt_NEW_LINE = "\r\n";	// End of line in a file. If we put only \n the file does not look good in some Windows text editors
 
@@ -12433,6 +12435,27 @@ const char *Txt_Extended_public_profile =
 	"Perfil p&uacute;blico estendido";
 #endif
 
+const char *Txt_X_exam_prints_with_Y_questions_have_been_regraded_in_Z_seconds =	// Warning: it is very important to include %u, %u and %.3lf in the following sentences
+#if   L==1	// ca
+	"%u exam prints with %u questions have been regraded in %.3lf s.";		// Necessita traduccio
+#elif L==2	// de
+	"%u exam prints with %u questions have been regraded in %.3lf s.";		// Need bersetzung
+#elif L==3	// en
+	"%u exam prints with %u questions have been regraded in %.3lf s.";
+#elif L==4	// es
+	"Se han recalificado %u ex&aacute;menes con %u preguntas en %.3lf s.";
+#elif L==5	// fr
+	"%u exam prints with %u questions have been regraded in %.3lf s.";		// Besoin de traduction
+#elif L==6	// gn
+	"Se han recalificado %u ex&aacute;menes con %u preguntas en %.3lf s.";	// Okoteve traduccin
+#elif L==7	// it
+	"%u exam prints with %u questions have been regraded in %.3lf s.";		// Bisogno di traduzione
+#elif L==8	// pl
+	"%u exam prints with %u questions have been regraded in %.3lf s.";		// Potrzebujesz tlumaczenie
+#elif L==9	// pt
+	"%u exam prints with %u questions have been regraded in %.3lf s.";		// Precisa de traduo
+#endif
+
 const char *Txt_X_faces_have_been_detected_in_front_position_1_Z_ =	// Warning: it is very important to include two %u in the following sentences
 #if   L==1	// ca
 	"Se han detectado %u rostros en posici&oacute;n frontal:<br />"
@@ -16756,6 +16779,27 @@ const char *Txt_Indicators_of_courses =
 	"Indicadores de disciplinas";
 #endif
 
+const char *Txt_Indicators_of_X_of_Y_courses_were_outdated_and_have_been_updated =	// Warning: it is very important to include two %u in the following sentences
+#if   L==1	// ca
+	"Els indicadors de %u de %u assignatures estaven desactualitzats i s'han actualitzat.";
+#elif L==2	// de
+	"Indicators of %u of %u courses were outdated and have been updated.";	// Need bersetzung
+#elif L==3	// en
+	"Indicators of %u of %u courses were outdated and have been updated.";
+#elif L==4	// es
+	"Los indicadores de %u de %u asignaturas estaban desactualizados y se han actualizado.";
+#elif L==5	// fr
+	"Indicators of %u of %u courses were outdated and have been updated.";	// Besoin de traduction
+#elif L==6	// gn
+	"Los indicadores de %u de %u asignaturas estaban desactualizados y se han actualizado.";	// Okoteve traduccin
+#elif L==7	// it
+	"Indicators of %u of %u courses were outdated and have been updated.";	// Bisogno di traduzione
+#elif L==8	// pl
+	"Indicators of %u of %u courses were outdated and have been updated.";	// Potrzebujesz tlumaczenie
+#elif L==9	// pt
+	"Indicators of %u of %u courses were outdated and have been updated.";	// Precisa de traduo
+#endif
+
 const char *Txt_Info =
 #if   L==1	// ca
 	"Info";
@@ -33601,6 +33645,27 @@ const char *Txt_Recipients =
 	"Destinat&aacute;rios";
 #endif
 
+const char *Txt_Regrade =
+#if   L==1	// ca
+	"Regrade";		// Necessita traduccio
+#elif L==2	// de
+	"Regrade";		// Need bersetzung
+#elif L==3	// en
+	"Regrade";
+#elif L==4	// es
+	"Recalificar";
+#elif L==5	// fr
+	"Regrade";		// Besoin de traduction
+#elif L==6	// gn
+	"Recalificar";		// Okoteve traduccin
+#elif L==7	// it
+	"Regrade";		// Bisogno di traduzione
+#elif L==8	// pl
+	"Regrade";		// Potrzebujesz tlumaczenie
+#elif L==9	// pt
+	"Regrade";		// Precisa de traduo
+#endif
+
 const char *Txt_Register =
 #if   L==1	// ca
 	"Inscriure";
@@ -10896,6 +10896,27 @@ const char *Txt_Actions[Act_NUM_ACTIONS] =
 	""			// Potrzebujesz tlumaczenie
 #elif L==9	// pt
 	""			// Precisa de traduo
+#endif
+	,
+	[ActRegExaSes] =
+#if   L==1	// ca
+	""			// Necessita traducci
+#elif L==2	// de
+	""			// Need bersetzung
+#elif L==3	// en
+	"Regrade exam session"
+#elif L==4	// es
+	"Recalificar sesi&oacute;n de examen"
+#elif L==5	// fr
+	""			// Besoin de traduction
+#elif L==6	// gn
+	""			// Okoteve traduccin
+#elif L==7	// it
+	""			// Bisogno di traduzione
+#elif L==8	// pl
+	""			// Potrzebujesz tlumaczenie
+#elif L==9	// pt
+	""			// Precisa de traduo
 #endif
 	,
 	[ActSeeExaPrn] =
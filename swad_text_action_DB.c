@@ -0,0 +1,1886 @@
+// swad_text_action_DB.c: texts of actions formerly got from database
+
+/*
+    SWAD (Shared Workspace At a Distance),
+    is a web platform developed at the University of Granada (Spain),
+    and used to support university teaching.
+
+    This file is part of SWAD core.
+    Copyright (C) 1999-2021 Antonio Caas Vargas
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as
+    published by the Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.
+
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/*****************************************************************************/
+/*********************************** Headers *********************************/
+/*****************************************************************************/
+
+#include <stddef.h>		// For NULL
+
+#include "swad_action.h"
+
+/*****************************************************************************/
+/******************************* Public constants ****************************/
+/*****************************************************************************/
+
+// Generated by py/swad_action_texts.py from sql/cambios.sql. Do not edit.
+// Texts in Spanish of actions (in English if not found), indexed by action code,
+// used when an action has no text in Txt_Actions
+
+const char *Txt_Actions_DB[1 + Act_MAX_ACTION_COD] =
+	{
+	[   0] = "Ver documentos",
+	[   1] = "Descargar archivo",
+	[   2] = "Ver men�",
+	[   3] = "Ver mensajes recibidos",
+	[   4] = "Ver registro accesos",
+	[   5] = "Ver descripci�n",
+	[   6] = "Autenticar usuario",
+	[   7] = "Ver foro",
+	[   8] = "Ver mensajes tema foro",
+	[   9] = "Ver enlaces",
+	[  10] = "Cerrar sesi�n",
+	[  11] = "Ver orla alumnos",
+	[  12] = "Administrar documentos asignatura",
+	[  13] = "Solicitar nueva descarga",
+	[  14] = "Enviar archivo descarga",
+	[  15] = "Ver evaluaci�n",
+	[  16] = "Ver calendario",
+	[  17] = "Ver calificaciones",
+	[  18] = "Solicitar consulta accesos",
+	[  19] = "Solicitar estad�sticas acceso",
+	[  20] = "Ver pr�cticas",
+	[  21] = "Ver tutor�as",
+	[  22] = "Ver fichas profesores",
+	[  23] = "Ver malet�n",
+	[  24] = "Eliminar descarga",
+	[  25] = "Ver horario",
+	[  26] = "Solicitar mensaje nuevo",
+	[  27] = "Enviar mensaje",
+	[  28] = "Ver teor�a",
+	[  29] = "Ver test",
+	[  30] = "Solicitar env�o foto",
+	[  31] = "Cambiar foto",
+	[  32] = "Ver bibliograf�a",
+	[  33] = "Crear carpeta descarga",
+	[  34] = "Solicitar cambio contrase�a",
+	[  35] = "Cambiar contrase�a",
+	[  36] = "Solicitar la creaci&oacute;n de una cuenta (1/2)",
+	[  37] = "Cambiar apodo",
+	[  38] = "Solicitar cambio ficha",
+	[  39] = "Cambiar ficha",
+	[  40] = "Solicitar alta usuario",
+	[  41] = "Dar alta usuario",
+	[  42] = "Ver lista alumnos",
+	[  43] = "Renombrar carpeta descarga",
+	[  44] = "Editar teor�a",
+	[  45] = "Editar horario asignatura",
+	[  46] = "Editar descripci�n",
+	[  47] = "Ver HTML acceso directo",
+	[  48] = "Cambiar horario tutor�as",
+	[  49] = "Eliminar item",
+	[  50] = "Enviar respuesta foro",
+	[  51] = "Ver salas chat y pizarra",
+	[  52] = "Abrir chat y pizarra",
+	[  53] = "Cambiar horario asignatura",
+	[  54] = "Ver FAQ",
+	[  55] = "Eliminar mensaje foro",
+	[  56] = "Solicitar cambio otra contrase�a",
+	[  57] = "Solicitar baja usuario",
+	[  58] = "Dar baja usuario",
+	[  59] = "Solicitar aviso nuevo",
+	[  60] = "Crear aviso nuevo",
+	[  61] = "Solicitar baja total usuario",
+	[  62] = "Dar baja total usuario",
+	[  63] = "Ver estad�sticas acceso",
+	[  64] = "Eliminar mensaje recibido",
+	[  65] = "Editar horario tutor�as",
+	[  66] = "Solicitar env�o calificaciones",
+	[  67] = "Enviar p�gina",
+	[  68] = "Editar item",
+	[  69] = "Editar evaluaci�n",
+	[  70] = "Ver mensajes enviados",
+	[  71] = "Imprimir calendario",
+	[  72] = "Solicitar eliminaci�n avisos",
+	[  73] = "Eliminar aviso",
+	[  74] = "Editar pr�cticas",
+	[  75] = "Insertar item",
+	[  76] = "Editar bibliograf�a",
+	[  77] = "Dar alta usuarios (formulario)",
+	[  78] = "Solicitar alta usuarios",
+	[  79] = "Ver accesos SWAD",
+	[  80] = "Aumentar nivel item",
+	[  81] = "Disminuir nivel item",
+	[  82] = "Cambiar otra contrase�a",
+	[  83] = "Ver lista resumida alumnos",
+	[  84] = "Ver uso de SWAD",
+	[  85] = "Ver convocatorias",
+	[  86] = "Enviar descripci�n",
+	[  87] = "Dar baja todos alumnos",
+	[  88] = "Solicitar baja todos alumnos",
+	[  89] = "Ver fichas alumnos",
+	[  90] = "Eliminar mensaje enviado",
+	[  91] = "Editar convocatoria",
+	[  92] = "Solicitar edici�n convocatorias",
+	[  93] = "Ver foro profesores",
+	[  94] = "Ver mensajes tema foro prof.",
+	[  95] = "Ver foros",
+	[  96] = "Editar enlaces",
+	[  97] = "Enviar enlace",
+	[  98] = "Evaluar test",
+	[  99] = "Enviar calificaciones",
+	[ 100] = "Solicitar env�o correo",
+	[ 101] = "Solicitar eliminaci�n registro",
+	[ 102] = "Eliminar registro accesos",
+	[ 103] = "Solicitar test",
+	[ 104] = "Solicitar edici�n de tests",
+	[ 105] = "Escribir pregunta test",
+	[ 106] = "Cambiar m�x. alumnos en grupo",
+	[ 107] = "Solicitar eliminaci�n grupo",
+	[ 108] = "Solicitar edici�n de grupos",
+	[ 109] = "Editar FAQ",
+	[ 110] = "Enviar convocatoria",
+	[ 111] = "Imprimir fichas alumnos",
+	[ 112] = "Solicitar consulta accesos asig.",
+	[ 113] = "Solicitar consulta accesos SWAD",
+	[ 114] = "Enviar tema foro",
+	[ 115] = "Cambiar usuarios a MySQL",
+	[ 116] = "Solicitar uni�n a grupos",
+	[ 117] = "Pasar apodos a BD",
+	[ 118] = "Cambiar de grupos",
+	[ 119] = "Ver accesos asignatura",
+	[ 120] = "Imprimir orla alumnos",
+	[ 121] = "Renombrar grupo",
+	[ 122] = "Crear grupo",
+	[ 123] = "Subir posici�n item",
+	[ 124] = "Bajar posici�n item",
+	[ 125] = "Editar test",
+	[ 126] = "Enviar pregunta test",
+	[ 127] = "Imprimir fichas profesores",
+	[ 128] = "Ver mensajes tema foro asig.",
+	[ 129] = "Ver foro asignatura",
+	[ 130] = "Editar trabajos",
+	[ 131] = "Editar pregunta test",
+	[ 132] = "Editar preguntas test",
+	[ 133] = "Eliminar pregunta test",
+	[ 134] = "Solicitar preguntas test",
+	[ 135] = "Enviar respuesta foro usrs.",
+	[ 136] = "Eliminar mensaje foro usrs.",
+	[ 137] = "Ver mensajes tema foro usrs.",
+	[ 138] = "Ver foro usuarios",
+	[ 139] = "Editar trabajos de asignatura",
+	[ 140] = "Importar tests",
+	[ 141] = "Solicitar cambio descriptor test",
+	[ 142] = "Cambiar descriptor test",
+	[ 143] = "Renombrar descriptor test",
+	[ 144] = "Enviar respuesta foro asig.",
+	[ 145] = "Eliminar carpeta descarga",
+	[ 146] = "Dar alta usuarios (archivo)",
+	[ 147] = "Exportar fichas a base de datos",
+	[ 148] = "Subir archivo mis trabajos (ant.)",
+	[ 149] = "Solicitar nuevo arch/carp desc.",
+	[ 150] = "Solic. nuevo arch/carp mis trab.",
+	[ 151] = "Editar trabajos de alumno",
+	[ 152] = "Imprimir horario",
+	[ 153] = "Subir archivo a malet&iacute;n (ant.)",
+	[ 154] = "Solicitar nuevo arch/carp malet.",
+	[ 155] = "Eliminar archivo malet�n",
+	[ 156] = "Eliminar mensaje foro prof.",
+	[ 157] = "Eliminar mensaje foro asig.",
+	[ 158] = "Enviar tema foro prof.",
+	[ 159] = "Enviar tema foro asig.",
+	[ 160] = "Enviar respuesta foro prof.",
+	[ 161] = "Confirmar alta usuario",
+	[ 162] = "Solicitar DNI cambio contrase�a",
+	[ 163] = "Solicitar creaci�n grupo",
+	[ 164] = "Enviar p�gina de enlaces",
+	[ 165] = "Solicitar edici�n grupos",
+	[ 166] = "Borrar grupo",
+	[ 167] = "Cambiar tipo de grupo",
+	[ 168] = "Ver mis calificaciones",
+	[ 169] = "Eliminar archivo mis trabajos",
+	[ 170] = "Crear carpeta en malet�n",
+	[ 171] = "Ver centros y departamentos",
+	[ 172] = "Crear carpeta mis trabajos",
+	[ 173] = "Eliminar archivo descarga",
+	[ 174] = "Crear tipo de grupo",
+	[ 175] = "Eliminar grupo",
+	[ 176] = "Enviar tema foro usrs.",
+	[ 177] = "Solicitar DNI alta usuario",
+	[ 178] = "Cambiar de grupo",
+	[ 179] = "Imprimir convocatoria",
+	[ 180] = "Convertir horarios",
+	[ 181] = "Insertar item pr�cticas",
+	[ 182] = "Enviar enlace a enlaces",
+	[ 183] = "Eliminar item pr�cticas",
+	[ 184] = "Enviar p�gina de evaluaci�n",
+	[ 185] = "Enviar p�gina de bibliograf�a",
+	[ 186] = "A�adir convocatoria",
+	[ 187] = "Eliminar convocatoria",
+	[ 188] = "Eliminar hebra foro asig.",
+	[ 189] = "Solicitar elim. hebra foro asig.",
+	[ 190] = "Solicitar elim. hebra foro prof.",
+	[ 191] = "Solicitar elim. hebra foro usrs.",
+	[ 192] = "Eliminar hebra foro usrs.",
+	[ 193] = "Eliminar hebra foro prof.",
+	[ 194] = "Acci�n desconocida",
+	[ 195] = "Editar trabajos de usuario",
+	[ 196] = "Eliminar carpeta malet�n",
+	[ 197] = "Renombrar carpeta en malet�n",
+	[ 198] = "Solicitar nuevo arch/carp trab.",
+	[ 199] = "Crear carpeta de trabajos",
+	[ 200] = "Renombrar carpeta de trabajos",
+	[ 201] = "Enviar archivo de trabajo",
+	[ 202] = "Eliminar archivo trabajo",
+	[ 203] = "Eliminar carpeta trabajos",
+	[ 204] = "Renombrar carpeta mis trabajos",
+	[ 205] = "Solic. nuevo arch/carp trab.asg.",
+	[ 206] = "Crear carpeta trabajos asg.",
+	[ 207] = "Subir archivo trabajos asg. (ant.)",
+	[ 208] = "Renombrar carpeta trabajos asg.",
+	[ 209] = "Eliminar archivo trabajos asg.",
+	[ 210] = "Eliminar carpeta trabajos asg.",
+	[ 211] = "Editar item teor�a",
+	[ 212] = "Bajar posici�n item pr�cticas",
+	[ 213] = "Subir posici�n item pr�cticas",
+	[ 214] = "Disminuir nivel item pr�cticas",
+	[ 215] = "Aumentar nivel item pr�cticas",
+	[ 216] = "Editar item pr�cticas",
+	[ 217] = "Insertar item teor�a",
+	[ 218] = "Eliminar item teor�a",
+	[ 219] = "Enviar p�gina de FAQ",
+	[ 220] = "Bajar posici�n item teor�a",
+	[ 221] = "Subir posici�n item teor�a",
+	[ 222] = "Disminuir nivel item teor�a",
+	[ 223] = "Aumentar nivel item teor�a",
+	[ 224] = "Enviar enlace a bibliograf�a",
+	[ 225] = "Solicitar baja alumnos",
+	[ 226] = "Dar baja usuarios (formulario)",
+	[ 227] = "Dar baja usuarios (archivo)",
+	[ 228] = "Eliminar carpeta mis trabajos",
+	[ 229] = "Solicitar DNI baja total",
+	[ 230] = "Confirmar baja total usuario",
+	[ 231] = "Solicitar DNI baja usuario",
+	[ 232] = "Confirmar baja usuario",
+	[ 233] = "Confirmar cambio otra contrase�a",
+	[ 234] = "Enviar enlace a FAQ",
+	[ 235] = "Enviar enlace a evaluaci�n",
+	[ 236] = "Solicitar eliminaci�n tipo grupo",
+	[ 237] = "Eliminar tipo de grupo",
+	[ 238] = "Cambiar obligatoriedad grupo",
+	[ 239] = "Cambiar multiplicidad grupo",
+	[ 240] = "Ver lista resumida profes. SWAD",
+	[ 241] = "Ver foro usuarios titulaci�n",
+	[ 242] = "Ver foro usuarios SWAD",
+	[ 243] = "Ver foro profesores titulaci�n",
+	[ 244] = "Ver msjs. tema foro usrs.SWAD",
+	[ 245] = "Ver foro profesores SWAD",
+	[ 246] = "Ver msjs. tema foro prof.SWAD",
+	[ 247] = "Enviar tema foro prof.tit.",
+	[ 248] = "Enviar respuesta foro prof.tit.",
+	[ 249] = "Solic. elim.hebra foro prof.tit.",
+	[ 250] = "Eliminar hebra foro prof.tit.",
+	[ 251] = "Eliminar mensaje foro prof.tit.",
+	[ 252] = "Enviar tema foro usrs.tit.",
+	[ 253] = "Solic. elim.hebra foro usrs.tit.",
+	[ 254] = "Eliminar hebra foro usrs.tit.",
+	[ 255] = "Ver msjs. tema foro usrs.tit.",
+	[ 256] = "Eliminar mensaje foro usrs.tit.",
+	[ 257] = "Ver msjs. tema foro asig.",
+	[ 258] = "Enviar tema foro usrs.SWAD",
+	[ 259] = "Enviar tema foro prof.SWAD",
+	[ 260] = "Solic. elim.hebra foro usrs.SWAD",
+	[ 261] = "Eliminar hebra foro usrs.SWAD",
+	[ 262] = "Eliminar mensaje foro prof.SWAD",
+	[ 263] = "Enviar respuesta foro prof.SWAD",
+	[ 264] = "Enviar respuesta foro usrs.SWAD",
+	[ 265] = "Solic. elim.hebra foro asig.",
+	[ 266] = "Eliminar mensaje foro usrs.SWAD",
+	[ 267] = "Administrar zona com�n asg.",
+	[ 268] = "Administrar zona com�n grp.",
+	[ 269] = "Enviar respuesta foro usrs.tit.",
+	[ 270] = "Solicitar nuevo arch/carp calif.",
+	[ 271] = "Crear carpeta calificaciones",
+	[ 272] = "Eliminar archivo calificaciones",
+	[ 273] = "Eliminar carpeta calificaciones",
+	[ 274] = "Enviar archivo calificaciones",
+	[ 275] = "Renombrar carpeta calificaciones",
+	[ 276] = "Eliminar �rbol malet�n",
+	[ 277] = "Eliminar �rbol descarga",
+	[ 278] = "Eliminar �rbol mis trabajos",
+	[ 279] = "Eliminar �rbol trabajos asg.",
+	[ 280] = "Eliminar �rbol calificaciones",
+	[ 281] = "Cambiar filas de cabecera",
+	[ 282] = "Cambiar filas de pie",
+	[ 283] = "Cambiar calificaciones",
+	[ 284] = "Administrar calificaciones asignatura",
+	[ 285] = "Solicitar cambio ficha com�n",
+	[ 286] = "Solicitar elim. arch. malet�n",
+	[ 287] = "Solicitar elim. arch. descarga",
+	[ 288] = "Solicitar elim. arch. mis trab.",
+	[ 289] = "Solicitar elim. arch. trab. asg.",
+	[ 290] = "Solicitar elim. arch. calif.",
+	[ 291] = "Ver msjs. tema foro prof.tit.",
+	[ 292] = "Solicitar edici�n campos fichas",
+	[ 293] = "Crear campo de fichas",
+	[ 294] = "Solicitar elimin. campo fichas",
+	[ 295] = "Eliminar campo de fichas",
+	[ 296] = "Renombrar campo de fichas",
+	[ 297] = "Cambiar visibilidad campo",
+	[ 298] = "Cambiar ficha com�n",
+	[ 299] = "Solicitar cambio ficha asig.",
+	[ 300] = "Cambiar ficha alumno en asig.",
+	[ 301] = "Cambiar ficha asignatura",
+	[ 302] = "Cambiar multiplic. tipo grupo",
+	[ 303] = "Cambiar obligator. tipo grupo",
+	[ 304] = "Renombrar tipo de grupo",
+	[ 305] = "Cambiar l�neas campo",
+	[ 306] = "Solicitar fichas alumnos",
+	[ 307] = "Ocultar arch/carp descarga",
+	[ 308] = "Inhabilitar arch/carp descarga",
+	[ 309] = "Habilitar arch/carp descarga",
+	[ 310] = "Copiar descarga",
+	[ 311] = "Copiar de malet�n",
+	[ 312] = "Copiar de trabajos asg.",
+	[ 313] = "Copiar de calificaciones",
+	[ 314] = "Copiar de mis trabajos",
+	[ 315] = "Pegar en malet�n",
+	[ 316] = "Copiar de descarga",
+	[ 317] = "Pegar en descarga",
+	[ 318] = "Pegar en mis trabajos",
+	[ 319] = "Pegar en trabajos asg.",
+	[ 320] = "Pegar en calificaciones",
+	[ 321] = "Cerrar grupo",
+	[ 322] = "Abrir grupo",
+	[ 323] = "Solic.nuevo arch/carp com�n asg.",
+	[ 324] = "Crear carpeta com�n asg.",
+	[ 325] = "Eliminar carpeta com�n asg.",
+	[ 326] = "Subir archivo com&uacute;n asg. (ant.)",
+	[ 327] = "Solicitar elim. arch. com�n asg.",
+	[ 328] = "Eliminar archivo com�n asg.",
+	[ 329] = "Renombrar carpeta com�n asg.",
+	[ 330] = "Copiar de zona com�n asg.",
+	[ 331] = "Pegar en zona com�n asg.",
+	[ 332] = "Eliminar �rbol com�n asg.",
+	[ 333] = "Solic.nuevo arch/carp com�n grp.",
+	[ 334] = "Crear carpeta com�n grp.",
+	[ 335] = "Subir archivo com&uacute;n grp. (ant.)",
+	[ 336] = "Copiar de zona com�n grp.",
+	[ 337] = "Pegar en zona com�n grp.",
+	[ 338] = "Eliminar carpeta com�n grp.",
+	[ 339] = "Eliminar �rbol com�n grp.",
+	[ 340] = "Renombrar carpeta com�n grp.",
+	[ 341] = "Solicitar elim. arch. com�n grp.",
+	[ 342] = "Eliminar archivo com�n grp.",
+	[ 343] = "Ver lista profes. SWAD",
+	[ 344] = "Pasar mensajes a base de datos",
+	[ 345] = "Ver foro usuarios asignatura",
+	[ 346] = "Ver msjs. tema foro usrs.asig.",
+	[ 347] = "Ver msjs. tema foro prof.asig.",
+	[ 348] = "Ver msjs. tema foro usrs.cent.",
+	[ 349] = "Enviar respuesta foro usrs.asig.",
+	[ 350] = "Enviar tema foro usrs.asig.",
+	[ 351] = "Eliminar mensaje foro usrs.asig.",
+	[ 352] = "Solic. elim.hebra foro usrs.asig",
+	[ 353] = "Eliminar hebra foro usrs.asig.",
+	[ 354] = "Pasar avisos a base de datos",
+	[ 355] = "Pasar foros a base de datos",
+	[ 356] = "Pasar mensajes 9 a base de datos",
+	[ 357] = "Pasar mensajes 0 a base de datos",
+	[ 358] = "Pasar mensajes 1 a base de datos",
+	[ 359] = "Pasar mensajes 2 a base de datos",
+	[ 360] = "Pasar mensajes 3 a base de datos",
+	[ 361] = "Pasar mensajes 4 a base de datos",
+	[ 362] = "Pasar mensajes 5 a base de datos",
+	[ 363] = "Pasar mensajes 6 a base de datos",
+	[ 364] = "Pasar mensajes 7 a base de datos",
+	[ 365] = "Pasar mensajes 8 a base de datos",
+	[ 366] = "Solic. elim.hebra foro prof.SWAD",
+	[ 367] = "Eliminar hebra foro prof.SWAD",
+	[ 368] = "Cambiar ficha com�n de otro usr.",
+	[ 369] = "Selec. tipo de info. asignatura",
+	[ 370] = "Selec. tipo de bibliograf�a",
+	[ 371] = "Editor integrado de pr�cticas",
+	[ 372] = "Editor integrado de teor�a",
+	[ 373] = "Solicitar DNI foto usuario",
+	[ 374] = "Cambiar foto otro usuario",
+	[ 375] = "Solicitar cambio foto otro usr.",
+	[ 376] = "Editor integrado de bibliograf�a",
+	[ 377] = "Editor de texto plano de bibliografa",
+	[ 378] = "Selec. tipo de prog. de teor�a",
+	[ 379] = "Editor de texto plano de teora",
+	[ 380] = "Selec. tipo de FAQ",
+	[ 381] = "Enviar p�gina de teor�a",
+	[ 382] = "Selec. tipo de prog. de pr�ct.",
+	[ 383] = "Enviar p�gina de pr�cticas",
+	[ 384] = "Selec. tipo de evaluaci�n",
+	[ 385] = "Selec. tipo de enlaces",
+	[ 386] = "Editor integrado de evaluaci�n",
+	[ 387] = "Editor de texto plano de evaluacin",
+	[ 388] = "Editor integrado de enlaces",
+	[ 389] = "Editor de texto plano de prcticas",
+	[ 390] = "Selec. tipo de descripci�n",
+	[ 391] = "Pasar descrip.<BR>a base datos",
+	[ 392] = "Editor de texto de descripci�n",
+	[ 393] = "Enviar texto de descripci�n",
+	[ 394] = "Enviar texto plano de teora",
+	[ 395] = "Editor integrado de descripci�n",
+	[ 396] = "Enviar texto plano de prcticas",
+	[ 397] = "Enviar texto plano de evaluacin",
+	[ 398] = "Enviar texto plano de bibliografa",
+	[ 399] = "Enviar p�gina de descripci�n",
+	[ 400] = "Editor de texto plano de enlaces",
+	[ 401] = "Enviar texto plano de enlaces",
+	[ 402] = "Enviar enlace a pr�cticas",
+	[ 403] = "Enviar enlace a teor�a",
+	[ 404] = "Editor integrado de FAQ",
+	[ 405] = "Editor de texto plano de FAQ",
+	[ 406] = "Enviar texto plano de FAQ",
+	[ 407] = "Enviar enlace a descripci�n",
+	[ 408] = "Ver horario todas clases",
+	[ 409] = "Imprimir horario todas clases",
+	[ 410] = "Expandir carpeta malet�n",
+	[ 411] = "Contraer carpeta malet�n",
+	[ 412] = "Expandir carpeta ver calif.",
+	[ 413] = "Contraer carpeta ver calif.",
+	[ 414] = "Expandir carpeta ver descarga",
+	[ 415] = "Expandir carpeta admin. descarga",
+	[ 416] = "Expandir carpeta trabajos asg.",
+	[ 417] = "Contraer carpeta admin. calif.",
+	[ 418] = "Expandir carpeta admin. calif.",
+	[ 419] = "Contraer carpeta ver descarga",
+	[ 420] = "Contraer carpeta admin. descarga",
+	[ 421] = "Expandir carpeta com�n asg.",
+	[ 422] = "Contraer carpeta com�n asg.",
+	[ 423] = "Expandir carpeta mis trabajos",
+	[ 424] = "Contraer carpeta trabajos asg.",
+	[ 425] = "Contraer carpeta mis trabajos",
+	[ 426] = "Contraer carpeta com�n grupo",
+	[ 427] = "Expandir carpeta com�n grupo",
+	[ 428] = "Eliminar foto",
+	[ 429] = "Eliminar foto otro usuario",
+	[ 430] = "Ver foro profesores centro",
+	[ 431] = "Ver foro profesores asignatura",
+	[ 432] = "Solicitar elim. usuarios antiguo",
+	[ 433] = "Solic. elimin. mensajes enviados",
+	[ 434] = "Eliminar mensajes enviados",
+	[ 435] = "Solic. elimin. mensajes recibido",
+	[ 436] = "Eliminar mensajes recibidos",
+	[ 437] = "Solicitar edici�n titulaci�n",
+	[ 438] = "Dar alta usr. sin cambiar datos",
+	[ 439] = "Dar alta usr. cambiando datos",
+	[ 440] = "Dar alta usuario nuevo",
+	[ 441] = "Ver orla profes. SWAD",
+	[ 442] = "Ver orla profesores",
+	[ 443] = "Imprimir orla profesores",
+	[ 444] = "Calcular fotos promedio",
+	[ 445] = "Ver fotos promedio",
+	[ 446] = "Imprimir fotos promedio",
+	[ 447] = "Ver orla de titulaciones",
+	[ 448] = "Imprimir orla de titulaciones",
+	[ 449] = "Ver salas pizarra",
+	[ 450] = "Abrir pizarra virtual",
+	[ 451] = "Solicitar configuraci�n test",
+	[ 452] = "Prohibir descriptor test",
+	[ 453] = "Permitir descriptor test",
+	[ 454] = "Recibir configuraci�n test",
+	[ 455] = "Cambiar orden. respuestas test",
+	[ 456] = "Censurar mensaje foro usrs.asig.",
+	[ 457] = "Permitir mensaje foro usrs.asig.",
+	[ 458] = "Censurar mensaje foro usrs.SWAD",
+	[ 459] = "Permitir mensaje foro usrs.SWAD",
+	[ 460] = "Censurar mensaje foro usrs.tit.",
+	[ 461] = "Administrar zona com�n",
+	[ 462] = "Expandir carpeta ver desc. asg.",
+	[ 463] = "Ver documentos asignatura",
+	[ 464] = "Habilitar arch/carp desc. asg.",
+	[ 465] = "Inhabilitar arch/carp desc. asg.",
+	[ 466] = "Ver documentos grupo",
+	[ 467] = "Administrar documentos grupo",
+	[ 468] = "Solicitar nueva descarga grp.",
+	[ 469] = "Crear carpeta descarga grp.",
+	[ 470] = "Copiar de descarga asg.",
+	[ 471] = "Pegar en descarga grp.",
+	[ 472] = "Copiar de descarga grp.",
+	[ 473] = "Solicitar elim. arch. desc. grp.",
+	[ 474] = "Eliminar archivo descarga grp.",
+	[ 475] = "Administrar documentos asignatura",
+	[ 476] = "Contraer carpeta ver desc. asg.",
+	[ 477] = "Expandir carpeta admin.desc.asg.",
+	[ 478] = "Pegar en descarga asg.",
+	[ 479] = "Solicitar elim. arch. desc. asg.",
+	[ 480] = "Eliminar archivo descarga asg.",
+	[ 481] = "Solicitar nueva descarga asg.",
+	[ 482] = "Subir archivo doc. asg. (ant.)",
+	[ 483] = "Subir archivo doc. grp. (ant.)",
+	[ 484] = "Eliminar carpeta descarga grp.",
+	[ 485] = "Eliminar �rbol descarga grp.",
+	[ 486] = "Expandir carpeta admin.desc.grp.",
+	[ 487] = "Contraer carpeta admin.desc.grp.",
+	[ 488] = "Expandir carpeta ver desc. grp.",
+	[ 489] = "Contraer carpeta ver desc. grp.",
+	[ 490] = "Renombrar carpeta descarga grp.",
+	[ 491] = "Crear carpeta descarga asg.",
+	[ 492] = "Inhabilitar arch/carp desc. grp.",
+	[ 493] = "Habilitar arch/carp desc. grp.",
+	[ 494] = "Contraer carpeta admin.desc.asg.",
+	[ 495] = "Habilitar zonas archivos grupo",
+	[ 496] = "Inhabilitar zonas archivos grupo",
+	[ 497] = "Eliminar carpeta descarga asg.",
+	[ 498] = "Eliminar �rbol descarga asg.",
+	[ 499] = "Administrar calificaciones asg.",
+	[ 500] = "Administrar calificaciones grp.",
+	[ 501] = "Copiar de calif. asg.",
+	[ 502] = "Pegar en calif. grp.",
+	[ 503] = "Cambiar filas de cabecera asg.",
+	[ 504] = "Cambiar filas de pie asg.",
+	[ 505] = "Solic. nuevo arch/carp calif.asg",
+	[ 506] = "Crear carpeta calif. asg.",
+	[ 507] = "Pegar en calif. asg.",
+	[ 508] = "Solicitar elim. arch. calif. grp",
+	[ 509] = "Eliminar archivo calif. grp.",
+	[ 510] = "Cambiar filas de cabecera grp.",
+	[ 511] = "Cambiar filas de pie grp.",
+	[ 512] = "Solic. nuevo arch/carp calif.grp",
+	[ 513] = "Crear carpeta calif. grp.",
+	[ 514] = "Subir archivo calif. grp. (ant.)",
+	[ 515] = "Contraer carpeta admin.calif.asg",
+	[ 516] = "Subir archivo calif. asg. (ant.)",
+	[ 517] = "Expandir carpeta admin.calif.grp",
+	[ 518] = "Contraer carpeta admin.calif.grp",
+	[ 519] = "Copiar de calif. grp.",
+	[ 520] = "Eliminar carpeta calif. grp.",
+	[ 521] = "Eliminar �rbol calif. grp.",
+	[ 522] = "Expandir carpeta ver calif. grp",
+	[ 523] = "Ver mis calificaciones asg.",
+	[ 524] = "Ver mis calificaciones grp.",
+	[ 525] = "Ver calificaciones asignatura",
+	[ 526] = "Ver calificaciones grupo",
+	[ 527] = "Contraer carpeta ver calif. asg.",
+	[ 528] = "Expandir carpeta ver calif. asg.",
+	[ 529] = "Renombrar carpeta calif. grp.",
+	[ 530] = "Eliminar carpeta calif. asg.",
+	[ 531] = "Expandir carpeta admin.calif.asg",
+	[ 532] = "Solicitar elim. arch. calif. asg",
+	[ 533] = "Eliminar archivo calif. asg.",
+	[ 534] = "Eliminar �rbol calif. asg.",
+	[ 535] = "Renombrar carpeta descarga asg.",
+	[ 536] = "Solicitar edici�n titulaciones",
+	[ 537] = "Crear tipo de titulaci�n",
+	[ 538] = "Renombrar tipo de titulaci�n",
+	[ 539] = "Solicitar eliminaci�n tipo titul",
+	[ 540] = "Crear titulaci�n",
+	[ 541] = "Solicitar eliminaci�n titulaci�n",
+	[ 542] = "Eliminar titulaci�n",
+	[ 543] = "Renombrar titulaci�n",
+	[ 544] = "Cambiar tipo de titulaci�n",
+	[ 545] = "Eliminar tipo titulaci�n",
+	[ 546] = "Cambiar nombre breve titulaci�n",
+	[ 547] = "Cambiar nombre completo titulac.",
+	[ 548] = "Cambiar campus de titulaci�n",
+	[ 549] = "Contraer carpeta ver calif. grp.",
+	[ 550] = "Cambiar primer a�o de titulaci�n",
+	[ 551] = "Cambiar �ltimo a�o de titulaci�n",
+	[ 552] = "Cambiar a�o opcional titulaci�n",
+	[ 553] = "Cambiar logo de titulaci�n",
+	[ 554] = "Cambiar web de titulaci�n",
+	[ 555] = "Solicitar edici�n asignaturas",
+	[ 556] = "Crear asignatura",
+	[ 557] = "Solicitar acept./rechazo mi alta",
+	[ 558] = "Aceptar mi alta",
+	[ 559] = "Rechazar mi alta",
+	[ 560] = "Eliminar asignatura",
+	[ 561] = "Cambiar curso de asignatura",
+	[ 562] = "Cambiar semestre de asignatura",
+	[ 563] = "Cambiar nombre breve asignatura",
+	[ 564] = "Cambiar nombre completo asig.",
+	[ 565] = "Mover asignatura a otra titulac.",
+	[ 566] = "Importar titulaciones",
+	[ 567] = "Importar asignaturas",
+	[ 568] = "Solicitar cambio resp. secreta",
+	[ 569] = "Cambiar respuesta secreta",
+	[ 570] = "Solicitar recuerdo contrase�a",
+	[ 571] = "Recordar contrase�a",
+	[ 572] = "Censurar mensaje foro prof.SWAD",
+	[ 573] = "Solicitar edici�n tipos titul.",
+	[ 574] = "Renombrar carpeta calif. asg.",
+	[ 575] = "Solicitar b�squeda asignaturas",
+	[ 576] = "Buscar asignaturas",
+	[ 577] = "Ver lista resumida profesores",
+	[ 578] = "Ver lista profesores",
+	[ 579] = "Ver lista resumida administrador",
+	[ 580] = "Solicitar DNI alta administrador",
+	[ 581] = "Confirmar alta administrador",
+	[ 582] = "Solicitar DNI baja administrador",
+	[ 583] = "Solicitar baja administrador",
+	[ 584] = "Dar baja administrador",
+	[ 585] = "Confirmar baja administrador",
+	[ 586] = "Dar alta administrador",
+	[ 587] = "Ver lista administradores",
+	[ 588] = "Cambiar tipo de usuario identifi",
+	[ 589] = "Cambiar tipo de usuario identif.",
+	[ 590] = "Solicitar elim.usuarios antiguos",
+	[ 591] = "Solic. consulta accesos SWAD",
+	[ 592] = "Solicitar acept/rechazo mi alta",
+	[ 593] = "Solic. elim. mensajes recibidos",
+	[ 594] = "Solic. consulta accesos asig.",
+	[ 595] = "Solicitar elim.arch.calif.asg.",
+	[ 596] = "Solic.nuevo arch/carp calif.asg.",
+	[ 597] = "Solic. nuevo arch/carp malet.",
+	[ 598] = "Confirm. cambio otra contrase�a",
+	[ 599] = "Enviar resp. foro usrs.asig.",
+	[ 600] = "Solicitar elim.arch.calif.grp.",
+	[ 601] = "Solic.nuevo arch/carp calif.grp.",
+	[ 602] = "Eliminar mens. foro usrs.asig.",
+	[ 603] = "Enviar resp. foro usrs.SWAD",
+	[ 604] = "Solic. elim. mensajes enviados",
+	[ 605] = "Expandir carpeta ver calif.grp",
+	[ 606] = "Enviar resp. foro usrs.tit.",
+	[ 607] = "Expandir carp. admin.calif.asg.",
+	[ 608] = "Eliminar mens. foro usrs.tit.",
+	[ 609] = "Contraer carpeta ver calif.grp.",
+	[ 610] = "Censurar mens. foro usrs.asig.",
+	[ 611] = "Solic.elim.hebra foro usrs.asig",
+	[ 612] = "Solic. elim. usuarios antiguos",
+	[ 613] = "Eliminar mens. foro usrs.SWAD",
+	[ 614] = "Solic.elim.hebra foro usrs.tit.",
+	[ 615] = "Censurar mens. foro usrs.tit.",
+	[ 616] = "Permitir mens. foro usrs.tit.",
+	[ 617] = "Enviar resp. foro prof.tit.",
+	[ 618] = "Censurar mens. foro prof.tit.",
+	[ 619] = "Permitir mens. foro prof.tit.",
+	[ 620] = "Solic.elim.hebra foro prof.tit.",
+	[ 621] = "Contraer carp. admin.calif.asg.",
+	[ 622] = "Enviar resp. foro prof.SWAD",
+	[ 623] = "Eliminar mens. foro prof.SWAD",
+	[ 624] = "Permitir mens. foro usrs.asig.",
+	[ 625] = "Censurar mens. foro usrs.SWAD",
+	[ 626] = "Solic.elim.hebra foro prof.SWAD",
+	[ 627] = "Solicitar b�squeda asig./prof.",
+	[ 628] = "Buscar asignaturas/profesores",
+	[ 629] = "Ver mensajes recibidos nuevos",
+	[ 630] = "Solic.elim.hebra foro usrs.SWAD",
+	[ 631] = "Expandir carp. admin.calif.grp.",
+	[ 632] = "Permitir mens. foro usrs.SWAD",
+	[ 633] = "Enviar contrase�a por correo",
+	[ 634] = "Permitir mens. foro prof.SWAD",
+	[ 635] = "Censurar mens. foro prof.SWAD",
+	[ 636] = "Pegar hebra foro usrs.asig.",
+	[ 637] = "Cortar hebra foro usrs.asig.",
+	[ 638] = "Cortar hebra foro usrs.SWAD",
+	[ 639] = "Pegar hebra foro usrs.SWAD",
+	[ 640] = "Pegar hebra foro usrs.tit.",
+	[ 641] = "Cortar hebra foro prof.SWAD",
+	[ 642] = "Ver foro profesores univ.",
+	[ 643] = "Ver msjs. tema foro prof.univ.",
+	[ 644] = "Cortar hebra foro prof.univ.",
+	[ 645] = "Cualquier acci�n",
+	[ 646] = "Ver foro usuarios univ.",
+	[ 647] = "Pegar hebra foro prof.SWAD",
+	[ 648] = "Ver msjs. tema foro usrs.univ.",
+	[ 649] = "Cortar hebra foro usrs.univ.",
+	[ 650] = "Pegar hebra foro usrs.univ.",
+	[ 651] = "Enviar resp. foro prof.univ.",
+	[ 652] = "Eliminar mens. foro prof.univ.",
+	[ 653] = "Cortar hebra foro usrs.tit.",
+	[ 654] = "Cambiar idioma",
+	[ 655] = "Enviar tema foro prof.univ.",
+	[ 656] = "Enviar resp. foro usrs.univ.",
+	[ 657] = "Eliminar mens. foro usrs.univ.",
+	[ 658] = "Enviar tema foro usrs.univ.",
+	[ 659] = "Censurar mens. foro usrs.univ.",
+	[ 660] = "Solic.elim.hebra foro usrs.univ.",
+	[ 661] = "Eliminar hebra foro usrs.univ.",
+	[ 662] = "Permitir mens. foro usrs.univ.",
+	[ 663] = "Ver mensaje recibido",
+	[ 664] = "Ver mensaje enviado",
+	[ 665] = "Solicitar env�o contrase�a",
+	[ 666] = "Ocultar columnas laterales",
+	[ 667] = "Mostrar columnas laterales",
+	[ 668] = "Ocultar columna izquierda",
+	[ 669] = "Ocultar columna derecha",
+	[ 670] = "Mostrar columna izquierda",
+	[ 671] = "Mostrar columna derecha",
+	[ 672] = "Cambiar dise�o",
+	[ 673] = "Editar preferencias",
+	[ 674] = "Cambiar columnas",
+	[ 675] = "Ver departamentos",
+	[ 676] = "Ver centros",
+	[ 677] = "Editar departamentos",
+	[ 678] = "Ver orla o lista de alumnos",
+	[ 679] = "Ver orla o lista de profesores",
+	[ 680] = "Eliminar mens. foro prof.tit.",
+	[ 681] = "Editar centros",
+	[ 682] = "Cambiar nombre breve centro",
+	[ 683] = "Cambiar web de centro",
+	[ 684] = "Cambiar nombre completo centro",
+	[ 685] = "Crear centro",
+	[ 686] = "Eliminar centro",
+	[ 687] = "Crear departamento",
+	[ 688] = "Cambiar nombre breve depar.",
+	[ 689] = "Cambiar nombre completo depar.",
+	[ 690] = "Eliminar departamento",
+	[ 691] = "Cambiar web de departamento",
+	[ 692] = "Recibir foto y detectar rostros",
+	[ 693] = "Detectar rostros mi foto",
+	[ 694] = "Cambiar mi foto",
+	[ 695] = "Detectar rostros en foto otro us",
+	[ 696] = "Ver instituciones",
+	[ 697] = "Editar instituciones",
+	[ 698] = "Crear instituci�n",
+	[ 699] = "Cambiar logo de instituci�n",
+	[ 700] = "Cambiar web de instituci�n",
+	[ 701] = "Cambiar nombre completo ins.",
+	[ 702] = "Cambiar nombre breve ins.",
+	[ 703] = "Ver lugares",
+	[ 704] = "Editar lugares",
+	[ 705] = "Crear lugar",
+	[ 706] = "Cambiar lugar de titulaci�n",
+	[ 707] = "Ver d&iacute;as festivos",
+	[ 708] = "Editar d�as festivos",
+	[ 709] = "Cambiar fecha d�a festivo",
+	[ 710] = "Cambiar nombre d�a festivo",
+	[ 711] = "Crear d�a festivo",
+	[ 712] = "Cambiar lugar d�a festivo",
+	[ 713] = "Editar festivo.",
+	[ 714] = "Crear festiv.",
+	[ 715] = "Cambiar tipo festiv.",
+	[ 716] = "Eliminar festiv.",
+	[ 717] = "Cambiar fecha inicio festiv.",
+	[ 718] = "Cambiar fecha fin festiv.",
+	[ 719] = "Cambiar institituci�n de titul.",
+	[ 720] = "Cambiar instituci�n centro",
+	[ 721] = "Cambiar instituci�n depar.",
+	[ 722] = "Cambiar instituci�n de titul.",
+	[ 723] = "Ver foro profesores general",
+	[ 724] = "Ver foro profesores instit.",
+	[ 725] = "Ver foro usuarios instit.",
+	[ 726] = "Ver foro usuarios general",
+	[ 727] = "Ver msjs. tema foro usrs.gral.",
+	[ 728] = "Cortar hebra foro usrs.gral.",
+	[ 729] = "Pegar hebra foro usrs.inst.",
+	[ 730] = "Ver msjs. tema foro usrs.inst.",
+	[ 731] = "Ver msjs. tema foro prof.gral.",
+	[ 732] = "Cortar hebra foro prof.gral.",
+	[ 733] = "Pegar hebra foro prof.inst.",
+	[ 734] = "Pegar hebra foro prof.gral.",
+	[ 735] = "Eliminar mens. foro usrs.gral.",
+	[ 736] = "Enviar tema foro usrs.gral.",
+	[ 737] = "Enviar tema foro usrs.inst.",
+	[ 738] = "Cortar hebra foro usrs.inst.",
+	[ 739] = "Pegar hebra foro usrs.gral.",
+	[ 740] = "Enviar resp. foro usrs.inst.",
+	[ 741] = "Solic.elim.hebra foro usrs.inst.",
+	[ 742] = "Eliminar hebra foro usrs.inst.",
+	[ 743] = "Eliminar mens. foro usrs.inst.",
+	[ 744] = "Solic.elim.hebra foro usrs.gral.",
+	[ 745] = "Eliminar hebra foro usrs.gral.",
+	[ 746] = "Ver msjs. tema foro prof.inst.",
+	[ 747] = "Enviar resp. foro usrs.gral.",
+	[ 748] = "Ver enlaces institucionales",
+	[ 749] = "Editar enlaces institucionales",
+	[ 750] = "Crear enlace institucional",
+	[ 751] = "Cambiar nombre completo enlace i",
+	[ 752] = "Cambiar web de enlace institucio",
+	[ 753] = "Cambiar nombre breve enlace ins.",
+	[ 754] = "Enviar tema foro prof.asig.",
+	[ 755] = "Enviar resp. foro prof.asig.",
+	[ 756] = "Eliminar mens. foro prof.asig.",
+	[ 757] = "Solic.elim.hebra foro prof.asig",
+	[ 758] = "Eliminar hebra foro prof.asig.",
+	[ 759] = "Eliminar instituci�n",
+	[ 760] = "Cambiar iconos seguros",
+	[ 761] = "Solicitar ver uso de SWAD",
+	[ 762] = "Ver avisos",
+	[ 763] = "Ocultar aviso",
+	[ 764] = "Mostrar aviso",
+	[ 765] = "Enviar tema foro prof.gral.",
+	[ 766] = "Cambiar nombre festiv.",
+	[ 767] = "Solicitar estad. asignaturas",
+	[ 768] = "Ver estad. asignaturas",
+	[ 769] = "Enviar tema foro prof.inst.",
+	[ 770] = "Enviar resp. foro prof.inst.",
+	[ 771] = "Cortar hebra foro prof.inst.",
+	[ 772] = "Eliminar mens. foro prof.inst.",
+	[ 773] = "Eliminar usuarios antiguos",
+	[ 774] = "Cambiar privacidad foto",
+	[ 775] = "Cambiar notificaci�n mensajes",
+	[ 776] = "Eliminar lugar",
+	[ 777] = "Listar plugins",
+	[ 778] = "Editar plugins",
+	[ 779] = "Crear plugin",
+	[ 780] = "Cambiar IP de plugin",
+	[ 781] = "Cambiar logo de plugin",
+	[ 782] = "Cambiar nombre de plugin",
+	[ 783] = "Cambiar URL de plugin",
+	[ 784] = "Ver gu�a docente",
+	[ 785] = "Editar gu�a docente",
+	[ 786] = "Editor integrado de gu�a docente",
+	[ 787] = "Editor de texto plano de gua docente",
+	[ 788] = "Enviar p�gina de gu�a docente",
+	[ 789] = "Selec. tipo de gu�a docente",
+	[ 790] = "Enviar texto plano de gua docente",
+	[ 791] = "Enviar enlace a gu�a docente",
+	[ 792] = "Editar mis trabajos",
+	[ 793] = "Pruebas de PRADO",
+	[ 794] = "Autenticar usuario desde fuera",
+	[ 795] = "Solicitar importaci�n de alumnos",
+	[ 796] = "Ver lista de alumnos oficiales",
+	[ 797] = "Solicitar alta/baja alumnos",
+	[ 798] = "Dar alta/baja alumnos (archivo)",
+	[ 799] = "Dar alta/baja alumnos (formul.)",
+	[ 800] = "Eliminando ceros de los DNI",
+	[ 801] = "Ver actividades",
+	[ 802] = "Editar actividades",
+	[ 803] = "Crear actividad",
+	[ 804] = "Cambiar tipo actividad",
+	[ 805] = "Cambiar fecha fin actividad",
+	[ 806] = "Eliminar actividad",
+	[ 807] = "Cambiar fecha inicio actividad",
+	[ 808] = "Cambiar nombre actividad",
+	[ 809] = "Cambiar texto actividad",
+	[ 810] = "Cambiar env�o trabajo actividad",
+	[ 811] = "Editar actividad",
+	[ 812] = "Solicitar creaci�n actividad",
+	[ 813] = "Solicitar elim. actividad",
+	[ 814] = "Solicitar edici�n actividad",
+	[ 815] = "Modificar actividad",
+	[ 816] = "Enviar resp. foro prof.gral.",
+	[ 817] = "Solic. nuevo arch/carp act.asg.",
+	[ 818] = "Crear carpeta activid. asg.",
+	[ 819] = "Expandir carpeta activid. asg.",
+	[ 820] = "Eliminar carpeta activid. asg.",
+	[ 821] = "Pegar en actividades asg.",
+	[ 822] = "Eliminar �rbol activid. asg.",
+	[ 823] = "Renombrar carpeta activid. asg.",
+	[ 824] = "Expandir carpeta mis activid.",
+	[ 825] = "Solic. nuevo arch/carp mis act.",
+	[ 826] = "Crear carpeta mis actividades",
+	[ 827] = "Eliminar carpeta mis activid.",
+	[ 828] = "Eliminar �rbol mis activid.",
+	[ 829] = "Copiar de mis actividades",
+	[ 830] = "Pegar en mis actividades",
+	[ 831] = "Contraer carpeta mis activid.",
+	[ 832] = "Subir archivo mis activid. (ant.)",
+	[ 833] = "Eliminar archivo mis activid.",
+	[ 834] = "Solicitar elim. arch. mis act.",
+	[ 835] = "Contraer carpeta activid. asg.",
+	[ 836] = "Copiar de actividades asg.",
+	[ 837] = "Solicitar elim. arch. ct. asg.",
+	[ 838] = "Eliminar archivo activid. asg.",
+	[ 839] = "Renombrar carpeta mis activid.",
+	[ 840] = "Instalaci�n inicial",
+	[ 841] = "Cambiar tema (colores)",
+	[ 842] = "Seleccionar titulaci�n/asignatura",
+	[ 843] = "Solicitar inicio sesi�n",
+	[ 844] = "Ver men� inicial",
+	[ 845] = "Refrescar mensajes y usuarios",
+	[ 846] = "Subir archivo activid. asg. (ant.)",
+	[ 847] = "Ver info. asignatura",
+	[ 848] = "Editar info. asignatura",
+	[ 849] = "Selec. tipo de info. asg.",
+	[ 850] = "Editor de texto plano de info. asg.",
+	[ 851] = "Enviar texto plano de info. asg.",
+	[ 852] = "Editor integrado de info. asg.",
+	[ 853] = "Enviar p�gina de info. asg.",
+	[ 854] = "Enviar enlace a info asg.",
+	[ 855] = "Ver dominios de correo",
+	[ 856] = "Editar dominios de correo",
+	[ 857] = "Crear dominio de correo",
+	[ 858] = "Cambiar dominio de correo",
+	[ 859] = "Cambiar informaci�n dominio corr",
+	[ 860] = "Eliminar dominio de correo",
+	[ 861] = "Pasar lista",
+	[ 862] = "Ver pa�ses",
+	[ 863] = "Editar pa�ses",
+	[ 864] = "Crear pa�s",
+	[ 865] = "Cambiar pa�s de instituci�n",
+	[ 866] = "Cambiar nombre breve pa�s",
+	[ 867] = "Solic.elim.discus.foro usrs.asig",
+	[ 868] = "Eliminar discus. foro usrs.asig.",
+	[ 869] = "Solic.elim.discus.foro prof.asig",
+	[ 870] = "Cambiar oblig. leer gu�a docente",
+	[ 871] = "Cambiar oblig. leer prog. de teo",
+	[ 872] = "Cambiar oblig. leer prog. de pr�",
+	[ 873] = "Cambiar oblig. leer bibliograf�a",
+	[ 874] = "Cambiar oblig. leer FAQ",
+	[ 875] = "Cambiar oblig. leer enlaces",
+	[ 876] = "Eliminar discus. foro prof.asig.",
+	[ 877] = "Cambiar oblig. leer info. asg.",
+	[ 878] = "Cambiar alumno leido info. asg.",
+	[ 879] = "Cambiar alumno leido FAQ",
+	[ 880] = "Cambiar alumno leido prog. de te",
+	[ 881] = "Solic.elim.discus.foro usrs.SWAD",
+	[ 882] = "Eliminar discus. foro usrs.SWAD",
+	[ 883] = "Cambiar oblig. leer evaluaci�n",
+	[ 884] = "Cambiar alumno leido bibliograf�",
+	[ 885] = "Cambiar alumno leido enlaces",
+	[ 886] = "Cambiar alumno leido gu�a docent",
+	[ 887] = "Cambiar alumno leido prog. de pr",
+	[ 888] = "Cambiar descripci�n de plugin",
+	[ 889] = "Eliminar plugin",
+	[ 890] = "Cortar discus. foro usrs.SWAD",
+	[ 891] = "Pegar discus. foro usrs.asig.",
+	[ 892] = "Ejecutar servicio web",
+	[ 893] = "Eliminar pa�s",
+	[ 894] = "Cambiar nombre breve lugar",
+	[ 895] = "Cambiar nombre completo lugar",
+	[ 896] = "Cambiar lugar festiv.",
+	[ 897] = "Eliminar enlace institucional",
+	[ 898] = "Cambiar alumno leido evaluaci�n",
+	[ 899] = "Solicitar editar trabajos asig.",
+	[ 900] = "Contraer carp. admin.calif.grp.",
+	[ 901] = "Ver foro usuarios centro",
+	[ 902] = "Ver msjs. tema foro prof.cent.",
+	[ 903] = "Enviar tema foro usrs.cent.",
+	[ 904] = "Enviar tema foro prof.cent.",
+	[ 905] = "Enviar resp. foro usrs.cent.",
+	[ 906] = "Enviar resp. foro prof.cent.",
+	[ 907] = "Solic.elim.discus.foro usrs.tit.",
+	[ 908] = "Solic.elim.discus.foro prof.tit.",
+	[ 909] = "Solic.elim.discus.foro usrs.cent",
+	[ 910] = "Solic.elim.discus.foro prof.cent",
+	[ 911] = "Solic.elim.discus.foro usrs.inst",
+	[ 912] = "Solic.elim.discus.foro prof.inst",
+	[ 913] = "Solic.elim.discus.foro usrs.gral",
+	[ 914] = "Solic.elim.discus.foro prof.gral",
+	[ 915] = "Solic.elim.discus.foro prof.SWAD",
+	[ 916] = "Eliminar discus. foro usrs.tit.",
+	[ 917] = "Eliminar discus. foro prof.tit.",
+	[ 918] = "Eliminar discus. foro usrs.cent.",
+	[ 919] = "Eliminar discus. foro prof.cent.",
+	[ 920] = "Eliminar discus. foro usrs.inst.",
+	[ 921] = "Eliminar discus. foro prof.inst.",
+	[ 922] = "Eliminar discus. foro usrs.gral.",
+	[ 923] = "Eliminar discus. foro prof.gral.",
+	[ 924] = "Eliminar discus. foro prof.SWAD",
+	[ 925] = "Censurar mens. foro prof.gral.",
+	[ 926] = "Cortar discus. foro usrs.asig.",
+	[ 927] = "Cortar discus. foro prof.asig.",
+	[ 928] = "Cortar discus. foro usrs.tit.",
+	[ 929] = "Cortar discus. foro prof.tit.",
+	[ 930] = "Cortar discus. foro usrs.cent.",
+	[ 931] = "Cortar discus. foro prof.cent.",
+	[ 932] = "Cortar discus. foro usrs.inst.",
+	[ 933] = "Cortar discus. foro prof.inst.",
+	[ 934] = "Cortar discus. foro usrs.gral.",
+	[ 935] = "Cortar discus. foro prof.gral.",
+	[ 936] = "Cortar discus. foro prof.SWAD",
+	[ 937] = "Pegar discus. foro prof.asig.",
+	[ 938] = "Pegar discus. foro usrs.tit.",
+	[ 939] = "Pegar discus. foro prof.tit.",
+	[ 940] = "Pegar discus. foro usrs.cent.",
+	[ 941] = "Pegar discus. foro prof.cent.",
+	[ 942] = "Pegar discus. foro usrs.inst.",
+	[ 943] = "Pegar discus. foro prof.inst.",
+	[ 944] = "Pegar discus. foro usrs.gral.",
+	[ 945] = "Pegar discus. foro prof.gral.",
+	[ 946] = "Pegar discus. foro usrs.SWAD",
+	[ 947] = "Pegar discus. foro prof.SWAD",
+	[ 948] = "Eliminar mens. foro usrs.cent.",
+	[ 949] = "Eliminar mens. foro prof.cent.",
+	[ 950] = "Eliminar mens. foro prof.gral.",
+	[ 951] = "Permitir mens. foro prof.asig.",
+	[ 952] = "Permitir mens. foro usrs.cent.",
+	[ 953] = "Permitir mens. foro prof.cent.",
+	[ 954] = "Permitir mens. foro usrs.inst.",
+	[ 955] = "Permitir mens. foro prof.inst.",
+	[ 956] = "Permitir mens. foro usrs.gral.",
+	[ 957] = "Permitir mens. foro prof.gral.",
+	[ 958] = "Censurar mens. foro prof.asig.",
+	[ 959] = "Censurar mens. foro usrs.cent.",
+	[ 960] = "Censurar mens. foro prof.cent.",
+	[ 961] = "Censurar mens. foro usrs.inst.",
+	[ 962] = "Censurar mens. foro prof.inst.",
+	[ 963] = "Censurar mens. foro usrs.gral.",
+	[ 964] = "Ocultar actividad",
+	[ 965] = "Mostrar actividad",
+	[ 966] = "Ver encuestas",
+	[ 967] = "Editar encuestas",
+	[ 968] = "Crear encuesta",
+	[ 969] = "Eliminar encuesta",
+	[ 970] = "Cambiar nombre de encuesta",
+	[ 971] = "Cambiar descripci�n de encuesta",
+	[ 972] = "Cambiar IP de encuesta",
+	[ 973] = "Solicitar creaci�n encuesta",
+	[ 974] = "Solicitar edici�n encuesta",
+	[ 975] = "Modificar encuesta",
+	[ 976] = "Solicitar elim. encuesta",
+	[ 977] = "Ocultar encuesta",
+	[ 978] = "Mostrar encuesta",
+	[ 979] = "Solicitar creaci�n pregunta encuesta",
+	[ 980] = "Enviar pregunta encuesta",
+	[ 981] = "Eliminar pregunta encuesta",
+	[ 982] = "Ver una encuesta",
+	[ 983] = "Responder encuesta",
+	[ 984] = "Request the reset of answers of a survey",
+	[ 985] = "Reset answers of survey",
+	[ 986] = "Cambiar clave aplicaci�n plugin",
+	[ 987] = "Seleccionar una de mis asignaturas",
+	[ 988] = "Cambiar a una de mis asignaturas",
+	[ 989] = "Ver usuarios conectados",
+	[ 990] = "Ver notificaciones",
+	[ 991] = "Ver notificaciones nuevas",
+	[ 992] = "Solicitar cambio idioma",
+	[ 993] = "Ver acciones frecuentes",
+	[ 994] = "Refrescar �ltimos clics",
+	[ 995] = "Ver �ltimos clics",
+	[ 996] = "Ver metadatos arch. doc. asg.",
+	[ 997] = "Hacer priv. arch. doc. asg.",
+	[ 998] = "Ver metadatos arch. doc. grp.",
+	[ 999] = "Hacer priv. arch. doc. grp.",
+	[1000] = "Ver metadatos arch. com. asg.",
+	[1001] = "Hacer priv. arch. com. asg.",
+	[1002] = "Ver metadatos arch. com. grp.",
+	[1003] = "Hacer priv. arch. com. grp.",
+	[1004] = "Solicitar edici�n de tipos de grupo",
+	[1005] = "Importar preguntas de test",
+	[1006] = "Cambiar m�todo autenticaci�n tipo titulaci�n",
+	[1007] = "Solicitar importaci�n preguntas test",
+	[1008] = "Importar preguntas test",
+	[1009] = "Ver asignaturas de titulaci�n",
+	[1010] = "Cambiar a otra asignatura",
+	[1011] = "Ver titulaciones",
+	[1012] = "Ir a titulaci�n de un tipo",
+	[1013] = "Ver tipos de titulaci�n",
+	[1014] = "Ir a tipo de titulaci�n",
+	[1015] = "Bloquear remitente",
+	[1016] = "Desbloquear remitente",
+	[1017] = "Ver usuarios bloqueados",
+	[1018] = "Quitar remitente de bloqueados",
+	[1019] = "Ocultar mensaje recibido",
+	[1020] = "Ocultar mensaje enviado",
+	[1021] = "Ver mi c�digo QR",
+	[1022] = "Imprimir mi c�digo QR",
+	[1023] = "Ver configuraci�n asignatura",
+	[1024] = "Cambiar configuraci�n asignatura",
+	[1025] = "Cambiar c�d. institucional asignatura",
+	[1026] = "Ir a instituci�n",
+	[1027] = "Ir a pa�s",
+	[1028] = "Imprimir configuraci�n asignatura",
+	[1029] = "Ver metadatos arch. doc. asg.",
+	[1030] = "Ver metadatos arch. doc. grp.",
+	[1031] = "Ver metadatos arch. com. asg.",
+	[1032] = "Ver metadatos arch. com. grp.",
+	[1033] = "Ver datos arch. doc. asg.",
+	[1034] = "Ver datos arch. doc. grp.",
+	[1035] = "Ver datos arch. admin.calif.asg.",
+	[1036] = "Cambiar datos arch. admin.calif.asg.",
+	[1037] = "Ver datos arch. admin.calif.grp.",
+	[1038] = "Cambiar datos arch. admin.calif.grp.",
+	[1039] = "Ver datos arch. mis actividades",
+	[1040] = "Cambiar datos arch. mis actividades",
+	[1041] = "Ver datos arch. mis trabajos",
+	[1042] = "Cambiar datos arch. mis trabajos",
+	[1043] = "Ver datos arch. activ. asg.",
+	[1044] = "Cambiar datos arch. activ. asg.",
+	[1045] = "Ver datos arch. trab. asg.",
+	[1046] = "Cambiar datos arch. trab. asg.",
+	[1047] = "Ver datos arch. malet�n",
+	[1048] = "Cambiar datos arch. malet�n",
+	[1049] = "Cambiar centro de titul.",
+	[1050] = "Ir a un centro",
+	[1051] = "Cambiar logo de centro",
+	[1052] = "Solicitar asignaturas",
+	[1053] = "Solicitar asignatura",
+	[1054] = "Formulario solicitud inscripcin",
+	[1055] = "Cambiar estado asignatura",
+	[1056] = "Solicitar inscripcin",
+	[1057] = "Listar inscripciones pendientes",
+	[1058] = "Preguntar si rechazar solicitud inscripcin",
+	[1059] = "Rechazar solicitud inscripcin",
+	[1060] = "Ver instit., centros, titul. y asig. pendientes",
+	[1061] = "Cambiar fecha apertura tipo grupo",
+	[1062] = "Administrar documentos (opcin antigua)",
+	[1063] = "Solicitar creacin evento asistencia",
+	[1064] = "Solicitar edicin evento asistencia",
+	[1065] = "Crear evento asistencia",
+	[1066] = "Modificar evento asistencia",
+	[1067] = "Solicitar elim. evento asistencia",
+	[1068] = "Eliminar evento asistencia",
+	[1069] = "Ocultar evento asistencia",
+	[1070] = "Mostrar evento asistencia",
+	[1071] = "Listar estudiantes asistentes a evento",
+	[1072] = "Registrar estudiantes asistentes a evento",
+	[1073] = "Selec. estud. y eventos listado asistencia",
+	[1074] = "Listar asistencia a varios eventos",
+	[1075] = "Imprimir asistencia a varios eventos",
+	[1076] = "Registrar estudiante asistente a evento",
+	[1077] = "Cambiar de idioma tras autenticar",
+	[1078] = "Ver documentos asignatura",
+	[1079] = "Ver calificaciones asignatura",
+	[1080] = "Seleccionar usuarios para result. test",
+	[1081] = "Ver resultados de tests de usuarios",
+	[1082] = "Ver un examen de test ya realizado",
+	[1083] = "Seleccionar fechas para mis result. test",
+	[1084] = "Ver mis resultados de tests",
+	[1085] = "Ver un examen de test m&iacute;o ya realizado",
+	[1086] = "Ver datos arch. calif. asg.",
+	[1087] = "Ver datos arch. calif. grp.",
+	[1088] = "Cambiar mi direcci&oacute;n de correo",
+	[1089] = "Eliminar apodo",
+	[1090] = "Eliminar direcci&oacute;n de correo",
+	[1091] = "Confirm email address",
+	[1092] = "Cambiar conjunto de iconos",
+	[1093] = "Editor de texto enriq. de info. asg.",
+	[1094] = "Editor de texto enriq. de gua docente",
+	[1095] = "Editor de texto enriq. de teora",
+	[1096] = "Editor de texto enriq. de prcticas",
+	[1097] = "Editor de texto enriq. de bibliografa",
+	[1098] = "Editor de texto enriq. de FAQ",
+	[1099] = "Editor de texto enriq. de enlaces",
+	[1100] = "Editor de texto enriq. de evaluacin",
+	[1101] = "Enviar texto enriq. de info. asg.",
+	[1102] = "Enviar texto enriq. de gua docente",
+	[1103] = "Enviar texto enriq. de teora",
+	[1104] = "Enviar texto enriq. de prcticas",
+	[1105] = "Enviar texto enriq. de bibliografa",
+	[1106] = "Enviar texto enriq. de FAQ",
+	[1107] = "Enviar texto enriq. de enlaces",
+	[1108] = "Enviar texto enriq. de evaluacin",
+	[1109] = "Solicitar elim. asignaturas antiguas",
+	[1110] = "Eliminar asignaturas antiguas",
+	[1111] = "Descargar arch. doc. asg.",
+	[1112] = "Descargar arch. doc. grp.",
+	[1113] = "Descargar arch. doc. asg.",
+	[1114] = "Descargar arch. doc. grp.",
+	[1115] = "Descargar arch. com. asg.",
+	[1116] = "Descargar arch. com. grp.",
+	[1117] = "Descargar arch. mis actividades",
+	[1118] = "Descargar arch. mis trabajos",
+	[1119] = "Descargar arch. activ. asg.",
+	[1120] = "Descargar arch. trab. asg.",
+	[1121] = "Descargar arch. admin.calif.asg.",
+	[1122] = "Descargar arch. admin.calif.grp.",
+	[1123] = "Descargar arch. malet&iacute;n",
+	[1124] = "Crear ZIP doc. asg.",
+	[1125] = "Crear ZIP doc. grp.",
+	[1126] = "Crear ZIP admin.doc.asg.",
+	[1127] = "Crear ZIP admin.doc.grp.",
+	[1128] = "Crear ZIP compart.asg.",
+	[1129] = "Crear ZIP compart.grp.",
+	[1130] = "Crear ZIP carpeta mis activid.",
+	[1131] = "Crear ZIP carpeta mis trabajos",
+	[1132] = "Crear ZIP carpeta activid. asg.",
+	[1133] = "Crear ZIP carpeta trabajos asg.",
+	[1134] = "Crear ZIP carpeta admin. calif. asg.",
+	[1135] = "Crear ZIP carpeta admin. calif. grp.",
+	[1136] = "Crear ZIP carpeta malet&iacute;n",
+	[1137] = "Ver banners",
+	[1138] = "Editar banners",
+	[1139] = "Crear banner",
+	[1140] = "Eliminar banner",
+	[1141] = "Cambiar nombre corto de banner",
+	[1142] = "Cambiar nombre largo de banner (",
+	[1143] = "Cambiar URL de banner",
+	[1144] = "Cambiar imagen de banner",
+	[1145] = "Clic en un banner",
+	[1146] = "Marcar notificaciones como vistas",
+	[1147] = "Eliminar uno de mis ID",
+	[1148] = "Crear un nuevo ID para m&iacute;",
+	[1149] = "Ver configuraci&oacute;n titulaci&oacute;n",
+	[1150] = "Imprimir configuraci&oacute;n titulaci&oacute;n",
+	[1151] = "Ver informaci&oacute;n centro",
+	[1152] = "Imprimir informaci&oacute;n centro",
+	[1153] = "Ver informaci&oacute;n instituci&oacute;n",
+	[1154] = "Imprimir informaci&oacute;n instituci&oacute;n",
+	[1155] = "Ver informaci&oacute;n instituci&oacute;n",
+	[1156] = "Imprimir informaci&oacute;n instituci&oacute;n",
+	[1157] = "Cambiar web pa&iacute;s",
+	[1158] = "Cambiar atribuci&oacute;n mapa pa&iacute;s",
+	[1159] = "Cambiar atribuci&oacute;n foto centro",
+	[1160] = "Solicitar env&iacute;o de foto del centro",
+	[1161] = "Enviar foto del centro",
+	[1162] = "Solicitar la creaci&oacute;n de una cuenta",
+	[1163] = "Crear una nueva cuenta",
+	[1164] = "Mostrar aviso completo",
+	[1165] = "Editar instituci&oacute;n, centro, departamento",
+	[1166] = "Cambiar pa&iacute;s instituci&oacute;n",
+	[1167] = "Cambiar instituci&oacute;n",
+	[1168] = "Cambiar centro",
+	[1169] = "Cambiar departamento",
+	[1170] = "Cambiar despacho",
+	[1171] = "Cambiar tel&eacute;fono despacho",
+	[1172] = "Editar redes sociales",
+	[1173] = "Cambiar redes sociales",
+	[1174] = "Ver ficha estudiante",
+	[1175] = "Ver ficha profesor",
+	[1186] = "Ver orla o lista de invitados",
+	[1187] = "Ver fichas invitados",
+	[1188] = "Imprimir fichas invitados",
+	[1189] = "Ver lista invitados",
+	[1190] = "Imprimir orla ionvitados",
+	[1191] = "Habilitar arch/carp calif. grp.",
+	[1192] = "Inhabilitar arch/carp calif. grp.",
+	[1193] = "Habilitar arch/carp calif. asig.",
+	[1194] = "Inhabilitar arch/carp calif. asig.",
+	[1195] = "Cambiar a ver documentos",
+	[1196] = "Cambiar a admin. documentos",
+	[1197] = "Cambiar a admin. archivos compartidos",
+	[1198] = "Cambiar a ver archivos calificaciones",
+	[1199] = "Cambiar a admin. archivos calificaciones",
+	[1200] = "Ver documentos grupo",
+	[1201] = "Administrar documentos grupo",
+	[1202] = "Administrar archivos compartidos asignatura",
+	[1203] = "Administrar archivos compartidos grupo",
+	[1204] = "Ver calificaciones grupo",
+	[1205] = "Administrar calificaciones grupo",
+	[1206] = "Solicitar titulaci&oacute;n",
+	[1207] = "Cambiar estado titulaci&oacute;n",
+	[1208] = "Solicitar centro",
+	[1209] = "Cambiar estado centro",
+	[1210] = "Solicitar instituci&oacute;n",
+	[1211] = "Cambiar estado instituci&oacute;n",
+	[1212] = "Mostrar banner",
+	[1213] = "Ocultar banner",
+	[1214] = "Subir archivo doc. asg.",
+	[1215] = "Subir archivo doc. grp.",
+	[1216] = "Subir archivo com&uacute;n asg.",
+	[1217] = "Subir archivo com&uacute;n grp.",
+	[1218] = "Subir archivo mis activid.",
+	[1219] = "Subir archivo mis trabajos",
+	[1220] = "Subir archivo activid. asg.",
+	[1221] = "Subir archivo trabajos asg.",
+	[1222] = "Subir archivo calif. asg.",
+	[1223] = "Subir archivo calif. grp.",
+	[1224] = "Subir archivo a malet&iacute;n",
+	[1225] = "Crear enlace documentos asg.",
+	[1226] = "Crear enlace com&uacute;n asg.",
+	[1227] = "Crear enlace com&uacute;n grp.",
+	[1228] = "Crear enlace mis trabajos",
+	[1229] = "Crear enlace trabajos asg.",
+	[1230] = "Crear enlace en malet&iacute;n",
+	[1231] = "Crear enlace documentos grp.",
+	[1232] = "Crear enlace mis actividades",
+	[1233] = "Crear enlace activid. asg.",
+	[1234] = "Mark announcement as seen",
+	[1235] = "Show global announcements",
+	[1236] = "Remove global announcement",
+	[1237] = "Show form to create a new global announcement",
+	[1238] = "Receive and create a new global announcement",
+	[1242] = "Show syllabus (lectures or practicals)",
+	[1243] = "Cambiar men&uacute;",
+	[1244] = "Show form to send the logo of the current centre",
+	[1245] = "Show form to send the logo of the current institution",
+	[1246] = "Show form to send the logo of the current degree",
+	[1247] = "Documents zone of the degree (see or admin)",
+	[1248] = "Documents zone of the centre (see or admin)",
+	[1249] = "Documents zone of the institution (see or admin)",
+	[1250] = "Change to see degree documents",
+	[1251] = "See the files of the documents zone of the degree",
+	[1252] = "Expand a folder in degree documents",
+	[1253] = "Contract a folder in degree documents",
+	[1254] = "Compress a folder in degree documents",
+	[1255] = "Ask for metadata of a file of the documents zone of the degree",
+	[1256] = "Download a file in documents zone of the degree",
+	[1257] = "Change to administrate degree documents",
+	[1258] = "Admin the files of the documents zone of the degree",
+	[1259] = "Request removal of a file in the documents zone of the degree",
+	[1260] = "Remove a file in the documents zone of the degree",
+	[1261] = "Remove a folder empty the documents zone of the degree",
+	[1262] = "Set source of copy in the documents zone of the degree",
+	[1263] = "Paste a folder or file in the documents zone of the degree",
+	[1264] = "Remove a folder no empty in the documents zone of the degree",
+	[1265] = "Form to crear a folder or file in the documents zone of the degree",
+	[1266] = "Create a new folder in the documents zone of the degree",
+	[1267] = "Create a new link in the documents zone of the degree",
+	[1268] = "Rename a folder in the documents zone of the degree",
+	[1269] = "Receive a file in the documents zone of the degree using Dropzone.js",
+	[1270] = "Receive a file in the documents zone of the degree using the classic way",
+	[1271] = "Expand a folder when administrating the documents zone of the degree",
+	[1272] = "Contract a folder when administrating the documents zone of the degree",
+	[1273] = "Compress a folder when administrating the documents zone of the degree",
+	[1274] = "Show hidden folder or file of the documents zone of the degree",
+	[1275] = "Hide folder or file of the documents zone of the degree",
+	[1276] = "Ask for metadata of a file of the documents zone of the degree",
+	[1277] = "Change metadata of a file of the documents zone of the degree",
+	[1278] = "Download a file of the documents zone of the degree",
+	[1279] = "Change to see centre documents",
+	[1280] = "See the files of the documents zone of the centre",
+	[1281] = "Expand a folder in centre documents",
+	[1282] = "Contract a folder in centre documents",
+	[1283] = "Compress a folder in centre documents",
+	[1284] = "Ask for metadata of a file of the documents zone of the centre",
+	[1285] = "Download a file in documents zone of the centre",
+	[1286] = "Change to administrate centre documents",
+	[1287] = "Admin the files of the documents zone of the centre",
+	[1288] = "Request removal of a file in the documents zone of the centre",
+	[1289] = "Remove a file in the documents zone of the centre",
+	[1290] = "Remove a folder empty the documents zone of the centre",
+	[1291] = "Set source of copy in the documents zone of the centre",
+	[1292] = "Paste a folder or file in the documents zone of the centre",
+	[1293] = "Remove a folder no empty in the documents zone of the centre",
+	[1294] = "Form to crear a folder or file in the documents zone of the centre",
+	[1295] = "Create a new folder in the documents zone of the centre",
+	[1296] = "Create a new link in the documents zone of the centre",
+	[1297] = "Rename a folder in the documents zone of the centre",
+	[1298] = "Receive a file in the documents zone of the centre using Dropzone.js",
+	[1299] = "Receive a file in the documents zone of the centre using the classic way",
+	[1300] = "Expand a folder when administrating the documents zone of the centre",
+	[1301] = "Contract a folder when administrating the documents zone of the centre",
+	[1302] = "Compress a folder when administrating the documents zone of the centre",
+	[1303] = "Show hidden folder or file of the documents zone of the centre",
+	[1304] = "Hide folder or file of the documents zone of the centre",
+	[1305] = "Ask for metadata of a file of the documents zone of the centre",
+	[1306] = "Change metadata of a file of the documents zone of the centre",
+	[1307] = "Download a file of the documents zone of the centre",
+	[1308] = "Change to see institution documents",
+	[1309] = "See the files of the documents zone of the institution",
+	[1310] = "Expand a folder in institution documents",
+	[1311] = "Contract a folder in institution documents",
+	[1312] = "Compress a folder in institution documents",
+	[1313] = "Ask for metadata of a file of the documents zone of the institution",
+	[1314] = "Download a file in documents zone of the institution",
+	[1315] = "Change to administrate institution documents",
+	[1316] = "Admin the files of the documents zone of the institution",
+	[1317] = "Request removal of a file in the documents zone of the institution",
+	[1318] = "Remove a file in the documents zone of the institution",
+	[1319] = "Remove a folder empty the documents zone of the institution",
+	[1320] = "Set source of copy in the documents zone of the institution",
+	[1321] = "Paste a folder or file in the documents zone of the institution",
+	[1322] = "Remove a folder no empty in the documents zone of the institution",
+	[1323] = "Form to crear a folder or file in the documents zone of the institution",
+	[1324] = "Create a new folder in the documents zone of the institution",
+	[1325] = "Create a new link in the documents zone of the institution",
+	[1326] = "Rename a folder in the documents zone of the institution",
+	[1327] = "Receive a file in the documents zone of the institution using Dropzone.js",
+	[1328] = "Receive a file in the documents zone of the institution using the classic way",
+	[1329] = "Expand a folder when administrating the documents zone of the institution",
+	[1330] = "Contract a folder when administrating the documents zone of the institution",
+	[1331] = "Compress a folder when administrating the documents zone of the institution",
+	[1332] = "Show hidden folder or file of the documents zone of the institution",
+	[1333] = "Hide folder or file of the documents zone of the institution",
+	[1334] = "Ask for metadata of a file of the documents zone of the institution",
+	[1335] = "Change metadata of a file of the documents zone of the institution",
+	[1336] = "Download a file of the documents zone of the institution",
+	[1337] = "Register an administrador in this institution",
+	[1338] = "Remove an administrador of this institution",
+	[1339] = "Register an administrador in this centre",
+	[1340] = "Remove an administrador of this centre",
+	[1341] = "Remove the logo of the current institution",
+	[1342] = "Remove the logo of the current centre",
+	[1343] = "Remove the logo of the current degree",
+	[1344] = "Admin the shared files zone of the degree",
+	[1345] = "Request removal of a shared file of the degree",
+	[1346] = "Remove a shared file of the degree",
+	[1347] = "Remove an empty shared folder of the degree",
+	[1348] = "Set source of copy in shared zone of the degree",
+	[1349] = "Paste a folder or file in shared zone of the degree",
+	[1350] = "Remove a folder no empty of shared zone of the degree",
+	[1351] = "Form to crear a folder or file in shared zone of the degree",
+	[1352] = "Create a new folder in shared zone of the degree",
+	[1353] = "Create a new link in shared zone of the degree",
+	[1354] = "Rename a folder in shared zone of the degree",
+	[1355] = "Receive a file in shared zone of the degree using Dropzone.js",
+	[1356] = "Receive a file in shared zone of the degree using the classic way",
+	[1357] = "Expand a folder in shared zone of the degree",
+	[1358] = "Contract a folder in shared zone of the degree",
+	[1359] = "Compress a folder in shared zone of the degree",
+	[1360] = "Ask for metadata of a file of the shared zone of the degree",
+	[1361] = "Change metadata of a file of the shared zone of the degree",
+	[1362] = "Download a file of the shared zone of the degree",
+	[1363] = "Admin the shared files zone of the centre",
+	[1364] = "Request removal of a shared file of the centre",
+	[1365] = "Remove a shared file of the centre",
+	[1366] = "Remove an empty shared folder of the centre",
+	[1367] = "Set source of copy in shared zone of the centre",
+	[1368] = "Paste a folder or file in shared zone of the centre",
+	[1369] = "Remove a folder no empty of shared zone of the centre",
+	[1370] = "Form to crear a folder or file in shared zone of the centre",
+	[1371] = "Create a new folder in shared zone of the centre",
+	[1372] = "Create a new link in shared zone of the centre",
+	[1373] = "Rename a folder in shared zone of the centre",
+	[1374] = "Receive a file in shared zone of the centre using Dropzone.js",
+	[1375] = "Receive a file in shared zone of the centre using the classic way",
+	[1376] = "Expand a folder in shared zone of the centre",
+	[1377] = "Contract a folder in shared zone of the centre",
+	[1378] = "Compress a folder in shared zone of the centre",
+	[1379] = "Ask for metadata of a file of the shared zone of the centre",
+	[1380] = "Change metadata of a file of the shared zone of the centre",
+	[1381] = "Download a file of the shared zone of the centre",
+	[1382] = "Admin the shared files zone of the institution",
+	[1383] = "Request removal of a shared file of the institution",
+	[1384] = "Remove a shared file of the institution",
+	[1385] = "Remove an empty shared folder of the institution",
+	[1386] = "Set source of copy in shared zone of the institution",
+	[1387] = "Paste a folder or file in shared zone of the institution",
+	[1388] = "Remove a folder no empty of shared zone of the institution",
+	[1389] = "Form to crear a folder or file in shared zone of the institution",
+	[1390] = "Create a new folder in shared zone of the institution",
+	[1391] = "Create a new link in shared zone of the institution",
+	[1392] = "Rename a folder in shared zone of the institution",
+	[1393] = "Receive a file in shared zone of the institution using Dropzone.js",
+	[1394] = "Receive a file in shared zone of the institution using the classic way",
+	[1395] = "Expand a folder in shared zone of the institution",
+	[1396] = "Contract a folder in shared zone of the institution",
+	[1397] = "Compress a folder in shared zone of the institution",
+	[1398] = "Ask for metadata of a file of the shared zone of the institution",
+	[1399] = "Change metadata of a file of the shared zone of the institution",
+	[1400] = "Download a file of the shared zone of the institution",
+	[1401] = "Request to show public user profile",
+	[1402] = "Show user profile",
+	[1404] = "Change privacy of my basic public profile",
+	[1405] = "Calculate user figures",
+	[1410] = "Follow a user",
+	[1411] = "Unfollow a user",
+	[1412] = "Show followed users",
+	[1413] = "Show followers",
+	[1414] = "Solicitar ID modif. invitado",
+	[1415] = "Solicitar ID modif. estudiante",
+	[1416] = "Solicitar ID modif. profesor",
+	[1417] = "Solicitar ID modif. administrador",
+	[1418] = "Confirmar modif. invitado",
+	[1419] = "Confirmar modif. estudiante",
+	[1420] = "Confirmar modif. profesor",
+	[1421] = "Confirmar modif. administrador",
+	[1422] = "Modificar datos invitado",
+	[1423] = "Modificar datos estudiante",
+	[1424] = "Modificar datos profesor",
+	[1425] = "Modificar datos administrador",
+	[1426] = "Administrar varios estudiantes",
+	[1427] = "Administrar varios profesores",
+	[1428] = "Inscribir/eliminar varios estudiantes",
+	[1429] = "Inscribir/eliminar varios profesores",
+	[1430] = "Preguntar si eliminar mi cuenta",
+	[1431] = "Eliminar mi cuenta",
+	[1432] = "Solicitar cambio foto otro usr.",
+	[1433] = "Solicitar cambio foto estudiante",
+	[1434] = "Solicitar cambio foto profesor",
+	[1435] = "Detectar rostros foto otro usr.",
+	[1436] = "Detectar rostros foto estudiante",
+	[1437] = "Detectar rostros foto profesor",
+	[1438] = "Cambiar foto otro usr.",
+	[1439] = "Cambiar foto estudiante",
+	[1440] = "Cambiar foto profesor",
+	[1441] = "Eliminar foto otro usr.",
+	[1442] = "Eliminar foto estudiante",
+	[1443] = "Eliminar foto profesor",
+	[1444] = "Crear invitado",
+	[1445] = "Crear usuario como estudiante",
+	[1446] = "Crear usuario como profesor",
+	[1447] = "Solicitar edici&oacute;n ID invitado",
+	[1448] = "Solicitar edici&oacute;n ID estudiante",
+	[1449] = "Solicitar edici&oacute;n ID profesor",
+	[1450] = "Eliminar ID invitado",
+	[1451] = "Eliminar ID estudiante",
+	[1452] = "Eliminar ID profesor",
+	[1453] = "Crear ID invitado",
+	[1454] = "Crear ID estudiante",
+	[1455] = "Crear ID profesor",
+	[1456] = "Solicitar acept. inscrip. estudiante",
+	[1457] = "Solicitar acept. inscrip. profesor",
+	[1458] = "Aceptar inscrip. como estudiante",
+	[1459] = "Aceptar inscrip. como profesor",
+	[1460] = "Rechazar inscrip. como estudiante",
+	[1461] = "Rechazar inscrip. como profesor",
+	[1462] = "Eliminar estudiante asignatura",
+	[1463] = "Eliminar profesor asignatura",
+	[1464] = "Solicitar cambio contrase&ntilde;a otro usuario",
+	[1465] = "Solicitar cambio contrase&ntilde;a estudiante",
+	[1466] = "Solicitar cambio contrase&ntilde;a profesor",
+	[1467] = "Cambiar contrase&ntilde;a otro usuario",
+	[1468] = "Cambiar contrase&ntilde;a estudiante",
+	[1469] = "Cambiar contrase&ntilde;a profesor",
+	[1470] = "Hide a global announcement that was active",
+	[1471] = "Reveal a global announcement that was hidden",
+	[1472] = "Request removal of a notice",
+	[1473] = "List my attendance as student to several events",
+	[1474] = "Print my attendance as student to several events",
+	[1478] = "Remove one of the email of another user",
+	[1479] = "Remove one of the email of another user",
+	[1480] = "Remove one of the email of another user",
+	[1481] = "Create a new user's email for another user",
+	[1482] = "Create a new user's email for another user",
+	[1483] = "Create a new user's email for another user",
+	[1484] = "Change first day of the week",
+	[1486] = "Change first day of week and show timetable of the course",
+	[1487] = "Change first day of week and show timetable of the course",
+	[1488] = "Ask for removing old files in the briefcase",
+	[1489] = "Remove old files in the briefcase",
+	[1490] = "Show timeline global",
+	[1492] = "Create post in global timeline",
+	[1493] = "Delete a publication in global timeline",
+	[1494] = "Request deletion of a publication in global timeline",
+	[1495] = "Share a publication in global timeline",
+	[1496] = "Unshare a publication in global timeline",
+	[1498] = "Create post in user timeline",
+	[1499] = "Share a publication in user timeline",
+	[1500] = "Unshare a publication in user timeline",
+	[1501] = "Request deletion of a publication in user timeline",
+	[1502] = "Delete a publication in user timeline",
+	[1503] = "Create comment in global timeline",
+	[1504] = "Create comment in user timeline",
+	[1505] = "Request deletion of a comment in global timeline",
+	[1506] = "Request deletion of a comment in user timeline",
+	[1507] = "Delete a comment in global timeline",
+	[1508] = "Delete a comment in user timeline",
+	[1509] = "Refresh global timeline (new publications)",
+	[1510] = "Show previous publications in global timeline",
+	[1511] = "Show previous publications in user timeline",
+	[1512] = "Favourite a publication in global timeline",
+	[1513] = "Unfavourite a publication in global timeline",
+	[1514] = "Favourite a publication in user timeline",
+	[1515] = "Unfavourite a publication in user timeline",
+	[1516] = "Favourite a comment in global timeline",
+	[1517] = "Unfavourite a comment in global timeline",
+	[1518] = "Favourite a comment in user timeline",
+	[1519] = "Unfavourite a comment in user timeline",
+	[1520] = "Suggest list of users to follow",
+	[1521] = "Landing page",
+	[1522] = "Update pending requests for inscription in the current course",
+	[1523] = "Request removing one test question",
+	[1524] = "Request the removal of a question of a survey",
+	[1525] = "Request the administration of the files of the teachers' zone of the course or of a group",
+	[1526] = "Change to administrate teachers' files of the course/group",
+	[1527] = "Admin the teachers' files zone of the course",
+	[1528] = "Request removal of a teachers' file of the course",
+	[1529] = "Remove a teachers' file of the course",
+	[1530] = "Remove an empty teachers' folder of the course",
+	[1531] = "Set source of teachers' zone of the course",
+	[1532] = "Paste a folder or file in teachers' zone of the course",
+	[1533] = "Remove a folder no empty of teachers' zone of the course",
+	[1534] = "Form to crear a folder or file in teachers' zone of the course",
+	[1535] = "Create a new folder in teachers' zone of the course",
+	[1536] = "Create a new link in teachers' zone of the course",
+	[1537] = "Rename a folder in teachers' zone of the course",
+	[1538] = "Receive a file in teachers' zone of the course using Dropzone.js",
+	[1539] = "Receive a file in teachers' zone of the course using the classic way",
+	[1540] = "Expand a folder in teachers' zone of the course",
+	[1541] = "Contract a folder in teachers' zone of the course",
+	[1542] = "Compress a folder in teachers' zone of the course",
+	[1543] = "Ask for metadata of a file of the teachers' zone of the course",
+	[1544] = "Change metadata of a file of the teachers' zone of the course",
+	[1545] = "Download a file of the teachers' zone of the course",
+	[1546] = "Admin the teachers' files zone of a group",
+	[1547] = "Request removal of a teachers' file of a group",
+	[1548] = "Remove a teachers' file of a group",
+	[1549] = "Remove an empty teachers' folder of a group",
+	[1550] = "Set source of copy in teachers' zone of a group",
+	[1551] = "Paste a folder or file in teachers' zone of a group",
+	[1552] = "Remove a folder no empty of teachers' zone of a group",
+	[1553] = "Form to create a folder or file in teachers' zone of a group",
+	[1554] = "Create a new folder in teachers' zone of a group",
+	[1555] = "Create a new link in teachers' zone of a group",
+	[1556] = "Rename a folder in teachers' zone of a group",
+	[1557] = "Receive a file in teachers' zone of a group using Dropzone.js",
+	[1558] = "Receive a file in teachers' zone of a group using the classic way",
+	[1559] = "Expand a folder in teachers' zone of a group",
+	[1560] = "Contract a folder in teachers' zone of a group",
+	[1561] = "Compress a folder in teachers' zone of a group",
+	[1562] = "Ask for metadata of a file of the teachers' zone of a group",
+	[1563] = "Change metadata of a file of the teachers' zone of a group",
+	[1564] = "Download a file of the teachers' zone of a group",
+	[1568] = "Confirm another user's ID",
+	[1569] = "Confirm another user's ID",
+	[1570] = "Confirm another user's ID",
+	[1571] = "See exam announcements of a given date",
+	[1572] = "See one exam announcement",
+	[1573] = "Change year/semester in course configuration",
+	[1574] = "Request the removal of other user's photo",
+	[1575] = "Request the removal of student's photo",
+	[1576] = "Request the removal of teacher's photo",
+	[1577] = "Request the removal of my photo",
+	[1578] = "List possible duplicate users",
+	[1579] = "List users similar to a given one (possible duplicates)",
+	[1580] = "Remove user from list of possible duplicate users",
+	[1582] = "Show my usage report",
+	[1584] = "Check if already exists a new account without password associated to a ID",
+	[1585] = "Authenticate user in empty account",
+	[1586] = "Request my usage report",
+	[1587] = "Request change of degree in course configuration",
+	[1588] = "Request change of the centre of a degree in degree configuration",
+	[1589] = "Request change of the institution of a centre in centre configuration",
+	[1590] = "Change country of institution in institution configuration",
+	[1591] = "Change full name of institution in institution configuration",
+	[1592] = "Change short name of institution in institution configuration",
+	[1593] = "Change web of institution in institution configuration",
+	[1594] = "Change full name centre in centre configuration",
+	[1595] = "Change short name centre in centre configuration",
+	[1596] = "Change web of centre in centre configuration",
+	[1597] = "Request change of the full name of a degree in degree configuration",
+	[1598] = "Request change of the short name of a degree in degree configuration",
+	[1599] = "Request change of the web of a degree in degree configuration",
+	[1600] = "Request change of full name of a course in course configuration",
+	[1601] = "Request change of short name of a course in course configuration",
+	[1602] = "Show my full agenda (personal organizer)",
+	[1603] = "Form to create a new event in my agenda",
+	[1604] = "Edit one event from my agenda",
+	[1605] = "Create a new event in my agenda",
+	[1606] = "Modify data of an event from my agenda",
+	[1607] = "Request the removal of an event from my agenda",
+	[1608] = "Remove an event from my agenda",
+	[1609] = "Make private an event from my agenda",
+	[1610] = "Make public an event from my agenda",
+	[1611] = "Show another user's public agenda",
+	[1612] = "Hide an event from my agenda",
+	[1613] = "Show an event from my agenda",
+	[1614] = "Put form to log in to show another user's public agenda",
+	[1615] = "Show another user's public agenda after log in",
+	[1616] = "Show another user's public agenda after change language",
+	[1618] = "Show agenda QR code ready to print",
+	[1619] = "Request the removal of an exam announcement",
+	[1620] = "Hide exam announcement",
+	[1621] = "Unhide exam announcement",
+	[1622] = "Show calendar",
+	[1623] = "Print calendar",
+	[1624] = "Change first day of the week in calendar",
+	[1637] = "Print one assignment",
+	[1638] = "Change date format",
+	[1639] = "Confirm acceptation / refusion of enrolment as non-editing teacher in current course",
+	[1640] = "Accept enrolment as non-editing teacher in current course",
+	[1641] = "Reject enrolment as non-editing teacher in current course",
+	[1642] = "Request the enrolment/removing of several non-editing teachers to / from current course",
+	[1643] = "Receive a form with IDs of non-editing teachers to be registered/removed to/from current course",
+	[1644] = "Request enrolment/removing of a non-editing teacher",
+	[1645] = "Create a new non-editing teacher",
+	[1646] = "Update another non-editing teacher's data and groups",
+	[1647] = "Remove a non-editing teacher from the current course",
+	[1648] = "Change place of centre in centre configuration",
+	[1649] = "See all games",
+	[1650] = "See a game",
+	[1651] = "Answer a match question",
+	[1652] = "Form to create a new game",
+	[1653] = "Edit game",
+	[1654] = "Create new game",
+	[1655] = "Modify data of an existing game",
+	[1656] = "Request the removal of a game",
+	[1657] = "Remove game",
+	[1660] = "Hide game",
+	[1661] = "Show game",
+	[1662] = "Add a new question to a game",
+	[1664] = "Request the removal of a question of a game",
+	[1665] = "Confirm the removal of a question of a game",
+	[1666] = "List test questions to select one or several questions",
+	[1667] = "Add selected test questions to game",
+	[1668] = "Move up a question of a game",
+	[1669] = "Move down a question of a game",
+	[1670] = "Request the creation of a new match",
+	[1671] = "Create a new match and show it in a new tab",
+	[1672] = "Go forward when playing a match",
+	[1674] = "See projects",
+	[1675] = "Form to create a new project",
+	[1676] = "Edit one project",
+	[1677] = "Print one project",
+	[1678] = "Create new project",
+	[1679] = "Modify data of an existing project",
+	[1680] = "Request the removal of an project",
+	[1681] = "Remove project",
+	[1682] = "Hide project",
+	[1683] = "Show project",
+	[1684] = "Request adding a student to a project",
+	[1685] = "Request adding a tutor to a project",
+	[1686] = "Request adding an evaluator to a project",
+	[1687] = "Add a student to a project",
+	[1688] = "Add a tutor to a project",
+	[1689] = "Add an evaluator to a project",
+	[1690] = "Request removing a student from a project",
+	[1691] = "Request removing a tutor from a project",
+	[1692] = "Request removing an evaluator from a project",
+	[1693] = "Remove a student from a project",
+	[1694] = "Remove a tutor from a project",
+	[1695] = "Remove an emulator from a project",
+	[1696] = "Show all projects in a table",
+	[1697] = "Admin. project documents",
+	[1698] = "Request removal of a file from project documents",
+	[1699] = "Remove a file from project documents",
+	[1700] = "Remove an empty folder from project documents",
+	[1701] = "Set source of copy in project documents",
+	[1702] = "Paste a folder or file into project documents",
+	[1703] = "Remove a non empty folder from project documents",
+	[1704] = "Form to create a folder or file in project documents",
+	[1705] = "Create a new folder in project documents",
+	[1706] = "Create a new link in project documents",
+	[1707] = "Rename a folder in project documents",
+	[1708] = "Receive a file in project documents using Dropzone.js",
+	[1709] = "Receive a file in project documents using the classic way",
+	[1710] = "Expand a folder in project documents",
+	[1711] = "Contract a folder in project documents",
+	[1712] = "Compress a folder in project documents",
+	[1713] = "Ask for metadata of a file in project documents",
+	[1714] = "Change metadata of a file in project documents",
+	[1715] = "Download a file from project documents",
+	[1716] = "Admin. project assessment",
+	[1717] = "Request removal of a file from project assessment",
+	[1718] = "Remove a file from project assessment",
+	[1719] = "Remove an empty folder from project assessment",
+	[1720] = "Set source of copy in project assessment",
+	[1721] = "Paste a folder or file into project assessment",
+	[1722] = "Remove a non empty folder from project assessment",
+	[1723] = "Form to create a folder or file in project assessment",
+	[1724] = "Create a new folder in project assessment",
+	[1725] = "Create a new link in project assessment",
+	[1726] = "Rename a folder in project assessment",
+	[1727] = "Receive a file in project assessment using Dropzone.js",
+	[1728] = "Receive a file in project assessment using the classic way",
+	[1729] = "Expand a folder in project assessment",
+	[1730] = "Contract a folder in project assessment",
+	[1731] = "Compress a folder in project assessment",
+	[1732] = "Ask for metadata of a file in project assessment",
+	[1733] = "Change metadata of a file in project assessment",
+	[1734] = "Download a file from project assessment",
+	[1735] = "Show forms to the change another user's account",
+	[1736] = "Show forms to the change another user's account",
+	[1737] = "Show forms to the change another user's account",
+	[1738] = "Remove one of another user's old nicknames",
+	[1739] = "Remove one of another user's old nicknames",
+	[1740] = "Remove one of another user's old nicknames",
+	[1741] = "Change another user's nickname",
+	[1742] = "Change another user's nickname",
+	[1743] = "Change another user's nickname",
+	[1744] = "List rooms in a centre",
+	[1745] = "Edit rooms",
+	[1746] = "Request the creation of a room",
+	[1747] = "Remove a room",
+	[1748] = "Change short name of a room",
+	[1749] = "Change full name of a room",
+	[1750] = "Change number of users of a room",
+	[1752] = "Change the room of a group",
+	[1753] = "Do action on several selected guests",
+	[1754] = "Do action on several selected students",
+	[1755] = "Do action on several selected teachers",
+	[1756] = "Request follow several students",
+	[1757] = "Request follow several teachers",
+	[1758] = "Request unfollow several students",
+	[1759] = "Request unfollow several teachers",
+	[1760] = "Follow several students",
+	[1761] = "Follow several teachers",
+	[1762] = "Unfollow several students",
+	[1763] = "Unfollow several teachers",
+	[1764] = "Change setting about third party cookies",
+	[1765] = "Change privacy of my extended public profile",
+	[1766] = "Show who shared a publication in global timeline",
+	[1767] = "Show who favourited a publication in global timeline",
+	[1768] = "Show who favourited a comment in global timeline",
+	[1769] = "Show who shared a publication in user timeline",
+	[1770] = "Show who favourited a publication in user timeline",
+	[1771] = "Show who favourited a comment in user timeline",
+	[1772] = "Select users to send an email to them",
+	[1773] = "Lock project edition",
+	[1774] = "Unlock project edition",
+	[1775] = "Request locking of all projects",
+	[1776] = "Request unlocking of all projects",
+	[1777] = "Lock all projects",
+	[1778] = "Unlock all projects",
+	[1780] = "Show current question when playing a game (as student)",
+	[1782] = "Refresh current question when playing a game (as student)",
+	[1783] = "Request the removal of a match",
+	[1784] = "Confirm the removal of a match",
+	[1785] = "Resume a match showing current question in a new tab",
+	[1787] = "Solicitar la creaci&oacute;n de una cuenta (2/2)",
+	[1788] = "Refrescar partida (como profesor)",
+	[1789] = "Jugar partida",
+	[1790] = "Ir hacia atr&aacute;s en partida",
+	[1791] = "Pausar partida",
+	[1792] = "Mostrar solo enunciado en partida (como profesor)",
+	[1793] = "Mostrar enunciado y respuestas en partida (como profesor)",
+	[1794] = "Cambiar presentaci&oacute;n de resultados de pregunta en partida",
+	[1795] = "Seleccionar fechas para mis result. partidas",
+	[1796] = "Ver mis resultados de partidas",
+	[1797] = "Ver una partida m&iacute;a ya realizada",
+	[1798] = "Seleccionar usuarios para result. partidas",
+	[1799] = "Ver resultados de partidas de usuarios",
+	[1800] = "Ver una partida ya realizada",
+	[1801] = "Cambiar visibilidad de resultados de una partida",
+	[1802] = "Change number of columns when playing a match",
+	[1803] = "Configure all projects",
+	[1804] = "Receive configuration of all projects",
+	[1805] = "Select users to list their projects",
+	[1806] = "Show hidden comments in global timeline",
+	[1807] = "Show hidden comments in user timeline",
+	[1808] = "View my answer to a match question",
+	[1809] = "Remove my answer to a match question",
+	[1810] = "Show all my matches results in a given game",
+	[1811] = "Show all matches results in a given game",
+	[1812] = "Show all my matches results in a given match",
+	[1813] = "Show all matches results in a given game",
+	[1814] = "Start match countdown",
+	[1815] = "Change latitude of centre in centre configuration",
+	[1816] = "Change longitude of centre in centre configuration",
+	[1817] = "Change altitude of centre in centre configuration",
+	[1818] = "Show information on the platform",
+	[1819] = "Print information on the platform",
+	[1820] = "Maintenance",
+	[1821] = "See educational schedule of the course",
+	[1822] = "Request new program item",
+	[1823] = "Edit program item",
+	[1825] = "Create new program item",
+	[1826] = "Change program item",
+	[1827] = "Request the removal of program item",
+	[1828] = "Remove of program item",
+	[1829] = "Hide program item",
+	[1830] = "Show program item",
+	[1831] = "Move up program item",
+	[1832] = "Move down program item",
+	[1833] = "Move right program item",
+	[1834] = "Move left program item",
+	[1835] = "Request removing several test questions",
+	[1836] = "Remove several test questions",
+	[1837] = "Request assessment of a test",
+	[1838] = "List buildings in a centre",
+	[1839] = "Edit buildings",
+	[1840] = "Request the creation of a building",
+	[1841] = "Remove a building",
+	[1842] = "Change short name of a building",
+	[1843] = "Change full name of a building",
+	[1844] = "Change location of a building",
+	[1845] = "Change building of a room",
+	[1846] = "Change floor of a room",
+	[1848] = "See all exams",
+	[1849] = "See exams",
+	[1850] = "Request exam session removal",
+	[1851] = "Remove exam session",
+	[1852] = "Request new exam session",
+	[1853] = "Create new exam session",
+	[1867] = "See my exam results in a course",
+	[1868] = "See my exam results in an exam",
+	[1869] = "See my exam results in a session",
+	[1870] = "See one of my exam results",
+	[1871] = "Select users to see all their exam results",
+	[1872] = "See all exam results of a course",
+	[1873] = "See all exam results of an exam",
+	[1874] = "See all exam results of a session",
+	[1875] = "See one of the exam results of another user",
+	[1876] = "Change visibility of exam results",
+	[1877] = "Request new exam",
+	[1878] = "Request exam edition",
+	[1879] = "Create new exam",
+	[1880] = "Change exam",
+	[1881] = "Request exam removal",
+	[1882] = "Remove exam",
+	[1883] = "Hide exam",
+	[1884] = "Unhide exam",
+	[1885] = "Request add question to exam",
+	[1886] = "List test questions for exam",
+	[1887] = "Add question to exam",
+	[1888] = "Request exam question removal",
+	[1889] = "Remove exam question",
+	[1892] = "Request new exam set",
+	[1893] = "Request set of questions removal",
+	[1894] = "Remove set of questions",
+	[1895] = "Move up set of questions",
+	[1896] = "Move down set of questions",
+	[1897] = "Change set of questions title",
+	[1898] = "Create new exam set",
+	[1899] = "Change number of questions from set to each exam print",
+	[1900] = "Hide exam session",
+	[1901] = "Unhide exam session",
+	[1902] = "Edit exam session",
+	[1903] = "Change exam session",
+	[1904] = "Start / resume exam",
+	[1906] = "Answer exam question",
+	[1907] = "Edit tags in the question bank",
+	[1908] = "End exam",
+	[1912] = "View one game and its questions",
+	[1914] = "Change a match",
+	[1915] = "Regrade exam session",
+	};
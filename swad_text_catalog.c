@@ -0,0 +1,281 @@
+// swad_text_catalog.c: catalogs of texts in several languages, mapped in memory
+
+/*
+    SWAD (Shared Workspace At a Distance),
+    is a web platform developed at the University of Granada (Spain),
+    and used to support university teaching.
+
+    This file is part of SWAD core.
+    Copyright (C) 1999-2021 Antonio Caas Vargas
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as
+    published by the Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.
+
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/*****************************************************************************/
+/********************************* Headers ***********************************/
+/*****************************************************************************/
+
+#include <fcntl.h>		// For open
+#include <stddef.h>		// For NULL
+#include <stdint.h>		// For uint32_t
+#include <stdlib.h>		// For malloc, free
+#include <string.h>		// For memcmp, strlen
+#include <sys/mman.h>		// For mmap
+#include <sys/stat.h>		// For fstat
+#include <unistd.h>		// For close
+
+#include "swad_action.h"
+#include "swad_assignment.h"
+#include "swad_building.h"
+#include "swad_centre.h"
+#include "swad_config.h"
+#include "swad_country.h"
+#include "swad_course.h"
+#include "swad_date.h"
+#include "swad_degree.h"
+#include "swad_degree_type.h"
+#include "swad_department.h"
+#include "swad_exam_log.h"
+#include "swad_figure.h"
+#include "swad_file_browser.h"
+#include "swad_forum.h"
+#include "swad_holiday.h"
+#include "swad_info.h"
+#include "swad_institution.h"
+#include "swad_language.h"
+#include "swad_mail.h"
+#include "swad_menu.h"
+#include "swad_notification.h"
+#include "swad_photo.h"
+#include "swad_place.h"
+#include "swad_privacy.h"
+#include "swad_project.h"
+#include "swad_record.h"
+#include "swad_role.h"
+#include "swad_room.h"
+#include "swad_statistic.h"
+#include "swad_survey.h"
+#include "swad_syllabus.h"
+#include "swad_tab.h"
+#include "swad_test.h"
+#include "swad_test_visibility.h"
+#include "swad_text_catalog.h"
+#include "swad_timeline.h"
+#include "swad_timeline_note.h"
+#include "swad_timetable.h"
+#include "swad_user.h"
+
+/*****************************************************************************/
+/************** External global variables from others modules ****************/
+/*****************************************************************************/
+
+// swad_text_list.h is generated by make from swad_text*.c and swad_help_URL.c.
+// It has one line TxtCat_ENTRY (Name,Dimensions) for each text
+#define TxtCat_ENTRY(Name,Dims) extern const char *Name Dims;
+#include "swad_text_list.h"
+#undef TxtCat_ENTRY
+
+/*****************************************************************************/
+/***************************** Private constants *****************************/
+/*****************************************************************************/
+
+#define TxtCat_MAGIC "SWADCAT"
+#define TxtCat_NULL_STRING ((uint32_t) 0xFFFFFFFF)	// Offset used for NULL pointers
+
+/*****************************************************************************/
+/******************************* Private types *******************************/
+/*****************************************************************************/
+
+/*
+   A catalog file has:
+   - a header,
+   - an array with the offset of each string from the beginning of the file,
+     in the same order as TxtCat_Entries,
+   - the strings, each one ended by '\0'.
+   Catalogs are generated and read in the same machine,
+   so integers are stored in native byte order.
+*/
+struct TxtCat_Header
+  {
+   char Magic[8];	// TxtCat_MAGIC
+   uint32_t Signature;	// Checksum of list of texts
+   uint32_t NumStrings;	// Number of offsets after header
+  };
+
+struct TxtCat_Entry
+  {
+   const char **Str;	// Pointer to text, or to first text of an array
+   size_t NumStrings;	// Number of texts (1 or number of elements in array)
+  };
+
+/*****************************************************************************/
+/***************************** Private variables *****************************/
+/*****************************************************************************/
+
+static const struct TxtCat_Entry TxtCat_Entries[] =
+  {
+#define TxtCat_ENTRY(Name,Dims) {(const char **) &Name,sizeof (Name) / sizeof (const char *)},
+#include "swad_text_list.h"
+#undef TxtCat_ENTRY
+  };
+
+#define TxtCat_NUM_ENTRIES (sizeof (TxtCat_Entries) / sizeof (TxtCat_Entries[0]))
+
+/*****************************************************************************/
+/****************************** Private prototypes ***************************/
+/*****************************************************************************/
+
+static uint32_t TxtCat_GetNumStrings (void);
+
+/*****************************************************************************/
+/************ Make texts point to the strings in a catalog file **************/
+/*****************************************************************************/
+// The file is mapped in memory, so only the pages with strings used are read.
+// Return false if catalog can not be used. In this case texts are not changed.
+
+bool TxtCat_LoadCatalog (const char *FileName)
+  {
+   int FileDescriptor;
+   struct stat FileStatus;
+   size_t Size;
+   const char *Catalog;
+   const struct TxtCat_Header *Header;
+   const uint32_t *Offsets;
+   size_t NumEntry;
+   size_t NumStrInEntry;
+   uint32_t NumStr;
+
+   /***** Map catalog file in memory *****/
+   if ((FileDescriptor = open (FileName,O_RDONLY)) < 0)
+      return false;
+   if (fstat (FileDescriptor,&FileStatus))
+     {
+      close (FileDescriptor);
+      return false;
+     }
+   Size = (size_t) FileStatus.st_size;
+   if (Size <= sizeof (struct TxtCat_Header))
+     {
+      close (FileDescriptor);
+      return false;
+     }
+   Catalog = mmap (NULL,Size,PROT_READ,MAP_SHARED,FileDescriptor,0);
+   close (FileDescriptor);	// Mapping is not removed when closing file
+   if (Catalog == MAP_FAILED)
+      return false;
+
+   /***** Check that catalog has been generated from the current list of texts *****/
+   Header = (const struct TxtCat_Header *) Catalog;
+   if (memcmp (Header->Magic,TxtCat_MAGIC,sizeof (TxtCat_MAGIC)) ||
+       Header->Signature  != TxtCat_LIST_SIGNATURE ||
+       Header->NumStrings != TxtCat_GetNumStrings () ||
+       Size < sizeof (struct TxtCat_Header) + Header->NumStrings * sizeof (uint32_t) ||
+       Catalog[Size - 1] != '\0')	// Last string must be ended
+     {
+      munmap ((void *) Catalog,Size);
+      return false;
+     }
+   Offsets = (const uint32_t *) (Catalog + sizeof (struct TxtCat_Header));
+
+   /***** Make texts point to strings in catalog *****/
+   // The file is never unmapped, so texts are valid until the end of the program
+   for (NumEntry = 0, NumStr = 0;
+	NumEntry < TxtCat_NUM_ENTRIES;
+	NumEntry++)
+      for (NumStrInEntry = 0;
+	   NumStrInEntry < TxtCat_Entries[NumEntry].NumStrings;
+	   NumStrInEntry++, NumStr++)
+	 if (Offsets[NumStr] == TxtCat_NULL_STRING)
+	    TxtCat_Entries[NumEntry].Str[NumStrInEntry] = NULL;
+	 else if (Offsets[NumStr] < Size)
+	    TxtCat_Entries[NumEntry].Str[NumStrInEntry] = Catalog + Offsets[NumStr];
+
+   return true;
+  }
+
+/*****************************************************************************/
+/************ Write a catalog file with the texts built in program ***********/
+/*****************************************************************************/
+// Called from swad_text_catalog_gen.c, compiled with the texts of one language.
+// Return false if there is no memory, before writing anything
+
+bool TxtCat_WriteCatalog (FILE *File)
+  {
+   struct TxtCat_Header Header;
+   uint32_t *Offsets;
+   uint32_t Offset;
+   size_t NumEntry;
+   size_t NumStrInEntry;
+   uint32_t NumStr;
+   const char *Str;
+
+   /***** Build header *****/
+   memset (&Header,0,sizeof (Header));
+   memcpy (Header.Magic,TxtCat_MAGIC,sizeof (TxtCat_MAGIC));
+   Header.Signature  = TxtCat_LIST_SIGNATURE;
+   Header.NumStrings = TxtCat_GetNumStrings ();
+
+   /***** Allocate offsets *****/
+   if ((Offsets = malloc (Header.NumStrings * sizeof (*Offsets))) == NULL)
+      return false;
+
+   /***** Write header *****/
+   fwrite (&Header,sizeof (Header),1,File);
+
+   /***** Compute and write offsets *****/
+   Offset = sizeof (Header) + Header.NumStrings * sizeof (*Offsets);
+   for (NumEntry = 0, NumStr = 0;
+	NumEntry < TxtCat_NUM_ENTRIES;
+	NumEntry++)
+      for (NumStrInEntry = 0;
+	   NumStrInEntry < TxtCat_Entries[NumEntry].NumStrings;
+	   NumStrInEntry++, NumStr++)
+	 if ((Str = TxtCat_Entries[NumEntry].Str[NumStrInEntry]))
+	   {
+	    Offsets[NumStr] = Offset;
+	    Offset += (uint32_t) strlen (Str) + 1;
+	   }
+	 else
+	    Offsets[NumStr] = TxtCat_NULL_STRING;
+   fwrite (Offsets,sizeof (*Offsets),Header.NumStrings,File);
+   free (Offsets);
+
+   /***** Write strings *****/
+   for (NumEntry = 0;
+	NumEntry < TxtCat_NUM_ENTRIES;
+	NumEntry++)
+      for (NumStrInEntry = 0;
+	   NumStrInEntry < TxtCat_Entries[NumEntry].NumStrings;
+	   NumStrInEntry++)
+	 if ((Str = TxtCat_Entries[NumEntry].Str[NumStrInEntry]))
+	    fwrite (Str,1,strlen (Str) + 1,File);
+
+   return true;
+  }
+
+/*****************************************************************************/
+/************************ Get total number of strings ************************/
+/*****************************************************************************/
+
+static uint32_t TxtCat_GetNumStrings (void)
+  {
+   size_t NumEntry;
+   uint32_t NumStrings = 0;
+
+   for (NumEntry = 0;
+	NumEntry < TxtCat_NUM_ENTRIES;
+	NumEntry++)
+      NumStrings += (uint32_t) TxtCat_Entries[NumEntry].NumStrings;
+
+   return NumStrings;
+  }
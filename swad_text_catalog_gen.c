@@ -0,0 +1,51 @@
+// swad_text_catalog_gen.c: generate a catalog with the texts of one language
+
+/*
+    SWAD (Shared Workspace At a Distance),
+    is a web platform developed at the University of Granada (Spain),
+    and used to support university teaching.
+
+    This file is part of SWAD core.
+    Copyright (C) 1999-2021 Antonio Caas Vargas
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Affero General Public License as
+    published by the Free Software Foundation, either version 3 of the
+    License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Affero General Public License for more details.
+
+    You should have received a copy of the GNU Affero General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/*****************************************************************************/
+/********************************* Headers ***********************************/
+/*****************************************************************************/
+
+#include <stdio.h>		// For stdout
+#include <stdlib.h>		// For exit codes
+
+#include "swad_text_catalog.h"
+
+/*****************************************************************************/
+/****************************** Main function ********************************/
+/*****************************************************************************/
+// Compiled by make together with swad_text*.c and swad_help_URL.c,
+// all of them with -D L=n for the language n.
+// The catalog is written to standard output.
+// On error, exit status is not zero, so make stops
+
+int main (void)
+  {
+   if (!TxtCat_WriteCatalog (stdout))
+     {
+      perror ("Can not write catalog");
+      return EXIT_FAILURE;
+     }
+
+   return ferror (stdout) ? EXIT_FAILURE :
+			    EXIT_SUCCESS;
+  }
@@ -66,6 +66,7 @@
 #include "swad_password.h"
 #include "swad_photo.h"
 #include "swad_privacy.h"
+#include "swad_random.h"
 #include "swad_QR.h"
 #include "swad_record.h"
 #include "swad_role.h"
@@ -383,6 +384,7 @@ void Usr_ResetMyLastData (void)
    Gbl.Usrs.Me.UsrLast.LastRole      = Rol_UNK;
    Gbl.Usrs.Me.UsrLast.LastTime      = 0;
    Gbl.Usrs.Me.UsrLast.LastAccNotif  = 0;
+   Gbl.Usrs.Me.UsrLast.MFUEpoch      = 0;
   }
 
 /*****************************************************************************/
@@ -491,7 +493,74 @@ void Usr_GetUsrDataFromUsrCod (struct UsrData *UsrDat,Usr_GetPrefs_t GetPrefs)
    extern const char *The_ThemeId[The_NUM_THEMES];
    extern const char *Txt_The_user_does_not_exist;
    extern const char *Lan_STR_LANG_ID[1 + Lan_NUM_LANGUAGES];
-   MYSQL_RES *mysql_res;
+   static struct DB_Stmt StmtWithoutPrefs =
+   DB_STMT ("SELECT EncryptedUsrCod,"	// row[ 0]
+		   "Password,"		// row[ 1]
+		   "Surname1,"		// row[ 2]
+		   "Surname2,"		// row[ 3]
+		   "FirstName,"		// row[ 4]
+		   "Sex,"		// row[ 5]
+		   "Photo,"		// row[ 6]
+		   "PhotoVisibility,"	// row[ 7]
+		   "BaPrfVisibility,"	// row[ 8]
+		   "ExPrfVisibility,"	// row[ 9]
+		   "CtyCod,"		// row[10]
+		   "InsCtyCod,"		// row[11]
+		   "InsCod,"		// row[12]
+		   "DptCod,"		// row[13]
+		   "CtrCod,"		// row[14]
+		   "Office,"		// row[15]
+		   "OfficePhone,"	// row[16]
+		   "LocalPhone,"	// row[17]
+		   "FamilyPhone,"	// row[18]
+		   "DATE_FORMAT(Birthday,"
+		   "'%Y%m%d'),"		// row[19]
+		   "Comments,"		// row[20]
+		   "NotifNtfEvents,"	// row[21]
+		   "EmailNtfEvents"	// row[22]
+	    " FROM usr_data"
+	    " WHERE UsrCod=?",
+	    "l");
+   static struct DB_Stmt StmtWithPrefs =
+   DB_STMT ("SELECT EncryptedUsrCod,"	// row[ 0]
+		   "Password,"		// row[ 1]
+		   "Surname1,"		// row[ 2]
+		   "Surname2,"		// row[ 3]
+		   "FirstName,"		// row[ 4]
+		   "Sex,"		// row[ 5]
+		   "Photo,"		// row[ 6]
+		   "PhotoVisibility,"	// row[ 7]
+		   "BaPrfVisibility,"	// row[ 8]
+		   "ExPrfVisibility,"	// row[ 9]
+		   "CtyCod,"		// row[10]
+		   "InsCtyCod,"		// row[11]
+		   "InsCod,"		// row[12]
+		   "DptCod,"		// row[13]
+		   "CtrCod,"		// row[14]
+		   "Office,"		// row[15]
+		   "OfficePhone,"	// row[16]
+		   "LocalPhone,"	// row[17]
+		   "FamilyPhone,"	// row[18]
+		   "DATE_FORMAT(Birthday,"
+		   "'%Y%m%d'),"		// row[19]
+		   "Comments,"		// row[20]
+		   "NotifNtfEvents,"	// row[21]
+		   "EmailNtfEvents,"	// row[22]
+
+		   // Settings (usually not necessary
+		   // when getting another user's data)
+		   "Language,"		// row[23]
+		   "FirstDayOfWeek,"	// row[24]
+		   "DateFormat,"	// row[25]
+		   "Theme,"		// row[26]
+		   "IconSet,"		// row[27]
+		   "Menu,"		// row[28]
+		   "SideCols,"		// row[29]
+		   "ThirdPartyCookies"	// row[30]
+	    " FROM usr_data"
+	    " WHERE UsrCod=?",
+	    "l");
+   struct DB_Stmt *Stmt;
    MYSQL_ROW row;
    unsigned long NumRows;
    The_Theme_t Theme;
@@ -502,84 +571,21 @@ void Usr_GetUsrDataFromUsrCod (struct UsrData *UsrDat,Usr_GetPrefs_t GetPrefs)
    switch (GetPrefs)
      {
       case Usr_DONT_GET_PREFS:
-	 NumRows = DB_QuerySELECT (&mysql_res,"can not get user's data",
-				   "SELECT EncryptedUsrCod,"	// row[ 0]
-					  "Password,"		// row[ 1]
-					  "Surname1,"		// row[ 2]
-					  "Surname2,"		// row[ 3]
-					  "FirstName,"		// row[ 4]
-					  "Sex,"		// row[ 5]
-					  "Photo,"		// row[ 6]
-					  "PhotoVisibility,"	// row[ 7]
-					  "BaPrfVisibility,"	// row[ 8]
-					  "ExPrfVisibility,"	// row[ 9]
-					  "CtyCod,"		// row[10]
-					  "InsCtyCod,"		// row[11]
-					  "InsCod,"		// row[12]
-					  "DptCod,"		// row[13]
-					  "CtrCod,"		// row[14]
-					  "Office,"		// row[15]
-					  "OfficePhone,"	// row[16]
-					  "LocalPhone,"		// row[17]
-					  "FamilyPhone,"	// row[18]
-					  "DATE_FORMAT(Birthday,"
-					  "'%%Y%%m%%d'),"	// row[19]
-					  "Comments,"		// row[20]
-					  "NotifNtfEvents,"	// row[21]
-					  "EmailNtfEvents"	// row[22]
-				    " FROM usr_data"
-				    " WHERE UsrCod=%ld",
-				    UsrDat->UsrCod);
+	 Stmt = &StmtWithoutPrefs;
 	 break;
       case Usr_GET_PREFS:
       default:
-	 NumRows = DB_QuerySELECT (&mysql_res,"can not get user's data",
-				   "SELECT EncryptedUsrCod,"	// row[ 0]
-					  "Password,"		// row[ 1]
-					  "Surname1,"		// row[ 2]
-					  "Surname2,"		// row[ 3]
-					  "FirstName,"		// row[ 4]
-					  "Sex,"		// row[ 5]
-					  "Photo,"		// row[ 6]
-					  "PhotoVisibility,"	// row[ 7]
-					  "BaPrfVisibility,"	// row[ 8]
-					  "ExPrfVisibility,"	// row[ 9]
-					  "CtyCod,"		// row[10]
-					  "InsCtyCod,"		// row[11]
-					  "InsCod,"		// row[12]
-					  "DptCod,"		// row[13]
-					  "CtrCod,"		// row[14]
-					  "Office,"		// row[15]
-					  "OfficePhone,"	// row[16]
-					  "LocalPhone,"		// row[17]
-					  "FamilyPhone,"	// row[18]
-					  "DATE_FORMAT(Birthday,"
-					  "'%%Y%%m%%d'),"	// row[19]
-					  "Comments,"		// row[20]
-					  "NotifNtfEvents,"	// row[21]
-					  "EmailNtfEvents,"	// row[22]
-
-					  // Settings (usually not necessary
-					  // when getting another user's data)
-					  "Language,"		// row[23]
-					  "FirstDayOfWeek,"	// row[24]
-					  "DateFormat,"		// row[25]
-					  "Theme,"		// row[26]
-					  "IconSet,"		// row[27]
-					  "Menu,"		// row[28]
-					  "SideCols,"		// row[29]
-					  "ThirdPartyCookies"	// row[30]
-				    " FROM usr_data"
-				    " WHERE UsrCod=%ld",
-				    UsrDat->UsrCod);
+	 Stmt = &StmtWithPrefs;
          break;
      }
+   NumRows = DB_StmtQuerySELECT (Stmt,"can not get user's data",
+				 UsrDat->UsrCod);
 
    if (NumRows != 1)
       Lay_ShowErrorAndExit (Txt_The_user_does_not_exist);
 
    /***** Read user's data *****/
-   row = mysql_fetch_row (mysql_res);
+   row = DB_StmtFetchRow (Stmt);
 
    /* Get encrypted user's code (row[0]) */
    Str_Copy (UsrDat->EnUsrCod,row[0],sizeof (UsrDat->EnUsrCod) - 1);
@@ -715,7 +721,7 @@ void Usr_GetUsrDataFromUsrCod (struct UsrData *UsrDat,Usr_GetPrefs_t GetPrefs)
      }
 
    /***** Free structure that stores the query result *****/
-   DB_FreeMySQLResult (&mysql_res);
+   DB_StmtFreeResult (Stmt);
 
    /***** Get nickname and email *****/
    Nck_GetNicknameFromUsrCod (UsrDat->UsrCod,UsrDat->Nickname);
@@ -754,7 +760,8 @@ static void Usr_GetMyLastData (void)
 				    "LastAct,"			   // row[3]
 				    "LastRole,"			   // row[4]
 				    "UNIX_TIMESTAMP(LastTime),"    // row[5]
-				    "UNIX_TIMESTAMP(LastAccNotif)" // row[6]
+				    "UNIX_TIMESTAMP(LastAccNotif)," // row[6]
+				    "MFUEpoch"			   // row[7]
 			     " FROM usr_last WHERE UsrCod=%ld",
 			     Gbl.Usrs.Me.UsrDat.UsrCod);
    if (NumRows == 0)
@@ -820,6 +827,11 @@ static void Usr_GetMyLastData (void)
       if (row[6])
          sscanf (row[6],"%ld",&(Gbl.Usrs.Me.UsrLast.LastAccNotif));
 
+      /* Get epoch of most frequently used actions (row[7]) */
+      Gbl.Usrs.Me.UsrLast.MFUEpoch = 0L;
+      if (row[7])
+         sscanf (row[7],"%ld",&(Gbl.Usrs.Me.UsrLast.MFUEpoch));
+
       /***** Free structure that stores the query result *****/
       DB_FreeMySQLResult (&mysql_res);
      }
@@ -2569,7 +2581,7 @@ void Usr_WriteFormLogin (Act_Action_t NextAction,void (*FuncParams) (void))
 
 void Usr_WelcomeUsr (void)
   {
-   extern const unsigned Txt_Current_CGI_SWAD_Language;
+   extern unsigned Txt_Current_CGI_SWAD_Language;
    extern const char *Txt_NEW_YEAR_GREETING;
    extern const char *Txt_Happy_birthday_X;
    extern const char *Txt_Please_check_your_email_address;
@@ -3505,23 +3517,26 @@ bool Usr_ChkUsrCodAndGetAllUsrDataFromUsrCod (struct UsrData *UsrDat,Usr_GetPref
 
 void Usr_UpdateMyLastData (void)
   {
-   /***** Check if it exists an entry for me *****/
-   if (DB_QueryCOUNT ("can not get last user's click",
-		      "SELECT COUNT(*) FROM usr_last WHERE UsrCod=%ld",
-		      Gbl.Usrs.Me.UsrDat.UsrCod))
-      /***** Update my last accessed course, tab and time of click in database *****/
-      // WhatToSearch, LastAccNotif remain unchanged
-      DB_QueryUPDATE ("can not update last user's data",
-		      "UPDATE usr_last"
-		      " SET LastSco='%s',LastCod=%ld,LastAct=%ld,LastRole=%u,LastTime=NOW()"
-                      " WHERE UsrCod=%ld",
-		      Sco_GetDBStrFromScope (Gbl.Hierarchy.Level),
-		      Gbl.Hierarchy.Cod,
-		      Act_GetActCod (Gbl.Action.Act),
-		      (unsigned) Gbl.Usrs.Me.Role.Logged,
-		      Gbl.Usrs.Me.UsrDat.UsrCod);
-   else
-      Usr_InsertMyLastData ();
+   /***** Update my last accessed course, tab and time of click in database,
+          or create an entry for me if it does not exist *****/
+   // WhatToSearch, LastAccNotif remain unchanged if entry exists
+   DB_DeferQuery ("INSERT INTO usr_last"
+	          " (UsrCod,WhatToSearch,LastSco,LastCod,LastAct,LastRole,LastTime,LastAccNotif)"
+                  " VALUES"
+                  " (%ld,%u,'%s',%ld,%ld,%u,NOW(),FROM_UNIXTIME(%ld))"
+                  " ON DUPLICATE KEY UPDATE"
+                  " LastSco=VALUES(LastSco),"
+                  "LastCod=VALUES(LastCod),"
+                  "LastAct=VALUES(LastAct),"
+                  "LastRole=VALUES(LastRole),"
+                  "LastTime=NOW()",
+		  Gbl.Usrs.Me.UsrDat.UsrCod,
+		  (unsigned) Sch_SEARCH_ALL,
+		  Sco_GetDBStrFromScope (Gbl.Hierarchy.Level),
+		  Gbl.Hierarchy.Cod,
+		  Act_GetActCod (Gbl.Action.Act),
+		  (unsigned) Gbl.Usrs.Me.Role.Logged,
+		  (long) (time_t) 0);	// The user never accessed to notifications
   }
 
 /*****************************************************************************/
@@ -4055,20 +4070,20 @@ long Usr_GetRamdomStdFromCrs (long CrsCod)
   {
    MYSQL_RES *mysql_res;
    MYSQL_ROW row;
+   unsigned NumStds;
    long UsrCod = -1L;	// -1 means user not found
 
-   /***** Get a random student from current course from database *****/
-   if (DB_QuerySELECT (&mysql_res,"can not get a random student"
-				  " from the current course",
-		       "SELECT UsrCod FROM crs_usr"
-		       " WHERE CrsCod=%ld AND Role=%u"
-		       " ORDER BY RAND() LIMIT 1",
-		       CrsCod,(unsigned) Rol_STD))
-     {
-      /***** Get user code *****/
-      row = mysql_fetch_row (mysql_res);
+   /***** Get students from current course from database *****/
+   // Don't use ORDER BY RAND(): all the students would be sorted
+   NumStds = (unsigned) DB_QuerySELECT (&mysql_res,"can not get a random student"
+						   " from the current course",
+					"SELECT UsrCod FROM crs_usr"
+					" WHERE CrsCod=%ld AND Role=%u",
+					CrsCod,(unsigned) Rol_STD);
+
+   /***** Get user code of a random student *****/
+   if ((row = Rnd_GetRandomRow (mysql_res,NumStds)))
       UsrCod = Str_ConvertStrCodToLongCod (row[0]);
-     }
 
    /***** Free structure that stores the query result *****/
    DB_FreeMySQLResult (&mysql_res);
@@ -4085,23 +4100,25 @@ long Usr_GetRamdomStdFromGrp (long GrpCod)
   {
    MYSQL_RES *mysql_res;
    MYSQL_ROW row;
+   unsigned NumStds;
    long UsrCod = -1L;	// -1 means user not found
 
-   /***** Get a random student from a group from database *****/
-   if (DB_QuerySELECT (&mysql_res,"can not get a random student from a group",
-		       "SELECT crs_grp_usr.UsrCod FROM crs_grp_usr,crs_usr"
-		       " WHERE crs_grp_usr.GrpCod=%ld"
-		       " AND crs_grp_usr.UsrCod=crs_usr.UsrCod"
-		       " AND crs_usr.Role=%u ORDER BY RAND() LIMIT 1",
-		       GrpCod,(unsigned) Rol_STD))
-     {
-      /***** Get user code *****/
-      row = mysql_fetch_row (mysql_res);
+   /***** Get students from a group from database *****/
+   // Don't use ORDER BY RAND(): all the students would be sorted
+   NumStds = (unsigned) DB_QuerySELECT (&mysql_res,"can not get a random student"
+						   " from a group",
+					"SELECT crs_grp_usr.UsrCod FROM crs_grp_usr,crs_usr"
+					" WHERE crs_grp_usr.GrpCod=%ld"
+					" AND crs_grp_usr.UsrCod=crs_usr.UsrCod"
+					" AND crs_usr.Role=%u",
+					GrpCod,(unsigned) Rol_STD);
+
+   /***** Get user code of a random student *****/
+   if ((row = Rnd_GetRandomRow (mysql_res,NumStds)))
       UsrCod = Str_ConvertStrCodToLongCod (row[0]);
 
-      /***** Free structure that stores the query result *****/
-      DB_FreeMySQLResult (&mysql_res);
-     }
+   /***** Free structure that stores the query result *****/
+   DB_FreeMySQLResult (&mysql_res);
 
    return UsrCod;
   }
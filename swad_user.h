@@ -235,6 +235,7 @@ struct UsrLast
    Rol_Role_t LastRole;
    long LastTime;
    long LastAccNotif;
+   long MFUEpoch;		// Number of clicks that decayed my MFU actions
   };
 
 struct UsrInList
@@ -32,7 +32,6 @@
 
 #include "swad_changelog.h"
 #include "swad_global.h"
-#include "swad_HTML.h"
 #include "swad_xml.h"
 
 /*****************************************************************************/
@@ -45,14 +44,50 @@ extern struct Globals Gbl;
 /***************************** Private constants *****************************/
 /*****************************************************************************/
 
+#define XML_ARENA_BLOCK_SIZE		(64 * 1024)	// Size of each block of memory for trees read from stream
+#define XML_ARENA_ALIGN			16		// Alignment of memory allocated from arena
+#define XML_MAX_BYTES_ELEMENT_IN_STREAM	(16 * 1024 * 1024)	// Maximum size of each element read from stream
+
 /*****************************************************************************/
 /******************************* Private types *******************************/
 /*****************************************************************************/
 
+struct XML_ArenaBlock
+  {
+   struct XML_ArenaBlock *Next;
+   char *Mem;
+   size_t Size;
+   size_t Used;
+  };
+
+struct XML_Arena	// List of blocks of memory, reused for each element read from stream
+  {
+   struct XML_ArenaBlock *First;
+   struct XML_ArenaBlock *Current;
+   struct XML_ArenaBlock *Last;
+  };
+
+struct XML_Buffer	// Text read from stream
+  {
+   char *Txt;
+   size_t Length;
+   size_t Size;
+  };
+
+typedef enum
+  {
+   XML_TAG_START,	// <tag ...>
+   XML_TAG_END,		// </tag>
+   XML_TAG_EMPTY,	// <tag .../>
+   XML_TAG_OTHER,	// <!...> or <?...>
+  } XML_TagType_t;
+
 /*****************************************************************************/
 /***************************** Private variables *****************************/
 /*****************************************************************************/
 
+static struct XML_Arena *XML_CurrentArena = NULL;	// Arena where trees are allocated
+
 /*****************************************************************************/
 /***************************** Private prototypes ****************************/
 /*****************************************************************************/
@@ -61,6 +96,18 @@ static void XML_GetElement (struct XMLElement *ParentElem);
 static void XML_GetAttributes (struct XMLElement *Elem);
 static void XML_SkipSpaces (void);
 
+static XML_TagType_t XML_ReadTagFromStream (FILE *File,struct XML_Buffer *Tag);
+static bool XML_CheckTagName (const struct XML_Buffer *Tag,const char *TagName);
+static void XML_AddToBuffer (struct XML_Buffer *Buffer,
+                             const char *Txt,size_t Length);
+static void XML_ProcessElemInBuffer (const struct XML_Buffer *Elem,
+                                     struct XML_Arena *Arena,
+                                     void (*FunctionToProcessElem) (struct XMLElement *Elem,void *Args),
+                                     void *Args);
+static void *XML_Allocate (size_t Size);
+static void XML_ResetArena (struct XML_Arena *Arena);
+static void XML_FreeArena (struct XML_Arena *Arena);
+
 /*****************************************************************************/
 /****** Write the start of an XML file with author and date of creation ******/
 /*****************************************************************************/
@@ -93,20 +140,6 @@ void XML_WriteEndFile (FILE *FileTgt,const char *Type)
    fprintf (FileTgt,"</%s>%s",Type,Txt_NEW_LINE);
   }
 
-/*****************************************************************************/
-/****************** Get the content of XML root element **********************/
-/*****************************************************************************/
-
-void XML_GetTree (const char *XMLBuffer,struct XMLElement **XMLRootElem)
-  {
-   /***** Allocate space for the root element *****/
-   if ((*XMLRootElem = calloc (1,sizeof (**XMLRootElem))) == NULL)
-      Lay_NotEnoughMemoryExit ();
-
-   Gbl.XMLPtr = XMLBuffer;
-   XML_GetElement (*XMLRootElem);
-  }
-
 /*****************************************************************************/
 /******************* Get the content of an XML element ***********************/
 /*****************************************************************************/
@@ -184,8 +217,7 @@ static void XML_GetElement (struct XMLElement *ParentElem)
          /* Copy content */
          if (ContentLength)
            {
-            if ((ParentElem->Content = malloc (ContentLength + 1)) == NULL)
-               Lay_NotEnoughMemoryExit ();
+            ParentElem->Content = XML_Allocate (ContentLength + 1);
             strncpy (ParentElem->Content,StartContent,ContentLength);
             ParentElem->Content[ContentLength] = '\0';
             ParentElem->ContentLength = ContentLength;
@@ -209,8 +241,7 @@ static void XML_GetElement (struct XMLElement *ParentElem)
                  Gbl.XMLPtr
          */
          /***** Allocate space for the child element *****/
-         if ((ChildElem = calloc (1,sizeof (*ChildElem))) == NULL)
-            Lay_NotEnoughMemoryExit ();
+         ChildElem = XML_Allocate (sizeof (*ChildElem));
 
          /***** Adjust XML elements pointers *****/
          if (ParentElem->FirstChild)	// This child is a brother of a former child
@@ -221,8 +252,7 @@ static void XML_GetElement (struct XMLElement *ParentElem)
 
          /***** Get child tag name *****/
          ChildElem->TagNameLength = strcspn (Gbl.XMLPtr,">/ \t");
-         if ((ChildElem->TagName = malloc (ChildElem->TagNameLength + 1)) == NULL)
-            Lay_NotEnoughMemoryExit ();
+         ChildElem->TagName = XML_Allocate (ChildElem->TagNameLength + 1);
          strncpy (ChildElem->TagName,Gbl.XMLPtr,ChildElem->TagNameLength);
          ChildElem->TagName[ChildElem->TagNameLength] = '\0';
          Gbl.XMLPtr += ChildElem->TagNameLength;
@@ -330,8 +360,7 @@ static void XML_GetAttributes (struct XMLElement *Elem)
                        Gbl.XMLPtr
          */
          /***** Allocate space for the attribute *****/
-         if ((Attribute = calloc (1,sizeof (*Attribute))) == NULL)
-            Lay_NotEnoughMemoryExit ();
+         Attribute = XML_Allocate (sizeof (*Attribute));
 
          /***** Adjust XML element and attribute pointers *****/
          if (Elem->FirstAttribute)	// This attribute is a brother of a former attribute in current element
@@ -342,8 +371,7 @@ static void XML_GetAttributes (struct XMLElement *Elem)
 
          /***** Get attribute name *****/
          Attribute->AttributeNameLength = strcspn (Gbl.XMLPtr,"=");
-         if ((Attribute->AttributeName = malloc (Attribute->AttributeNameLength + 1)) == NULL)
-            Lay_NotEnoughMemoryExit ();
+         Attribute->AttributeName = XML_Allocate (Attribute->AttributeNameLength + 1);
          strncpy (Attribute->AttributeName,Gbl.XMLPtr,Attribute->AttributeNameLength);
          Attribute->AttributeName[Attribute->AttributeNameLength] = '\0';
          Gbl.XMLPtr += Attribute->AttributeNameLength;
@@ -374,8 +402,7 @@ static void XML_GetAttributes (struct XMLElement *Elem)
             Lay_ShowErrorAndExit (ErrorTxt);
            }
 
-         if ((Attribute->Content = malloc (Attribute->ContentLength + 1)) == NULL)
-            Lay_NotEnoughMemoryExit ();
+         Attribute->Content = XML_Allocate (Attribute->ContentLength + 1);
          strncpy (Attribute->Content,Gbl.XMLPtr,Attribute->ContentLength);
          Attribute->Content[Attribute->ContentLength] = '\0';
          Gbl.XMLPtr += Attribute->ContentLength;
@@ -403,135 +430,323 @@ static void XML_SkipSpaces (void)
   }
 
 /*****************************************************************************/
-/**************************** Print an XML element ***************************/
+/******* Read elements from a stream, one by one, calling a function *********/
 /*****************************************************************************/
+/*
+   Only the elements <ElemTagName> just inside root element <RootTagName>
+   are read. Each one is got as a tree, in memory allocated from an arena
+   that is reset after calling FunctionToProcessElem, so memory used
+   does not depend on the number of elements in the stream.
+   Return false if the root element is not <RootTagName>.
+*/
 
-void XML_PrintTree (struct XMLElement *ParentElem)
+bool XML_GetElementsFromStream (FILE *File,
+                                const char *RootTagName,const char *ElemTagName,
+                                void (*FunctionToProcessElem) (struct XMLElement *Elem,void *Args),
+                                void *Args)
   {
-   static int Level = -1;
-   struct XMLElement *ChildElem;
-   struct XMLElement *NextBrother;
-   struct XMLAttribute *Attribute;
-   int i;
-
-   Level++;
-
-   /***** Print start tag *****/
-   if (Level > 0)
+   struct XML_Arena Arena = {NULL,NULL,NULL};
+   struct XML_Buffer Tag  = {NULL,0,0};	// Last tag read from stream
+   struct XML_Buffer Elem = {NULL,0,0};	// Element being read from stream
+   XML_TagType_t TagType;
+   unsigned Depth = 0;		// Depth in elements outside the element being read
+   unsigned ElemDepth = 0;	// Depth in element being read (0 ==> no element is being read)
+   bool RootFound = false;
+   bool EndOfRoot = false;
+   int Ch;
+   char Chr;
+
+   while (!EndOfRoot && (Ch = getc (File)) != EOF)
      {
-      for (i = 1;
-	   i < Level;
-	   i++)
-         HTM_Txt ("   ");
-      HTM_TxtF ("&lt;%s",ParentElem->TagName ? ParentElem->TagName :
-        	                               "");
-
-      /* Print attributes */
-      for (Attribute = ParentElem->FirstAttribute;
-	   Attribute != NULL;
-	   Attribute = Attribute->Next)
-         HTM_TxtF (" %s=&quot;%s&quot;",
-                   Attribute->AttributeName,
-                   Attribute->Content);
-
-      HTM_Txt ("&gt;\n");
-
-      /***** Print content *****/
-      if (ParentElem->Content)
-        {
-         for (i = 1;
-              i < Level;
-              i++)
-            HTM_Txt ("   ");
-         HTM_TxtF ("%s\n",ParentElem->Content);
-        }
+      if (Ch != '<')
+	{
+	 if (ElemDepth)	// Content of element being read
+	   {
+	    Chr = (char) Ch;
+	    XML_AddToBuffer (&Elem,&Chr,1);
+	   }
+	 continue;
+	}
+
+      /***** Read tag *****/
+      TagType = XML_ReadTagFromStream (File,&Tag);
+
+      if (ElemDepth)	// Inside the element being read
+	{
+	 XML_AddToBuffer (&Elem,Tag.Txt,Tag.Length);
+	 if (TagType == XML_TAG_START)
+	    ElemDepth++;
+	 else if (TagType == XML_TAG_END)
+	    if (--ElemDepth == 0)	// End of element
+	       XML_ProcessElemInBuffer (&Elem,&Arena,FunctionToProcessElem,Args);
+	 continue;
+	}
+
+      switch (TagType)
+	{
+	 case XML_TAG_START:
+	 case XML_TAG_EMPTY:
+	    if (Depth == 0)	// Root element
+	      {
+	       if (!XML_CheckTagName (&Tag,RootTagName))
+		  EndOfRoot = true;	// Wrong root element
+	       else
+		 {
+		  RootFound = true;
+		  if (TagType == XML_TAG_START)
+		     Depth = 1;
+		  else
+		     EndOfRoot = true;	// Empty root element
+		 }
+	      }
+	    else if (Depth == 1 && XML_CheckTagName (&Tag,ElemTagName))
+	      {
+	       /* Start of an element to be read */
+	       Elem.Length = 0;
+	       XML_AddToBuffer (&Elem,Tag.Txt,Tag.Length);
+	       if (TagType == XML_TAG_START)
+		  ElemDepth = 1;
+	       else
+		  XML_ProcessElemInBuffer (&Elem,&Arena,FunctionToProcessElem,Args);
+	      }
+	    else if (TagType == XML_TAG_START)	// Other element to be skipped
+	       Depth++;
+	    break;
+	 case XML_TAG_END:
+	    if (Depth)
+	       if (--Depth == 0)	// End of root element
+		  EndOfRoot = true;
+	    break;
+	 default:	// <!...> or <?...>
+	    break;
+	}
      }
 
-   /***** Print children *****/
-   ChildElem = ParentElem->FirstChild;
-   while (ChildElem)
+   if (ElemDepth)
+      Lay_ShowErrorAndExit ("XML syntax error. Unexpected end of file.");
+
+   /***** Free memory *****/
+   XML_FreeArena (&Arena);
+   free (Tag.Txt);
+   free (Elem.Txt);
+
+   return RootFound;
+  }
+
+/*****************************************************************************/
+/*************************** Read a tag from stream **************************/
+/*****************************************************************************/
+// Character '<' has already been read from stream
+
+static XML_TagType_t XML_ReadTagFromStream (FILE *File,struct XML_Buffer *Tag)
+  {
+   char Quote = '\0';
+   int Ch;
+   char Chr;
+
+   Tag->Length = 0;
+   XML_AddToBuffer (Tag,"<",1);
+   do
      {
-      NextBrother = ChildElem->NextBrother;
-      XML_PrintTree (ChildElem);
-      ChildElem = NextBrother;
+      if ((Ch = getc (File)) == EOF)
+	 Lay_ShowErrorAndExit ("XML syntax error. Unexpected end of file.");
+      Chr = (char) Ch;
+      XML_AddToBuffer (Tag,&Chr,1);
+
+      /* Attribute values may contain '>' */
+      if (Tag->Txt[1] != '!' && Tag->Txt[1] != '?')
+	{
+	 if (Quote)
+	   {
+	    if (Ch == Quote)
+	       Quote = '\0';
+	   }
+	 else if (Ch == '\"' || Ch == '\'')
+	    Quote = (char) Ch;
+	}
      }
+   while (Ch != '>' || Quote);
+
+   /***** Get type of tag *****/
+   if (Tag->Txt[1] == '/')
+      return XML_TAG_END;
+   if (Tag->Txt[1] == '!' || Tag->Txt[1] == '?')
+      return XML_TAG_OTHER;
+   if (Tag->Txt[Tag->Length - 2] == '/')
+      return XML_TAG_EMPTY;
+   return XML_TAG_START;
+  }
+
+/*****************************************************************************/
+/***************** Check the name of a start tag read from stream ************/
+/*****************************************************************************/
 
-   /***** Print end tag *****/
-   if (Level > 0)
+static bool XML_CheckTagName (const struct XML_Buffer *Tag,const char *TagName)
+  {
+   size_t TagNameLength = strlen (TagName);
+
+   /*
+   <name attribute="value">
+    ^
+   */
+   return !strncmp (&Tag->Txt[1],TagName,TagNameLength) &&	// XML tags are case sensitive
+	  strchr (" \t\r\n/>",Tag->Txt[1 + TagNameLength]) != NULL;
+  }
+
+/*****************************************************************************/
+/********************** Add characters to a buffer ***************************/
+/*****************************************************************************/
+
+static void XML_AddToBuffer (struct XML_Buffer *Buffer,
+                             const char *Txt,size_t Length)
+  {
+   char *NewTxt;
+   size_t NewSize;
+
+   /***** Enlarge buffer if necessary *****/
+   if (Buffer->Length + Length + 1 > Buffer->Size)
      {
-      for (i = 1;
-	   i < Level;
-	   i++)
-         HTM_Txt ("   ");
-      HTM_TxtF ("&lt;/%s&gt;\n",ParentElem->TagName ? ParentElem->TagName :
-        	                                      "");
+      if (Buffer->Length + Length + 1 > XML_MAX_BYTES_ELEMENT_IN_STREAM)
+	 Lay_ShowErrorAndExit ("XML element too big.");
+      for (NewSize = Buffer->Size ? Buffer->Size :
+				    XML_ARENA_BLOCK_SIZE;
+	   NewSize < Buffer->Length + Length + 1;
+	   NewSize *= 2);
+      if ((NewTxt = realloc (Buffer->Txt,NewSize)) == NULL)
+	 Lay_NotEnoughMemoryExit ();
+      Buffer->Txt = NewTxt;
+      Buffer->Size = NewSize;
      }
 
-   Level--;
+   /***** Add characters, always ending with '\0' *****/
+   memcpy (&Buffer->Txt[Buffer->Length],Txt,Length);
+   Buffer->Length += Length;
+   Buffer->Txt[Buffer->Length] = '\0';
   }
 
 /*****************************************************************************/
-/********** Get attribute "yes"/"no" from an XML element in a tree ***********/
+/**** Get tree of element in buffer, process it and free its memory **********/
 /*****************************************************************************/
 
-bool XML_GetAttributteYesNoFromXMLTree (struct XMLAttribute *Attribute)
+static void XML_ProcessElemInBuffer (const struct XML_Buffer *Elem,
+                                     struct XML_Arena *Arena,
+                                     void (*FunctionToProcessElem) (struct XMLElement *Elem,void *Args),
+                                     void *Args)
   {
-   if (!Attribute->Content)
-      Lay_ShowErrorAndExit ("XML attribute yes/no not found.");
-   if (!strcasecmp (Attribute->Content,"yes") ||
-       !strcasecmp (Attribute->Content,"y"))	// case insensitive, because users can edit XML
-      return true;
-   if (!strcasecmp (Attribute->Content,"no") ||
-       !strcasecmp (Attribute->Content,"n"))	// case insensitive, because users can edit XML
-      return false;
-   Lay_ShowErrorAndExit ("XML attribute yes/no not found.");
-   return false;	// Not reached
+   struct XMLElement Root;
+
+   /***** Get tree of element, allocated in arena *****/
+   memset (&Root,0,sizeof (Root));
+   XML_CurrentArena = Arena;
+   Gbl.XMLPtr = Elem->Txt;
+   XML_GetElement (&Root);
+   XML_CurrentArena = NULL;
+
+   /***** Process element *****/
+   if (Root.FirstChild)
+      FunctionToProcessElem (Root.FirstChild,Args);
+
+   /***** Reuse memory of arena for next element *****/
+   XML_ResetArena (Arena);
   }
 
 /*****************************************************************************/
-/************ Free the memory allocated for an XML element *******************/
+/******************* Allocate memory for parts of a tree *********************/
 /*****************************************************************************/
+// Memory is zeroed and allocated from current arena
 
-void XML_FreeTree (struct XMLElement *ParentElem)
+static void *XML_Allocate (size_t Size)
   {
-   struct XMLElement *ChildElem;
-   struct XMLElement *NextElemBrother;
-   struct XMLAttribute *Attribute;
-   struct XMLAttribute *NextAttrib;
+   struct XML_ArenaBlock *Block;
+   void *Ptr;
 
-   /***** Free memory allocated for children *****/
-   ChildElem = ParentElem->FirstChild;
-   while (ChildElem)
-     {
-      NextElemBrother = ChildElem->NextBrother;
-      XML_FreeTree (ChildElem);
-      ChildElem = NextElemBrother;
-     }
+   /***** Round size to keep alignment *****/
+   Size = (Size + XML_ARENA_ALIGN - 1) & ~((size_t) XML_ARENA_ALIGN - 1);
 
-   /***** Free memory allocated for TagName *****/
-   if (ParentElem->TagName)
-     {
-      free (ParentElem->TagName);
-      ParentElem->TagName = NULL;
-      ParentElem->TagNameLength = (size_t) 0;
-     }
+   /***** Find a block with free space *****/
+   for (Block = XML_CurrentArena->Current;
+	Block != NULL;
+	Block = Block->Next)
+      if (Block->Used + Size <= Block->Size)
+	 break;
 
-   /***** Free memory allocated for attributes *****/
-   Attribute = ParentElem->FirstAttribute;
-   while (Attribute)
+   /***** Allocate a new block at the end of the list if not found *****/
+   if (!Block)
      {
-      NextAttrib = Attribute->Next;
-      free (Attribute->AttributeName);
-      free (Attribute->Content);
-      free (Attribute);
-      Attribute = NextAttrib;
+      if ((Block = malloc (sizeof (*Block))) == NULL)
+	 Lay_NotEnoughMemoryExit ();
+      Block->Size = Size > XML_ARENA_BLOCK_SIZE ? Size :
+						  XML_ARENA_BLOCK_SIZE;
+      if ((Block->Mem = malloc (Block->Size)) == NULL)
+	 Lay_NotEnoughMemoryExit ();
+      Block->Used = 0;
+      Block->Next = NULL;
+      if (XML_CurrentArena->Last)
+	 XML_CurrentArena->Last->Next = Block;
+      else
+	 XML_CurrentArena->First = Block;
+      XML_CurrentArena->Last = Block;
      }
+   XML_CurrentArena->Current = Block;
+
+   /***** Allocate from block *****/
+   Ptr = &Block->Mem[Block->Used];
+   Block->Used += Size;
+   memset (Ptr,0,Size);
+   return Ptr;
+  }
+
+/*****************************************************************************/
+/***************** Reset an arena, keeping its memory blocks *****************/
+/*****************************************************************************/
+
+static void XML_ResetArena (struct XML_Arena *Arena)
+  {
+   struct XML_ArenaBlock *Block;
+
+   for (Block = Arena->First;
+	Block != NULL;
+	Block = Block->Next)
+      Block->Used = 0;
+   Arena->Current = Arena->First;
+  }
 
-   /***** Free memory allocated for Content *****/
-   if (ParentElem->Content)
+/*****************************************************************************/
+/********************** Free all memory blocks of an arena *******************/
+/*****************************************************************************/
+
+static void XML_FreeArena (struct XML_Arena *Arena)
+  {
+   struct XML_ArenaBlock *Block;
+   struct XML_ArenaBlock *NextBlock;
+
+   for (Block = Arena->First;
+	Block != NULL;
+	Block = NextBlock)
      {
-      free (ParentElem->Content);
-      ParentElem->Content = NULL;
-      ParentElem->ContentLength = (size_t) 0;
+      NextBlock = Block->Next;
+      free (Block->Mem);
+      free (Block);
      }
+   Arena->First   =
+   Arena->Current =
+   Arena->Last    = NULL;
+  }
+
+/*****************************************************************************/
+/********** Get attribute "yes"/"no" from an XML element in a tree ***********/
+/*****************************************************************************/
+
+bool XML_GetAttributteYesNoFromXMLTree (struct XMLAttribute *Attribute)
+  {
+   if (!Attribute->Content)
+      Lay_ShowErrorAndExit ("XML attribute yes/no not found.");
+   if (!strcasecmp (Attribute->Content,"yes") ||
+       !strcasecmp (Attribute->Content,"y"))	// case insensitive, because users can edit XML
+      return true;
+   if (!strcasecmp (Attribute->Content,"no") ||
+       !strcasecmp (Attribute->Content,"n"))	// case insensitive, because users can edit XML
+      return false;
+   Lay_ShowErrorAndExit ("XML attribute yes/no not found.");
+   return false;	// Not reached
   }
@@ -62,9 +62,10 @@ struct XMLElement
 void XML_WriteStartFile (FILE *FileTgt,const char *Type,bool Credits);
 void XML_WriteEndFile (FILE *FileTgt,const char *Type);
 
-void XML_GetTree (const char *XMLBuffer,struct XMLElement **XMLRootElem);
-void XML_PrintTree (struct XMLElement *ParentElem);
+bool XML_GetElementsFromStream (FILE *File,
+                                const char *RootTagName,const char *ElemTagName,
+                                void (*FunctionToProcessElem) (struct XMLElement *Elem,void *Args),
+                                void *Args);
 bool XML_GetAttributteYesNoFromXMLTree (struct XMLAttribute *Attribute);
-void XML_FreeTree (struct XMLElement *ParentElem);
 
 #endif